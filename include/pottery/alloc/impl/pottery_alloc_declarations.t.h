@@ -181,7 +181,8 @@ void* pottery_alloc_malloc(POTTERY_ALLOC_CONTEXT_ARG size_t alignment, size_t si
 static inline
 void* pottery_alloc_impl_malloc_zero_ea(POTTERY_ALLOC_CONTEXT_ARG size_t alignment, size_t size) {
     void* ptr = pottery_alloc_impl_malloc_ea(POTTERY_ALLOC_CONTEXT_VAL alignment, size);
-    pottery_memset(ptr, 0, size);
+    if (ptr != pottery_null)
+        pottery_memset(ptr, 0, size);
     return ptr;
 }
 #endif
@@ -194,7 +195,8 @@ void* pottery_alloc_impl_malloc_zero_ea(POTTERY_ALLOC_CONTEXT_ARG size_t alignme
 static inline
 void* pottery_alloc_impl_malloc_zero_fa_wrap(POTTERY_ALLOC_CONTEXT_ARG size_t alignment, size_t size) {
     void* ptr = pottery_alloc_impl_malloc_fa(POTTERY_ALLOC_CONTEXT_VAL alignment, size);
-    pottery_memset(ptr, 0, size);
+    if (ptr != pottery_null)
+        pottery_memset(ptr, 0, size);
     return ptr;
 }
 #endif
@@ -82,7 +82,11 @@
     #define pottery_array_map_is_empty POTTERY_CONCAT(POTTERY_ARRAY_MAP_PREFIX, _is_empty)
     #define pottery_array_map_at POTTERY_CONCAT(POTTERY_ARRAY_MAP_PREFIX, _at)
     #define pottery_array_map_find POTTERY_CONCAT(POTTERY_ARRAY_MAP_PREFIX, _find)
+    #define pottery_array_map_find_with_hash POTTERY_CONCAT(POTTERY_ARRAY_MAP_PREFIX, _find_with_hash)
     #define pottery_array_map_contains_key POTTERY_CONCAT(POTTERY_ARRAY_MAP_PREFIX, _contains_key)
+    #define pottery_array_map_contains_key_with_hash POTTERY_CONCAT(POTTERY_ARRAY_MAP_PREFIX, _contains_key_with_hash)
+    #define pottery_array_map_find_bulk POTTERY_CONCAT(POTTERY_ARRAY_MAP_PREFIX, _find_bulk)
+    #define pottery_array_map_contains_bulk POTTERY_CONCAT(POTTERY_ARRAY_MAP_PREFIX, _contains_bulk)
     #define pottery_array_map_first POTTERY_CONCAT(POTTERY_ARRAY_MAP_PREFIX, _first)
     #define pottery_array_map_last POTTERY_CONCAT(POTTERY_ARRAY_MAP_PREFIX, _last)
     #define pottery_array_map_any POTTERY_CONCAT(POTTERY_ARRAY_MAP_PREFIX, _any)
@@ -120,6 +124,7 @@
     #define pottery_array_map_emplace POTTERY_CONCAT(POTTERY_ARRAY_MAP_PREFIX, _emplace)
     #define pottery_array_map_emplace_at POTTERY_CONCAT(POTTERY_ARRAY_MAP_PREFIX, _emplace_at)
     #define pottery_array_map_emplace_key POTTERY_CONCAT(POTTERY_ARRAY_MAP_PREFIX, _emplace_key)
+    #define pottery_array_map_emplace_key_with_hash POTTERY_CONCAT(POTTERY_ARRAY_MAP_PREFIX, _emplace_key_with_hash)
     #define pottery_array_map_emplace_first POTTERY_CONCAT(POTTERY_ARRAY_MAP_PREFIX, _emplace_first)
     #define pottery_array_map_emplace_last POTTERY_CONCAT(POTTERY_ARRAY_MAP_PREFIX, _emplace_last)
     #define pottery_array_map_emplace_before POTTERY_CONCAT(POTTERY_ARRAY_MAP_PREFIX, _emplace_before)
@@ -155,6 +160,7 @@
     #define pottery_array_map_remove POTTERY_CONCAT(POTTERY_ARRAY_MAP_PREFIX, _remove)
     #define pottery_array_map_remove_at POTTERY_CONCAT(POTTERY_ARRAY_MAP_PREFIX, _remove_at)
     #define pottery_array_map_remove_key POTTERY_CONCAT(POTTERY_ARRAY_MAP_PREFIX, _remove_key)
+    #define pottery_array_map_remove_key_with_hash POTTERY_CONCAT(POTTERY_ARRAY_MAP_PREFIX, _remove_key_with_hash)
     #define pottery_array_map_remove_first POTTERY_CONCAT(POTTERY_ARRAY_MAP_PREFIX, _remove_first)
     #define pottery_array_map_remove_last POTTERY_CONCAT(POTTERY_ARRAY_MAP_PREFIX, _remove_last)
     #define pottery_array_map_remove_and_next POTTERY_CONCAT(POTTERY_ARRAY_MAP_PREFIX, _remove_and_next)
@@ -239,7 +245,11 @@
     #define pottery_array_map_vector_is_empty POTTERY_CONCAT(POTTERY_ARRAY_MAP_NAME(_vector), _is_empty)
     #define pottery_array_map_vector_at POTTERY_CONCAT(POTTERY_ARRAY_MAP_NAME(_vector), _at)
     #define pottery_array_map_vector_find POTTERY_CONCAT(POTTERY_ARRAY_MAP_NAME(_vector), _find)
+    #define pottery_array_map_vector_find_with_hash POTTERY_CONCAT(POTTERY_ARRAY_MAP_NAME(_vector), _find_with_hash)
     #define pottery_array_map_vector_contains_key POTTERY_CONCAT(POTTERY_ARRAY_MAP_NAME(_vector), _contains_key)
+    #define pottery_array_map_vector_contains_key_with_hash POTTERY_CONCAT(POTTERY_ARRAY_MAP_NAME(_vector), _contains_key_with_hash)
+    #define pottery_array_map_vector_find_bulk POTTERY_CONCAT(POTTERY_ARRAY_MAP_NAME(_vector), _find_bulk)
+    #define pottery_array_map_vector_contains_bulk POTTERY_CONCAT(POTTERY_ARRAY_MAP_NAME(_vector), _contains_bulk)
     #define pottery_array_map_vector_first POTTERY_CONCAT(POTTERY_ARRAY_MAP_NAME(_vector), _first)
     #define pottery_array_map_vector_last POTTERY_CONCAT(POTTERY_ARRAY_MAP_NAME(_vector), _last)
     #define pottery_array_map_vector_any POTTERY_CONCAT(POTTERY_ARRAY_MAP_NAME(_vector), _any)
@@ -277,6 +287,7 @@
     #define pottery_array_map_vector_emplace POTTERY_CONCAT(POTTERY_ARRAY_MAP_NAME(_vector), _emplace)
     #define pottery_array_map_vector_emplace_at POTTERY_CONCAT(POTTERY_ARRAY_MAP_NAME(_vector), _emplace_at)
     #define pottery_array_map_vector_emplace_key POTTERY_CONCAT(POTTERY_ARRAY_MAP_NAME(_vector), _emplace_key)
+    #define pottery_array_map_vector_emplace_key_with_hash POTTERY_CONCAT(POTTERY_ARRAY_MAP_NAME(_vector), _emplace_key_with_hash)
     #define pottery_array_map_vector_emplace_first POTTERY_CONCAT(POTTERY_ARRAY_MAP_NAME(_vector), _emplace_first)
     #define pottery_array_map_vector_emplace_last POTTERY_CONCAT(POTTERY_ARRAY_MAP_NAME(_vector), _emplace_last)
     #define pottery_array_map_vector_emplace_before POTTERY_CONCAT(POTTERY_ARRAY_MAP_NAME(_vector), _emplace_before)
@@ -312,6 +323,7 @@
     #define pottery_array_map_vector_remove POTTERY_CONCAT(POTTERY_ARRAY_MAP_NAME(_vector), _remove)
     #define pottery_array_map_vector_remove_at POTTERY_CONCAT(POTTERY_ARRAY_MAP_NAME(_vector), _remove_at)
     #define pottery_array_map_vector_remove_key POTTERY_CONCAT(POTTERY_ARRAY_MAP_NAME(_vector), _remove_key)
+    #define pottery_array_map_vector_remove_key_with_hash POTTERY_CONCAT(POTTERY_ARRAY_MAP_NAME(_vector), _remove_key_with_hash)
     #define pottery_array_map_vector_remove_first POTTERY_CONCAT(POTTERY_ARRAY_MAP_NAME(_vector), _remove_first)
     #define pottery_array_map_vector_remove_last POTTERY_CONCAT(POTTERY_ARRAY_MAP_NAME(_vector), _remove_last)
     #define pottery_array_map_vector_remove_and_next POTTERY_CONCAT(POTTERY_ARRAY_MAP_NAME(_vector), _remove_and_next)
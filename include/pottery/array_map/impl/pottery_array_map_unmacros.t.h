@@ -201,7 +201,11 @@
     #undef pottery_array_map_is_empty
     #undef pottery_array_map_at
     #undef pottery_array_map_find
+    #undef pottery_array_map_find_with_hash
     #undef pottery_array_map_contains_key
+    #undef pottery_array_map_contains_key_with_hash
+    #undef pottery_array_map_find_bulk
+    #undef pottery_array_map_contains_bulk
     #undef pottery_array_map_first
     #undef pottery_array_map_last
     #undef pottery_array_map_any
@@ -239,6 +243,7 @@
     #undef pottery_array_map_emplace
     #undef pottery_array_map_emplace_at
     #undef pottery_array_map_emplace_key
+    #undef pottery_array_map_emplace_key_with_hash
     #undef pottery_array_map_emplace_first
     #undef pottery_array_map_emplace_last
     #undef pottery_array_map_emplace_before
@@ -274,6 +279,7 @@
     #undef pottery_array_map_remove
     #undef pottery_array_map_remove_at
     #undef pottery_array_map_remove_key
+    #undef pottery_array_map_remove_key_with_hash
     #undef pottery_array_map_remove_first
     #undef pottery_array_map_remove_last
     #undef pottery_array_map_remove_and_next
@@ -355,7 +361,11 @@
     #undef pottery_array_map_vector_is_empty
     #undef pottery_array_map_vector_at
     #undef pottery_array_map_vector_find
+    #undef pottery_array_map_vector_find_with_hash
     #undef pottery_array_map_vector_contains_key
+    #undef pottery_array_map_vector_contains_key_with_hash
+    #undef pottery_array_map_vector_find_bulk
+    #undef pottery_array_map_vector_contains_bulk
     #undef pottery_array_map_vector_first
     #undef pottery_array_map_vector_last
     #undef pottery_array_map_vector_any
@@ -393,6 +403,7 @@
     #undef pottery_array_map_vector_emplace
     #undef pottery_array_map_vector_emplace_at
     #undef pottery_array_map_vector_emplace_key
+    #undef pottery_array_map_vector_emplace_key_with_hash
     #undef pottery_array_map_vector_emplace_first
     #undef pottery_array_map_vector_emplace_last
     #undef pottery_array_map_vector_emplace_before
@@ -428,6 +439,7 @@
     #undef pottery_array_map_vector_remove
     #undef pottery_array_map_vector_remove_at
     #undef pottery_array_map_vector_remove_key
+    #undef pottery_array_map_vector_remove_key_with_hash
     #undef pottery_array_map_vector_remove_first
     #undef pottery_array_map_vector_remove_last
     #undef pottery_array_map_vector_remove_and_next
@@ -0,0 +1,396 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2020-2021 11037650 Canada Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef POTTERY_CHAINED_HASH_TABLE_IMPL
+#error "This is an internal header. Do not include it."
+#endif
+
+// The entry type is the same as the ref type. Values are never moved by the
+// table so entries remain valid for as long as the value is linked, even
+// across rehashes.
+typedef pottery_cht_ref_t pottery_cht_entry_t;
+
+typedef struct pottery_cht_t {
+    #if POTTERY_CHAINED_HASH_TABLE_HAS_CONTEXT
+    pottery_cht_context_t context;
+    #endif
+    pottery_cht_ref_t* buckets; // null if the table has no buckets
+    size_t log_2_size;
+    size_t count;
+} pottery_cht_t;
+
+
+
+static inline
+bool pottery_cht_ref_is_null(pottery_cht_t* cht, pottery_cht_ref_t ref) {
+    (void)cht;
+    return pottery_cht_ref_equal(POTTERY_CHT_CONTEXT_VAL(cht)
+            ref, pottery_cht_null(cht));
+}
+
+static inline
+bool pottery_cht_entry_exists(pottery_cht_t* cht, pottery_cht_entry_t entry) {
+    return !pottery_cht_ref_is_null(cht, entry);
+}
+
+static inline
+pottery_cht_ref_t pottery_cht_entry_ref(pottery_cht_t* cht, pottery_cht_entry_t entry) {
+    (void)cht;
+    pottery_assert(pottery_cht_entry_exists(cht, entry));
+    return entry;
+}
+
+
+
+/*
+ * next accessors
+ */
+
+static inline
+pottery_cht_ref_t pottery_cht_next_ref(pottery_cht_t* cht, pottery_cht_ref_t ref) {
+    (void)cht;
+    pottery_assert(cht != pottery_null);
+    pottery_assert(!pottery_cht_ref_is_null(cht, ref));
+
+    #ifdef POTTERY_CHAINED_HASH_TABLE_NEXT
+        #if POTTERY_CHAINED_HASH_TABLE_HAS_CONTEXT
+            return POTTERY_CHAINED_HASH_TABLE_NEXT((cht->context), ref);
+        #else
+            return POTTERY_CHAINED_HASH_TABLE_NEXT(ref);
+        #endif
+    #else
+        // If NEXT is not defined, the default is that ref is a pointer to a
+        // struct in which the next pointer is stored in a field called "next"
+        return ref->next;
+    #endif
+}
+
+static inline
+void pottery_cht_set_next_ref(pottery_cht_t* cht,
+        pottery_cht_ref_t ref, pottery_cht_ref_t next)
+{
+    (void)cht;
+    pottery_assert(cht != pottery_null);
+    pottery_assert(!pottery_cht_ref_is_null(cht, ref));
+
+    #ifdef POTTERY_CHAINED_HASH_TABLE_SET_NEXT
+        #if POTTERY_CHAINED_HASH_TABLE_HAS_CONTEXT
+            POTTERY_CHAINED_HASH_TABLE_SET_NEXT((cht->context), (ref), (next));
+        #else
+            POTTERY_CHAINED_HASH_TABLE_SET_NEXT((ref), (next));
+        #endif
+    #elif defined(POTTERY_CHAINED_HASH_TABLE_NEXT)
+        // If SET_NEXT is not defined but NEXT is, it must be an l-value.
+        #if POTTERY_CHAINED_HASH_TABLE_HAS_CONTEXT
+            POTTERY_CHAINED_HASH_TABLE_NEXT((cht->context), (ref)) = next;
+        #else
+            POTTERY_CHAINED_HASH_TABLE_NEXT((ref)) = next;
+        #endif
+    #else
+        // Otherwise it's a "next" field.
+        ref->next = next;
+    #endif
+}
+
+
+
+/*
+ * hashing
+ */
+
+static inline
+size_t pottery_cht_key_hash(pottery_cht_t* cht, pottery_cht_key_t key) {
+    (void)cht;
+    #if POTTERY_CHAINED_HASH_TABLE_HAS_CONTEXT
+        return POTTERY_CHAINED_HASH_TABLE_KEY_HASH((cht->context), key);
+    #else
+        return POTTERY_CHAINED_HASH_TABLE_KEY_HASH(key);
+    #endif
+}
+
+static inline
+bool pottery_cht_key_equal(pottery_cht_t* cht, pottery_cht_key_t left, pottery_cht_key_t right) {
+    (void)cht;
+    #if POTTERY_CHAINED_HASH_TABLE_HAS_CONTEXT
+        return POTTERY_CHAINED_HASH_TABLE_KEY_EQUAL((cht->context), left, right);
+    #else
+        return POTTERY_CHAINED_HASH_TABLE_KEY_EQUAL(left, right);
+    #endif
+}
+
+/**
+ * Returns the hash of the key of the given value.
+ *
+ * If hashes are stored, this returns the stored hash rather than re-hashing
+ * the key.
+ */
+static inline
+size_t pottery_cht_ref_hash(pottery_cht_t* cht, pottery_cht_ref_t ref) {
+    (void)cht;
+    #ifdef POTTERY_CHAINED_HASH_TABLE_STORED_HASH
+        #if POTTERY_CHAINED_HASH_TABLE_HAS_CONTEXT
+            return POTTERY_CHAINED_HASH_TABLE_STORED_HASH((cht->context), ref);
+        #else
+            return POTTERY_CHAINED_HASH_TABLE_STORED_HASH(ref);
+        #endif
+    #else
+        return pottery_cht_key_hash(cht, pottery_cht_ref_key(POTTERY_CHT_CONTEXT_VAL(cht) ref));
+    #endif
+}
+
+static inline
+void pottery_cht_set_ref_hash(pottery_cht_t* cht, pottery_cht_ref_t ref, size_t hash) {
+    (void)cht;
+    (void)ref;
+    (void)hash;
+    #ifdef POTTERY_CHAINED_HASH_TABLE_SET_STORED_HASH
+        #if POTTERY_CHAINED_HASH_TABLE_HAS_CONTEXT
+            POTTERY_CHAINED_HASH_TABLE_SET_STORED_HASH((cht->context), (ref), (hash));
+        #else
+            POTTERY_CHAINED_HASH_TABLE_SET_STORED_HASH((ref), (hash));
+        #endif
+    #endif
+}
+
+// Returns true if the given value has the given key. The hash is only used
+// to skip comparing keys if hashes are stored.
+static inline
+bool pottery_cht_ref_matches(pottery_cht_t* cht, pottery_cht_ref_t ref,
+        pottery_cht_key_t key, size_t hash)
+{
+    (void)hash;
+    #ifdef POTTERY_CHAINED_HASH_TABLE_STORED_HASH
+    if (pottery_cht_ref_hash(cht, ref) != hash)
+        return false;
+    #endif
+    return pottery_cht_key_equal(cht,
+            pottery_cht_ref_key(POTTERY_CHT_CONTEXT_VAL(cht) ref), key);
+}
+
+/**
+ * Returns the number of buckets in the table.
+ */
+static inline
+size_t pottery_cht_bucket_count(pottery_cht_t* cht) {
+    if (cht->buckets == pottery_null)
+        return 0;
+    return pottery_cast(size_t, 1) << cht->log_2_size;
+}
+
+// Returns the index of the bucket for the given hash. The table must have
+// buckets.
+static inline
+size_t pottery_cht_bucket_index(pottery_cht_t* cht, size_t hash) {
+    pottery_assert(cht->buckets != pottery_null);
+    if (cht->log_2_size == 0)
+        return 0;
+    return pottery_knuth_hash_s(hash, cht->log_2_size);
+}
+
+
+
+/*
+ * lifecycle and lookup
+ */
+
+#if POTTERY_FORWARD_DECLARATIONS
+/**
+ * Initializes a chained hash table on the given array of buckets.
+ *
+ * The array must have room for (1 << log_2_size) refs. It is not owned by
+ * the table; you must keep it alive while the table uses it. The buckets
+ * are cleared to null. You can pass a null array and a log_2_size of 0 to
+ * initialize a table without buckets, in which case you must rehash it
+ * before linking any values.
+ */
+POTTERY_CHAINED_HASH_TABLE_EXTERN
+void pottery_cht_init(pottery_cht_t* cht,
+        #if POTTERY_CHAINED_HASH_TABLE_HAS_CONTEXT
+        pottery_cht_context_t context,
+        #endif
+        pottery_cht_ref_t* /*nullable*/ buckets, size_t log_2_size);
+#endif
+
+static inline
+void pottery_cht_destroy(pottery_cht_t* cht) {
+    pottery_assert(cht != pottery_null);
+
+    // It is an error to destroy a non-empty table. The table contents must be
+    // properly disposed of.
+    pottery_assert(cht->count == 0);
+    (void)cht;
+}
+
+static inline
+size_t pottery_cht_count(pottery_cht_t* cht) {
+    return cht->count;
+}
+
+static inline
+bool pottery_cht_is_empty(pottery_cht_t* cht) {
+    return cht->count == 0;
+}
+
+static inline
+void pottery_cht_swap(pottery_cht_t* left, pottery_cht_t* right) {
+    pottery_cht_t temp = *left;
+    *left = *right;
+    *right = temp;
+}
+
+#if POTTERY_FORWARD_DECLARATIONS
+/**
+ * Finds the value with the given key, using the given pre-computed hash.
+ *
+ * The hash must be the hash of the key, i.e. what KEY_HASH would return.
+ */
+POTTERY_CHAINED_HASH_TABLE_EXTERN
+pottery_cht_entry_t pottery_cht_find_with_hash(pottery_cht_t* cht,
+        pottery_cht_key_t key, size_t hash);
+#endif
+
+static inline
+pottery_cht_entry_t pottery_cht_find(pottery_cht_t* cht, pottery_cht_key_t key) {
+    return pottery_cht_find_with_hash(cht, key, pottery_cht_key_hash(cht, key));
+}
+
+static inline
+bool pottery_cht_contains_key(pottery_cht_t* cht, pottery_cht_key_t key) {
+    return pottery_cht_entry_exists(cht, pottery_cht_find(cht, key));
+}
+
+
+
+/*
+ * link and unlink
+ */
+
+#if POTTERY_FORWARD_DECLARATIONS
+/**
+ * Links the given value into the table using the given pre-computed hash of
+ * its key.
+ *
+ * The table must have buckets, and a value with the same key must not
+ * already be linked. The value's key isn't accessed (unless you link it
+ * again later or iterate without stored hashes), so you can link a value
+ * before initializing it as long as you initialize its key before the table
+ * needs it again.
+ */
+POTTERY_CHAINED_HASH_TABLE_EXTERN
+void pottery_cht_link_with_hash(pottery_cht_t* cht, pottery_cht_ref_t ref, size_t hash);
+
+/**
+ * Unlinks the given value from the table.
+ *
+ * This walks the chain of the value's bucket to find the value that links
+ * to it.
+ */
+POTTERY_CHAINED_HASH_TABLE_EXTERN
+void pottery_cht_unlink(pottery_cht_t* cht, pottery_cht_entry_t entry);
+
+/**
+ * Unlinks the value with the given key and returns it, or returns null if
+ * there is no such value.
+ */
+POTTERY_CHAINED_HASH_TABLE_EXTERN
+pottery_cht_entry_t pottery_cht_unlink_key(pottery_cht_t* cht, pottery_cht_key_t key);
+
+/**
+ * Unlinks all values from the table.
+ *
+ * The values are not accessed. You are responsible for disposing of them.
+ */
+POTTERY_CHAINED_HASH_TABLE_EXTERN
+void pottery_cht_unlink_all(pottery_cht_t* cht);
+
+/**
+ * Moves all values into the given new array of buckets.
+ *
+ * The values themselves are not moved; only their links are changed. The
+ * table no longer uses the old bucket array once this returns so you can
+ * free it. The new array must be distinct from the old one. It can have no
+ * buckets (null and a log_2_size of 0) only if the table is empty.
+ */
+POTTERY_CHAINED_HASH_TABLE_EXTERN
+void pottery_cht_rehash(pottery_cht_t* cht, pottery_cht_ref_t* /*nullable*/ buckets,
+        size_t log_2_size);
+#endif
+
+/**
+ * Links the given value into the table.
+ *
+ * A value with the same key must not already be linked.
+ */
+static inline
+void pottery_cht_link(pottery_cht_t* cht, pottery_cht_ref_t ref) {
+    pottery_cht_link_with_hash(cht, ref, pottery_cht_key_hash(cht,
+                pottery_cht_ref_key(POTTERY_CHT_CONTEXT_VAL(cht) ref)));
+}
+
+
+
+/*
+ * iteration
+ *
+ * Values are visited in bucket order. Finding the next value after the last
+ * in a chain requires its hash so this re-hashes keys if hashes aren't
+ * stored.
+ */
+
+// Returns the first value in the first non-empty bucket at or after index.
+static inline
+pottery_cht_entry_t pottery_cht_impl_scan(pottery_cht_t* cht, size_t index) {
+    size_t bucket_count = pottery_cht_bucket_count(cht);
+    for (; index < bucket_count; ++index)
+        if (!pottery_cht_ref_is_null(cht, cht->buckets[index]))
+            return cht->buckets[index];
+    return pottery_cht_null(cht);
+}
+
+static inline
+pottery_cht_entry_t pottery_cht_first(pottery_cht_t* cht) {
+    if (cht->count == 0)
+        return pottery_cht_null(cht);
+    return pottery_cht_impl_scan(cht, 0);
+}
+
+static inline
+pottery_cht_entry_t pottery_cht_begin(pottery_cht_t* cht) {
+    return pottery_cht_first(cht);
+}
+
+static inline
+pottery_cht_entry_t pottery_cht_end(pottery_cht_t* cht) {
+    (void)cht;
+    return pottery_cht_null(cht);
+}
+
+static inline
+pottery_cht_entry_t pottery_cht_next(pottery_cht_t* cht, pottery_cht_entry_t entry) {
+    pottery_cht_ref_t next = pottery_cht_next_ref(cht, entry);
+    if (!pottery_cht_ref_is_null(cht, next))
+        return next;
+    return pottery_cht_impl_scan(cht, 1 + pottery_cht_bucket_index(cht,
+                pottery_cht_ref_hash(cht, entry)));
+}
@@ -0,0 +1,173 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2020-2021 11037650 Canada Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef POTTERY_CHAINED_HASH_TABLE_IMPL
+#error "This is an internal header. Do not include it."
+#endif
+
+POTTERY_CHAINED_HASH_TABLE_EXTERN
+void pottery_cht_init(pottery_cht_t* cht,
+        #if POTTERY_CHAINED_HASH_TABLE_HAS_CONTEXT
+        pottery_cht_context_t context,
+        #endif
+        pottery_cht_ref_t* /*nullable*/ buckets, size_t log_2_size)
+{
+    pottery_assert(cht != pottery_null);
+    pottery_assert(buckets != pottery_null || log_2_size == 0);
+    #if POTTERY_CHAINED_HASH_TABLE_HAS_CONTEXT
+    cht->context = context;
+    #endif
+    cht->buckets = buckets;
+    cht->log_2_size = log_2_size;
+    cht->count = 0;
+
+    size_t bucket_count = pottery_cht_bucket_count(cht);
+    size_t i;
+    for (i = 0; i < bucket_count; ++i)
+        buckets[i] = pottery_cht_null(cht);
+}
+
+POTTERY_CHAINED_HASH_TABLE_EXTERN
+pottery_cht_entry_t pottery_cht_find_with_hash(pottery_cht_t* cht,
+        pottery_cht_key_t key, size_t hash)
+{
+    if (cht->count == 0)
+        return pottery_cht_null(cht);
+
+    pottery_cht_ref_t ref = cht->buckets[pottery_cht_bucket_index(cht, hash)];
+    while (!pottery_cht_ref_is_null(cht, ref)) {
+        if (pottery_cht_ref_matches(cht, ref, key, hash))
+            return ref;
+        ref = pottery_cht_next_ref(cht, ref);
+    }
+    return ref;
+}
+
+POTTERY_CHAINED_HASH_TABLE_EXTERN
+void pottery_cht_link_with_hash(pottery_cht_t* cht, pottery_cht_ref_t ref, size_t hash) {
+    pottery_assert(!pottery_cht_ref_is_null(cht, ref));
+
+    // New values are linked at the head of their chain.
+    pottery_cht_ref_t* bucket = cht->buckets + pottery_cht_bucket_index(cht, hash);
+    pottery_cht_set_ref_hash(cht, ref, hash);
+    pottery_cht_set_next_ref(cht, ref, *bucket);
+    *bucket = ref;
+    ++cht->count;
+}
+
+POTTERY_CHAINED_HASH_TABLE_EXTERN
+void pottery_cht_unlink(pottery_cht_t* cht, pottery_cht_entry_t entry) {
+    pottery_assert(cht->count > 0);
+    pottery_cht_ref_t* bucket = cht->buckets + pottery_cht_bucket_index(cht,
+            pottery_cht_ref_hash(cht, entry));
+    pottery_cht_ref_t next = pottery_cht_next_ref(cht, entry);
+
+    if (pottery_cht_ref_equal(POTTERY_CHT_CONTEXT_VAL(cht) *bucket, entry)) {
+        *bucket = next;
+    } else {
+        // Find the value that links to this one.
+        pottery_cht_ref_t previous = *bucket;
+        while (true) {
+            // The value must be in the table.
+            pottery_assert(!pottery_cht_ref_is_null(cht, previous));
+            pottery_cht_ref_t current = pottery_cht_next_ref(cht, previous);
+            if (pottery_cht_ref_equal(POTTERY_CHT_CONTEXT_VAL(cht) current, entry))
+                break;
+            previous = current;
+        }
+        pottery_cht_set_next_ref(cht, previous, next);
+    }
+
+    --cht->count;
+}
+
+POTTERY_CHAINED_HASH_TABLE_EXTERN
+pottery_cht_entry_t pottery_cht_unlink_key(pottery_cht_t* cht, pottery_cht_key_t key) {
+    if (cht->count == 0)
+        return pottery_cht_null(cht);
+
+    size_t hash = pottery_cht_key_hash(cht, key);
+    pottery_cht_ref_t* bucket = cht->buckets + pottery_cht_bucket_index(cht, hash);
+    pottery_cht_ref_t previous = pottery_cht_null(cht);
+    pottery_cht_ref_t ref = *bucket;
+
+    while (!pottery_cht_ref_is_null(cht, ref)) {
+        pottery_cht_ref_t next = pottery_cht_next_ref(cht, ref);
+        if (pottery_cht_ref_matches(cht, ref, key, hash)) {
+            if (pottery_cht_ref_is_null(cht, previous))
+                *bucket = next;
+            else
+                pottery_cht_set_next_ref(cht, previous, next);
+            --cht->count;
+            return ref;
+        }
+        previous = ref;
+        ref = next;
+    }
+
+    return ref;
+}
+
+POTTERY_CHAINED_HASH_TABLE_EXTERN
+void pottery_cht_unlink_all(pottery_cht_t* cht) {
+    size_t bucket_count = pottery_cht_bucket_count(cht);
+    size_t i;
+    for (i = 0; i < bucket_count; ++i)
+        cht->buckets[i] = pottery_cht_null(cht);
+    cht->count = 0;
+}
+
+POTTERY_CHAINED_HASH_TABLE_EXTERN
+void pottery_cht_rehash(pottery_cht_t* cht, pottery_cht_ref_t* /*nullable*/ buckets,
+        size_t log_2_size)
+{
+    pottery_assert(buckets != pottery_null || log_2_size == 0);
+    pottery_assert(buckets != pottery_null || cht->count == 0);
+    pottery_assert(buckets == pottery_null || buckets != cht->buckets);
+
+    pottery_cht_ref_t* old_buckets = cht->buckets;
+    size_t old_bucket_count = pottery_cht_bucket_count(cht);
+
+    cht->buckets = buckets;
+    cht->log_2_size = log_2_size;
+
+    size_t bucket_count = pottery_cht_bucket_count(cht);
+    size_t i;
+    for (i = 0; i < bucket_count; ++i)
+        buckets[i] = pottery_cht_null(cht);
+
+    // Relink each chain into the new buckets. Only the links change; the
+    // values stay where they are.
+    for (i = 0; i < old_bucket_count; ++i) {
+        pottery_cht_ref_t ref = old_buckets[i];
+        while (!pottery_cht_ref_is_null(cht, ref)) {
+            pottery_cht_ref_t next = pottery_cht_next_ref(cht, ref);
+            pottery_cht_ref_t* bucket = buckets + pottery_cht_bucket_index(cht,
+                    pottery_cht_ref_hash(cht, ref));
+            pottery_cht_set_next_ref(cht, ref, *bucket);
+            *bucket = ref;
+            ref = next;
+        }
+    }
+}
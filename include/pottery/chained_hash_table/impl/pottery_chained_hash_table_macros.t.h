@@ -0,0 +1,281 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2020-2021 11037650 Canada Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef POTTERY_CHAINED_HASH_TABLE_IMPL
+#error "This is an internal header. Do not include it."
+#endif
+
+#include "pottery/pottery_dependencies.h"
+#include "pottery/platform/pottery_platform_pragma_push.t.h"
+
+// configs
+#ifndef POTTERY_CHAINED_HASH_TABLE_PREFIX
+    #error "POTTERY_CHAINED_HASH_TABLE_PREFIX is not defined."
+#endif
+#ifndef POTTERY_CHAINED_HASH_TABLE_KEY_HASH
+    #error "POTTERY_CHAINED_HASH_TABLE_KEY_HASH is not defined."
+#endif
+#ifndef POTTERY_CHAINED_HASH_TABLE_KEY_EQUAL
+    #error "POTTERY_CHAINED_HASH_TABLE_KEY_EQUAL is not defined."
+#endif
+
+// Stored hash
+// If you have somewhere to store the hash of each element, the table will use
+// it to avoid re-hashing keys and to skip comparing keys whose hashes differ.
+#if defined(POTTERY_CHAINED_HASH_TABLE_STORED_HASH) != defined(POTTERY_CHAINED_HASH_TABLE_SET_STORED_HASH)
+    #error "You must define both or neither of STORED_HASH and SET_STORED_HASH."
+#endif
+
+#ifdef POTTERY_CHAINED_HASH_TABLE_CONTEXT_TYPE
+    #define POTTERY_CHAINED_HASH_TABLE_HAS_CONTEXT 1
+#else
+    #define POTTERY_CHAINED_HASH_TABLE_HAS_CONTEXT 0
+#endif
+
+#if POTTERY_CHAINED_HASH_TABLE_HAS_CONTEXT
+    #define POTTERY_CHT_CONTEXT_VAL(cht) cht->context,
+#else
+    #define POTTERY_CHT_CONTEXT_VAL(cht) /*nothing*/
+#endif
+
+#ifdef POTTERY_CHAINED_HASH_TABLE_NULL
+    #if POTTERY_CHAINED_HASH_TABLE_HAS_CONTEXT
+        // NULL is a function-like macro that takes the context.
+        #define pottery_cht_null(cht) POTTERY_CHAINED_HASH_TABLE_NULL(((cht)->context))
+    #else
+        // NULL is not a function-like macro; there are no parentheses after it.
+        #define pottery_cht_null(cht) (POTTERY_CHAINED_HASH_TABLE_NULL)
+    #endif
+#else
+    // By default null is just a null pointer.
+    #define pottery_cht_null(cht) (pottery_null)
+#endif
+
+
+// naming macros
+#define POTTERY_CHAINED_HASH_TABLE_NAME(name) POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_PREFIX, name)
+
+// public functions not in the container template
+#define pottery_cht_link_with_hash POTTERY_CHAINED_HASH_TABLE_NAME(_link_with_hash)
+#define pottery_cht_bucket_count POTTERY_CHAINED_HASH_TABLE_NAME(_bucket_count)
+#define pottery_cht_rehash POTTERY_CHAINED_HASH_TABLE_NAME(_rehash)
+
+// internal accessors
+#define pottery_cht_next_ref POTTERY_CHAINED_HASH_TABLE_NAME(_next_ref)
+#define pottery_cht_set_next_ref POTTERY_CHAINED_HASH_TABLE_NAME(_set_next_ref)
+#define pottery_cht_ref_hash POTTERY_CHAINED_HASH_TABLE_NAME(_ref_hash)
+#define pottery_cht_set_ref_hash POTTERY_CHAINED_HASH_TABLE_NAME(_set_ref_hash)
+
+// other internal functions
+#define pottery_cht_ref_is_null POTTERY_CHAINED_HASH_TABLE_NAME(_ref_is_null)
+#define pottery_cht_key_hash POTTERY_CHAINED_HASH_TABLE_NAME(_key_hash)
+#define pottery_cht_key_equal POTTERY_CHAINED_HASH_TABLE_NAME(_key_equal)
+#define pottery_cht_ref_matches POTTERY_CHAINED_HASH_TABLE_NAME(_ref_matches)
+#define pottery_cht_bucket_index POTTERY_CHAINED_HASH_TABLE_NAME(_bucket_index)
+#define pottery_cht_impl_scan POTTERY_CHAINED_HASH_TABLE_NAME(_impl_scan)
+
+
+
+// container funcs
+//!!! AUTOGENERATED:container/rename.m.h SRC:pottery_cht DEST:POTTERY_CHAINED_HASH_TABLE_PREFIX
+    // This block is auto-generated. Do not modify until END_AUTOGENERATED.
+    // Renames array identifiers from pottery_cht to POTTERY_CHAINED_HASH_TABLE_PREFIX
+
+    // types
+    #define pottery_cht_t POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_PREFIX, _t)
+    #define pottery_cht_entry_t POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_PREFIX, _entry_t)
+    #define pottery_cht_location_t POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_PREFIX, _location_t) // currently only used for intrusive maps
+
+    // lifecycle operations
+    #define pottery_cht_copy POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_PREFIX, _copy)
+    #define pottery_cht_destroy POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_PREFIX, _destroy)
+    #define pottery_cht_init POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_PREFIX, _init)
+    #define pottery_cht_init_copy POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_PREFIX, _init_copy)
+    #define pottery_cht_init_steal POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_PREFIX, _init_steal)
+    #define pottery_cht_move POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_PREFIX, _move)
+    #define pottery_cht_steal POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_PREFIX, _steal)
+    #define pottery_cht_swap POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_PREFIX, _swap)
+
+    // entry operations
+    #define pottery_cht_entry_exists POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_PREFIX, _entry_exists)
+    #define pottery_cht_entry_equal POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_PREFIX, _entry_equal)
+    #define pottery_cht_entry_ref POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_PREFIX, _entry_ref)
+
+    // lookup
+    #define pottery_cht_count POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_PREFIX, _count)
+    #define pottery_cht_is_empty POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_PREFIX, _is_empty)
+    #define pottery_cht_at POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_PREFIX, _at)
+    #define pottery_cht_find POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_PREFIX, _find)
+    #define pottery_cht_find_with_hash POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_PREFIX, _find_with_hash)
+    #define pottery_cht_contains_key POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_PREFIX, _contains_key)
+    #define pottery_cht_contains_key_with_hash POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_PREFIX, _contains_key_with_hash)
+    #define pottery_cht_find_bulk POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_PREFIX, _find_bulk)
+    #define pottery_cht_contains_bulk POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_PREFIX, _contains_bulk)
+    #define pottery_cht_first POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_PREFIX, _first)
+    #define pottery_cht_last POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_PREFIX, _last)
+    #define pottery_cht_any POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_PREFIX, _any)
+
+    // array access
+    #define pottery_cht_select POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_PREFIX, _select)
+    #define pottery_cht_index POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_PREFIX, _index)
+    #define pottery_cht_shift POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_PREFIX, _shift)
+    #define pottery_cht_offset POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_PREFIX, _offset)
+    #define pottery_cht_begin POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_PREFIX, _begin)
+    #define pottery_cht_end POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_PREFIX, _end)
+    #define pottery_cht_next POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_PREFIX, _next)
+    #define pottery_cht_previous POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_PREFIX, _previous)
+
+    // misc
+    #define pottery_cht_capacity POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_PREFIX, _capacity)
+    #define pottery_cht_reserve POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_PREFIX, _reserve)
+    #define pottery_cht_shrink POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_PREFIX, _shrink)
+
+    // insert
+    #define pottery_cht_insert POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_PREFIX, _insert)
+    #define pottery_cht_insert_at POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_PREFIX, _insert_at)
+    #define pottery_cht_insert_first POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_PREFIX, _insert_first)
+    #define pottery_cht_insert_last POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_PREFIX, _insert_last)
+    #define pottery_cht_insert_before POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_PREFIX, _insert_before)
+    #define pottery_cht_insert_after POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_PREFIX, _insert_after)
+    #define pottery_cht_insert_bulk POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_PREFIX, _insert_bulk)
+    #define pottery_cht_insert_at_bulk POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_PREFIX, _insert_at_bulk)
+    #define pottery_cht_insert_first_bulk POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_PREFIX, _insert_first_bulk)
+    #define pottery_cht_insert_last_bulk POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_PREFIX, _insert_last_bulk)
+    #define pottery_cht_insert_before_bulk POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_PREFIX, _insert_before_bulk)
+    #define pottery_cht_insert_after_bulk POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_PREFIX, _insert_after_bulk)
+
+    // emplace
+    #define pottery_cht_emplace POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_PREFIX, _emplace)
+    #define pottery_cht_emplace_at POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_PREFIX, _emplace_at)
+    #define pottery_cht_emplace_key POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_PREFIX, _emplace_key)
+    #define pottery_cht_emplace_key_with_hash POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_PREFIX, _emplace_key_with_hash)
+    #define pottery_cht_emplace_first POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_PREFIX, _emplace_first)
+    #define pottery_cht_emplace_last POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_PREFIX, _emplace_last)
+    #define pottery_cht_emplace_before POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_PREFIX, _emplace_before)
+    #define pottery_cht_emplace_after POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_PREFIX, _emplace_after)
+    #define pottery_cht_emplace_bulk POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_PREFIX, _emplace_bulk)
+    #define pottery_cht_emplace_at_bulk POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_PREFIX, _emplace_at_bulk)
+    #define pottery_cht_emplace_first_bulk POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_PREFIX, _emplace_first_bulk)
+    #define pottery_cht_emplace_last_bulk POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_PREFIX, _emplace_last_bulk)
+    #define pottery_cht_emplace_before_bulk POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_PREFIX, _emplace_before_bulk)
+    #define pottery_cht_emplace_after_bulk POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_PREFIX, _emplace_after_bulk)
+
+    // construct
+    #define pottery_cht_construct POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_PREFIX, _construct)
+    #define pottery_cht_construct_at POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_PREFIX, _construct_at)
+    #define pottery_cht_construct_key POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_PREFIX, _construct_key)
+    #define pottery_cht_construct_first POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_PREFIX, _construct_first)
+    #define pottery_cht_construct_last POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_PREFIX, _construct_last)
+    #define pottery_cht_construct_before POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_PREFIX, _construct_before)
+    #define pottery_cht_construct_after POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_PREFIX, _construct_after)
+
+    // extract
+    #define pottery_cht_extract POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_PREFIX, _extract)
+    #define pottery_cht_extract_at POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_PREFIX, _extract_at)
+    #define pottery_cht_extract_key POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_PREFIX, _extract_key)
+    #define pottery_cht_extract_first POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_PREFIX, _extract_first)
+    #define pottery_cht_extract_first_bulk POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_PREFIX, _extract_first_bulk)
+    #define pottery_cht_extract_last POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_PREFIX, _extract_last)
+    #define pottery_cht_extract_last_bulk POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_PREFIX, _extract_last_bulk)
+    #define pottery_cht_extract_and_next POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_PREFIX, _extract_and_next)
+    #define pottery_cht_extract_and_previous POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_PREFIX, _extract_and_previous)
+
+    // remove
+    #define pottery_cht_remove POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_PREFIX, _remove)
+    #define pottery_cht_remove_at POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_PREFIX, _remove_at)
+    #define pottery_cht_remove_key POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_PREFIX, _remove_key)
+    #define pottery_cht_remove_key_with_hash POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_PREFIX, _remove_key_with_hash)
+    #define pottery_cht_remove_first POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_PREFIX, _remove_first)
+    #define pottery_cht_remove_last POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_PREFIX, _remove_last)
+    #define pottery_cht_remove_and_next POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_PREFIX, _remove_and_next)
+    #define pottery_cht_remove_and_previous POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_PREFIX, _remove_and_previous)
+    #define pottery_cht_remove_all POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_PREFIX, _remove_all)
+    #define pottery_cht_remove_bulk POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_PREFIX, _remove_bulk)
+    #define pottery_cht_remove_at_bulk POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_PREFIX, _remove_at_bulk)
+    #define pottery_cht_remove_first_bulk POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_PREFIX, _remove_first_bulk)
+    #define pottery_cht_remove_last_bulk POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_PREFIX, _remove_last_bulk)
+    #define pottery_cht_remove_at_bulk POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_PREFIX, _remove_at_bulk)
+    #define pottery_cht_remove_and_next_bulk POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_PREFIX, _remove_and_next_bulk)
+    #define pottery_cht_remove_and_previous_bulk POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_PREFIX, _remove_and_previous_bulk)
+
+    // displace
+    #define pottery_cht_displace POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_PREFIX, _displace)
+    #define pottery_cht_displace_at POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_PREFIX, _displace_at)
+    #define pottery_cht_displace_key POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_PREFIX, _displace_key)
+    #define pottery_cht_displace_first POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_PREFIX, _displace_first)
+    #define pottery_cht_displace_last POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_PREFIX, _displace_last)
+    #define pottery_cht_displace_and_next POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_PREFIX, _displace_and_next)
+    #define pottery_cht_displace_and_previous POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_PREFIX, _displace_and_previous)
+    #define pottery_cht_displace_all POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_PREFIX, _displace_all)
+    #define pottery_cht_displace_bulk POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_PREFIX, _displace_bulk)
+    #define pottery_cht_displace_at_bulk POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_PREFIX, _displace_at_bulk)
+    #define pottery_cht_displace_first_bulk POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_PREFIX, _displace_first_bulk)
+    #define pottery_cht_displace_last_bulk POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_PREFIX, _displace_last_bulk)
+    #define pottery_cht_displace_and_next_bulk POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_PREFIX, _displace_and_next_bulk)
+    #define pottery_cht_displace_and_previous_bulk POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_PREFIX, _displace_and_previous_bulk)
+
+    // link
+    #define pottery_cht_link POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_PREFIX, _link)
+    #define pottery_cht_link_first POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_PREFIX, _link_first)
+    #define pottery_cht_link_last POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_PREFIX, _link_last)
+    #define pottery_cht_link_before POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_PREFIX, _link_before)
+    #define pottery_cht_link_after POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_PREFIX, _link_after)
+
+    // unlink
+    #define pottery_cht_unlink POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_PREFIX, _unlink)
+    #define pottery_cht_unlink_at POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_PREFIX, _unlink_at)
+    #define pottery_cht_unlink_key POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_PREFIX, _unlink_key)
+    #define pottery_cht_unlink_first POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_PREFIX, _unlink_first)
+    #define pottery_cht_unlink_last POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_PREFIX, _unlink_last)
+    #define pottery_cht_unlink_and_next POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_PREFIX, _unlink_and_next)
+    #define pottery_cht_unlink_and_previous POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_PREFIX, _unlink_and_previous)
+    #define pottery_cht_unlink_all POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_PREFIX, _unlink_all)
+
+    // special links
+    #define pottery_cht_replace POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_PREFIX, _replace)
+    #define pottery_cht_find_location POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_PREFIX, _find_location)
+    #define pottery_cht_link_location POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_PREFIX, _link_location)
+//!!! END_AUTOGENERATED
+
+
+
+// container_types
+#ifdef POTTERY_CHAINED_HASH_TABLE_EXTERNAL_CONTAINER_TYPES
+    #define POTTERY_CHAINED_HASH_TABLE_CONTAINER_TYPES_PREFIX POTTERY_CHAINED_HASH_TABLE_EXTERNAL_CONTAINER_TYPES
+#else
+    #define POTTERY_CHAINED_HASH_TABLE_CONTAINER_TYPES_PREFIX POTTERY_CHAINED_HASH_TABLE_PREFIX
+#endif
+//!!! AUTOGENERATED:container_types/rename.m.h SRC:pottery_cht DEST:POTTERY_CHAINED_HASH_TABLE_CONTAINER_TYPES_PREFIX
+    // This block is auto-generated. Do not modify until END_AUTOGENERATED.
+    // Renames container_types template identifiers from pottery_cht to POTTERY_CHAINED_HASH_TABLE_CONTAINER_TYPES_PREFIX
+
+    #define pottery_cht_value_t POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_CONTAINER_TYPES_PREFIX, _value_t)
+    #define pottery_cht_ref_t POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_CONTAINER_TYPES_PREFIX, _ref_t)
+    #define pottery_cht_const_ref_t POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_CONTAINER_TYPES_PREFIX, _const_ref_t)
+    #define pottery_cht_key_t POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_CONTAINER_TYPES_PREFIX, _key_t)
+    #define pottery_cht_context_t POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_CONTAINER_TYPES_PREFIX, _context_t)
+
+    #define pottery_cht_ref_key POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_CONTAINER_TYPES_PREFIX, _ref_key)
+    #define pottery_cht_ref_equal POTTERY_CONCAT(POTTERY_CHAINED_HASH_TABLE_CONTAINER_TYPES_PREFIX, _ref_equal)
+//!!! END_AUTOGENERATED
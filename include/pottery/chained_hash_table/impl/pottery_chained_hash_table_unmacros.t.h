@@ -0,0 +1,268 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2020-2021 11037650 Canada Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef POTTERY_CHAINED_HASH_TABLE_IMPL
+#error "This is an internal header. Do not include it."
+#endif
+
+// naming macros
+#undef POTTERY_CHAINED_HASH_TABLE_NAME
+
+// configs
+#undef POTTERY_CHAINED_HASH_TABLE_PREFIX
+#undef POTTERY_CHAINED_HASH_TABLE_EXTERNAL_CONTAINER_TYPES
+#undef POTTERY_CHAINED_HASH_TABLE_KEY_HASH
+#undef POTTERY_CHAINED_HASH_TABLE_KEY_EQUAL
+#undef POTTERY_CHAINED_HASH_TABLE_NEXT
+#undef POTTERY_CHAINED_HASH_TABLE_SET_NEXT
+#undef POTTERY_CHAINED_HASH_TABLE_NULL
+#undef POTTERY_CHAINED_HASH_TABLE_STORED_HASH
+#undef POTTERY_CHAINED_HASH_TABLE_SET_STORED_HASH
+
+// other macros
+#undef POTTERY_CHAINED_HASH_TABLE_HAS_CONTEXT
+#undef POTTERY_CHAINED_HASH_TABLE_EXTERN
+#undef POTTERY_CHT_CONTEXT_VAL
+#undef pottery_cht_null
+
+// public functions not in the container template
+#undef pottery_cht_link_with_hash
+#undef pottery_cht_bucket_count
+#undef pottery_cht_rehash
+
+// internal accessors
+#undef pottery_cht_next_ref
+#undef pottery_cht_set_next_ref
+#undef pottery_cht_ref_hash
+#undef pottery_cht_set_ref_hash
+
+// other internal functions
+#undef pottery_cht_ref_is_null
+#undef pottery_cht_key_hash
+#undef pottery_cht_key_equal
+#undef pottery_cht_ref_matches
+#undef pottery_cht_bucket_index
+#undef pottery_cht_impl_scan
+
+
+
+//!!! AUTOGENERATED:container/unrename.m.h PREFIX:pottery_cht
+    // This block is auto-generated. Do not modify until END_AUTOGENERATED.
+    // Un-renames array identifiers with prefix "pottery_cht"
+
+    // types
+    #undef pottery_cht_t
+    #undef pottery_cht_entry_t
+    #undef pottery_cht_location_t // currently only used for intrusive maps
+
+    // lifecycle operations
+    #undef pottery_cht_copy
+    #undef pottery_cht_destroy
+    #undef pottery_cht_init
+    #undef pottery_cht_init_copy
+    #undef pottery_cht_init_steal
+    #undef pottery_cht_move
+    #undef pottery_cht_steal
+    #undef pottery_cht_swap
+
+    // entry operations
+    #undef pottery_cht_entry_exists
+    #undef pottery_cht_entry_equal
+    #undef pottery_cht_entry_ref
+
+    // lookup
+    #undef pottery_cht_count
+    #undef pottery_cht_is_empty
+    #undef pottery_cht_at
+    #undef pottery_cht_find
+    #undef pottery_cht_find_with_hash
+    #undef pottery_cht_contains_key
+    #undef pottery_cht_contains_key_with_hash
+    #undef pottery_cht_find_bulk
+    #undef pottery_cht_contains_bulk
+    #undef pottery_cht_first
+    #undef pottery_cht_last
+    #undef pottery_cht_any
+
+    // array access
+    #undef pottery_cht_select
+    #undef pottery_cht_index
+    #undef pottery_cht_shift
+    #undef pottery_cht_offset
+    #undef pottery_cht_begin
+    #undef pottery_cht_end
+    #undef pottery_cht_next
+    #undef pottery_cht_previous
+
+    // misc
+    #undef pottery_cht_capacity
+    #undef pottery_cht_reserve
+    #undef pottery_cht_shrink
+
+    // insert
+    #undef pottery_cht_insert
+    #undef pottery_cht_insert_at
+    #undef pottery_cht_insert_first
+    #undef pottery_cht_insert_last
+    #undef pottery_cht_insert_before
+    #undef pottery_cht_insert_after
+    #undef pottery_cht_insert_bulk
+    #undef pottery_cht_insert_at_bulk
+    #undef pottery_cht_insert_first_bulk
+    #undef pottery_cht_insert_last_bulk
+    #undef pottery_cht_insert_before_bulk
+    #undef pottery_cht_insert_after_bulk
+
+    // emplace
+    #undef pottery_cht_emplace
+    #undef pottery_cht_emplace_at
+    #undef pottery_cht_emplace_key
+    #undef pottery_cht_emplace_key_with_hash
+    #undef pottery_cht_emplace_first
+    #undef pottery_cht_emplace_last
+    #undef pottery_cht_emplace_before
+    #undef pottery_cht_emplace_after
+    #undef pottery_cht_emplace_bulk
+    #undef pottery_cht_emplace_at_bulk
+    #undef pottery_cht_emplace_first_bulk
+    #undef pottery_cht_emplace_last_bulk
+    #undef pottery_cht_emplace_before_bulk
+    #undef pottery_cht_emplace_after_bulk
+
+    // construct
+    #undef pottery_cht_construct
+    #undef pottery_cht_construct_at
+    #undef pottery_cht_construct_key
+    #undef pottery_cht_construct_first
+    #undef pottery_cht_construct_last
+    #undef pottery_cht_construct_before
+    #undef pottery_cht_construct_after
+
+    // extract
+    #undef pottery_cht_extract
+    #undef pottery_cht_extract_at
+    #undef pottery_cht_extract_key
+    #undef pottery_cht_extract_first
+    #undef pottery_cht_extract_first_bulk
+    #undef pottery_cht_extract_last
+    #undef pottery_cht_extract_last_bulk
+    #undef pottery_cht_extract_and_next
+    #undef pottery_cht_extract_and_previous
+
+    // remove
+    #undef pottery_cht_remove
+    #undef pottery_cht_remove_at
+    #undef pottery_cht_remove_key
+    #undef pottery_cht_remove_key_with_hash
+    #undef pottery_cht_remove_first
+    #undef pottery_cht_remove_last
+    #undef pottery_cht_remove_and_next
+    #undef pottery_cht_remove_and_previous
+    #undef pottery_cht_remove_all
+    #undef pottery_cht_remove_bulk
+    #undef pottery_cht_remove_at_bulk
+    #undef pottery_cht_remove_first_bulk
+    #undef pottery_cht_remove_last_bulk
+    #undef pottery_cht_remove_at_bulk
+    #undef pottery_cht_remove_and_next_bulk
+    #undef pottery_cht_remove_and_previous_bulk
+
+    // displace
+    #undef pottery_cht_displace
+    #undef pottery_cht_displace_at
+    #undef pottery_cht_displace_key
+    #undef pottery_cht_displace_first
+    #undef pottery_cht_displace_last
+    #undef pottery_cht_displace_and_next
+    #undef pottery_cht_displace_and_previous
+    #undef pottery_cht_displace_all
+    #undef pottery_cht_displace_bulk
+    #undef pottery_cht_displace_at_bulk
+    #undef pottery_cht_displace_first_bulk
+    #undef pottery_cht_displace_last_bulk
+    #undef pottery_cht_displace_and_next_bulk
+    #undef pottery_cht_displace_and_previous_bulk
+
+    // link
+    #undef pottery_cht_link
+    #undef pottery_cht_link_first
+    #undef pottery_cht_link_last
+    #undef pottery_cht_link_before
+    #undef pottery_cht_link_after
+
+    // unlink
+    #undef pottery_cht_unlink
+    #undef pottery_cht_unlink_at
+    #undef pottery_cht_unlink_key
+    #undef pottery_cht_unlink_first
+    #undef pottery_cht_unlink_last
+    #undef pottery_cht_unlink_and_next
+    #undef pottery_cht_unlink_and_previous
+    #undef pottery_cht_unlink_all
+
+    // special links
+    #undef pottery_cht_replace
+    #undef pottery_cht_find_location
+    #undef pottery_cht_link_location
+//!!! END_AUTOGENERATED
+
+
+
+// container_types
+
+//!!! AUTOGENERATED:container_types/unconfigure.m.h CONFIG:POTTERY_CHAINED_HASH_TABLE
+    // This block is auto-generated. Do not modify until END_AUTOGENERATED.
+    // Undefines (forwardable/forwarded) container_types configuration on POTTERY_CHAINED_HASH_TABLE
+
+    // types
+    #undef POTTERY_CHAINED_HASH_TABLE_VALUE_TYPE
+    #undef POTTERY_CHAINED_HASH_TABLE_REF_TYPE
+    #undef POTTERY_CHAINED_HASH_TABLE_ENTRY_TYPE
+    #undef POTTERY_CHAINED_HASH_TABLE_KEY_TYPE
+    #undef POTTERY_CHAINED_HASH_TABLE_CONTEXT_TYPE
+
+    // Conversion and comparison expressions
+    #undef POTTERY_CHAINED_HASH_TABLE_ENTRY_REF
+    #undef POTTERY_CHAINED_HASH_TABLE_REF_KEY
+    #undef POTTERY_CHAINED_HASH_TABLE_REF_EQUAL
+//!!! END_AUTOGENERATED
+
+#undef POTTERY_CHAINED_HASH_TABLE_CONTAINER_TYPES_PREFIX
+//!!! AUTOGENERATED:container_types/unrename.m.h PREFIX:pottery_cht
+    // This block is auto-generated. Do not modify until END_AUTOGENERATED.
+    // Unrenames container_types template identifiers from pottery_cht
+
+    #undef pottery_cht_value_t
+    #undef pottery_cht_ref_t
+    #undef pottery_cht_const_ref_t
+    #undef pottery_cht_key_t
+    #undef pottery_cht_context_t
+
+    #undef pottery_cht_ref_key
+    #undef pottery_cht_ref_equal
+//!!! END_AUTOGENERATED
+
+
+
+#include "pottery/platform/pottery_platform_pragma_pop.t.h"
@@ -0,0 +1,206 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2020-2021 11037650 Canada Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef POTTERY_COMPACT_HASH_MAP_IMPL
+#error "This is an internal header. Do not include it."
+#endif
+
+typedef pottery_cphm_ref_t pottery_cphm_entry_t;
+
+/*
+ * A compact hash map.
+ *
+ * Values are stored densely in insertion order in a separate array from the
+ * hash table. The hash table is an open-addressed array of indices into the
+ * value array, each only as wide as it needs to be for the capacity of the
+ * map (1, 2, 4 or 8 bytes.)
+ *
+ * Removing a value leaves a hole in the value array (tracked in a bitmap) and
+ * a tombstone in the index table. Both are cleaned up when the map needs room
+ * for more values, either by compacting at the same size or by growing.
+ */
+typedef struct pottery_cphm_t {
+    pottery_cphm_value_t* values;
+    uint64_t* holes; // a bit for each value; the index table follows it
+    void* indices;
+    size_t index_width; // the size of each index in bytes
+    size_t log_2_size;
+    size_t used; // the number of values used in the value array including holes
+    size_t load; // the number of indices used including tombstones
+    size_t count;
+} pottery_cphm_t;
+
+POTTERY_COMPACT_HASH_MAP_EXTERN
+pottery_error_t pottery_cphm_init(pottery_cphm_t* map);
+
+POTTERY_COMPACT_HASH_MAP_EXTERN
+void pottery_cphm_destroy(pottery_cphm_t* map);
+
+/**
+ * Finds the value with the given key or creates a slot for it.
+ *
+ * If the key does not exist, the returned entry is uninitialized and you must
+ * construct a value with the given key in it. New values are placed after all
+ * existing values in iteration order. If the key already exists, its value
+ * keeps its place.
+ */
+POTTERY_COMPACT_HASH_MAP_EXTERN
+pottery_error_t pottery_cphm_emplace_key(pottery_cphm_t* map, pottery_cphm_key_t key,
+        pottery_cphm_entry_t* entry, bool* /*nullable*/ created);
+
+/**
+ * Returns the entry for the given key, or an entry that doesn't exist if the
+ * key is not in the map.
+ */
+POTTERY_COMPACT_HASH_MAP_EXTERN
+pottery_cphm_entry_t pottery_cphm_find(pottery_cphm_t* map, pottery_cphm_key_t key);
+
+static inline
+bool pottery_cphm_entry_exists(pottery_cphm_t* map, pottery_cphm_entry_t entry) {
+    (void)map;
+    return entry != pottery_null;
+}
+
+static inline
+pottery_cphm_value_t* pottery_cphm_entry_ref(pottery_cphm_t* map, pottery_cphm_entry_t entry) {
+    (void)map;
+    return entry;
+}
+
+/**
+ * Returns true if there is a value in the map with this key.
+ */
+static inline
+bool pottery_cphm_contains_key(pottery_cphm_t* map, pottery_cphm_key_t key) {
+    return pottery_cphm_entry_exists(map, pottery_cphm_find(map, key));
+}
+
+static inline
+size_t pottery_cphm_count(pottery_cphm_t* map) {
+    return map->count;
+}
+
+static inline
+bool pottery_cphm_is_empty(pottery_cphm_t* map) {
+    return map->count == 0;
+}
+
+/**
+ * Returns the number of buckets in the index table.
+ */
+static inline
+size_t pottery_cphm_bucket_count(pottery_cphm_t* map) {
+    return pottery_cast(size_t, 1) << map->log_2_size;
+}
+
+/**
+ * Returns the current capacity of the map, i.e. the number of buckets times
+ * the max load factor. This is also the size of the value array.
+ */
+static inline
+size_t pottery_cphm_capacity(pottery_cphm_t* map) {
+    size_t buckets = pottery_cphm_bucket_count(map);
+    return (buckets / POTTERY_COMPACT_HASH_MAP_MAX_LOAD_FACTOR_DENOMINATOR) *
+                POTTERY_COMPACT_HASH_MAP_MAX_LOAD_FACTOR_NUMERATOR +
+            (buckets % POTTERY_COMPACT_HASH_MAP_MAX_LOAD_FACTOR_DENOMINATOR) *
+                POTTERY_COMPACT_HASH_MAP_MAX_LOAD_FACTOR_NUMERATOR /
+                POTTERY_COMPACT_HASH_MAP_MAX_LOAD_FACTOR_DENOMINATOR;
+}
+
+// Returns the count below which the map will shrink.
+static inline
+size_t pottery_cphm_min_count(pottery_cphm_t* map) {
+    size_t buckets = pottery_cphm_bucket_count(map);
+    return (buckets / POTTERY_COMPACT_HASH_MAP_MIN_LOAD_FACTOR_DENOMINATOR) *
+                POTTERY_COMPACT_HASH_MAP_MIN_LOAD_FACTOR_NUMERATOR +
+            (buckets % POTTERY_COMPACT_HASH_MAP_MIN_LOAD_FACTOR_DENOMINATOR) *
+                POTTERY_COMPACT_HASH_MAP_MIN_LOAD_FACTOR_NUMERATOR /
+                POTTERY_COMPACT_HASH_MAP_MIN_LOAD_FACTOR_DENOMINATOR;
+}
+
+/**
+ * Grows the map so that it can hold at least the given total number of values
+ * without growing again.
+ */
+POTTERY_COMPACT_HASH_MAP_EXTERN
+pottery_error_t pottery_cphm_reserve(pottery_cphm_t* map, size_t count);
+
+POTTERY_COMPACT_HASH_MAP_EXTERN
+void pottery_cphm_displace(pottery_cphm_t* map, pottery_cphm_entry_t entry);
+
+POTTERY_COMPACT_HASH_MAP_EXTERN
+void pottery_cphm_displace_all(pottery_cphm_t* map);
+
+#if POTTERY_COMPACT_HASH_MAP_CAN_DESTROY
+POTTERY_COMPACT_HASH_MAP_EXTERN
+void pottery_cphm_remove(pottery_cphm_t* map, pottery_cphm_entry_t entry);
+
+POTTERY_COMPACT_HASH_MAP_EXTERN
+void pottery_cphm_remove_all(pottery_cphm_t* map);
+
+/**
+ * Returns true if an entry matching the given key was removed.
+ */
+POTTERY_COMPACT_HASH_MAP_EXTERN
+bool pottery_cphm_remove_key(pottery_cphm_t* map, pottery_cphm_key_t key);
+#endif
+
+
+
+/*
+ * Iteration
+ *
+ * Values are visited in the order they were inserted. This is a linear scan
+ * of the value array; the index table isn't touched.
+ *
+ * Removing values doesn't invalidate entries to other values, but inserting
+ * values invalidates all entries (values can be moved when the map grows or
+ * compacts.) Removing values can also invalidate all entries if the map
+ * shrinks.
+ */
+
+POTTERY_COMPACT_HASH_MAP_EXTERN
+pottery_cphm_entry_t pottery_cphm_begin(pottery_cphm_t* map);
+
+static inline
+pottery_cphm_entry_t pottery_cphm_end(pottery_cphm_t* map) {
+    (void)map;
+    return pottery_null;
+}
+
+static inline
+pottery_cphm_entry_t pottery_cphm_first(pottery_cphm_t* map) {
+    pottery_cphm_entry_t entry = pottery_cphm_begin(map);
+    pottery_assert(pottery_cphm_entry_exists(map, entry));
+    return entry;
+}
+
+POTTERY_COMPACT_HASH_MAP_EXTERN
+pottery_cphm_entry_t pottery_cphm_last(pottery_cphm_t* map);
+
+POTTERY_COMPACT_HASH_MAP_EXTERN
+pottery_cphm_entry_t pottery_cphm_next(pottery_cphm_t* map, pottery_cphm_entry_t entry);
+
+POTTERY_COMPACT_HASH_MAP_EXTERN
+pottery_cphm_entry_t pottery_cphm_previous(pottery_cphm_t* map, pottery_cphm_entry_t entry);
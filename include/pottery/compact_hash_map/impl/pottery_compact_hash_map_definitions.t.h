@@ -0,0 +1,579 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2020-2021 11037650 Canada Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef POTTERY_COMPACT_HASH_MAP_IMPL
+#error "This is an internal header. Do not include it."
+#endif
+
+// Default to 8 buckets (5 values with the default load factor)
+#define POTTERY_COMPACT_HASH_MAP_MINIMUM_LOG_2_SIZE 3
+
+static inline
+size_t pottery_cphm_impl_key_hash(pottery_cphm_key_t key) {
+    return POTTERY_COMPACT_HASH_MAP_KEY_HASH(key);
+}
+
+static inline
+bool pottery_cphm_impl_key_equal(pottery_cphm_key_t left, pottery_cphm_key_t right) {
+    return POTTERY_COMPACT_HASH_MAP_KEY_EQUAL(left, right);
+}
+
+static inline
+pottery_cphm_key_t pottery_cphm_impl_key(pottery_cphm_value_t* value) {
+    return pottery_cphm_ref_key(value);
+}
+
+
+
+/*
+ * Index table
+ *
+ * Each bucket of the index table holds zero if it's empty, all ones if it's a
+ * tombstone, or otherwise the index of a value plus one. The width of a
+ * bucket is the smallest that can hold the capacity of the map without
+ * colliding with the tombstone, so maps of up to 254 values use one byte per
+ * bucket, maps of up to 65534 values use two, etc.
+ *
+ * The index table uses linear probing. Since buckets are tiny, a probe
+ * sequence usually stays within a cache line; the only other memory touched
+ * by a successful lookup is the value itself.
+ */
+
+// Returns the width in bytes of the indices of a map with the given capacity.
+static inline
+size_t pottery_cphm_impl_index_width(size_t capacity) {
+    if (capacity < pottery_cast(size_t, UINT8_MAX))
+        return 1;
+    if (capacity < pottery_cast(size_t, UINT16_MAX))
+        return 2;
+    if (pottery_cast(uint64_t, capacity) < UINT64_C(0xFFFFFFFF))
+        return 4;
+    return sizeof(size_t);
+}
+
+// Returns the index stored in the given bucket plus one, zero if the bucket
+// is empty, or SIZE_MAX if it's a tombstone.
+static inline
+size_t pottery_cphm_impl_get_index(pottery_cphm_t* map, size_t bucket) {
+    size_t index;
+    switch (map->index_width) {
+        case 1:
+            index = pottery_cast(const uint8_t*, map->indices)[bucket];
+            return (index == UINT8_MAX) ? SIZE_MAX : index;
+        case 2:
+            index = pottery_cast(const uint16_t*, map->indices)[bucket];
+            return (index == UINT16_MAX) ? SIZE_MAX : index;
+        case 4:
+            index = pottery_cast(const uint32_t*, map->indices)[bucket];
+            return (index == pottery_cast(size_t, UINT32_MAX)) ? SIZE_MAX : index;
+        default:
+            return pottery_cast(const size_t*, map->indices)[bucket];
+    }
+}
+
+// Stores an index plus one, zero, or SIZE_MAX for a tombstone in the given
+// bucket. (Truncating SIZE_MAX gives the tombstone of each width.)
+static inline
+void pottery_cphm_impl_set_index(pottery_cphm_t* map, size_t bucket, size_t index) {
+    switch (map->index_width) {
+        case 1:
+            pottery_cast(uint8_t*, map->indices)[bucket] = pottery_cast(uint8_t, index);
+            break;
+        case 2:
+            pottery_cast(uint16_t*, map->indices)[bucket] = pottery_cast(uint16_t, index);
+            break;
+        case 4:
+            pottery_cast(uint32_t*, map->indices)[bucket] = pottery_cast(uint32_t, index);
+            break;
+        default:
+            pottery_cast(size_t*, map->indices)[bucket] = index;
+            break;
+    }
+}
+
+static inline
+size_t pottery_cphm_impl_home(pottery_cphm_t* map, size_t hash) {
+    return pottery_knuth_hash_s(hash, map->log_2_size);
+}
+
+// Returns the bucket containing the index of the value with the given key,
+// or SIZE_MAX if it's not in the map.
+//
+// If available is not null, the first empty or tombstone bucket in the probe
+// sequence is stored in it (in case the caller wants to insert the key.)
+static inline
+size_t pottery_cphm_impl_probe(pottery_cphm_t* map, pottery_cphm_key_t key, size_t hash,
+        size_t* /*nullable*/ available)
+{
+    size_t mask = pottery_cphm_bucket_count(map) - 1;
+    size_t bucket = pottery_cphm_impl_home(map, hash);
+    size_t first_available = SIZE_MAX;
+
+    // The load is always less than the number of buckets so there is always
+    // an empty bucket to stop the probe.
+    while (true) {
+        size_t index = pottery_cphm_impl_get_index(map, bucket);
+        if (index == 0) {
+            if (first_available == SIZE_MAX)
+                first_available = bucket;
+            break;
+        }
+        if (index == SIZE_MAX) {
+            if (first_available == SIZE_MAX)
+                first_available = bucket;
+        } else if (pottery_cphm_impl_key_equal(key,
+                    pottery_cphm_impl_key(map->values + index - 1)))
+        {
+            return bucket;
+        }
+        bucket = (bucket + 1) & mask;
+    }
+
+    if (available != pottery_null)
+        *available = first_available;
+    return SIZE_MAX;
+}
+
+// Returns the bucket containing the index of the given value.
+static inline
+size_t pottery_cphm_impl_bucket_of(pottery_cphm_t* map, pottery_cphm_entry_t entry) {
+    size_t mask = pottery_cphm_bucket_count(map) - 1;
+    size_t index = pottery_cast(size_t, entry - map->values) + 1;
+    size_t bucket = pottery_cphm_impl_home(map,
+            pottery_cphm_impl_key_hash(pottery_cphm_impl_key(entry)));
+    pottery_assert(index <= map->used);
+    while (pottery_cphm_impl_get_index(map, bucket) != index) {
+        pottery_assert(pottery_cphm_impl_get_index(map, bucket) != 0);
+        bucket = (bucket + 1) & mask;
+    }
+    return bucket;
+}
+
+// Stores the index of a value with the given hash in the given bucket, or in
+// the first available bucket for the hash if the given bucket is SIZE_MAX.
+static inline
+void pottery_cphm_impl_insert_index(pottery_cphm_t* map, size_t hash, size_t index,
+        size_t bucket)
+{
+    if (bucket == SIZE_MAX) {
+        size_t mask = pottery_cphm_bucket_count(map) - 1;
+        bucket = pottery_cphm_impl_home(map, hash);
+        while (true) {
+            size_t existing = pottery_cphm_impl_get_index(map, bucket);
+            if (existing == 0 || existing == SIZE_MAX)
+                break;
+            bucket = (bucket + 1) & mask;
+        }
+    }
+    if (pottery_cphm_impl_get_index(map, bucket) == 0)
+        ++map->load;
+    pottery_cphm_impl_set_index(map, bucket, index + 1);
+}
+
+
+
+/*
+ * Holes
+ *
+ * Removed values leave holes in the value array. We track them with one bit
+ * per value so that iteration can skip them without touching the values.
+ */
+
+static inline
+size_t pottery_cphm_impl_hole_words(size_t capacity) {
+    return (capacity + 63) / 64;
+}
+
+static inline
+bool pottery_cphm_impl_is_hole(pottery_cphm_t* map, size_t index) {
+    return 0 != ((map->holes[index / 64] >> (index % 64)) & 1);
+}
+
+static inline
+void pottery_cphm_impl_set_hole(pottery_cphm_t* map, size_t index, bool hole) {
+    uint64_t bit = UINT64_C(1) << (index % 64);
+    if (hole)
+        map->holes[index / 64] |= bit;
+    else
+        map->holes[index / 64] &= ~bit;
+}
+
+
+
+/*
+ * Allocation
+ *
+ * The value array and the index table are separate allocations. The hole
+ * bitmap is stored at the start of the index table's allocation.
+ */
+
+// Allocates an empty map with the given size.
+static
+pottery_error_t pottery_cphm_impl_alloc(pottery_cphm_t* map, size_t log_2_size) {
+    size_t capacity;
+    size_t words;
+
+    if (log_2_size >= 8 * sizeof(size_t) - 4)
+        return POTTERY_ERROR_OVERFLOW;
+
+    map->log_2_size = log_2_size;
+    map->used = 0;
+    map->load = 0;
+    map->count = 0;
+    capacity = pottery_cphm_capacity(map);
+    map->index_width = pottery_cphm_impl_index_width(capacity);
+
+    map->values = pottery_cast(pottery_cphm_value_t*, pottery_cphm_alloc_malloc_array(
+            pottery_alignof(pottery_cphm_value_t), capacity, sizeof(pottery_cphm_value_t)));
+    if (map->values == pottery_null)
+        return POTTERY_ERROR_ALLOC;
+
+    // The index table is a multiple of 8 bytes since we have at least 8
+    // buckets.
+    words = pottery_cphm_impl_hole_words(capacity) +
+            (pottery_cphm_bucket_count(map) * map->index_width) / sizeof(uint64_t);
+    map->holes = pottery_cast(uint64_t*, pottery_cphm_alloc_malloc_array_zero(
+            pottery_alignof(uint64_t), words, sizeof(uint64_t)));
+    if (map->holes == pottery_null) {
+        pottery_cphm_alloc_free(pottery_alignof(pottery_cphm_value_t), map->values);
+        return POTTERY_ERROR_ALLOC;
+    }
+    map->indices = map->holes + pottery_cphm_impl_hole_words(capacity);
+
+    return POTTERY_OK;
+}
+
+static inline
+void pottery_cphm_impl_free(pottery_cphm_t* map) {
+    pottery_cphm_alloc_free(pottery_alignof(uint64_t), map->holes);
+    pottery_cphm_alloc_free(pottery_alignof(pottery_cphm_value_t), map->values);
+}
+
+
+
+/*
+ * Rebuilding
+ */
+
+// Rebuilds the map at the given size, removing all holes and tombstones.
+//
+// The values stay in order. At the same size we compact the values in place
+// and clear the index table so this can't fail; otherwise we move the values
+// into new allocations. Either way the index table is rebuilt by re-hashing
+// the keys.
+pottery_noinline static
+pottery_error_t pottery_cphm_impl_rebuild(pottery_cphm_t* map, size_t new_log_2_size) {
+    pottery_cphm_t new_map;
+    size_t i;
+
+    if (new_log_2_size == map->log_2_size) {
+        size_t capacity = pottery_cphm_capacity(map);
+        size_t used = 0;
+        for (i = 0; i < map->used; ++i) {
+            if (pottery_cphm_impl_is_hole(map, i))
+                continue;
+            if (used != i)
+                pottery_cphm_lifecycle_move_restrict(map->values + used, map->values + i);
+            ++used;
+        }
+        pottery_assert(used == map->count);
+
+        pottery_memset(map->holes, 0, sizeof(uint64_t) *
+                pottery_cphm_impl_hole_words(capacity) +
+                pottery_cphm_bucket_count(map) * map->index_width);
+        map->used = used;
+        map->load = 0;
+        for (i = 0; i < used; ++i)
+            pottery_cphm_impl_insert_index(map,
+                    pottery_cphm_impl_key_hash(pottery_cphm_impl_key(map->values + i)),
+                    i, SIZE_MAX);
+        return POTTERY_OK;
+    }
+
+    {
+        pottery_error_t error = pottery_cphm_impl_alloc(&new_map, new_log_2_size);
+        if (error != POTTERY_OK)
+            return error;
+    }
+
+    pottery_assert(map->count <= pottery_cphm_capacity(&new_map));
+    for (i = 0; i < map->used; ++i) {
+        pottery_cphm_value_t* value;
+        if (pottery_cphm_impl_is_hole(map, i))
+            continue;
+        value = new_map.values + new_map.used;
+        pottery_cphm_lifecycle_move_restrict(value, map->values + i);
+        pottery_cphm_impl_insert_index(&new_map,
+                pottery_cphm_impl_key_hash(pottery_cphm_impl_key(value)),
+                new_map.used, SIZE_MAX);
+        ++new_map.used;
+    }
+    new_map.count = new_map.used;
+
+    pottery_cphm_impl_free(map);
+    *map = new_map;
+    return POTTERY_OK;
+}
+
+// Makes room for at least one more value.
+//
+// If more than half our capacity is live values, we grow. Otherwise there are
+// enough holes or tombstones that we can compact at the same size instead.
+static
+pottery_error_t pottery_cphm_impl_make_room(pottery_cphm_t* map) {
+    size_t log_2_size = map->log_2_size;
+    if (map->count >= pottery_cphm_capacity(map) / 2)
+        ++log_2_size;
+    return pottery_cphm_impl_rebuild(map, log_2_size);
+}
+
+static inline
+void pottery_cphm_shrink_if_needed(pottery_cphm_t* map) {
+    if (map->log_2_size == POTTERY_COMPACT_HASH_MAP_MINIMUM_LOG_2_SIZE)
+        return;
+    if (map->count >= pottery_cphm_min_count(map))
+        return;
+
+    // Note: we ignore the return value here. If the smaller table can't be
+    // allocated, we just keep our larger table. This way displace can't fail.
+    (void)pottery_cphm_impl_rebuild(map, map->log_2_size - 1);
+}
+
+// Removes the index in the given bucket, leaving a hole where its value was.
+// This doesn't touch the value itself.
+static inline
+void pottery_cphm_impl_unlink(pottery_cphm_t* map, size_t bucket) {
+    size_t index = pottery_cphm_impl_get_index(map, bucket) - 1;
+    pottery_assert(index < map->used);
+
+    pottery_cphm_impl_set_index(map, bucket, SIZE_MAX);
+    --map->count;
+
+    // Holes at the end of the value array are trimmed so the slots can be
+    // used again without compacting.
+    if (index + 1 == map->used) {
+        --map->used;
+        while (map->used > 0 && pottery_cphm_impl_is_hole(map, map->used - 1)) {
+            --map->used;
+            pottery_cphm_impl_set_hole(map, map->used, false);
+        }
+    } else {
+        pottery_cphm_impl_set_hole(map, index, true);
+    }
+}
+
+
+
+/*
+ * Public functions
+ */
+
+POTTERY_COMPACT_HASH_MAP_EXTERN
+pottery_error_t pottery_cphm_init(pottery_cphm_t* map) {
+    return pottery_cphm_impl_alloc(map, POTTERY_COMPACT_HASH_MAP_MINIMUM_LOG_2_SIZE);
+}
+
+POTTERY_COMPACT_HASH_MAP_EXTERN
+void pottery_cphm_destroy(pottery_cphm_t* map) {
+    #if POTTERY_COMPACT_HASH_MAP_CAN_DESTROY
+    size_t i;
+    for (i = 0; i < map->used; ++i)
+        if (!pottery_cphm_impl_is_hole(map, i))
+            pottery_cphm_lifecycle_destroy(map->values + i);
+    #else
+    // If we don't have a destroy expression, you must manually empty the hash
+    // map before destroying it.
+    pottery_assert(pottery_cphm_is_empty(map));
+    #endif
+
+    pottery_cphm_impl_free(map);
+}
+
+POTTERY_COMPACT_HASH_MAP_EXTERN
+pottery_cphm_entry_t pottery_cphm_find(pottery_cphm_t* map, pottery_cphm_key_t key) {
+    size_t bucket = pottery_cphm_impl_probe(map, key, pottery_cphm_impl_key_hash(key), pottery_null);
+    if (bucket == SIZE_MAX)
+        return pottery_null;
+    return map->values + pottery_cphm_impl_get_index(map, bucket) - 1;
+}
+
+POTTERY_COMPACT_HASH_MAP_EXTERN
+pottery_error_t pottery_cphm_emplace_key(pottery_cphm_t* map, pottery_cphm_key_t key,
+        pottery_cphm_entry_t* entry, bool* /*nullable*/ created)
+{
+    size_t hash = pottery_cphm_impl_key_hash(key);
+    size_t available = SIZE_MAX;
+    size_t bucket = pottery_cphm_impl_probe(map, key, hash, &available);
+    size_t capacity = pottery_cphm_capacity(map);
+
+    if (bucket != SIZE_MAX) {
+        *entry = map->values + pottery_cphm_impl_get_index(map, bucket) - 1;
+        if (created)
+            *created = false;
+        return POTTERY_OK;
+    }
+
+    // A reused tombstone doesn't add to the load, but the new value always
+    // goes at the end of the value array, so we need room in both.
+    if (map->used == capacity || (map->load == capacity &&
+                pottery_cphm_impl_get_index(map, available) == 0))
+    {
+        pottery_error_t error = pottery_cphm_impl_make_room(map);
+        if (error != POTTERY_OK)
+            return error;
+        available = SIZE_MAX;
+    }
+
+    pottery_cphm_impl_insert_index(map, hash, map->used, available);
+    *entry = map->values + map->used;
+    ++map->used;
+    ++map->count;
+    if (created)
+        *created = true;
+    return POTTERY_OK;
+}
+
+POTTERY_COMPACT_HASH_MAP_EXTERN
+pottery_error_t pottery_cphm_reserve(pottery_cphm_t* map, size_t count) {
+    pottery_cphm_t sized;
+    if (count <= pottery_cphm_capacity(map))
+        return POTTERY_OK;
+
+    sized.log_2_size = map->log_2_size;
+    do {
+        if (sized.log_2_size >= 8 * sizeof(size_t) - 4)
+            return POTTERY_ERROR_OVERFLOW;
+        ++sized.log_2_size;
+    } while (pottery_cphm_capacity(&sized) < count);
+
+    return pottery_cphm_impl_rebuild(map, sized.log_2_size);
+}
+
+POTTERY_COMPACT_HASH_MAP_EXTERN
+void pottery_cphm_displace(pottery_cphm_t* map, pottery_cphm_entry_t entry) {
+    pottery_cphm_impl_unlink(map, pottery_cphm_impl_bucket_of(map, entry));
+    pottery_cphm_shrink_if_needed(map);
+}
+
+POTTERY_COMPACT_HASH_MAP_EXTERN
+void pottery_cphm_displace_all(pottery_cphm_t* map) {
+    pottery_cphm_t empty;
+
+    // If the map is larger than the minimum size, we re-allocate to the
+    // minimum size. If that fails (or if it's already the minimum size) we
+    // clear our existing index table.
+    if (map->log_2_size != POTTERY_COMPACT_HASH_MAP_MINIMUM_LOG_2_SIZE &&
+            POTTERY_OK == pottery_cphm_impl_alloc(&empty, POTTERY_COMPACT_HASH_MAP_MINIMUM_LOG_2_SIZE))
+    {
+        pottery_cphm_impl_free(map);
+        *map = empty;
+        return;
+    }
+
+    pottery_memset(map->holes, 0, sizeof(uint64_t) *
+            pottery_cphm_impl_hole_words(pottery_cphm_capacity(map)) +
+            pottery_cphm_bucket_count(map) * map->index_width);
+    map->used = 0;
+    map->load = 0;
+    map->count = 0;
+}
+
+#if POTTERY_COMPACT_HASH_MAP_CAN_DESTROY
+POTTERY_COMPACT_HASH_MAP_EXTERN
+void pottery_cphm_remove(pottery_cphm_t* map, pottery_cphm_entry_t entry) {
+    // We find the index before destroying the value since we need its key.
+    size_t bucket = pottery_cphm_impl_bucket_of(map, entry);
+    pottery_cphm_lifecycle_destroy(entry);
+    pottery_cphm_impl_unlink(map, bucket);
+    pottery_cphm_shrink_if_needed(map);
+}
+
+POTTERY_COMPACT_HASH_MAP_EXTERN
+bool pottery_cphm_remove_key(pottery_cphm_t* map, pottery_cphm_key_t key) {
+    size_t bucket = pottery_cphm_impl_probe(map, key, pottery_cphm_impl_key_hash(key), pottery_null);
+    if (bucket == SIZE_MAX)
+        return false;
+    pottery_cphm_lifecycle_destroy(map->values + pottery_cphm_impl_get_index(map, bucket) - 1);
+    pottery_cphm_impl_unlink(map, bucket);
+    pottery_cphm_shrink_if_needed(map);
+    return true;
+}
+
+POTTERY_COMPACT_HASH_MAP_EXTERN
+void pottery_cphm_remove_all(pottery_cphm_t* map) {
+    size_t i;
+    for (i = 0; i < map->used; ++i)
+        if (!pottery_cphm_impl_is_hole(map, i))
+            pottery_cphm_lifecycle_destroy(map->values + i);
+    pottery_cphm_displace_all(map);
+}
+#endif
+
+
+
+/*
+ * Iteration
+ */
+
+// Returns the first value at or after the given index.
+static inline
+pottery_cphm_entry_t pottery_cphm_impl_scan_forward(pottery_cphm_t* map, size_t index) {
+    for (; index < map->used; ++index)
+        if (!pottery_cphm_impl_is_hole(map, index))
+            return map->values + index;
+    return pottery_null;
+}
+
+// Returns the last value before the given index.
+static inline
+pottery_cphm_entry_t pottery_cphm_impl_scan_backward(pottery_cphm_t* map, size_t index) {
+    while (index > 0) {
+        --index;
+        if (!pottery_cphm_impl_is_hole(map, index))
+            return map->values + index;
+    }
+    return pottery_null;
+}
+
+POTTERY_COMPACT_HASH_MAP_EXTERN
+pottery_cphm_entry_t pottery_cphm_begin(pottery_cphm_t* map) {
+    return pottery_cphm_impl_scan_forward(map, 0);
+}
+
+POTTERY_COMPACT_HASH_MAP_EXTERN
+pottery_cphm_entry_t pottery_cphm_last(pottery_cphm_t* map) {
+    pottery_cphm_entry_t entry = pottery_cphm_impl_scan_backward(map, map->used);
+    pottery_assert(pottery_cphm_entry_exists(map, entry));
+    return entry;
+}
+
+POTTERY_COMPACT_HASH_MAP_EXTERN
+pottery_cphm_entry_t pottery_cphm_next(pottery_cphm_t* map, pottery_cphm_entry_t entry) {
+    return pottery_cphm_impl_scan_forward(map, pottery_cast(size_t, entry - map->values) + 1);
+}
+
+POTTERY_COMPACT_HASH_MAP_EXTERN
+pottery_cphm_entry_t pottery_cphm_previous(pottery_cphm_t* map, pottery_cphm_entry_t entry) {
+    return pottery_cphm_impl_scan_backward(map, pottery_cast(size_t, entry - map->values));
+}
@@ -0,0 +1,236 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2020-2021 11037650 Canada Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef POTTERY_COMPACT_HASH_MAP_IMPL
+#error "This is an internal header. Do not include it."
+#endif
+
+#include "pottery/pottery_dependencies.h"
+#include "pottery/platform/pottery_platform_pragma_push.t.h"
+
+
+
+/*
+ * Configuration
+ */
+
+#ifndef POTTERY_COMPACT_HASH_MAP_PREFIX
+#error "POTTERY_COMPACT_HASH_MAP_PREFIX is not defined."
+#endif
+
+#ifndef POTTERY_COMPACT_HASH_MAP_VALUE_TYPE
+#error "POTTERY_COMPACT_HASH_MAP_VALUE_TYPE is not defined."
+#endif
+
+#ifndef POTTERY_COMPACT_HASH_MAP_KEY_HASH
+#error "POTTERY_COMPACT_HASH_MAP_KEY_HASH is not defined."
+#endif
+
+#ifndef POTTERY_COMPACT_HASH_MAP_KEY_EQUAL
+#error "POTTERY_COMPACT_HASH_MAP_KEY_EQUAL is not defined."
+#endif
+
+#ifdef POTTERY_COMPACT_HASH_MAP_CONTEXT_TYPE
+#error "compact_hash_map does not support a context yet."
+#endif
+
+#ifndef POTTERY_COMPACT_HASH_MAP_EXTERN
+#define POTTERY_COMPACT_HASH_MAP_EXTERN /*nothing*/
+#endif
+
+// Values are moved to a new array when the map grows or compacts.
+#if !POTTERY_LIFECYCLE_CAN_MOVE
+    #error "compact_hash_map requires a move expression."
+#endif
+
+// Load factors
+// These work the same as in open_hash_map. They apply to the index table; the
+// value array holds exactly as many values as the index table can take before
+// it grows. Indices are small so the default maximum is 2/3 (as in CPython's
+// dict) and the default minimum is 1/6.
+#ifndef POTTERY_COMPACT_HASH_MAP_MAX_LOAD_FACTOR_NUMERATOR
+    #define POTTERY_COMPACT_HASH_MAP_MAX_LOAD_FACTOR_NUMERATOR 2
+#endif
+#ifndef POTTERY_COMPACT_HASH_MAP_MAX_LOAD_FACTOR_DENOMINATOR
+    #define POTTERY_COMPACT_HASH_MAP_MAX_LOAD_FACTOR_DENOMINATOR 3
+#endif
+#ifndef POTTERY_COMPACT_HASH_MAP_MIN_LOAD_FACTOR_NUMERATOR
+    #define POTTERY_COMPACT_HASH_MAP_MIN_LOAD_FACTOR_NUMERATOR 1
+#endif
+#ifndef POTTERY_COMPACT_HASH_MAP_MIN_LOAD_FACTOR_DENOMINATOR
+    #define POTTERY_COMPACT_HASH_MAP_MIN_LOAD_FACTOR_DENOMINATOR 6
+#endif
+#if POTTERY_COMPACT_HASH_MAP_MAX_LOAD_FACTOR_NUMERATOR <= 0 || \
+        POTTERY_COMPACT_HASH_MAP_MAX_LOAD_FACTOR_NUMERATOR >= POTTERY_COMPACT_HASH_MAP_MAX_LOAD_FACTOR_DENOMINATOR
+    #error "The MAX_LOAD_FACTOR must be greater than 0 and less than 1."
+#endif
+#if POTTERY_COMPACT_HASH_MAP_MIN_LOAD_FACTOR_NUMERATOR < 0 || \
+        POTTERY_COMPACT_HASH_MAP_MIN_LOAD_FACTOR_DENOMINATOR <= 0
+    #error "The MIN_LOAD_FACTOR cannot be negative."
+#endif
+#if 2 * POTTERY_COMPACT_HASH_MAP_MIN_LOAD_FACTOR_NUMERATOR * POTTERY_COMPACT_HASH_MAP_MAX_LOAD_FACTOR_DENOMINATOR >= \
+        POTTERY_COMPACT_HASH_MAP_MAX_LOAD_FACTOR_NUMERATOR * POTTERY_COMPACT_HASH_MAP_MIN_LOAD_FACTOR_DENOMINATOR
+    #error "The MIN_LOAD_FACTOR must be less than half the MAX_LOAD_FACTOR."
+#endif
+
+#if POTTERY_LIFECYCLE_CAN_DESTROY
+    #define POTTERY_COMPACT_HASH_MAP_CAN_DESTROY 1
+#else
+    #define POTTERY_COMPACT_HASH_MAP_CAN_DESTROY 0
+#endif
+
+
+
+/*
+ * Renaming
+ */
+
+#define POTTERY_COMPACT_HASH_MAP_NAME(name) \
+    POTTERY_CONCAT(POTTERY_COMPACT_HASH_MAP_PREFIX, name)
+
+#define pottery_cphm_t POTTERY_COMPACT_HASH_MAP_NAME(_t)
+#define pottery_cphm_entry_t POTTERY_COMPACT_HASH_MAP_NAME(_entry_t)
+#define pottery_cphm_bucket_count POTTERY_COMPACT_HASH_MAP_NAME(_bucket_count)
+#define pottery_cphm_capacity POTTERY_COMPACT_HASH_MAP_NAME(_capacity)
+#define pottery_cphm_min_count POTTERY_COMPACT_HASH_MAP_NAME(_min_count)
+#define pottery_cphm_impl_index_width POTTERY_COMPACT_HASH_MAP_NAME(_impl_index_width)
+#define pottery_cphm_impl_get_index POTTERY_COMPACT_HASH_MAP_NAME(_impl_get_index)
+#define pottery_cphm_impl_set_index POTTERY_COMPACT_HASH_MAP_NAME(_impl_set_index)
+#define pottery_cphm_impl_home POTTERY_COMPACT_HASH_MAP_NAME(_impl_home)
+#define pottery_cphm_impl_hole_words POTTERY_COMPACT_HASH_MAP_NAME(_impl_hole_words)
+#define pottery_cphm_impl_is_hole POTTERY_COMPACT_HASH_MAP_NAME(_impl_is_hole)
+#define pottery_cphm_impl_set_hole POTTERY_COMPACT_HASH_MAP_NAME(_impl_set_hole)
+#define pottery_cphm_impl_alloc POTTERY_COMPACT_HASH_MAP_NAME(_impl_alloc)
+#define pottery_cphm_impl_free POTTERY_COMPACT_HASH_MAP_NAME(_impl_free)
+#define pottery_cphm_impl_probe POTTERY_COMPACT_HASH_MAP_NAME(_impl_probe)
+#define pottery_cphm_impl_bucket_of POTTERY_COMPACT_HASH_MAP_NAME(_impl_bucket_of)
+#define pottery_cphm_impl_insert_index POTTERY_COMPACT_HASH_MAP_NAME(_impl_insert_index)
+#define pottery_cphm_impl_unlink POTTERY_COMPACT_HASH_MAP_NAME(_impl_unlink)
+#define pottery_cphm_impl_rebuild POTTERY_COMPACT_HASH_MAP_NAME(_impl_rebuild)
+#define pottery_cphm_impl_make_room POTTERY_COMPACT_HASH_MAP_NAME(_impl_make_room)
+#define pottery_cphm_shrink_if_needed POTTERY_COMPACT_HASH_MAP_NAME(_shrink_if_needed)
+#define pottery_cphm_impl_scan_forward POTTERY_COMPACT_HASH_MAP_NAME(_impl_scan_forward)
+#define pottery_cphm_impl_scan_backward POTTERY_COMPACT_HASH_MAP_NAME(_impl_scan_backward)
+#define pottery_cphm_impl_key_hash POTTERY_COMPACT_HASH_MAP_NAME(_impl_key_hash)
+#define pottery_cphm_impl_key_equal POTTERY_COMPACT_HASH_MAP_NAME(_impl_key_equal)
+#define pottery_cphm_impl_key POTTERY_COMPACT_HASH_MAP_NAME(_impl_key)
+#define pottery_cphm_init POTTERY_COMPACT_HASH_MAP_NAME(_init)
+#define pottery_cphm_destroy POTTERY_COMPACT_HASH_MAP_NAME(_destroy)
+#define pottery_cphm_emplace_key POTTERY_COMPACT_HASH_MAP_NAME(_emplace_key)
+#define pottery_cphm_find POTTERY_COMPACT_HASH_MAP_NAME(_find)
+#define pottery_cphm_contains_key POTTERY_COMPACT_HASH_MAP_NAME(_contains_key)
+#define pottery_cphm_count POTTERY_COMPACT_HASH_MAP_NAME(_count)
+#define pottery_cphm_is_empty POTTERY_COMPACT_HASH_MAP_NAME(_is_empty)
+#define pottery_cphm_reserve POTTERY_COMPACT_HASH_MAP_NAME(_reserve)
+#define pottery_cphm_displace POTTERY_COMPACT_HASH_MAP_NAME(_displace)
+#define pottery_cphm_displace_all POTTERY_COMPACT_HASH_MAP_NAME(_displace_all)
+#define pottery_cphm_remove POTTERY_COMPACT_HASH_MAP_NAME(_remove)
+#define pottery_cphm_remove_all POTTERY_COMPACT_HASH_MAP_NAME(_remove_all)
+#define pottery_cphm_remove_key POTTERY_COMPACT_HASH_MAP_NAME(_remove_key)
+#define pottery_cphm_entry_exists POTTERY_COMPACT_HASH_MAP_NAME(_entry_exists)
+#define pottery_cphm_entry_ref POTTERY_COMPACT_HASH_MAP_NAME(_entry_ref)
+#define pottery_cphm_begin POTTERY_COMPACT_HASH_MAP_NAME(_begin)
+#define pottery_cphm_end POTTERY_COMPACT_HASH_MAP_NAME(_end)
+#define pottery_cphm_first POTTERY_COMPACT_HASH_MAP_NAME(_first)
+#define pottery_cphm_last POTTERY_COMPACT_HASH_MAP_NAME(_last)
+#define pottery_cphm_next POTTERY_COMPACT_HASH_MAP_NAME(_next)
+#define pottery_cphm_previous POTTERY_COMPACT_HASH_MAP_NAME(_previous)
+
+
+
+// alloc functions
+#define POTTERY_COMPACT_HASH_MAP_ALLOC_PREFIX POTTERY_CONCAT(POTTERY_COMPACT_HASH_MAP_PREFIX, _alloc)
+//!!! AUTOGENERATED:alloc/rename.m.h SRC:pottery_cphm_alloc DEST:POTTERY_COMPACT_HASH_MAP_ALLOC_PREFIX
+    // This block is auto-generated. Do not modify until END_AUTOGENERATED.
+    // Renames alloc identifiers from pottery_cphm_alloc to POTTERY_COMPACT_HASH_MAP_ALLOC_PREFIX
+
+    #define pottery_cphm_alloc_free POTTERY_CONCAT(POTTERY_COMPACT_HASH_MAP_ALLOC_PREFIX, _free)
+    #define pottery_cphm_alloc_impl_free_ea POTTERY_CONCAT(POTTERY_COMPACT_HASH_MAP_ALLOC_PREFIX, _impl_free_ea)
+    #define pottery_cphm_alloc_impl_free_fa POTTERY_CONCAT(POTTERY_COMPACT_HASH_MAP_ALLOC_PREFIX, _impl_free_fa)
+
+    #define pottery_cphm_alloc_malloc POTTERY_CONCAT(POTTERY_COMPACT_HASH_MAP_ALLOC_PREFIX, _malloc)
+    #define pottery_cphm_alloc_impl_malloc_ea POTTERY_CONCAT(POTTERY_COMPACT_HASH_MAP_ALLOC_PREFIX, _impl_malloc_ea)
+    #define pottery_cphm_alloc_impl_malloc_fa POTTERY_CONCAT(POTTERY_COMPACT_HASH_MAP_ALLOC_PREFIX, _impl_malloc_fa)
+
+    #define pottery_cphm_alloc_malloc_zero POTTERY_CONCAT(POTTERY_COMPACT_HASH_MAP_ALLOC_PREFIX, _malloc_zero)
+    #define pottery_cphm_alloc_impl_malloc_zero_ea POTTERY_CONCAT(POTTERY_COMPACT_HASH_MAP_ALLOC_PREFIX, _impl_malloc_zero_ea)
+    #define pottery_cphm_alloc_impl_malloc_zero_fa POTTERY_CONCAT(POTTERY_COMPACT_HASH_MAP_ALLOC_PREFIX, _impl_malloc_zero_fa)
+    #define pottery_cphm_alloc_impl_malloc_zero_fa_wrap POTTERY_CONCAT(POTTERY_COMPACT_HASH_MAP_ALLOC_PREFIX, _impl_malloc_zero_fa_wrap)
+
+    #define pottery_cphm_alloc_malloc_array_at_least POTTERY_CONCAT(POTTERY_COMPACT_HASH_MAP_ALLOC_PREFIX, _malloc_array_at_least)
+    #define pottery_cphm_alloc_impl_malloc_array_at_least_ea POTTERY_CONCAT(POTTERY_COMPACT_HASH_MAP_ALLOC_PREFIX, _impl_malloc_array_at_least_ea)
+    #define pottery_cphm_alloc_impl_malloc_array_at_least_fa POTTERY_CONCAT(POTTERY_COMPACT_HASH_MAP_ALLOC_PREFIX, _impl_malloc_array_at_least_fa)
+
+    #define pottery_cphm_alloc_malloc_array POTTERY_CONCAT(POTTERY_COMPACT_HASH_MAP_ALLOC_PREFIX, _malloc_array)
+    #define pottery_cphm_alloc_malloc_array_zero POTTERY_CONCAT(POTTERY_COMPACT_HASH_MAP_ALLOC_PREFIX, _malloc_array_zero)
+//!!! END_AUTOGENERATED
+
+
+
+// container types
+//!!! AUTOGENERATED:container_types/rename.m.h SRC:pottery_cphm DEST:POTTERY_COMPACT_HASH_MAP_PREFIX
+    // This block is auto-generated. Do not modify until END_AUTOGENERATED.
+    // Renames container_types template identifiers from pottery_cphm to POTTERY_COMPACT_HASH_MAP_PREFIX
+
+    #define pottery_cphm_value_t POTTERY_CONCAT(POTTERY_COMPACT_HASH_MAP_PREFIX, _value_t)
+    #define pottery_cphm_ref_t POTTERY_CONCAT(POTTERY_COMPACT_HASH_MAP_PREFIX, _ref_t)
+    #define pottery_cphm_const_ref_t POTTERY_CONCAT(POTTERY_COMPACT_HASH_MAP_PREFIX, _const_ref_t)
+    #define pottery_cphm_key_t POTTERY_CONCAT(POTTERY_COMPACT_HASH_MAP_PREFIX, _key_t)
+    #define pottery_cphm_context_t POTTERY_CONCAT(POTTERY_COMPACT_HASH_MAP_PREFIX, _context_t)
+
+    #define pottery_cphm_ref_key POTTERY_CONCAT(POTTERY_COMPACT_HASH_MAP_PREFIX, _ref_key)
+    #define pottery_cphm_ref_equal POTTERY_CONCAT(POTTERY_COMPACT_HASH_MAP_PREFIX, _ref_equal)
+//!!! END_AUTOGENERATED
+
+
+
+// lifecycle functions
+#define POTTERY_COMPACT_HASH_MAP_LIFECYCLE_PREFIX POTTERY_COMPACT_HASH_MAP_NAME(_lifecycle)
+//!!! AUTOGENERATED:lifecycle/rename.m.h SRC:pottery_cphm_lifecycle DEST:POTTERY_COMPACT_HASH_MAP_LIFECYCLE_PREFIX
+    // This block is auto-generated. Do not modify until END_AUTOGENERATED.
+    // Renames lifecycle identifiers from pottery_cphm_lifecycle to POTTERY_COMPACT_HASH_MAP_LIFECYCLE_PREFIX
+
+    #define pottery_cphm_lifecycle_init_steal POTTERY_CONCAT(POTTERY_COMPACT_HASH_MAP_LIFECYCLE_PREFIX, _init_steal)
+    #define pottery_cphm_lifecycle_init_copy POTTERY_CONCAT(POTTERY_COMPACT_HASH_MAP_LIFECYCLE_PREFIX, _init_copy)
+    #define pottery_cphm_lifecycle_init POTTERY_CONCAT(POTTERY_COMPACT_HASH_MAP_LIFECYCLE_PREFIX, _init)
+    #define pottery_cphm_lifecycle_destroy POTTERY_CONCAT(POTTERY_COMPACT_HASH_MAP_LIFECYCLE_PREFIX, _destroy)
+
+    #define pottery_cphm_lifecycle_swap POTTERY_CONCAT(POTTERY_COMPACT_HASH_MAP_LIFECYCLE_PREFIX, _swap)
+    #define pottery_cphm_lifecycle_move POTTERY_CONCAT(POTTERY_COMPACT_HASH_MAP_LIFECYCLE_PREFIX, _move)
+    #define pottery_cphm_lifecycle_steal POTTERY_CONCAT(POTTERY_COMPACT_HASH_MAP_LIFECYCLE_PREFIX, _steal)
+    #define pottery_cphm_lifecycle_copy POTTERY_CONCAT(POTTERY_COMPACT_HASH_MAP_LIFECYCLE_PREFIX, _copy)
+    #define pottery_cphm_lifecycle_swap_restrict POTTERY_CONCAT(POTTERY_COMPACT_HASH_MAP_LIFECYCLE_PREFIX, _swap_restrict)
+    #define pottery_cphm_lifecycle_move_restrict POTTERY_CONCAT(POTTERY_COMPACT_HASH_MAP_LIFECYCLE_PREFIX, _move_restrict)
+    #define pottery_cphm_lifecycle_steal_restrict POTTERY_CONCAT(POTTERY_COMPACT_HASH_MAP_LIFECYCLE_PREFIX, _steal_restrict)
+    #define pottery_cphm_lifecycle_copy_restrict POTTERY_CONCAT(POTTERY_COMPACT_HASH_MAP_LIFECYCLE_PREFIX, _copy_restrict)
+
+    #define pottery_cphm_lifecycle_destroy_bulk POTTERY_CONCAT(POTTERY_COMPACT_HASH_MAP_LIFECYCLE_PREFIX, _destroy_bulk)
+    #define pottery_cphm_lifecycle_move_bulk POTTERY_CONCAT(POTTERY_COMPACT_HASH_MAP_LIFECYCLE_PREFIX, _move_bulk)
+    #define pottery_cphm_lifecycle_move_bulk_restrict POTTERY_CONCAT(POTTERY_COMPACT_HASH_MAP_LIFECYCLE_PREFIX, _move_bulk_restrict)
+    #define pottery_cphm_lifecycle_move_bulk_restrict_impl POTTERY_CONCAT(POTTERY_COMPACT_HASH_MAP_LIFECYCLE_PREFIX, _move_bulk_restrict_impl)
+    #define pottery_cphm_lifecycle_move_bulk_up POTTERY_CONCAT(POTTERY_COMPACT_HASH_MAP_LIFECYCLE_PREFIX, _move_bulk_up)
+    #define pottery_cphm_lifecycle_move_bulk_up_impl POTTERY_CONCAT(POTTERY_COMPACT_HASH_MAP_LIFECYCLE_PREFIX, _move_bulk_up_impl)
+    #define pottery_cphm_lifecycle_move_bulk_down POTTERY_CONCAT(POTTERY_COMPACT_HASH_MAP_LIFECYCLE_PREFIX, _move_bulk_down)
+    #define pottery_cphm_lifecycle_move_bulk_down_impl POTTERY_CONCAT(POTTERY_COMPACT_HASH_MAP_LIFECYCLE_PREFIX, _move_bulk_down_impl)
+//!!! END_AUTOGENERATED
@@ -0,0 +1,227 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2020-2021 11037650 Canada Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef POTTERY_COMPACT_HASH_MAP_IMPL
+#error "This is an internal header. Do not include it."
+#endif
+
+
+
+/*
+ * Configuration
+ */
+
+#undef POTTERY_COMPACT_HASH_MAP_PREFIX
+#undef POTTERY_COMPACT_HASH_MAP_EXTERN
+#undef POTTERY_COMPACT_HASH_MAP_KEY_HASH
+#undef POTTERY_COMPACT_HASH_MAP_KEY_EQUAL
+#undef POTTERY_COMPACT_HASH_MAP_MAX_LOAD_FACTOR_NUMERATOR
+#undef POTTERY_COMPACT_HASH_MAP_MAX_LOAD_FACTOR_DENOMINATOR
+#undef POTTERY_COMPACT_HASH_MAP_MIN_LOAD_FACTOR_NUMERATOR
+#undef POTTERY_COMPACT_HASH_MAP_MIN_LOAD_FACTOR_DENOMINATOR
+#undef POTTERY_COMPACT_HASH_MAP_MINIMUM_LOG_2_SIZE
+#undef POTTERY_COMPACT_HASH_MAP_CAN_DESTROY
+
+
+
+/*
+ * Renaming
+ */
+
+#undef POTTERY_COMPACT_HASH_MAP_NAME
+
+#undef pottery_cphm_t
+#undef pottery_cphm_entry_t
+#undef pottery_cphm_bucket_count
+#undef pottery_cphm_capacity
+#undef pottery_cphm_min_count
+#undef pottery_cphm_impl_index_width
+#undef pottery_cphm_impl_get_index
+#undef pottery_cphm_impl_set_index
+#undef pottery_cphm_impl_home
+#undef pottery_cphm_impl_hole_words
+#undef pottery_cphm_impl_is_hole
+#undef pottery_cphm_impl_set_hole
+#undef pottery_cphm_impl_alloc
+#undef pottery_cphm_impl_free
+#undef pottery_cphm_impl_probe
+#undef pottery_cphm_impl_bucket_of
+#undef pottery_cphm_impl_insert_index
+#undef pottery_cphm_impl_unlink
+#undef pottery_cphm_impl_rebuild
+#undef pottery_cphm_impl_make_room
+#undef pottery_cphm_shrink_if_needed
+#undef pottery_cphm_impl_scan_forward
+#undef pottery_cphm_impl_scan_backward
+#undef pottery_cphm_impl_key_hash
+#undef pottery_cphm_impl_key_equal
+#undef pottery_cphm_impl_key
+#undef pottery_cphm_init
+#undef pottery_cphm_destroy
+#undef pottery_cphm_emplace_key
+#undef pottery_cphm_find
+#undef pottery_cphm_contains_key
+#undef pottery_cphm_count
+#undef pottery_cphm_is_empty
+#undef pottery_cphm_reserve
+#undef pottery_cphm_displace
+#undef pottery_cphm_displace_all
+#undef pottery_cphm_remove
+#undef pottery_cphm_remove_all
+#undef pottery_cphm_remove_key
+#undef pottery_cphm_entry_exists
+#undef pottery_cphm_entry_ref
+#undef pottery_cphm_begin
+#undef pottery_cphm_end
+#undef pottery_cphm_first
+#undef pottery_cphm_last
+#undef pottery_cphm_next
+#undef pottery_cphm_previous
+
+#undef POTTERY_COMPACT_HASH_MAP_ALLOC_PREFIX
+//!!! AUTOGENERATED:alloc/unrename.m.h PREFIX:pottery_cphm_alloc
+    // This block is auto-generated. Do not modify until END_AUTOGENERATED.
+    // Un-renames alloc identifiers with prefix "pottery_cphm_alloc"
+
+    #undef pottery_cphm_alloc_free
+    #undef pottery_cphm_alloc_impl_free_ea
+    #undef pottery_cphm_alloc_impl_free_fa
+
+    #undef pottery_cphm_alloc_malloc
+    #undef pottery_cphm_alloc_impl_malloc_ea
+    #undef pottery_cphm_alloc_impl_malloc_fa
+
+    #undef pottery_cphm_alloc_malloc_zero
+    #undef pottery_cphm_alloc_impl_malloc_zero_ea
+    #undef pottery_cphm_alloc_impl_malloc_zero_fa
+    #undef pottery_cphm_alloc_impl_malloc_zero_fa_wrap
+
+    #undef pottery_cphm_alloc_malloc_array_at_least
+    #undef pottery_cphm_alloc_impl_malloc_array_at_least_ea
+    #undef pottery_cphm_alloc_impl_malloc_array_at_least_fa
+
+    #undef pottery_cphm_alloc_malloc_array
+    #undef pottery_cphm_alloc_malloc_array_zero
+//!!! END_AUTOGENERATED
+
+//!!! AUTOGENERATED:alloc/unconfigure.m.h PREFIX:POTTERY_COMPACT_HASH_MAP_ALLOC
+    // This block is auto-generated. Do not modify until END_AUTOGENERATED.
+    // Undefines (forwardable/forwarded) alloc configuration on POTTERY_COMPACT_HASH_MAP_ALLOC
+    #undef POTTERY_COMPACT_HASH_MAP_ALLOC_CONTEXT_TYPE
+
+    #undef POTTERY_COMPACT_HASH_MAP_ALLOC_FREE
+    #undef POTTERY_COMPACT_HASH_MAP_ALLOC_MALLOC
+    #undef POTTERY_COMPACT_HASH_MAP_ALLOC_ZALLOC
+    #undef POTTERY_COMPACT_HASH_MAP_ALLOC_REALLOC
+    #undef POTTERY_COMPACT_HASH_MAP_ALLOC_MALLOC_GOOD_SIZE
+
+    #undef POTTERY_COMPACT_HASH_MAP_ALLOC_ALIGNED_FREE
+    #undef POTTERY_COMPACT_HASH_MAP_ALLOC_ALIGNED_MALLOC
+    #undef POTTERY_COMPACT_HASH_MAP_ALLOC_ALIGNED_ZALLOC
+    #undef POTTERY_COMPACT_HASH_MAP_ALLOC_ALIGNED_REALLOC
+    #undef POTTERY_COMPACT_HASH_MAP_ALLOC_ALIGNED_MALLOC_GOOD_SIZE
+//!!! END_AUTOGENERATED
+
+//!!! AUTOGENERATED:container_types/unrename.m.h PREFIX:pottery_cphm
+    // This block is auto-generated. Do not modify until END_AUTOGENERATED.
+    // Unrenames container_types template identifiers from pottery_cphm
+
+    #undef pottery_cphm_value_t
+    #undef pottery_cphm_ref_t
+    #undef pottery_cphm_const_ref_t
+    #undef pottery_cphm_key_t
+    #undef pottery_cphm_context_t
+
+    #undef pottery_cphm_ref_key
+    #undef pottery_cphm_ref_equal
+//!!! END_AUTOGENERATED
+
+//!!! AUTOGENERATED:container_types/unconfigure.m.h CONFIG:POTTERY_COMPACT_HASH_MAP
+    // This block is auto-generated. Do not modify until END_AUTOGENERATED.
+    // Undefines (forwardable/forwarded) container_types configuration on POTTERY_COMPACT_HASH_MAP
+
+    // types
+    #undef POTTERY_COMPACT_HASH_MAP_VALUE_TYPE
+    #undef POTTERY_COMPACT_HASH_MAP_REF_TYPE
+    #undef POTTERY_COMPACT_HASH_MAP_ENTRY_TYPE
+    #undef POTTERY_COMPACT_HASH_MAP_KEY_TYPE
+    #undef POTTERY_COMPACT_HASH_MAP_CONTEXT_TYPE
+
+    // Conversion and comparison expressions
+    #undef POTTERY_COMPACT_HASH_MAP_ENTRY_REF
+    #undef POTTERY_COMPACT_HASH_MAP_REF_KEY
+    #undef POTTERY_COMPACT_HASH_MAP_REF_EQUAL
+//!!! END_AUTOGENERATED
+
+#undef POTTERY_COMPACT_HASH_MAP_LIFECYCLE_PREFIX
+//!!! AUTOGENERATED:lifecycle/unrename.m.h PREFIX:pottery_cphm_lifecycle
+    // This block is auto-generated. Do not modify until END_AUTOGENERATED.
+    // Un-renames lifecycle identifiers with prefix "pottery_cphm_lifecycle"
+
+    #undef pottery_cphm_lifecycle_init_steal
+    #undef pottery_cphm_lifecycle_init_copy
+    #undef pottery_cphm_lifecycle_init
+    #undef pottery_cphm_lifecycle_destroy
+    #undef pottery_cphm_lifecycle_swap
+    #undef pottery_cphm_lifecycle_move
+    #undef pottery_cphm_lifecycle_steal
+    #undef pottery_cphm_lifecycle_copy
+
+    #undef pottery_cphm_lifecycle_move_bulk
+    #undef pottery_cphm_lifecycle_move_bulk_restrict
+    #undef pottery_cphm_lifecycle_move_bulk_restrict_impl
+    #undef pottery_cphm_lifecycle_move_bulk_up
+    #undef pottery_cphm_lifecycle_move_bulk_up_impl
+    #undef pottery_cphm_lifecycle_move_bulk_down
+    #undef pottery_cphm_lifecycle_move_bulk_down_impl
+    #undef pottery_cphm_lifecycle_destroy_bulk
+//!!! END_AUTOGENERATED
+
+//!!! AUTOGENERATED:lifecycle/unconfigure.m.h PREFIX:POTTERY_COMPACT_HASH_MAP_LIFECYCLE
+    // This block is auto-generated. Do not modify until END_AUTOGENERATED.
+
+    // Undefines (forwardable/forwarded) lifecycle configuration on POTTERY_COMPACT_HASH_MAP_LIFECYCLE
+
+    #undef POTTERY_COMPACT_HASH_MAP_LIFECYCLE_BY_VALUE
+    #undef POTTERY_COMPACT_HASH_MAP_LIFECYCLE_DESTROY
+    #undef POTTERY_COMPACT_HASH_MAP_LIFECYCLE_DESTROY_BY_VALUE
+    #undef POTTERY_COMPACT_HASH_MAP_LIFECYCLE_INIT
+    #undef POTTERY_COMPACT_HASH_MAP_LIFECYCLE_INIT_BY_VALUE
+    #undef POTTERY_COMPACT_HASH_MAP_LIFECYCLE_INIT_COPY
+    #undef POTTERY_COMPACT_HASH_MAP_LIFECYCLE_INIT_COPY_BY_VALUE
+    #undef POTTERY_COMPACT_HASH_MAP_LIFECYCLE_INIT_STEAL
+    #undef POTTERY_COMPACT_HASH_MAP_LIFECYCLE_INIT_STEAL_BY_VALUE
+    #undef POTTERY_COMPACT_HASH_MAP_LIFECYCLE_MOVE
+    #undef POTTERY_COMPACT_HASH_MAP_LIFECYCLE_MOVE_BY_VALUE
+    #undef POTTERY_COMPACT_HASH_MAP_LIFECYCLE_COPY
+    #undef POTTERY_COMPACT_HASH_MAP_LIFECYCLE_COPY_BY_VALUE
+    #undef POTTERY_COMPACT_HASH_MAP_LIFECYCLE_STEAL
+    #undef POTTERY_COMPACT_HASH_MAP_LIFECYCLE_STEAL_BY_VALUE
+    #undef POTTERY_COMPACT_HASH_MAP_LIFECYCLE_SWAP
+    #undef POTTERY_COMPACT_HASH_MAP_LIFECYCLE_SWAP_BY_VALUE
+//!!! END_AUTOGENERATED
+
+
+
+#include "pottery/platform/pottery_platform_pragma_pop.t.h"
@@ -0,0 +1,202 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2020-2021 11037650 Canada Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef POTTERY_CUCKOO_HASH_MAP_IMPL
+#error "This is an internal header. Do not include it."
+#endif
+
+typedef pottery_chm_ref_t pottery_chm_entry_t;
+
+/*
+ * A bucket of values.
+ *
+ * The tag of each slot is zero if the slot is empty; otherwise it's an 8-bit
+ * fingerprint of the hash of its value's key. We compare tags before keys so
+ * we rarely compare keys that don't match, and the tag also determines the
+ * alternate bucket of a value so values can be displaced without re-hashing
+ * their keys.
+ */
+typedef struct pottery_chm_bucket_t {
+    uint8_t tags[POTTERY_CUCKOO_HASH_MAP_BUCKET_SLOTS];
+    pottery_chm_value_t values[POTTERY_CUCKOO_HASH_MAP_BUCKET_SLOTS];
+} pottery_chm_bucket_t;
+
+typedef struct pottery_chm_t {
+    void* allocation;
+    char* buckets; // aligned within the allocation
+    size_t log_2_size;
+    size_t count;
+} pottery_chm_t;
+
+POTTERY_CUCKOO_HASH_MAP_EXTERN
+pottery_error_t pottery_chm_init(pottery_chm_t* map);
+
+POTTERY_CUCKOO_HASH_MAP_EXTERN
+void pottery_chm_destroy(pottery_chm_t* map);
+
+/**
+ * Finds the value with the given key or creates a slot for it.
+ *
+ * If the key does not exist, the returned entry is uninitialized and you must
+ * construct a value with the given key in it.
+ *
+ * This returns POTTERY_ERROR_FULL if the map can't make room for the key
+ * because too many keys collide. This can only happen with a very poor hash
+ * function (or a hostile one.)
+ */
+POTTERY_CUCKOO_HASH_MAP_EXTERN
+pottery_error_t pottery_chm_emplace_key(pottery_chm_t* map, pottery_chm_key_t key,
+        pottery_chm_entry_t* entry, bool* /*nullable*/ created);
+
+/**
+ * Returns the entry for the given key, or an entry that doesn't exist if the
+ * key is not in the map.
+ *
+ * This examines at most two buckets.
+ */
+POTTERY_CUCKOO_HASH_MAP_EXTERN
+pottery_chm_entry_t pottery_chm_find(pottery_chm_t* map, pottery_chm_key_t key);
+
+static inline
+bool pottery_chm_entry_exists(pottery_chm_t* map, pottery_chm_entry_t entry) {
+    (void)map;
+    return entry != pottery_null;
+}
+
+static inline
+pottery_chm_value_t* pottery_chm_entry_ref(pottery_chm_t* map, pottery_chm_entry_t entry) {
+    (void)map;
+    return entry;
+}
+
+/**
+ * Returns true if there is a value in the map with this key.
+ */
+static inline
+bool pottery_chm_contains_key(pottery_chm_t* map, pottery_chm_key_t key) {
+    return pottery_chm_entry_exists(map, pottery_chm_find(map, key));
+}
+
+static inline
+size_t pottery_chm_count(pottery_chm_t* map) {
+    return map->count;
+}
+
+static inline
+bool pottery_chm_is_empty(pottery_chm_t* map) {
+    return map->count == 0;
+}
+
+/**
+ * Returns the number of buckets currently in the map.
+ */
+static inline
+size_t pottery_chm_bucket_count(pottery_chm_t* map) {
+    return pottery_cast(size_t, 1) << map->log_2_size;
+}
+
+// Returns the number of slots in all buckets.
+static inline
+size_t pottery_chm_bucket_slots(pottery_chm_t* map) {
+    return pottery_chm_bucket_count(map) * POTTERY_CUCKOO_HASH_MAP_BUCKET_SLOTS;
+}
+
+/**
+ * Returns the current capacity of the map, i.e. the number of slots times the
+ * max load factor.
+ */
+static inline
+size_t pottery_chm_capacity(pottery_chm_t* map) {
+    size_t slots = pottery_chm_bucket_slots(map);
+    return (slots / POTTERY_CUCKOO_HASH_MAP_MAX_LOAD_FACTOR_DENOMINATOR) *
+                POTTERY_CUCKOO_HASH_MAP_MAX_LOAD_FACTOR_NUMERATOR +
+            (slots % POTTERY_CUCKOO_HASH_MAP_MAX_LOAD_FACTOR_DENOMINATOR) *
+                POTTERY_CUCKOO_HASH_MAP_MAX_LOAD_FACTOR_NUMERATOR /
+                POTTERY_CUCKOO_HASH_MAP_MAX_LOAD_FACTOR_DENOMINATOR;
+}
+
+// Returns the count below which the map will shrink.
+static inline
+size_t pottery_chm_min_count(pottery_chm_t* map) {
+    size_t slots = pottery_chm_bucket_slots(map);
+    return (slots / POTTERY_CUCKOO_HASH_MAP_MIN_LOAD_FACTOR_DENOMINATOR) *
+                POTTERY_CUCKOO_HASH_MAP_MIN_LOAD_FACTOR_NUMERATOR +
+            (slots % POTTERY_CUCKOO_HASH_MAP_MIN_LOAD_FACTOR_DENOMINATOR) *
+                POTTERY_CUCKOO_HASH_MAP_MIN_LOAD_FACTOR_NUMERATOR /
+                POTTERY_CUCKOO_HASH_MAP_MIN_LOAD_FACTOR_DENOMINATOR;
+}
+
+POTTERY_CUCKOO_HASH_MAP_EXTERN
+void pottery_chm_displace(pottery_chm_t* map, pottery_chm_entry_t entry);
+
+POTTERY_CUCKOO_HASH_MAP_EXTERN
+void pottery_chm_displace_all(pottery_chm_t* map);
+
+#if POTTERY_CUCKOO_HASH_MAP_CAN_DESTROY
+POTTERY_CUCKOO_HASH_MAP_EXTERN
+void pottery_chm_remove(pottery_chm_t* map, pottery_chm_entry_t entry);
+
+POTTERY_CUCKOO_HASH_MAP_EXTERN
+void pottery_chm_remove_all(pottery_chm_t* map);
+
+/**
+ * Returns true if an entry matching the given key was removed.
+ */
+POTTERY_CUCKOO_HASH_MAP_EXTERN
+bool pottery_chm_remove_key(pottery_chm_t* map, pottery_chm_key_t key);
+#endif
+
+
+
+/*
+ * Iteration
+ *
+ * Values are visited in bucket order. Inserting or removing values
+ * invalidates all entries (values can be displaced to other buckets.)
+ */
+
+POTTERY_CUCKOO_HASH_MAP_EXTERN
+pottery_chm_entry_t pottery_chm_begin(pottery_chm_t* map);
+
+static inline
+pottery_chm_entry_t pottery_chm_end(pottery_chm_t* map) {
+    (void)map;
+    return pottery_null;
+}
+
+static inline
+pottery_chm_entry_t pottery_chm_first(pottery_chm_t* map) {
+    pottery_chm_entry_t entry = pottery_chm_begin(map);
+    pottery_assert(pottery_chm_entry_exists(map, entry));
+    return entry;
+}
+
+POTTERY_CUCKOO_HASH_MAP_EXTERN
+pottery_chm_entry_t pottery_chm_last(pottery_chm_t* map);
+
+POTTERY_CUCKOO_HASH_MAP_EXTERN
+pottery_chm_entry_t pottery_chm_next(pottery_chm_t* map, pottery_chm_entry_t entry);
+
+POTTERY_CUCKOO_HASH_MAP_EXTERN
+pottery_chm_entry_t pottery_chm_previous(pottery_chm_t* map, pottery_chm_entry_t entry);
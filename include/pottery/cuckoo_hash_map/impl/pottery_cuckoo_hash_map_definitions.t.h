@@ -0,0 +1,664 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2020-2021 11037650 Canada Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef POTTERY_CUCKOO_HASH_MAP_IMPL
+#error "This is an internal header. Do not include it."
+#endif
+
+// Default to 4 buckets (16 slots with the default bucket size)
+#define POTTERY_CUCKOO_HASH_MAP_MINIMUM_LOG_2_SIZE 2
+
+static inline
+size_t pottery_chm_impl_key_hash(pottery_chm_key_t key) {
+    return POTTERY_CUCKOO_HASH_MAP_KEY_HASH(key);
+}
+
+static inline
+bool pottery_chm_impl_key_equal(pottery_chm_key_t left, pottery_chm_key_t right) {
+    return POTTERY_CUCKOO_HASH_MAP_KEY_EQUAL(left, right);
+}
+
+static inline
+pottery_chm_key_t pottery_chm_impl_key(pottery_chm_value_t* value) {
+    return pottery_chm_ref_key(value);
+}
+
+
+
+/*
+ * Buckets
+ *
+ * Buckets are stored in a single allocation. The start of the buckets is
+ * aligned to BUCKET_ALIGNMENT and buckets are padded so that each one starts
+ * on an alignment boundary or is contained entirely between two. With the
+ * default alignment and small values, every bucket is exactly one cache line
+ * so a lookup touches at most two cache lines.
+ */
+
+// Returns the distance in bytes between the start of consecutive buckets.
+// This is a constant so the compiler should fold it.
+static inline
+size_t pottery_chm_impl_stride(void) {
+    size_t size = sizeof(pottery_chm_bucket_t);
+    size_t stride = 1;
+    if (size >= POTTERY_CUCKOO_HASH_MAP_BUCKET_ALIGNMENT)
+        return (size + POTTERY_CUCKOO_HASH_MAP_BUCKET_ALIGNMENT - 1) &
+                ~pottery_cast(size_t, POTTERY_CUCKOO_HASH_MAP_BUCKET_ALIGNMENT - 1);
+    while (stride < size)
+        stride <<= 1;
+    return stride;
+}
+
+static inline
+pottery_chm_bucket_t* pottery_chm_impl_bucket(char* buckets, size_t index) {
+    return pottery_reinterpret_cast(pottery_chm_bucket_t*,
+            buckets + index * pottery_chm_impl_stride());
+}
+
+// Returns the index of the bucket containing the given entry, storing the
+// index of its slot in the given slot.
+static inline
+size_t pottery_chm_impl_bucket_index(pottery_chm_t* map, pottery_chm_entry_t entry, size_t* slot) {
+    size_t index = pottery_cast(size_t, pottery_reinterpret_cast(char*, entry) - map->buckets) /
+            pottery_chm_impl_stride();
+    *slot = pottery_cast(size_t, entry - pottery_chm_impl_bucket(map->buckets, index)->values);
+    pottery_assert(*slot < POTTERY_CUCKOO_HASH_MAP_BUCKET_SLOTS);
+    return index;
+}
+
+// Allocates zeroed (i.e. empty) buckets.
+static
+pottery_error_t pottery_chm_impl_alloc(size_t log_2_size, void** allocation, char** buckets) {
+    size_t stride = pottery_chm_impl_stride();
+    size_t extra = (POTTERY_CUCKOO_HASH_MAP_BUCKET_ALIGNMENT + stride - 1) / stride;
+    uintptr_t address;
+
+    if (log_2_size >= 8 * sizeof(size_t) - 1)
+        return POTTERY_ERROR_OVERFLOW;
+
+    // We allocate a bit extra so we can align the buckets.
+    *allocation = pottery_chm_alloc_malloc_array_zero(
+            pottery_alignof(pottery_chm_bucket_t),
+            (pottery_cast(size_t, 1) << log_2_size) + extra,
+            stride);
+    if (*allocation == pottery_null)
+        return POTTERY_ERROR_ALLOC;
+
+    address = pottery_reinterpret_cast(uintptr_t, *allocation);
+    address = (address + POTTERY_CUCKOO_HASH_MAP_BUCKET_ALIGNMENT - 1) &
+            ~pottery_cast(uintptr_t, POTTERY_CUCKOO_HASH_MAP_BUCKET_ALIGNMENT - 1);
+    *buckets = pottery_reinterpret_cast(char*, address);
+    return POTTERY_OK;
+}
+
+static inline
+void pottery_chm_impl_free(void* allocation) {
+    pottery_chm_alloc_free(pottery_alignof(pottery_chm_bucket_t), allocation);
+}
+
+
+
+/*
+ * Hashing
+ *
+ * This is partial-key cuckoo hashing. The primary bucket of a key comes from
+ * a multiplicative hash of its hash. Its alternate bucket is the primary
+ * bucket xor a multiplicative hash of its tag, which is an 8-bit fingerprint
+ * taken from an independent mix of its hash. We can therefore compute the
+ * other bucket of any value from the bucket it's in and its tag alone.
+ */
+
+static inline
+uint8_t pottery_chm_impl_tag(size_t hash) {
+    // The MurmurHash3 finalizer
+    uint64_t x = pottery_cast(uint64_t, hash);
+    uint8_t tag;
+    x ^= x >> 33;
+    x *= UINT64_C(0xff51afd7ed558ccd);
+    x ^= x >> 33;
+    x *= UINT64_C(0xc4ceb9fe1a85ec53);
+    x ^= x >> 33;
+    tag = pottery_cast(uint8_t, x >> 56);
+
+    // Zero means empty.
+    return (tag == 0) ? 1 : tag;
+}
+
+static inline
+size_t pottery_chm_impl_primary(size_t log_2_size, size_t hash) {
+    return pottery_knuth_hash_s(hash, log_2_size);
+}
+
+// Returns the other bucket of a value with the given tag in the given bucket.
+static inline
+size_t pottery_chm_impl_alternate(size_t log_2_size, size_t index, uint8_t tag) {
+    size_t offset = pottery_knuth_hash_s(tag, log_2_size);
+    return index ^ ((offset == 0) ? 1 : offset);
+}
+
+static inline
+pottery_chm_entry_t pottery_chm_impl_find_in_bucket(pottery_chm_bucket_t* bucket,
+        uint8_t tag, pottery_chm_key_t key)
+{
+    size_t i;
+    for (i = 0; i < POTTERY_CUCKOO_HASH_MAP_BUCKET_SLOTS; ++i)
+        if (bucket->tags[i] == tag &&
+                pottery_chm_impl_key_equal(key, pottery_chm_impl_key(bucket->values + i)))
+            return bucket->values + i;
+    return pottery_null;
+}
+
+// Returns the index of a free slot in the bucket, or BUCKET_SLOTS if it's
+// full.
+static inline
+size_t pottery_chm_impl_free_slot(pottery_chm_bucket_t* bucket) {
+    size_t i;
+    for (i = 0; i < POTTERY_CUCKOO_HASH_MAP_BUCKET_SLOTS; ++i)
+        if (bucket->tags[i] == 0)
+            break;
+    return i;
+}
+
+
+
+/*
+ * Displacement
+ *
+ * When both buckets of a new key are full, we search breadth-first through
+ * the alternate buckets of the values in them (and so on) for a free slot.
+ * This finds the shortest path of displacements. Each node of the search is a
+ * bucket along with the slot in its parent bucket whose value would move into
+ * it.
+ *
+ * Once we find a free slot we move the values along the path backwards,
+ * starting with the value that moves into the free slot, so each value moves
+ * into a slot that was just vacated. This leaves a free slot in one of the
+ * buckets of the new key.
+ *
+ * The same search is used to plan where values go when rehashing. In that
+ * case we move entries of the plan instead of values.
+ */
+
+typedef struct pottery_chm_impl_node_t {
+    size_t bucket;
+    uint16_t parent; // SEARCH_LIMIT for the two root buckets
+    uint8_t slot;
+} pottery_chm_impl_node_t;
+
+typedef struct pottery_chm_impl_path_t {
+    pottery_chm_impl_node_t nodes[POTTERY_CUCKOO_HASH_MAP_SEARCH_LIMIT];
+    size_t leaf;       // the node whose value moves into the free slot
+    size_t leaf_slot;  // the slot of that value
+    size_t free_bucket;
+    size_t free_slot;
+} pottery_chm_impl_path_t;
+
+// Returns true if the given bucket is on the path from a root to the given
+// node. A path must not visit the same bucket twice, otherwise a value could
+// be moved out of a slot after something else was moved into it.
+static inline
+bool pottery_chm_impl_on_path(pottery_chm_impl_path_t* path, size_t node, size_t bucket) {
+    while (true) {
+        if (path->nodes[node].bucket == bucket)
+            return true;
+        if (path->nodes[node].parent == POTTERY_CUCKOO_HASH_MAP_SEARCH_LIMIT)
+            return false;
+        node = path->nodes[node].parent;
+    }
+}
+
+// Searches for a path of displacements from the two given (full) buckets to
+// a free slot. Returns false if none was found within the search limit.
+static
+bool pottery_chm_impl_search(char* buckets, size_t log_2_size,
+        size_t first, size_t second, pottery_chm_impl_path_t* path)
+{
+    size_t head;
+    size_t tail = 2;
+
+    path->nodes[0].bucket = first;
+    path->nodes[0].parent = POTTERY_CUCKOO_HASH_MAP_SEARCH_LIMIT;
+    path->nodes[0].slot = 0;
+    path->nodes[1].bucket = second;
+    path->nodes[1].parent = POTTERY_CUCKOO_HASH_MAP_SEARCH_LIMIT;
+    path->nodes[1].slot = 0;
+
+    for (head = 0; head < tail; ++head) {
+        size_t index = path->nodes[head].bucket;
+        pottery_chm_bucket_t* bucket = pottery_chm_impl_bucket(buckets, index);
+        size_t slot;
+
+        for (slot = 0; slot < POTTERY_CUCKOO_HASH_MAP_BUCKET_SLOTS; ++slot) {
+            size_t alternate = pottery_chm_impl_alternate(log_2_size, index, bucket->tags[slot]);
+            size_t free_slot = pottery_chm_impl_free_slot(pottery_chm_impl_bucket(buckets, alternate));
+            if (free_slot != POTTERY_CUCKOO_HASH_MAP_BUCKET_SLOTS) {
+                path->leaf = head;
+                path->leaf_slot = slot;
+                path->free_bucket = alternate;
+                path->free_slot = free_slot;
+                return true;
+            }
+
+            if (tail < POTTERY_CUCKOO_HASH_MAP_SEARCH_LIMIT &&
+                    !pottery_chm_impl_on_path(path, head, alternate))
+            {
+                path->nodes[tail].bucket = alternate;
+                path->nodes[tail].parent = pottery_cast(uint16_t, head);
+                path->nodes[tail].slot = pottery_cast(uint8_t, slot);
+                ++tail;
+            }
+        }
+    }
+
+    return false;
+}
+
+// Moves a value (or, if plan is not null, an entry of the plan) and its tag
+// to an empty slot.
+static inline
+void pottery_chm_impl_move(char* buckets, size_t* /*nullable*/ plan,
+        size_t to_index, size_t to_slot, size_t from_index, size_t from_slot)
+{
+    pottery_chm_bucket_t* to = pottery_chm_impl_bucket(buckets, to_index);
+    pottery_chm_bucket_t* from = pottery_chm_impl_bucket(buckets, from_index);
+    pottery_assert(to->tags[to_slot] == 0);
+
+    if (plan != pottery_null)
+        plan[to_index * POTTERY_CUCKOO_HASH_MAP_BUCKET_SLOTS + to_slot] =
+                plan[from_index * POTTERY_CUCKOO_HASH_MAP_BUCKET_SLOTS + from_slot];
+    else
+        pottery_chm_lifecycle_move_restrict(to->values + to_slot, from->values + from_slot);
+
+    to->tags[to_slot] = from->tags[from_slot];
+    from->tags[from_slot] = 0;
+}
+
+// Makes room for a new value with the given tag in one of the given buckets,
+// displacing other values if necessary, and sets the tag of its slot.
+//
+// Returns the position of the slot (the bucket index times BUCKET_SLOTS plus
+// the slot index), or SIZE_MAX if no room could be made.
+static
+size_t pottery_chm_impl_insert_new(char* buckets, size_t log_2_size,
+        size_t first, size_t second, uint8_t tag, size_t* /*nullable*/ plan)
+{
+    pottery_chm_impl_path_t path;
+    size_t index = first;
+    size_t slot = pottery_chm_impl_free_slot(pottery_chm_impl_bucket(buckets, first));
+    size_t node;
+
+    if (slot == POTTERY_CUCKOO_HASH_MAP_BUCKET_SLOTS) {
+        index = second;
+        slot = pottery_chm_impl_free_slot(pottery_chm_impl_bucket(buckets, second));
+    }
+
+    if (slot == POTTERY_CUCKOO_HASH_MAP_BUCKET_SLOTS) {
+        if (!pottery_chm_impl_search(buckets, log_2_size, first, second, &path))
+            return SIZE_MAX;
+
+        // Walk the path backwards. Each value moves into the slot vacated by
+        // the one before it.
+        index = path.free_bucket;
+        slot = path.free_slot;
+        node = path.leaf;
+        pottery_chm_impl_move(buckets, plan, index, slot,
+                path.nodes[node].bucket, path.leaf_slot);
+        index = path.nodes[node].bucket;
+        slot = path.leaf_slot;
+        while (path.nodes[node].parent != POTTERY_CUCKOO_HASH_MAP_SEARCH_LIMIT) {
+            size_t parent = path.nodes[node].parent;
+            pottery_chm_impl_move(buckets, plan, index, slot,
+                    path.nodes[parent].bucket, path.nodes[node].slot);
+            index = path.nodes[parent].bucket;
+            slot = path.nodes[node].slot;
+            node = parent;
+        }
+    }
+
+    pottery_chm_impl_bucket(buckets, index)->tags[slot] = tag;
+    return index * POTTERY_CUCKOO_HASH_MAP_BUCKET_SLOTS + slot;
+}
+
+
+
+/*
+ * Rehashing
+ */
+
+// Rehashes the map into the given number of buckets.
+//
+// Rather than moving values as we go, we first plan the position of every
+// value in the new buckets. If we can't find room for a value (because its
+// keys collide too much), we can give up and leave the map untouched.
+pottery_noinline static
+pottery_error_t pottery_chm_impl_rehash(pottery_chm_t* map, size_t new_log_2_size) {
+    void* allocation;
+    char* buckets;
+    size_t* plan;
+    size_t new_slots;
+    size_t i, slot;
+    pottery_error_t error;
+
+    error = pottery_chm_impl_alloc(new_log_2_size, &allocation, &buckets);
+    if (error != POTTERY_OK)
+        return error;
+
+    new_slots = (pottery_cast(size_t, 1) << new_log_2_size) * POTTERY_CUCKOO_HASH_MAP_BUCKET_SLOTS;
+    plan = pottery_cast(size_t*, pottery_chm_alloc_malloc_array(
+            pottery_alignof(size_t), new_slots, sizeof(size_t)));
+    if (plan == pottery_null) {
+        pottery_chm_impl_free(allocation);
+        return POTTERY_ERROR_ALLOC;
+    }
+
+    // Plan the new position of every value.
+    for (i = 0; i < pottery_chm_bucket_count(map); ++i) {
+        pottery_chm_bucket_t* bucket = pottery_chm_impl_bucket(map->buckets, i);
+        for (slot = 0; slot < POTTERY_CUCKOO_HASH_MAP_BUCKET_SLOTS; ++slot) {
+            uint8_t tag = bucket->tags[slot];
+            size_t hash, first, position;
+            if (tag == 0)
+                continue;
+
+            hash = pottery_chm_impl_key_hash(pottery_chm_impl_key(bucket->values + slot));
+            first = pottery_chm_impl_primary(new_log_2_size, hash);
+            position = pottery_chm_impl_insert_new(buckets, new_log_2_size, first,
+                    pottery_chm_impl_alternate(new_log_2_size, first, tag), tag, plan);
+            if (position == SIZE_MAX) {
+                pottery_chm_alloc_free(pottery_alignof(size_t), plan);
+                pottery_chm_impl_free(allocation);
+                return POTTERY_ERROR_FULL;
+            }
+            plan[position] = i * POTTERY_CUCKOO_HASH_MAP_BUCKET_SLOTS + slot;
+        }
+    }
+
+    // Move the values.
+    for (i = 0; i < (pottery_cast(size_t, 1) << new_log_2_size); ++i) {
+        pottery_chm_bucket_t* bucket = pottery_chm_impl_bucket(buckets, i);
+        for (slot = 0; slot < POTTERY_CUCKOO_HASH_MAP_BUCKET_SLOTS; ++slot) {
+            size_t from;
+            if (bucket->tags[slot] == 0)
+                continue;
+            from = plan[i * POTTERY_CUCKOO_HASH_MAP_BUCKET_SLOTS + slot];
+            pottery_chm_lifecycle_move_restrict(bucket->values + slot,
+                    pottery_chm_impl_bucket(map->buckets,
+                        from / POTTERY_CUCKOO_HASH_MAP_BUCKET_SLOTS)->values +
+                        from % POTTERY_CUCKOO_HASH_MAP_BUCKET_SLOTS);
+        }
+    }
+
+    pottery_chm_alloc_free(pottery_alignof(size_t), plan);
+    pottery_chm_impl_free(map->allocation);
+    map->allocation = allocation;
+    map->buckets = buckets;
+    map->log_2_size = new_log_2_size;
+    return POTTERY_OK;
+}
+
+static inline
+void pottery_chm_shrink_if_needed(pottery_chm_t* map) {
+    if (map->log_2_size == POTTERY_CUCKOO_HASH_MAP_MINIMUM_LOG_2_SIZE)
+        return;
+    if (map->count >= pottery_chm_min_count(map))
+        return;
+
+    // Note: we ignore the return value here. If the smaller table can't be
+    // allocated (or the values don't fit), we just keep our larger table. This
+    // way displace can't fail.
+    (void)pottery_chm_impl_rehash(map, map->log_2_size - 1);
+}
+
+
+
+/*
+ * Public functions
+ */
+
+POTTERY_CUCKOO_HASH_MAP_EXTERN
+pottery_error_t pottery_chm_init(pottery_chm_t* map) {
+    map->log_2_size = POTTERY_CUCKOO_HASH_MAP_MINIMUM_LOG_2_SIZE;
+    map->count = 0;
+    return pottery_chm_impl_alloc(map->log_2_size, &map->allocation, &map->buckets);
+}
+
+POTTERY_CUCKOO_HASH_MAP_EXTERN
+void pottery_chm_destroy(pottery_chm_t* map) {
+    #if POTTERY_CUCKOO_HASH_MAP_CAN_DESTROY
+    size_t i, slot;
+    for (i = 0; i < pottery_chm_bucket_count(map); ++i) {
+        pottery_chm_bucket_t* bucket = pottery_chm_impl_bucket(map->buckets, i);
+        for (slot = 0; slot < POTTERY_CUCKOO_HASH_MAP_BUCKET_SLOTS; ++slot)
+            if (bucket->tags[slot] != 0)
+                pottery_chm_lifecycle_destroy(bucket->values + slot);
+    }
+    #else
+    // If we don't have a destroy expression, you must manually empty the hash
+    // map before destroying it.
+    pottery_assert(pottery_chm_is_empty(map));
+    #endif
+
+    pottery_chm_impl_free(map->allocation);
+}
+
+POTTERY_CUCKOO_HASH_MAP_EXTERN
+pottery_chm_entry_t pottery_chm_find(pottery_chm_t* map, pottery_chm_key_t key) {
+    size_t hash = pottery_chm_impl_key_hash(key);
+    uint8_t tag = pottery_chm_impl_tag(hash);
+    size_t first = pottery_chm_impl_primary(map->log_2_size, hash);
+    pottery_chm_bucket_t* second = pottery_chm_impl_bucket(map->buckets,
+            pottery_chm_impl_alternate(map->log_2_size, first, tag));
+    pottery_chm_entry_t entry;
+
+    // Fetch both buckets at once.
+    pottery_prefetch(second);
+
+    entry = pottery_chm_impl_find_in_bucket(pottery_chm_impl_bucket(map->buckets, first), tag, key);
+    if (entry != pottery_null)
+        return entry;
+    return pottery_chm_impl_find_in_bucket(second, tag, key);
+}
+
+POTTERY_CUCKOO_HASH_MAP_EXTERN
+pottery_error_t pottery_chm_emplace_key(pottery_chm_t* map, pottery_chm_key_t key,
+        pottery_chm_entry_t* entry, bool* /*nullable*/ created)
+{
+    size_t hash = pottery_chm_impl_key_hash(key);
+    uint8_t tag = pottery_chm_impl_tag(hash);
+    size_t first = pottery_chm_impl_primary(map->log_2_size, hash);
+    size_t second = pottery_chm_impl_alternate(map->log_2_size, first, tag);
+    size_t position;
+    pottery_error_t error;
+
+    *entry = pottery_chm_impl_find_in_bucket(pottery_chm_impl_bucket(map->buckets, first), tag, key);
+    if (*entry == pottery_null)
+        *entry = pottery_chm_impl_find_in_bucket(pottery_chm_impl_bucket(map->buckets, second), tag, key);
+    if (*entry != pottery_null) {
+        if (created)
+            *created = false;
+        return POTTERY_OK;
+    }
+
+    if (map->count >= pottery_chm_capacity(map)) {
+        error = pottery_chm_impl_rehash(map, map->log_2_size + 1);
+        if (error != POTTERY_OK)
+            return error;
+        first = pottery_chm_impl_primary(map->log_2_size, hash);
+        second = pottery_chm_impl_alternate(map->log_2_size, first, tag);
+    }
+
+    while (true) {
+        position = pottery_chm_impl_insert_new(map->buckets, map->log_2_size,
+                first, second, tag, pottery_null);
+        if (position != SIZE_MAX)
+            break;
+
+        // We couldn't make room. If the map is less than half full, this is
+        // because too many keys collide and growing won't help.
+        if (map->count < pottery_chm_bucket_slots(map) / 2)
+            return POTTERY_ERROR_FULL;
+
+        error = pottery_chm_impl_rehash(map, map->log_2_size + 1);
+        if (error != POTTERY_OK)
+            return error;
+        first = pottery_chm_impl_primary(map->log_2_size, hash);
+        second = pottery_chm_impl_alternate(map->log_2_size, first, tag);
+    }
+
+    *entry = pottery_chm_impl_bucket(map->buckets, position / POTTERY_CUCKOO_HASH_MAP_BUCKET_SLOTS)->values +
+            position % POTTERY_CUCKOO_HASH_MAP_BUCKET_SLOTS;
+    ++map->count;
+    if (created)
+        *created = true;
+    return POTTERY_OK;
+}
+
+POTTERY_CUCKOO_HASH_MAP_EXTERN
+void pottery_chm_displace(pottery_chm_t* map, pottery_chm_entry_t entry) {
+    size_t slot;
+    size_t index = pottery_chm_impl_bucket_index(map, entry, &slot);
+    pottery_chm_bucket_t* bucket = pottery_chm_impl_bucket(map->buckets, index);
+    pottery_assert(bucket->tags[slot] != 0);
+    bucket->tags[slot] = 0;
+    --map->count;
+    pottery_chm_shrink_if_needed(map);
+}
+
+POTTERY_CUCKOO_HASH_MAP_EXTERN
+void pottery_chm_displace_all(pottery_chm_t* map) {
+    void* allocation;
+    char* buckets;
+    size_t i;
+
+    map->count = 0;
+
+    // If the map is larger than the minimum size, we re-allocate to the
+    // minimum size. If that fails (or if it's already the minimum size) we
+    // clear the tags of our existing buckets.
+    if (map->log_2_size != POTTERY_CUCKOO_HASH_MAP_MINIMUM_LOG_2_SIZE &&
+            POTTERY_OK == pottery_chm_impl_alloc(POTTERY_CUCKOO_HASH_MAP_MINIMUM_LOG_2_SIZE,
+                &allocation, &buckets))
+    {
+        pottery_chm_impl_free(map->allocation);
+        map->allocation = allocation;
+        map->buckets = buckets;
+        map->log_2_size = POTTERY_CUCKOO_HASH_MAP_MINIMUM_LOG_2_SIZE;
+        return;
+    }
+
+    for (i = 0; i < pottery_chm_bucket_count(map); ++i)
+        pottery_memset(pottery_chm_impl_bucket(map->buckets, i)->tags, 0,
+                sizeof(pottery_chm_impl_bucket(map->buckets, i)->tags));
+}
+
+#if POTTERY_CUCKOO_HASH_MAP_CAN_DESTROY
+POTTERY_CUCKOO_HASH_MAP_EXTERN
+void pottery_chm_remove(pottery_chm_t* map, pottery_chm_entry_t entry) {
+    pottery_chm_lifecycle_destroy(entry);
+    pottery_chm_displace(map, entry);
+}
+
+POTTERY_CUCKOO_HASH_MAP_EXTERN
+bool pottery_chm_remove_key(pottery_chm_t* map, pottery_chm_key_t key) {
+    pottery_chm_entry_t entry = pottery_chm_find(map, key);
+    if (!pottery_chm_entry_exists(map, entry))
+        return false;
+    pottery_chm_remove(map, entry);
+    return true;
+}
+
+POTTERY_CUCKOO_HASH_MAP_EXTERN
+void pottery_chm_remove_all(pottery_chm_t* map) {
+    size_t i, slot;
+    for (i = 0; i < pottery_chm_bucket_count(map); ++i) {
+        pottery_chm_bucket_t* bucket = pottery_chm_impl_bucket(map->buckets, i);
+        for (slot = 0; slot < POTTERY_CUCKOO_HASH_MAP_BUCKET_SLOTS; ++slot)
+            if (bucket->tags[slot] != 0)
+                pottery_chm_lifecycle_destroy(bucket->values + slot);
+    }
+    pottery_chm_displace_all(map);
+}
+#endif
+
+
+
+/*
+ * Iteration
+ */
+
+// Returns the first value at or after the given slot of the given bucket.
+static
+pottery_chm_entry_t pottery_chm_impl_scan_forward(pottery_chm_t* map, size_t index, size_t slot) {
+    for (; index < pottery_chm_bucket_count(map); ++index, slot = 0) {
+        pottery_chm_bucket_t* bucket = pottery_chm_impl_bucket(map->buckets, index);
+        for (; slot < POTTERY_CUCKOO_HASH_MAP_BUCKET_SLOTS; ++slot)
+            if (bucket->tags[slot] != 0)
+                return bucket->values + slot;
+    }
+    return pottery_null;
+}
+
+// Returns the last value before the given slot of the given bucket.
+static
+pottery_chm_entry_t pottery_chm_impl_scan_backward(pottery_chm_t* map, size_t index, size_t slot) {
+    while (true) {
+        pottery_chm_bucket_t* bucket = pottery_chm_impl_bucket(map->buckets, index);
+        while (slot > 0) {
+            --slot;
+            if (bucket->tags[slot] != 0)
+                return bucket->values + slot;
+        }
+        if (index == 0)
+            return pottery_null;
+        --index;
+        slot = POTTERY_CUCKOO_HASH_MAP_BUCKET_SLOTS;
+    }
+}
+
+POTTERY_CUCKOO_HASH_MAP_EXTERN
+pottery_chm_entry_t pottery_chm_begin(pottery_chm_t* map) {
+    return pottery_chm_impl_scan_forward(map, 0, 0);
+}
+
+POTTERY_CUCKOO_HASH_MAP_EXTERN
+pottery_chm_entry_t pottery_chm_last(pottery_chm_t* map) {
+    pottery_chm_entry_t entry = pottery_chm_impl_scan_backward(map,
+            pottery_chm_bucket_count(map) - 1, POTTERY_CUCKOO_HASH_MAP_BUCKET_SLOTS);
+    pottery_assert(pottery_chm_entry_exists(map, entry));
+    return entry;
+}
+
+POTTERY_CUCKOO_HASH_MAP_EXTERN
+pottery_chm_entry_t pottery_chm_next(pottery_chm_t* map, pottery_chm_entry_t entry) {
+    size_t slot;
+    size_t index = pottery_chm_impl_bucket_index(map, entry, &slot);
+    return pottery_chm_impl_scan_forward(map, index, slot + 1);
+}
+
+POTTERY_CUCKOO_HASH_MAP_EXTERN
+pottery_chm_entry_t pottery_chm_previous(pottery_chm_t* map, pottery_chm_entry_t entry) {
+    size_t slot;
+    size_t index = pottery_chm_impl_bucket_index(map, entry, &slot);
+    return pottery_chm_impl_scan_backward(map, index, slot);
+}
@@ -0,0 +1,267 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2020-2021 11037650 Canada Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef POTTERY_CUCKOO_HASH_MAP_IMPL
+#error "This is an internal header. Do not include it."
+#endif
+
+#include "pottery/pottery_dependencies.h"
+#include "pottery/platform/pottery_platform_pragma_push.t.h"
+
+
+
+/*
+ * Configuration
+ */
+
+#ifndef POTTERY_CUCKOO_HASH_MAP_PREFIX
+#error "POTTERY_CUCKOO_HASH_MAP_PREFIX is not defined."
+#endif
+
+#ifndef POTTERY_CUCKOO_HASH_MAP_VALUE_TYPE
+#error "POTTERY_CUCKOO_HASH_MAP_VALUE_TYPE is not defined."
+#endif
+
+#ifndef POTTERY_CUCKOO_HASH_MAP_KEY_HASH
+#error "POTTERY_CUCKOO_HASH_MAP_KEY_HASH is not defined."
+#endif
+
+#ifndef POTTERY_CUCKOO_HASH_MAP_KEY_EQUAL
+#error "POTTERY_CUCKOO_HASH_MAP_KEY_EQUAL is not defined."
+#endif
+
+#ifdef POTTERY_CUCKOO_HASH_MAP_CONTEXT_TYPE
+#error "cuckoo_hash_map does not support a context yet."
+#endif
+
+#ifndef POTTERY_CUCKOO_HASH_MAP_EXTERN
+#define POTTERY_CUCKOO_HASH_MAP_EXTERN /*nothing*/
+#endif
+
+// Values are moved between buckets to make room for new ones.
+#if !POTTERY_LIFECYCLE_CAN_MOVE
+    #error "cuckoo_hash_map requires a move expression."
+#endif
+
+// Slots per bucket
+// Each bucket holds this many values along with a one-byte tag for each. A
+// lookup examines at most two buckets.
+#ifndef POTTERY_CUCKOO_HASH_MAP_BUCKET_SLOTS
+    #define POTTERY_CUCKOO_HASH_MAP_BUCKET_SLOTS 4
+#endif
+#if POTTERY_CUCKOO_HASH_MAP_BUCKET_SLOTS < 1 || POTTERY_CUCKOO_HASH_MAP_BUCKET_SLOTS > 64
+    #error "BUCKET_SLOTS must be between 1 and 64."
+#endif
+
+// Bucket alignment
+// Buckets are aligned to this (a power of two, normally the cache line size.)
+// Buckets smaller than this are padded to a power of two so that none of them
+// straddle an alignment boundary.
+#ifndef POTTERY_CUCKOO_HASH_MAP_BUCKET_ALIGNMENT
+    #define POTTERY_CUCKOO_HASH_MAP_BUCKET_ALIGNMENT 64
+#endif
+
+// Search limit
+// When both buckets of a new key are full, we search breadth-first for a path
+// of displacements that ends in a free slot. This is the maximum number of
+// buckets the search will visit before giving up and growing the map.
+#ifndef POTTERY_CUCKOO_HASH_MAP_SEARCH_LIMIT
+    #define POTTERY_CUCKOO_HASH_MAP_SEARCH_LIMIT 128
+#endif
+#if POTTERY_CUCKOO_HASH_MAP_SEARCH_LIMIT < 2 || POTTERY_CUCKOO_HASH_MAP_SEARCH_LIMIT > 65535
+    #error "SEARCH_LIMIT must be between 2 and 65535."
+#endif
+
+// Load factors
+// These work the same as in open_hash_map except that they are fractions of
+// slots rather than buckets. Bucketized cuckoo hashing can sustain high loads
+// so the default maximum is 7/8 (87.5%) and the default minimum is 1/8.
+#ifndef POTTERY_CUCKOO_HASH_MAP_MAX_LOAD_FACTOR_NUMERATOR
+    #define POTTERY_CUCKOO_HASH_MAP_MAX_LOAD_FACTOR_NUMERATOR 7
+#endif
+#ifndef POTTERY_CUCKOO_HASH_MAP_MAX_LOAD_FACTOR_DENOMINATOR
+    #define POTTERY_CUCKOO_HASH_MAP_MAX_LOAD_FACTOR_DENOMINATOR 8
+#endif
+#ifndef POTTERY_CUCKOO_HASH_MAP_MIN_LOAD_FACTOR_NUMERATOR
+    #define POTTERY_CUCKOO_HASH_MAP_MIN_LOAD_FACTOR_NUMERATOR 1
+#endif
+#ifndef POTTERY_CUCKOO_HASH_MAP_MIN_LOAD_FACTOR_DENOMINATOR
+    #define POTTERY_CUCKOO_HASH_MAP_MIN_LOAD_FACTOR_DENOMINATOR 8
+#endif
+#if POTTERY_CUCKOO_HASH_MAP_MAX_LOAD_FACTOR_NUMERATOR <= 0 || \
+        POTTERY_CUCKOO_HASH_MAP_MAX_LOAD_FACTOR_NUMERATOR > POTTERY_CUCKOO_HASH_MAP_MAX_LOAD_FACTOR_DENOMINATOR
+    #error "The MAX_LOAD_FACTOR must be greater than 0 and at most 1."
+#endif
+#if POTTERY_CUCKOO_HASH_MAP_MIN_LOAD_FACTOR_NUMERATOR < 0 || \
+        POTTERY_CUCKOO_HASH_MAP_MIN_LOAD_FACTOR_DENOMINATOR <= 0
+    #error "The MIN_LOAD_FACTOR cannot be negative."
+#endif
+#if 2 * POTTERY_CUCKOO_HASH_MAP_MIN_LOAD_FACTOR_NUMERATOR * POTTERY_CUCKOO_HASH_MAP_MAX_LOAD_FACTOR_DENOMINATOR >= \
+        POTTERY_CUCKOO_HASH_MAP_MAX_LOAD_FACTOR_NUMERATOR * POTTERY_CUCKOO_HASH_MAP_MIN_LOAD_FACTOR_DENOMINATOR
+    #error "The MIN_LOAD_FACTOR must be less than half the MAX_LOAD_FACTOR."
+#endif
+
+#if POTTERY_LIFECYCLE_CAN_DESTROY
+    #define POTTERY_CUCKOO_HASH_MAP_CAN_DESTROY 1
+#else
+    #define POTTERY_CUCKOO_HASH_MAP_CAN_DESTROY 0
+#endif
+
+
+
+/*
+ * Renaming
+ */
+
+#define POTTERY_CUCKOO_HASH_MAP_NAME(name) \
+    POTTERY_CONCAT(POTTERY_CUCKOO_HASH_MAP_PREFIX, name)
+
+#define pottery_chm_t POTTERY_CUCKOO_HASH_MAP_NAME(_t)
+#define pottery_chm_entry_t POTTERY_CUCKOO_HASH_MAP_NAME(_entry_t)
+#define pottery_chm_bucket_t POTTERY_CUCKOO_HASH_MAP_NAME(_bucket_t)
+#define pottery_chm_bucket_count POTTERY_CUCKOO_HASH_MAP_NAME(_bucket_count)
+#define pottery_chm_bucket_slots POTTERY_CUCKOO_HASH_MAP_NAME(_bucket_slots)
+#define pottery_chm_capacity POTTERY_CUCKOO_HASH_MAP_NAME(_capacity)
+#define pottery_chm_min_count POTTERY_CUCKOO_HASH_MAP_NAME(_min_count)
+#define pottery_chm_impl_stride POTTERY_CUCKOO_HASH_MAP_NAME(_impl_stride)
+#define pottery_chm_impl_bucket POTTERY_CUCKOO_HASH_MAP_NAME(_impl_bucket)
+#define pottery_chm_impl_bucket_index POTTERY_CUCKOO_HASH_MAP_NAME(_impl_bucket_index)
+#define pottery_chm_impl_tag POTTERY_CUCKOO_HASH_MAP_NAME(_impl_tag)
+#define pottery_chm_impl_primary POTTERY_CUCKOO_HASH_MAP_NAME(_impl_primary)
+#define pottery_chm_impl_alternate POTTERY_CUCKOO_HASH_MAP_NAME(_impl_alternate)
+#define pottery_chm_impl_find_in_bucket POTTERY_CUCKOO_HASH_MAP_NAME(_impl_find_in_bucket)
+#define pottery_chm_impl_free_slot POTTERY_CUCKOO_HASH_MAP_NAME(_impl_free_slot)
+#define pottery_chm_impl_scan_forward POTTERY_CUCKOO_HASH_MAP_NAME(_impl_scan_forward)
+#define pottery_chm_impl_scan_backward POTTERY_CUCKOO_HASH_MAP_NAME(_impl_scan_backward)
+#define pottery_chm_impl_alloc POTTERY_CUCKOO_HASH_MAP_NAME(_impl_alloc)
+#define pottery_chm_impl_free POTTERY_CUCKOO_HASH_MAP_NAME(_impl_free)
+#define pottery_chm_impl_node_t POTTERY_CUCKOO_HASH_MAP_NAME(_impl_node_t)
+#define pottery_chm_impl_path_t POTTERY_CUCKOO_HASH_MAP_NAME(_impl_path_t)
+#define pottery_chm_impl_on_path POTTERY_CUCKOO_HASH_MAP_NAME(_impl_on_path)
+#define pottery_chm_impl_search POTTERY_CUCKOO_HASH_MAP_NAME(_impl_search)
+#define pottery_chm_impl_move POTTERY_CUCKOO_HASH_MAP_NAME(_impl_move)
+#define pottery_chm_impl_insert_new POTTERY_CUCKOO_HASH_MAP_NAME(_impl_insert_new)
+#define pottery_chm_impl_rehash POTTERY_CUCKOO_HASH_MAP_NAME(_impl_rehash)
+#define pottery_chm_shrink_if_needed POTTERY_CUCKOO_HASH_MAP_NAME(_shrink_if_needed)
+#define pottery_chm_impl_key_hash POTTERY_CUCKOO_HASH_MAP_NAME(_impl_key_hash)
+#define pottery_chm_impl_key_equal POTTERY_CUCKOO_HASH_MAP_NAME(_impl_key_equal)
+#define pottery_chm_impl_key POTTERY_CUCKOO_HASH_MAP_NAME(_impl_key)
+#define pottery_chm_init POTTERY_CUCKOO_HASH_MAP_NAME(_init)
+#define pottery_chm_destroy POTTERY_CUCKOO_HASH_MAP_NAME(_destroy)
+#define pottery_chm_emplace_key POTTERY_CUCKOO_HASH_MAP_NAME(_emplace_key)
+#define pottery_chm_find POTTERY_CUCKOO_HASH_MAP_NAME(_find)
+#define pottery_chm_contains_key POTTERY_CUCKOO_HASH_MAP_NAME(_contains_key)
+#define pottery_chm_count POTTERY_CUCKOO_HASH_MAP_NAME(_count)
+#define pottery_chm_is_empty POTTERY_CUCKOO_HASH_MAP_NAME(_is_empty)
+#define pottery_chm_displace POTTERY_CUCKOO_HASH_MAP_NAME(_displace)
+#define pottery_chm_displace_all POTTERY_CUCKOO_HASH_MAP_NAME(_displace_all)
+#define pottery_chm_remove POTTERY_CUCKOO_HASH_MAP_NAME(_remove)
+#define pottery_chm_remove_all POTTERY_CUCKOO_HASH_MAP_NAME(_remove_all)
+#define pottery_chm_remove_key POTTERY_CUCKOO_HASH_MAP_NAME(_remove_key)
+#define pottery_chm_entry_exists POTTERY_CUCKOO_HASH_MAP_NAME(_entry_exists)
+#define pottery_chm_entry_ref POTTERY_CUCKOO_HASH_MAP_NAME(_entry_ref)
+#define pottery_chm_begin POTTERY_CUCKOO_HASH_MAP_NAME(_begin)
+#define pottery_chm_end POTTERY_CUCKOO_HASH_MAP_NAME(_end)
+#define pottery_chm_first POTTERY_CUCKOO_HASH_MAP_NAME(_first)
+#define pottery_chm_last POTTERY_CUCKOO_HASH_MAP_NAME(_last)
+#define pottery_chm_next POTTERY_CUCKOO_HASH_MAP_NAME(_next)
+#define pottery_chm_previous POTTERY_CUCKOO_HASH_MAP_NAME(_previous)
+
+
+
+// alloc functions
+#define POTTERY_CUCKOO_HASH_MAP_ALLOC_PREFIX POTTERY_CONCAT(POTTERY_CUCKOO_HASH_MAP_PREFIX, _alloc)
+//!!! AUTOGENERATED:alloc/rename.m.h SRC:pottery_chm_alloc DEST:POTTERY_CUCKOO_HASH_MAP_ALLOC_PREFIX
+    // This block is auto-generated. Do not modify until END_AUTOGENERATED.
+    // Renames alloc identifiers from pottery_chm_alloc to POTTERY_CUCKOO_HASH_MAP_ALLOC_PREFIX
+
+    #define pottery_chm_alloc_free POTTERY_CONCAT(POTTERY_CUCKOO_HASH_MAP_ALLOC_PREFIX, _free)
+    #define pottery_chm_alloc_impl_free_ea POTTERY_CONCAT(POTTERY_CUCKOO_HASH_MAP_ALLOC_PREFIX, _impl_free_ea)
+    #define pottery_chm_alloc_impl_free_fa POTTERY_CONCAT(POTTERY_CUCKOO_HASH_MAP_ALLOC_PREFIX, _impl_free_fa)
+
+    #define pottery_chm_alloc_malloc POTTERY_CONCAT(POTTERY_CUCKOO_HASH_MAP_ALLOC_PREFIX, _malloc)
+    #define pottery_chm_alloc_impl_malloc_ea POTTERY_CONCAT(POTTERY_CUCKOO_HASH_MAP_ALLOC_PREFIX, _impl_malloc_ea)
+    #define pottery_chm_alloc_impl_malloc_fa POTTERY_CONCAT(POTTERY_CUCKOO_HASH_MAP_ALLOC_PREFIX, _impl_malloc_fa)
+
+    #define pottery_chm_alloc_malloc_zero POTTERY_CONCAT(POTTERY_CUCKOO_HASH_MAP_ALLOC_PREFIX, _malloc_zero)
+    #define pottery_chm_alloc_impl_malloc_zero_ea POTTERY_CONCAT(POTTERY_CUCKOO_HASH_MAP_ALLOC_PREFIX, _impl_malloc_zero_ea)
+    #define pottery_chm_alloc_impl_malloc_zero_fa POTTERY_CONCAT(POTTERY_CUCKOO_HASH_MAP_ALLOC_PREFIX, _impl_malloc_zero_fa)
+    #define pottery_chm_alloc_impl_malloc_zero_fa_wrap POTTERY_CONCAT(POTTERY_CUCKOO_HASH_MAP_ALLOC_PREFIX, _impl_malloc_zero_fa_wrap)
+
+    #define pottery_chm_alloc_malloc_array_at_least POTTERY_CONCAT(POTTERY_CUCKOO_HASH_MAP_ALLOC_PREFIX, _malloc_array_at_least)
+    #define pottery_chm_alloc_impl_malloc_array_at_least_ea POTTERY_CONCAT(POTTERY_CUCKOO_HASH_MAP_ALLOC_PREFIX, _impl_malloc_array_at_least_ea)
+    #define pottery_chm_alloc_impl_malloc_array_at_least_fa POTTERY_CONCAT(POTTERY_CUCKOO_HASH_MAP_ALLOC_PREFIX, _impl_malloc_array_at_least_fa)
+
+    #define pottery_chm_alloc_malloc_array POTTERY_CONCAT(POTTERY_CUCKOO_HASH_MAP_ALLOC_PREFIX, _malloc_array)
+    #define pottery_chm_alloc_malloc_array_zero POTTERY_CONCAT(POTTERY_CUCKOO_HASH_MAP_ALLOC_PREFIX, _malloc_array_zero)
+//!!! END_AUTOGENERATED
+
+
+
+// container types
+//!!! AUTOGENERATED:container_types/rename.m.h SRC:pottery_chm DEST:POTTERY_CUCKOO_HASH_MAP_PREFIX
+    // This block is auto-generated. Do not modify until END_AUTOGENERATED.
+    // Renames container_types template identifiers from pottery_chm to POTTERY_CUCKOO_HASH_MAP_PREFIX
+
+    #define pottery_chm_value_t POTTERY_CONCAT(POTTERY_CUCKOO_HASH_MAP_PREFIX, _value_t)
+    #define pottery_chm_ref_t POTTERY_CONCAT(POTTERY_CUCKOO_HASH_MAP_PREFIX, _ref_t)
+    #define pottery_chm_const_ref_t POTTERY_CONCAT(POTTERY_CUCKOO_HASH_MAP_PREFIX, _const_ref_t)
+    #define pottery_chm_key_t POTTERY_CONCAT(POTTERY_CUCKOO_HASH_MAP_PREFIX, _key_t)
+    #define pottery_chm_context_t POTTERY_CONCAT(POTTERY_CUCKOO_HASH_MAP_PREFIX, _context_t)
+
+    #define pottery_chm_ref_key POTTERY_CONCAT(POTTERY_CUCKOO_HASH_MAP_PREFIX, _ref_key)
+    #define pottery_chm_ref_equal POTTERY_CONCAT(POTTERY_CUCKOO_HASH_MAP_PREFIX, _ref_equal)
+//!!! END_AUTOGENERATED
+
+
+
+// lifecycle functions
+#define POTTERY_CUCKOO_HASH_MAP_LIFECYCLE_PREFIX POTTERY_CUCKOO_HASH_MAP_NAME(_lifecycle)
+//!!! AUTOGENERATED:lifecycle/rename.m.h SRC:pottery_chm_lifecycle DEST:POTTERY_CUCKOO_HASH_MAP_LIFECYCLE_PREFIX
+    // This block is auto-generated. Do not modify until END_AUTOGENERATED.
+    // Renames lifecycle identifiers from pottery_chm_lifecycle to POTTERY_CUCKOO_HASH_MAP_LIFECYCLE_PREFIX
+
+    #define pottery_chm_lifecycle_init_steal POTTERY_CONCAT(POTTERY_CUCKOO_HASH_MAP_LIFECYCLE_PREFIX, _init_steal)
+    #define pottery_chm_lifecycle_init_copy POTTERY_CONCAT(POTTERY_CUCKOO_HASH_MAP_LIFECYCLE_PREFIX, _init_copy)
+    #define pottery_chm_lifecycle_init POTTERY_CONCAT(POTTERY_CUCKOO_HASH_MAP_LIFECYCLE_PREFIX, _init)
+    #define pottery_chm_lifecycle_destroy POTTERY_CONCAT(POTTERY_CUCKOO_HASH_MAP_LIFECYCLE_PREFIX, _destroy)
+
+    #define pottery_chm_lifecycle_swap POTTERY_CONCAT(POTTERY_CUCKOO_HASH_MAP_LIFECYCLE_PREFIX, _swap)
+    #define pottery_chm_lifecycle_move POTTERY_CONCAT(POTTERY_CUCKOO_HASH_MAP_LIFECYCLE_PREFIX, _move)
+    #define pottery_chm_lifecycle_steal POTTERY_CONCAT(POTTERY_CUCKOO_HASH_MAP_LIFECYCLE_PREFIX, _steal)
+    #define pottery_chm_lifecycle_copy POTTERY_CONCAT(POTTERY_CUCKOO_HASH_MAP_LIFECYCLE_PREFIX, _copy)
+    #define pottery_chm_lifecycle_swap_restrict POTTERY_CONCAT(POTTERY_CUCKOO_HASH_MAP_LIFECYCLE_PREFIX, _swap_restrict)
+    #define pottery_chm_lifecycle_move_restrict POTTERY_CONCAT(POTTERY_CUCKOO_HASH_MAP_LIFECYCLE_PREFIX, _move_restrict)
+    #define pottery_chm_lifecycle_steal_restrict POTTERY_CONCAT(POTTERY_CUCKOO_HASH_MAP_LIFECYCLE_PREFIX, _steal_restrict)
+    #define pottery_chm_lifecycle_copy_restrict POTTERY_CONCAT(POTTERY_CUCKOO_HASH_MAP_LIFECYCLE_PREFIX, _copy_restrict)
+
+    #define pottery_chm_lifecycle_destroy_bulk POTTERY_CONCAT(POTTERY_CUCKOO_HASH_MAP_LIFECYCLE_PREFIX, _destroy_bulk)
+    #define pottery_chm_lifecycle_move_bulk POTTERY_CONCAT(POTTERY_CUCKOO_HASH_MAP_LIFECYCLE_PREFIX, _move_bulk)
+    #define pottery_chm_lifecycle_move_bulk_restrict POTTERY_CONCAT(POTTERY_CUCKOO_HASH_MAP_LIFECYCLE_PREFIX, _move_bulk_restrict)
+    #define pottery_chm_lifecycle_move_bulk_restrict_impl POTTERY_CONCAT(POTTERY_CUCKOO_HASH_MAP_LIFECYCLE_PREFIX, _move_bulk_restrict_impl)
+    #define pottery_chm_lifecycle_move_bulk_up POTTERY_CONCAT(POTTERY_CUCKOO_HASH_MAP_LIFECYCLE_PREFIX, _move_bulk_up)
+    #define pottery_chm_lifecycle_move_bulk_up_impl POTTERY_CONCAT(POTTERY_CUCKOO_HASH_MAP_LIFECYCLE_PREFIX, _move_bulk_up_impl)
+    #define pottery_chm_lifecycle_move_bulk_down POTTERY_CONCAT(POTTERY_CUCKOO_HASH_MAP_LIFECYCLE_PREFIX, _move_bulk_down)
+    #define pottery_chm_lifecycle_move_bulk_down_impl POTTERY_CONCAT(POTTERY_CUCKOO_HASH_MAP_LIFECYCLE_PREFIX, _move_bulk_down_impl)
+//!!! END_AUTOGENERATED
@@ -0,0 +1,233 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2020-2021 11037650 Canada Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef POTTERY_CUCKOO_HASH_MAP_IMPL
+#error "This is an internal header. Do not include it."
+#endif
+
+
+
+/*
+ * Configuration
+ */
+
+#undef POTTERY_CUCKOO_HASH_MAP_PREFIX
+#undef POTTERY_CUCKOO_HASH_MAP_EXTERN
+#undef POTTERY_CUCKOO_HASH_MAP_KEY_HASH
+#undef POTTERY_CUCKOO_HASH_MAP_KEY_EQUAL
+#undef POTTERY_CUCKOO_HASH_MAP_BUCKET_SLOTS
+#undef POTTERY_CUCKOO_HASH_MAP_BUCKET_ALIGNMENT
+#undef POTTERY_CUCKOO_HASH_MAP_SEARCH_LIMIT
+#undef POTTERY_CUCKOO_HASH_MAP_MAX_LOAD_FACTOR_NUMERATOR
+#undef POTTERY_CUCKOO_HASH_MAP_MAX_LOAD_FACTOR_DENOMINATOR
+#undef POTTERY_CUCKOO_HASH_MAP_MIN_LOAD_FACTOR_NUMERATOR
+#undef POTTERY_CUCKOO_HASH_MAP_MIN_LOAD_FACTOR_DENOMINATOR
+#undef POTTERY_CUCKOO_HASH_MAP_MINIMUM_LOG_2_SIZE
+#undef POTTERY_CUCKOO_HASH_MAP_CAN_DESTROY
+
+
+
+/*
+ * Renaming
+ */
+
+#undef POTTERY_CUCKOO_HASH_MAP_NAME
+
+#undef pottery_chm_t
+#undef pottery_chm_entry_t
+#undef pottery_chm_bucket_t
+#undef pottery_chm_bucket_count
+#undef pottery_chm_bucket_slots
+#undef pottery_chm_capacity
+#undef pottery_chm_min_count
+#undef pottery_chm_impl_stride
+#undef pottery_chm_impl_bucket
+#undef pottery_chm_impl_bucket_index
+#undef pottery_chm_impl_tag
+#undef pottery_chm_impl_primary
+#undef pottery_chm_impl_alternate
+#undef pottery_chm_impl_find_in_bucket
+#undef pottery_chm_impl_free_slot
+#undef pottery_chm_impl_scan_forward
+#undef pottery_chm_impl_scan_backward
+#undef pottery_chm_impl_alloc
+#undef pottery_chm_impl_free
+#undef pottery_chm_impl_node_t
+#undef pottery_chm_impl_path_t
+#undef pottery_chm_impl_on_path
+#undef pottery_chm_impl_search
+#undef pottery_chm_impl_move
+#undef pottery_chm_impl_insert_new
+#undef pottery_chm_impl_rehash
+#undef pottery_chm_shrink_if_needed
+#undef pottery_chm_impl_key_hash
+#undef pottery_chm_impl_key_equal
+#undef pottery_chm_impl_key
+#undef pottery_chm_init
+#undef pottery_chm_destroy
+#undef pottery_chm_emplace_key
+#undef pottery_chm_find
+#undef pottery_chm_contains_key
+#undef pottery_chm_count
+#undef pottery_chm_is_empty
+#undef pottery_chm_displace
+#undef pottery_chm_displace_all
+#undef pottery_chm_remove
+#undef pottery_chm_remove_all
+#undef pottery_chm_remove_key
+#undef pottery_chm_entry_exists
+#undef pottery_chm_entry_ref
+#undef pottery_chm_begin
+#undef pottery_chm_end
+#undef pottery_chm_first
+#undef pottery_chm_last
+#undef pottery_chm_next
+#undef pottery_chm_previous
+
+#undef POTTERY_CUCKOO_HASH_MAP_ALLOC_PREFIX
+//!!! AUTOGENERATED:alloc/unrename.m.h PREFIX:pottery_chm_alloc
+    // This block is auto-generated. Do not modify until END_AUTOGENERATED.
+    // Un-renames alloc identifiers with prefix "pottery_chm_alloc"
+
+    #undef pottery_chm_alloc_free
+    #undef pottery_chm_alloc_impl_free_ea
+    #undef pottery_chm_alloc_impl_free_fa
+
+    #undef pottery_chm_alloc_malloc
+    #undef pottery_chm_alloc_impl_malloc_ea
+    #undef pottery_chm_alloc_impl_malloc_fa
+
+    #undef pottery_chm_alloc_malloc_zero
+    #undef pottery_chm_alloc_impl_malloc_zero_ea
+    #undef pottery_chm_alloc_impl_malloc_zero_fa
+    #undef pottery_chm_alloc_impl_malloc_zero_fa_wrap
+
+    #undef pottery_chm_alloc_malloc_array_at_least
+    #undef pottery_chm_alloc_impl_malloc_array_at_least_ea
+    #undef pottery_chm_alloc_impl_malloc_array_at_least_fa
+
+    #undef pottery_chm_alloc_malloc_array
+    #undef pottery_chm_alloc_malloc_array_zero
+//!!! END_AUTOGENERATED
+
+//!!! AUTOGENERATED:alloc/unconfigure.m.h PREFIX:POTTERY_CUCKOO_HASH_MAP_ALLOC
+    // This block is auto-generated. Do not modify until END_AUTOGENERATED.
+    // Undefines (forwardable/forwarded) alloc configuration on POTTERY_CUCKOO_HASH_MAP_ALLOC
+    #undef POTTERY_CUCKOO_HASH_MAP_ALLOC_CONTEXT_TYPE
+
+    #undef POTTERY_CUCKOO_HASH_MAP_ALLOC_FREE
+    #undef POTTERY_CUCKOO_HASH_MAP_ALLOC_MALLOC
+    #undef POTTERY_CUCKOO_HASH_MAP_ALLOC_ZALLOC
+    #undef POTTERY_CUCKOO_HASH_MAP_ALLOC_REALLOC
+    #undef POTTERY_CUCKOO_HASH_MAP_ALLOC_MALLOC_GOOD_SIZE
+
+    #undef POTTERY_CUCKOO_HASH_MAP_ALLOC_ALIGNED_FREE
+    #undef POTTERY_CUCKOO_HASH_MAP_ALLOC_ALIGNED_MALLOC
+    #undef POTTERY_CUCKOO_HASH_MAP_ALLOC_ALIGNED_ZALLOC
+    #undef POTTERY_CUCKOO_HASH_MAP_ALLOC_ALIGNED_REALLOC
+    #undef POTTERY_CUCKOO_HASH_MAP_ALLOC_ALIGNED_MALLOC_GOOD_SIZE
+//!!! END_AUTOGENERATED
+
+//!!! AUTOGENERATED:container_types/unrename.m.h PREFIX:pottery_chm
+    // This block is auto-generated. Do not modify until END_AUTOGENERATED.
+    // Unrenames container_types template identifiers from pottery_chm
+
+    #undef pottery_chm_value_t
+    #undef pottery_chm_ref_t
+    #undef pottery_chm_const_ref_t
+    #undef pottery_chm_key_t
+    #undef pottery_chm_context_t
+
+    #undef pottery_chm_ref_key
+    #undef pottery_chm_ref_equal
+//!!! END_AUTOGENERATED
+
+//!!! AUTOGENERATED:container_types/unconfigure.m.h CONFIG:POTTERY_CUCKOO_HASH_MAP
+    // This block is auto-generated. Do not modify until END_AUTOGENERATED.
+    // Undefines (forwardable/forwarded) container_types configuration on POTTERY_CUCKOO_HASH_MAP
+
+    // types
+    #undef POTTERY_CUCKOO_HASH_MAP_VALUE_TYPE
+    #undef POTTERY_CUCKOO_HASH_MAP_REF_TYPE
+    #undef POTTERY_CUCKOO_HASH_MAP_ENTRY_TYPE
+    #undef POTTERY_CUCKOO_HASH_MAP_KEY_TYPE
+    #undef POTTERY_CUCKOO_HASH_MAP_CONTEXT_TYPE
+
+    // Conversion and comparison expressions
+    #undef POTTERY_CUCKOO_HASH_MAP_ENTRY_REF
+    #undef POTTERY_CUCKOO_HASH_MAP_REF_KEY
+    #undef POTTERY_CUCKOO_HASH_MAP_REF_EQUAL
+//!!! END_AUTOGENERATED
+
+#undef POTTERY_CUCKOO_HASH_MAP_LIFECYCLE_PREFIX
+//!!! AUTOGENERATED:lifecycle/unrename.m.h PREFIX:pottery_chm_lifecycle
+    // This block is auto-generated. Do not modify until END_AUTOGENERATED.
+    // Un-renames lifecycle identifiers with prefix "pottery_chm_lifecycle"
+
+    #undef pottery_chm_lifecycle_init_steal
+    #undef pottery_chm_lifecycle_init_copy
+    #undef pottery_chm_lifecycle_init
+    #undef pottery_chm_lifecycle_destroy
+    #undef pottery_chm_lifecycle_swap
+    #undef pottery_chm_lifecycle_move
+    #undef pottery_chm_lifecycle_steal
+    #undef pottery_chm_lifecycle_copy
+
+    #undef pottery_chm_lifecycle_move_bulk
+    #undef pottery_chm_lifecycle_move_bulk_restrict
+    #undef pottery_chm_lifecycle_move_bulk_restrict_impl
+    #undef pottery_chm_lifecycle_move_bulk_up
+    #undef pottery_chm_lifecycle_move_bulk_up_impl
+    #undef pottery_chm_lifecycle_move_bulk_down
+    #undef pottery_chm_lifecycle_move_bulk_down_impl
+    #undef pottery_chm_lifecycle_destroy_bulk
+//!!! END_AUTOGENERATED
+
+//!!! AUTOGENERATED:lifecycle/unconfigure.m.h PREFIX:POTTERY_CUCKOO_HASH_MAP_LIFECYCLE
+    // This block is auto-generated. Do not modify until END_AUTOGENERATED.
+
+    // Undefines (forwardable/forwarded) lifecycle configuration on POTTERY_CUCKOO_HASH_MAP_LIFECYCLE
+
+    #undef POTTERY_CUCKOO_HASH_MAP_LIFECYCLE_BY_VALUE
+    #undef POTTERY_CUCKOO_HASH_MAP_LIFECYCLE_DESTROY
+    #undef POTTERY_CUCKOO_HASH_MAP_LIFECYCLE_DESTROY_BY_VALUE
+    #undef POTTERY_CUCKOO_HASH_MAP_LIFECYCLE_INIT
+    #undef POTTERY_CUCKOO_HASH_MAP_LIFECYCLE_INIT_BY_VALUE
+    #undef POTTERY_CUCKOO_HASH_MAP_LIFECYCLE_INIT_COPY
+    #undef POTTERY_CUCKOO_HASH_MAP_LIFECYCLE_INIT_COPY_BY_VALUE
+    #undef POTTERY_CUCKOO_HASH_MAP_LIFECYCLE_INIT_STEAL
+    #undef POTTERY_CUCKOO_HASH_MAP_LIFECYCLE_INIT_STEAL_BY_VALUE
+    #undef POTTERY_CUCKOO_HASH_MAP_LIFECYCLE_MOVE
+    #undef POTTERY_CUCKOO_HASH_MAP_LIFECYCLE_MOVE_BY_VALUE
+    #undef POTTERY_CUCKOO_HASH_MAP_LIFECYCLE_COPY
+    #undef POTTERY_CUCKOO_HASH_MAP_LIFECYCLE_COPY_BY_VALUE
+    #undef POTTERY_CUCKOO_HASH_MAP_LIFECYCLE_STEAL
+    #undef POTTERY_CUCKOO_HASH_MAP_LIFECYCLE_STEAL_BY_VALUE
+    #undef POTTERY_CUCKOO_HASH_MAP_LIFECYCLE_SWAP
+    #undef POTTERY_CUCKOO_HASH_MAP_LIFECYCLE_SWAP_BY_VALUE
+//!!! END_AUTOGENERATED
+
+
+
+#include "pottery/platform/pottery_platform_pragma_pop.t.h"
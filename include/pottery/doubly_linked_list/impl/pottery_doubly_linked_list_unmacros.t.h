@@ -104,7 +104,11 @@
     #undef pottery_dll_is_empty
     #undef pottery_dll_at
     #undef pottery_dll_find
+    #undef pottery_dll_find_with_hash
     #undef pottery_dll_contains_key
+    #undef pottery_dll_contains_key_with_hash
+    #undef pottery_dll_find_bulk
+    #undef pottery_dll_contains_bulk
     #undef pottery_dll_first
     #undef pottery_dll_last
     #undef pottery_dll_any
@@ -142,6 +146,7 @@
     #undef pottery_dll_emplace
     #undef pottery_dll_emplace_at
     #undef pottery_dll_emplace_key
+    #undef pottery_dll_emplace_key_with_hash
     #undef pottery_dll_emplace_first
     #undef pottery_dll_emplace_last
     #undef pottery_dll_emplace_before
@@ -177,6 +182,7 @@
     #undef pottery_dll_remove
     #undef pottery_dll_remove_at
     #undef pottery_dll_remove_key
+    #undef pottery_dll_remove_key_with_hash
     #undef pottery_dll_remove_first
     #undef pottery_dll_remove_last
     #undef pottery_dll_remove_and_next
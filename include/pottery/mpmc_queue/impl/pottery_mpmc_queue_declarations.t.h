@@ -0,0 +1,378 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2020-2021 11037650 Canada Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef POTTERY_MPMC_QUEUE_IMPL
+#error "This is an internal header. Do not include it."
+#endif
+
+/**
+ * A slot of the queue's buffer.
+ *
+ * The sequence number of a slot tells producers and consumers whose turn it
+ * is. A slot at position pos (counting from when the queue was created) is
+ * free for the producer that claims pos when its sequence is pos, and holds a
+ * value ready for the consumer that claims pos when its sequence is pos + 1.
+ * The consumer then sets it to pos + capacity, which is the position of the
+ * slot on the next lap around the buffer.
+ */
+typedef struct pottery_mpmc_queue_slot_t {
+    size_t sequence;
+    pottery_mpmc_queue_value_t value;
+} pottery_mpmc_queue_slot_t;
+
+typedef pottery_mpmc_queue_slot_t* pottery_mpmc_queue_entry_t;
+
+/**
+ * A fixed-capacity lock-free queue for passing values between any number of
+ * producer and consumer threads.
+ *
+ * Producers and consumers each claim positions by advancing a shared counter
+ * with compare-and-swap, then construct or take the value in the slot at that
+ * position and publish it by storing its sequence number. A producer or
+ * consumer never waits for another to finish; if a slot isn't ready yet,
+ * try_push() reports that the queue is full and try_pop() reports that it's
+ * empty. init() and destroy() must not run concurrently with anything else.
+ */
+typedef struct pottery_mpmc_queue_t {
+    pottery_mpmc_queue_slot_t* slots;
+    size_t mask;
+
+    char padding0[POTTERY_MPMC_QUEUE_PADDING];
+
+    // The next position a producer will claim
+    size_t tail;
+
+    char padding1[POTTERY_MPMC_QUEUE_PADDING];
+
+    // The next position a consumer will claim
+    size_t head;
+
+    char padding2[POTTERY_MPMC_QUEUE_PADDING];
+} pottery_mpmc_queue_t;
+
+#if POTTERY_FORWARD_DECLARATIONS
+/**
+ * Initializes a queue that can hold at least the given number of values.
+ *
+ * The capacity is rounded up to a power of two (and at least 2.)
+ */
+POTTERY_MPMC_QUEUE_EXTERN
+pottery_error_t pottery_mpmc_queue_init(pottery_mpmc_queue_t* queue, size_t capacity);
+
+/**
+ * Destroys the queue, destroying any values that remain in it.
+ *
+ * All claimed slots must have been committed, displaced or removed.
+ */
+POTTERY_MPMC_QUEUE_EXTERN
+void pottery_mpmc_queue_destroy(pottery_mpmc_queue_t* queue);
+#endif
+
+static inline
+size_t pottery_mpmc_queue_capacity(pottery_mpmc_queue_t* queue) {
+    return queue->mask + 1;
+}
+
+/**
+ * Returns the number of values in the queue, including values that have been
+ * claimed but not yet committed or displaced.
+ *
+ * This can be called from any thread but it may be out of date by the time it
+ * returns if the queue is in use.
+ */
+static inline
+size_t pottery_mpmc_queue_count(pottery_mpmc_queue_t* queue) {
+    // The head is read first so it can't be past the tail we read afterwards.
+    size_t head = pottery_atomic_load_acquire_s(&queue->head);
+    size_t tail = pottery_atomic_load_acquire_s(&queue->tail);
+    return pottery_min_s(tail - head, pottery_mpmc_queue_capacity(queue));
+}
+
+static inline
+bool pottery_mpmc_queue_is_empty(pottery_mpmc_queue_t* queue) {
+    return pottery_mpmc_queue_count(queue) == 0;
+}
+
+static inline
+pottery_mpmc_queue_value_t* pottery_mpmc_queue_entry_ref(pottery_mpmc_queue_t* queue,
+        pottery_mpmc_queue_entry_t entry)
+{
+    (void)queue;
+    return &entry->value;
+}
+
+static inline
+pottery_mpmc_queue_slot_t* pottery_mpmc_queue_impl_slot(pottery_mpmc_queue_t* queue, size_t position) {
+    return queue->slots + (position & queue->mask);
+}
+
+/*
+ * Claims up to count consecutive positions from the given counter (the tail
+ * for producers or the head for consumers), returning the number claimed and
+ * the first position in first. A slot can be claimed if its sequence number
+ * is its position plus ready (0 for producers or 1 for consumers.)
+ *
+ * All positions are claimed with a single compare-and-swap. If contiguous is
+ * true, the positions don't wrap around the end of the buffer.
+ *
+ * Returns 0 if the first slot isn't ready, i.e. if the queue is full (for
+ * producers) or empty (for consumers.)
+ */
+static inline
+size_t pottery_mpmc_queue_impl_claim(pottery_mpmc_queue_t* queue, size_t* counter,
+        size_t ready, size_t count, bool contiguous, size_t* first)
+{
+    size_t position = pottery_atomic_load_relaxed_s(counter);
+    while (true) {
+        size_t limit = count;
+        if (contiguous)
+            limit = pottery_min_s(limit, pottery_mpmc_queue_capacity(queue) -
+                    (position & queue->mask));
+
+        size_t claimable = 0;
+        ptrdiff_t difference = 0;
+        while (claimable < limit) {
+            size_t expected = position + claimable + ready;
+            size_t sequence = pottery_atomic_load_acquire_s(
+                    &pottery_mpmc_queue_impl_slot(queue, position + claimable)->sequence);
+            difference = pottery_cast(ptrdiff_t, sequence - expected);
+            if (difference != 0)
+                break;
+            ++claimable;
+        }
+
+        if (claimable == 0) {
+            // If the slot is behind, it's still in use from the previous lap
+            // (or not yet filled) so the queue is full (or empty.)
+            if (limit == 0 || difference < 0)
+                return 0;
+            // Otherwise another thread claimed it first. Try again.
+            position = pottery_atomic_load_relaxed_s(counter);
+            continue;
+        }
+
+        // On failure this reloads the position.
+        if (pottery_atomic_compare_exchange_weak_relaxed_s(counter,
+                    &position, position + claimable))
+        {
+            *first = position;
+            return claimable;
+        }
+    }
+}
+
+
+
+/*
+ * Producer functions
+ */
+
+/**
+ * Claims up to the given number of free slots at the end of the queue,
+ * returning the number of slots claimed and the first one in entry. Returns 0
+ * if the queue is full.
+ *
+ * The slots are contiguous so fewer than requested may be claimed if they
+ * would wrap around the end of the buffer. Construct values in them (see
+ * entry_ref()) and then publish them to consumers with commit_bulk().
+ * Consumers can't get past these slots until they are committed so don't
+ * hold on to them for long.
+ */
+static inline
+size_t pottery_mpmc_queue_try_emplace_bulk(pottery_mpmc_queue_t* queue,
+        size_t count, pottery_mpmc_queue_entry_t* entry)
+{
+    size_t first = 0;
+    size_t claimed = pottery_mpmc_queue_impl_claim(queue, &queue->tail, 0, count, true, &first);
+    *entry = pottery_mpmc_queue_impl_slot(queue, first);
+    return claimed;
+}
+
+/**
+ * Publishes values constructed in slots returned by try_emplace_bulk().
+ */
+static inline
+void pottery_mpmc_queue_commit_bulk(pottery_mpmc_queue_t* queue,
+        pottery_mpmc_queue_entry_t entry, size_t count)
+{
+    (void)queue;
+    size_t i;
+    for (i = 0; i < count; ++i) {
+        // We own the slot so its sequence is still its position.
+        size_t position = pottery_atomic_load_relaxed_s(&entry[i].sequence);
+        pottery_atomic_store_release_s(&entry[i].sequence, position + 1);
+    }
+}
+
+/**
+ * Claims a free slot at the end of the queue, returning false if the queue is
+ * full. Construct a value in it and then call commit().
+ */
+static inline
+bool pottery_mpmc_queue_try_emplace(pottery_mpmc_queue_t* queue, pottery_mpmc_queue_entry_t* entry) {
+    return pottery_mpmc_queue_try_emplace_bulk(queue, 1, entry) == 1;
+}
+
+static inline
+void pottery_mpmc_queue_commit(pottery_mpmc_queue_t* queue, pottery_mpmc_queue_entry_t entry) {
+    pottery_mpmc_queue_commit_bulk(queue, entry, 1);
+}
+
+
+
+/*
+ * Consumer functions
+ */
+
+/**
+ * Claims up to the given number of values at the front of the queue,
+ * returning the number of values claimed and the first one in entry. Returns
+ * 0 if the queue is empty.
+ *
+ * As with try_emplace_bulk(), the values are contiguous. They stay in their
+ * slots until you call displace_bulk() or remove_bulk(), and producers can't
+ * get past these slots until you do.
+ */
+static inline
+size_t pottery_mpmc_queue_try_claim_bulk(pottery_mpmc_queue_t* queue,
+        size_t count, pottery_mpmc_queue_entry_t* entry)
+{
+    size_t first = 0;
+    size_t claimed = pottery_mpmc_queue_impl_claim(queue, &queue->head, 1, count, true, &first);
+    *entry = pottery_mpmc_queue_impl_slot(queue, first);
+    return claimed;
+}
+
+/**
+ * Hands slots returned by try_claim_bulk() back to producers without
+ * destroying their values.
+ */
+static inline
+void pottery_mpmc_queue_displace_bulk(pottery_mpmc_queue_t* queue,
+        pottery_mpmc_queue_entry_t entry, size_t count)
+{
+    size_t i;
+    for (i = 0; i < count; ++i) {
+        // The sequence is our position plus one. We set it to our position on
+        // the next lap.
+        size_t sequence = pottery_atomic_load_relaxed_s(&entry[i].sequence);
+        pottery_atomic_store_release_s(&entry[i].sequence, sequence + queue->mask);
+    }
+}
+
+/**
+ * Claims the value at the front of the queue, returning false if the queue is
+ * empty. Call displace() or remove() when you're done with it.
+ */
+static inline
+bool pottery_mpmc_queue_try_claim(pottery_mpmc_queue_t* queue, pottery_mpmc_queue_entry_t* entry) {
+    return pottery_mpmc_queue_try_claim_bulk(queue, 1, entry) == 1;
+}
+
+static inline
+void pottery_mpmc_queue_displace(pottery_mpmc_queue_t* queue, pottery_mpmc_queue_entry_t entry) {
+    pottery_mpmc_queue_displace_bulk(queue, entry, 1);
+}
+
+#if POTTERY_LIFECYCLE_CAN_DESTROY
+/**
+ * Destroys the values in slots returned by try_claim_bulk() and hands the
+ * slots back to producers.
+ */
+static inline
+void pottery_mpmc_queue_remove_bulk(pottery_mpmc_queue_t* queue,
+        pottery_mpmc_queue_entry_t entry, size_t count)
+{
+    size_t i;
+    for (i = 0; i < count; ++i)
+        pottery_mpmc_queue_lifecycle_destroy(&entry[i].value);
+    pottery_mpmc_queue_displace_bulk(queue, entry, count);
+}
+
+static inline
+void pottery_mpmc_queue_remove(pottery_mpmc_queue_t* queue, pottery_mpmc_queue_entry_t entry) {
+    pottery_mpmc_queue_remove_bulk(queue, entry, 1);
+}
+#endif
+
+
+
+/*
+ * Pass-by-value functions
+ */
+
+#if POTTERY_LIFECYCLE_CAN_PASS
+/**
+ * Moves the given value into the end of the queue, returning false if the
+ * queue is full.
+ */
+static inline
+bool pottery_mpmc_queue_try_push(pottery_mpmc_queue_t* queue, pottery_mpmc_queue_value_t value) {
+    pottery_mpmc_queue_entry_t entry;
+    if (!pottery_mpmc_queue_try_emplace(queue, &entry))
+        return false;
+    pottery_move_construct(pottery_mpmc_queue_value_t, entry->value, value);
+    pottery_mpmc_queue_commit(queue, entry);
+    return true;
+}
+
+/**
+ * Moves the value at the front of the queue into the given value, returning
+ * false if the queue is empty.
+ */
+static inline
+bool pottery_mpmc_queue_try_pop(pottery_mpmc_queue_t* queue, pottery_mpmc_queue_value_t* value) {
+    pottery_mpmc_queue_entry_t entry;
+    if (!pottery_mpmc_queue_try_claim(queue, &entry))
+        return false;
+    *value = pottery_move_if_cxx(entry->value);
+    #ifdef __cplusplus
+    // see pottery_vector_extract() for details
+    entry->value.~pottery_mpmc_queue_value_t();
+    #endif
+    pottery_mpmc_queue_displace(queue, entry);
+    return true;
+}
+
+#if POTTERY_FORWARD_DECLARATIONS
+/**
+ * Copies as many of the given values as will fit into the end of the queue,
+ * returning the number copied.
+ *
+ * The slots for all of the values are claimed at once. Each value is
+ * published as soon as it's copied.
+ */
+POTTERY_MPMC_QUEUE_EXTERN
+size_t pottery_mpmc_queue_try_push_bulk(pottery_mpmc_queue_t* queue,
+        const pottery_mpmc_queue_value_t* values, size_t count);
+
+/**
+ * Moves up to the given number of values from the front of the queue into
+ * the given array, returning the number moved.
+ */
+POTTERY_MPMC_QUEUE_EXTERN
+size_t pottery_mpmc_queue_try_pop_bulk(pottery_mpmc_queue_t* queue,
+        pottery_mpmc_queue_value_t* values, size_t count);
+#endif
+#endif
@@ -0,0 +1,114 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2020-2021 11037650 Canada Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef POTTERY_MPMC_QUEUE_IMPL
+#error "This is an internal header. Do not include it."
+#endif
+
+POTTERY_MPMC_QUEUE_EXTERN
+pottery_error_t pottery_mpmc_queue_init(pottery_mpmc_queue_t* queue, size_t capacity) {
+    // A capacity of 1 would make a full slot look free to the producer on the
+    // next lap so we need at least 2.
+    size_t rounded = 2;
+    while (rounded < capacity) {
+        // We limit the overall size so we don't need to do overflow checks.
+        if (rounded > SIZE_MAX / 4)
+            return POTTERY_ERROR_ALLOC;
+        rounded *= 2;
+    }
+
+    queue->slots = pottery_cast(pottery_mpmc_queue_slot_t*,
+            pottery_mpmc_queue_alloc_malloc_array(
+                pottery_alignof(pottery_mpmc_queue_slot_t),
+                rounded,
+                sizeof(pottery_mpmc_queue_slot_t)));
+    if (queue->slots == pottery_null)
+        return POTTERY_ERROR_ALLOC;
+
+    size_t i;
+    for (i = 0; i < rounded; ++i)
+        queue->slots[i].sequence = i;
+
+    queue->mask = rounded - 1;
+    queue->tail = 0;
+    queue->head = 0;
+    return POTTERY_OK;
+}
+
+POTTERY_MPMC_QUEUE_EXTERN
+void pottery_mpmc_queue_destroy(pottery_mpmc_queue_t* queue) {
+    #if POTTERY_LIFECYCLE_CAN_DESTROY
+    size_t position;
+    for (position = queue->head; position != queue->tail; ++position) {
+        pottery_mpmc_queue_slot_t* slot = pottery_mpmc_queue_impl_slot(queue, position);
+        pottery_assert(slot->sequence == position + 1);
+        pottery_mpmc_queue_lifecycle_destroy(&slot->value);
+    }
+    #else
+    // Without a destroy expression it is an error to destroy a non-empty
+    // container.
+    pottery_assert(queue->head == queue->tail);
+    #endif
+
+    pottery_mpmc_queue_alloc_free(pottery_alignof(pottery_mpmc_queue_slot_t), queue->slots);
+}
+
+#if POTTERY_LIFECYCLE_CAN_PASS
+POTTERY_MPMC_QUEUE_EXTERN
+size_t pottery_mpmc_queue_try_push_bulk(pottery_mpmc_queue_t* queue,
+        const pottery_mpmc_queue_value_t* values, size_t count)
+{
+    size_t first = 0;
+    count = pottery_mpmc_queue_impl_claim(queue, &queue->tail, 0, count, false, &first);
+
+    size_t i;
+    for (i = 0; i < count; ++i) {
+        pottery_mpmc_queue_slot_t* slot = pottery_mpmc_queue_impl_slot(queue, first + i);
+        pottery_move_construct(pottery_mpmc_queue_value_t, slot->value, values[i]);
+        pottery_atomic_store_release_s(&slot->sequence, first + i + 1);
+    }
+    return count;
+}
+
+POTTERY_MPMC_QUEUE_EXTERN
+size_t pottery_mpmc_queue_try_pop_bulk(pottery_mpmc_queue_t* queue,
+        pottery_mpmc_queue_value_t* values, size_t count)
+{
+    size_t first = 0;
+    count = pottery_mpmc_queue_impl_claim(queue, &queue->head, 1, count, false, &first);
+
+    size_t i;
+    for (i = 0; i < count; ++i) {
+        pottery_mpmc_queue_slot_t* slot = pottery_mpmc_queue_impl_slot(queue, first + i);
+        values[i] = pottery_move_if_cxx(slot->value);
+        #ifdef __cplusplus
+        // see pottery_vector_extract() for details
+        slot->value.~pottery_mpmc_queue_value_t();
+        #endif
+        pottery_atomic_store_release_s(&slot->sequence,
+                first + i + pottery_mpmc_queue_capacity(queue));
+    }
+    return count;
+}
+#endif
@@ -0,0 +1,173 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2020-2021 11037650 Canada Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef POTTERY_MPMC_QUEUE_IMPL
+#error "This is an internal header. Do not include it."
+#endif
+
+#include "pottery/pottery_dependencies.h"
+#include "pottery/platform/pottery_platform_pragma_push.t.h"
+
+#ifndef POTTERY_MPMC_QUEUE_PREFIX
+#error "POTTERY_MPMC_QUEUE_PREFIX is not defined."
+#endif
+#ifndef POTTERY_MPMC_QUEUE_VALUE_TYPE
+#error "POTTERY_MPMC_QUEUE_VALUE_TYPE is not defined."
+#endif
+
+#ifndef POTTERY_MPMC_QUEUE_EXTERN
+#define POTTERY_MPMC_QUEUE_EXTERN /*nothing*/
+#endif
+
+#if !POTTERY_ATOMICS
+    #error "mpmc_queue needs POTTERY_ATOMICS."
+#endif
+
+// The producer and consumer counters are separated by this much padding so
+// that they don't share a cache line.
+#define POTTERY_MPMC_QUEUE_PADDING 64
+
+#define POTTERY_MPMC_QUEUE_NAME(name) POTTERY_CONCAT(POTTERY_MPMC_QUEUE_PREFIX, name)
+
+// types
+#define pottery_mpmc_queue_t POTTERY_MPMC_QUEUE_NAME(_t)
+#define pottery_mpmc_queue_slot_t POTTERY_MPMC_QUEUE_NAME(_slot_t)
+#define pottery_mpmc_queue_entry_t POTTERY_MPMC_QUEUE_NAME(_entry_t)
+
+// public functions
+#define pottery_mpmc_queue_init POTTERY_MPMC_QUEUE_NAME(_init)
+#define pottery_mpmc_queue_destroy POTTERY_MPMC_QUEUE_NAME(_destroy)
+#define pottery_mpmc_queue_capacity POTTERY_MPMC_QUEUE_NAME(_capacity)
+#define pottery_mpmc_queue_count POTTERY_MPMC_QUEUE_NAME(_count)
+#define pottery_mpmc_queue_is_empty POTTERY_MPMC_QUEUE_NAME(_is_empty)
+#define pottery_mpmc_queue_entry_ref POTTERY_MPMC_QUEUE_NAME(_entry_ref)
+#define pottery_mpmc_queue_try_emplace POTTERY_MPMC_QUEUE_NAME(_try_emplace)
+#define pottery_mpmc_queue_try_emplace_bulk POTTERY_MPMC_QUEUE_NAME(_try_emplace_bulk)
+#define pottery_mpmc_queue_commit POTTERY_MPMC_QUEUE_NAME(_commit)
+#define pottery_mpmc_queue_commit_bulk POTTERY_MPMC_QUEUE_NAME(_commit_bulk)
+#define pottery_mpmc_queue_try_claim POTTERY_MPMC_QUEUE_NAME(_try_claim)
+#define pottery_mpmc_queue_try_claim_bulk POTTERY_MPMC_QUEUE_NAME(_try_claim_bulk)
+#define pottery_mpmc_queue_displace POTTERY_MPMC_QUEUE_NAME(_displace)
+#define pottery_mpmc_queue_displace_bulk POTTERY_MPMC_QUEUE_NAME(_displace_bulk)
+#define pottery_mpmc_queue_remove POTTERY_MPMC_QUEUE_NAME(_remove)
+#define pottery_mpmc_queue_remove_bulk POTTERY_MPMC_QUEUE_NAME(_remove_bulk)
+#define pottery_mpmc_queue_try_push POTTERY_MPMC_QUEUE_NAME(_try_push)
+#define pottery_mpmc_queue_try_push_bulk POTTERY_MPMC_QUEUE_NAME(_try_push_bulk)
+#define pottery_mpmc_queue_try_pop POTTERY_MPMC_QUEUE_NAME(_try_pop)
+#define pottery_mpmc_queue_try_pop_bulk POTTERY_MPMC_QUEUE_NAME(_try_pop_bulk)
+
+// internal functions
+#define pottery_mpmc_queue_impl_slot POTTERY_MPMC_QUEUE_NAME(_impl_slot)
+#define pottery_mpmc_queue_impl_claim POTTERY_MPMC_QUEUE_NAME(_impl_claim)
+
+
+
+// container_types
+#ifdef POTTERY_MPMC_QUEUE_EXTERNAL_CONTAINER_TYPES
+    #define POTTERY_MPMC_QUEUE_CONTAINER_TYPES_PREFIX POTTERY_MPMC_QUEUE_EXTERNAL_CONTAINER_TYPES
+#else
+    #define POTTERY_MPMC_QUEUE_CONTAINER_TYPES_PREFIX POTTERY_MPMC_QUEUE_PREFIX
+#endif
+//!!! AUTOGENERATED:container_types/rename.m.h SRC:pottery_mpmc_queue DEST:POTTERY_MPMC_QUEUE_CONTAINER_TYPES_PREFIX
+    // This block is auto-generated. Do not modify until END_AUTOGENERATED.
+    // Renames container_types template identifiers from pottery_mpmc_queue to POTTERY_MPMC_QUEUE_CONTAINER_TYPES_PREFIX
+
+    #define pottery_mpmc_queue_value_t POTTERY_CONCAT(POTTERY_MPMC_QUEUE_CONTAINER_TYPES_PREFIX, _value_t)
+    #define pottery_mpmc_queue_ref_t POTTERY_CONCAT(POTTERY_MPMC_QUEUE_CONTAINER_TYPES_PREFIX, _ref_t)
+    #define pottery_mpmc_queue_const_ref_t POTTERY_CONCAT(POTTERY_MPMC_QUEUE_CONTAINER_TYPES_PREFIX, _const_ref_t)
+    #define pottery_mpmc_queue_key_t POTTERY_CONCAT(POTTERY_MPMC_QUEUE_CONTAINER_TYPES_PREFIX, _key_t)
+    #define pottery_mpmc_queue_context_t POTTERY_CONCAT(POTTERY_MPMC_QUEUE_CONTAINER_TYPES_PREFIX, _context_t)
+
+    #define pottery_mpmc_queue_ref_key POTTERY_CONCAT(POTTERY_MPMC_QUEUE_CONTAINER_TYPES_PREFIX, _ref_key)
+    #define pottery_mpmc_queue_ref_equal POTTERY_CONCAT(POTTERY_MPMC_QUEUE_CONTAINER_TYPES_PREFIX, _ref_equal)
+//!!! END_AUTOGENERATED
+
+
+
+// lifecycle functions
+#ifdef POTTERY_MPMC_QUEUE_EXTERNAL_LIFECYCLE
+    #define POTTERY_MPMC_QUEUE_LIFECYCLE_PREFIX POTTERY_MPMC_QUEUE_EXTERNAL_LIFECYCLE
+#else
+    #define POTTERY_MPMC_QUEUE_LIFECYCLE_PREFIX POTTERY_MPMC_QUEUE_NAME(_lifecycle)
+#endif
+//!!! AUTOGENERATED:lifecycle/rename.m.h SRC:pottery_mpmc_queue_lifecycle DEST:POTTERY_MPMC_QUEUE_LIFECYCLE_PREFIX
+    // This block is auto-generated. Do not modify until END_AUTOGENERATED.
+    // Renames lifecycle identifiers from pottery_mpmc_queue_lifecycle to POTTERY_MPMC_QUEUE_LIFECYCLE_PREFIX
+
+    #define pottery_mpmc_queue_lifecycle_init_steal POTTERY_CONCAT(POTTERY_MPMC_QUEUE_LIFECYCLE_PREFIX, _init_steal)
+    #define pottery_mpmc_queue_lifecycle_init_copy POTTERY_CONCAT(POTTERY_MPMC_QUEUE_LIFECYCLE_PREFIX, _init_copy)
+    #define pottery_mpmc_queue_lifecycle_init POTTERY_CONCAT(POTTERY_MPMC_QUEUE_LIFECYCLE_PREFIX, _init)
+    #define pottery_mpmc_queue_lifecycle_destroy POTTERY_CONCAT(POTTERY_MPMC_QUEUE_LIFECYCLE_PREFIX, _destroy)
+
+    #define pottery_mpmc_queue_lifecycle_swap POTTERY_CONCAT(POTTERY_MPMC_QUEUE_LIFECYCLE_PREFIX, _swap)
+    #define pottery_mpmc_queue_lifecycle_move POTTERY_CONCAT(POTTERY_MPMC_QUEUE_LIFECYCLE_PREFIX, _move)
+    #define pottery_mpmc_queue_lifecycle_steal POTTERY_CONCAT(POTTERY_MPMC_QUEUE_LIFECYCLE_PREFIX, _steal)
+    #define pottery_mpmc_queue_lifecycle_copy POTTERY_CONCAT(POTTERY_MPMC_QUEUE_LIFECYCLE_PREFIX, _copy)
+    #define pottery_mpmc_queue_lifecycle_swap_restrict POTTERY_CONCAT(POTTERY_MPMC_QUEUE_LIFECYCLE_PREFIX, _swap_restrict)
+    #define pottery_mpmc_queue_lifecycle_move_restrict POTTERY_CONCAT(POTTERY_MPMC_QUEUE_LIFECYCLE_PREFIX, _move_restrict)
+    #define pottery_mpmc_queue_lifecycle_steal_restrict POTTERY_CONCAT(POTTERY_MPMC_QUEUE_LIFECYCLE_PREFIX, _steal_restrict)
+    #define pottery_mpmc_queue_lifecycle_copy_restrict POTTERY_CONCAT(POTTERY_MPMC_QUEUE_LIFECYCLE_PREFIX, _copy_restrict)
+
+    #define pottery_mpmc_queue_lifecycle_destroy_bulk POTTERY_CONCAT(POTTERY_MPMC_QUEUE_LIFECYCLE_PREFIX, _destroy_bulk)
+    #define pottery_mpmc_queue_lifecycle_move_bulk POTTERY_CONCAT(POTTERY_MPMC_QUEUE_LIFECYCLE_PREFIX, _move_bulk)
+    #define pottery_mpmc_queue_lifecycle_move_bulk_restrict POTTERY_CONCAT(POTTERY_MPMC_QUEUE_LIFECYCLE_PREFIX, _move_bulk_restrict)
+    #define pottery_mpmc_queue_lifecycle_move_bulk_restrict_impl POTTERY_CONCAT(POTTERY_MPMC_QUEUE_LIFECYCLE_PREFIX, _move_bulk_restrict_impl)
+    #define pottery_mpmc_queue_lifecycle_move_bulk_up POTTERY_CONCAT(POTTERY_MPMC_QUEUE_LIFECYCLE_PREFIX, _move_bulk_up)
+    #define pottery_mpmc_queue_lifecycle_move_bulk_up_impl POTTERY_CONCAT(POTTERY_MPMC_QUEUE_LIFECYCLE_PREFIX, _move_bulk_up_impl)
+    #define pottery_mpmc_queue_lifecycle_move_bulk_down POTTERY_CONCAT(POTTERY_MPMC_QUEUE_LIFECYCLE_PREFIX, _move_bulk_down)
+    #define pottery_mpmc_queue_lifecycle_move_bulk_down_impl POTTERY_CONCAT(POTTERY_MPMC_QUEUE_LIFECYCLE_PREFIX, _move_bulk_down_impl)
+//!!! END_AUTOGENERATED
+
+
+
+// alloc functions
+#ifdef POTTERY_MPMC_QUEUE_EXTERNAL_ALLOC
+    #define POTTERY_MPMC_QUEUE_ALLOC_PREFIX POTTERY_MPMC_QUEUE_EXTERNAL_ALLOC
+#else
+    #define POTTERY_MPMC_QUEUE_ALLOC_PREFIX POTTERY_MPMC_QUEUE_NAME(_alloc)
+#endif
+//!!! AUTOGENERATED:alloc/rename.m.h SRC:pottery_mpmc_queue_alloc DEST:POTTERY_MPMC_QUEUE_ALLOC_PREFIX
+    // This block is auto-generated. Do not modify until END_AUTOGENERATED.
+    // Renames alloc identifiers from pottery_mpmc_queue_alloc to POTTERY_MPMC_QUEUE_ALLOC_PREFIX
+
+    #define pottery_mpmc_queue_alloc_free POTTERY_CONCAT(POTTERY_MPMC_QUEUE_ALLOC_PREFIX, _free)
+    #define pottery_mpmc_queue_alloc_impl_free_ea POTTERY_CONCAT(POTTERY_MPMC_QUEUE_ALLOC_PREFIX, _impl_free_ea)
+    #define pottery_mpmc_queue_alloc_impl_free_fa POTTERY_CONCAT(POTTERY_MPMC_QUEUE_ALLOC_PREFIX, _impl_free_fa)
+
+    #define pottery_mpmc_queue_alloc_malloc POTTERY_CONCAT(POTTERY_MPMC_QUEUE_ALLOC_PREFIX, _malloc)
+    #define pottery_mpmc_queue_alloc_impl_malloc_ea POTTERY_CONCAT(POTTERY_MPMC_QUEUE_ALLOC_PREFIX, _impl_malloc_ea)
+    #define pottery_mpmc_queue_alloc_impl_malloc_fa POTTERY_CONCAT(POTTERY_MPMC_QUEUE_ALLOC_PREFIX, _impl_malloc_fa)
+
+    #define pottery_mpmc_queue_alloc_malloc_zero POTTERY_CONCAT(POTTERY_MPMC_QUEUE_ALLOC_PREFIX, _malloc_zero)
+    #define pottery_mpmc_queue_alloc_impl_malloc_zero_ea POTTERY_CONCAT(POTTERY_MPMC_QUEUE_ALLOC_PREFIX, _impl_malloc_zero_ea)
+    #define pottery_mpmc_queue_alloc_impl_malloc_zero_fa POTTERY_CONCAT(POTTERY_MPMC_QUEUE_ALLOC_PREFIX, _impl_malloc_zero_fa)
+    #define pottery_mpmc_queue_alloc_impl_malloc_zero_fa_wrap POTTERY_CONCAT(POTTERY_MPMC_QUEUE_ALLOC_PREFIX, _impl_malloc_zero_fa_wrap)
+
+    #define pottery_mpmc_queue_alloc_malloc_array_at_least POTTERY_CONCAT(POTTERY_MPMC_QUEUE_ALLOC_PREFIX, _malloc_array_at_least)
+    #define pottery_mpmc_queue_alloc_impl_malloc_array_at_least_ea POTTERY_CONCAT(POTTERY_MPMC_QUEUE_ALLOC_PREFIX, _impl_malloc_array_at_least_ea)
+    #define pottery_mpmc_queue_alloc_impl_malloc_array_at_least_fa POTTERY_CONCAT(POTTERY_MPMC_QUEUE_ALLOC_PREFIX, _impl_malloc_array_at_least_fa)
+
+    #define pottery_mpmc_queue_alloc_malloc_array POTTERY_CONCAT(POTTERY_MPMC_QUEUE_ALLOC_PREFIX, _malloc_array)
+    #define pottery_mpmc_queue_alloc_malloc_array_zero POTTERY_CONCAT(POTTERY_MPMC_QUEUE_ALLOC_PREFIX, _malloc_array_zero)
+//!!! END_AUTOGENERATED
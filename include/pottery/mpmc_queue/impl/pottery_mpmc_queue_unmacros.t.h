@@ -0,0 +1,208 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2020-2021 11037650 Canada Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef POTTERY_MPMC_QUEUE_IMPL
+#error "This is an internal header. Do not include it."
+#endif
+
+
+#undef POTTERY_MPMC_QUEUE_PREFIX
+#undef POTTERY_MPMC_QUEUE_VALUE_TYPE
+#undef POTTERY_MPMC_QUEUE_EXTERN
+#undef POTTERY_MPMC_QUEUE_EXTERNAL_ALLOC
+#undef POTTERY_MPMC_QUEUE_NAME
+#undef POTTERY_MPMC_QUEUE_PADDING
+
+// types
+#undef pottery_mpmc_queue_t
+#undef pottery_mpmc_queue_slot_t
+#undef pottery_mpmc_queue_entry_t
+
+// public functions
+#undef pottery_mpmc_queue_init
+#undef pottery_mpmc_queue_destroy
+#undef pottery_mpmc_queue_capacity
+#undef pottery_mpmc_queue_count
+#undef pottery_mpmc_queue_is_empty
+#undef pottery_mpmc_queue_entry_ref
+#undef pottery_mpmc_queue_try_emplace
+#undef pottery_mpmc_queue_try_emplace_bulk
+#undef pottery_mpmc_queue_commit
+#undef pottery_mpmc_queue_commit_bulk
+#undef pottery_mpmc_queue_try_claim
+#undef pottery_mpmc_queue_try_claim_bulk
+#undef pottery_mpmc_queue_displace
+#undef pottery_mpmc_queue_displace_bulk
+#undef pottery_mpmc_queue_remove
+#undef pottery_mpmc_queue_remove_bulk
+#undef pottery_mpmc_queue_try_push
+#undef pottery_mpmc_queue_try_push_bulk
+#undef pottery_mpmc_queue_try_pop
+#undef pottery_mpmc_queue_try_pop_bulk
+
+// internal functions
+#undef pottery_mpmc_queue_impl_slot
+#undef pottery_mpmc_queue_impl_claim
+
+
+
+// container types
+
+#undef POTTERY_MPMC_QUEUE_CONTAINER_TYPES_PREFIX
+//!!! AUTOGENERATED:container_types/unrename.m.h PREFIX:pottery_mpmc_queue
+    // This block is auto-generated. Do not modify until END_AUTOGENERATED.
+    // Unrenames container_types template identifiers from pottery_mpmc_queue
+
+    #undef pottery_mpmc_queue_value_t
+    #undef pottery_mpmc_queue_ref_t
+    #undef pottery_mpmc_queue_const_ref_t
+    #undef pottery_mpmc_queue_key_t
+    #undef pottery_mpmc_queue_context_t
+
+    #undef pottery_mpmc_queue_ref_key
+    #undef pottery_mpmc_queue_ref_equal
+//!!! END_AUTOGENERATED
+
+//!!! AUTOGENERATED:container_types/unconfigure.m.h CONFIG:POTTERY_MPMC_QUEUE
+    // This block is auto-generated. Do not modify until END_AUTOGENERATED.
+    // Undefines (forwardable/forwarded) container_types configuration on POTTERY_MPMC_QUEUE
+
+    // types
+    #undef POTTERY_MPMC_QUEUE_VALUE_TYPE
+    #undef POTTERY_MPMC_QUEUE_REF_TYPE
+    #undef POTTERY_MPMC_QUEUE_ENTRY_TYPE
+    #undef POTTERY_MPMC_QUEUE_KEY_TYPE
+    #undef POTTERY_MPMC_QUEUE_CONTEXT_TYPE
+
+    // Conversion and comparison expressions
+    #undef POTTERY_MPMC_QUEUE_ENTRY_REF
+    #undef POTTERY_MPMC_QUEUE_REF_KEY
+    #undef POTTERY_MPMC_QUEUE_REF_EQUAL
+//!!! END_AUTOGENERATED
+
+
+
+// lifecycle
+
+#undef POTTERY_MPMC_QUEUE_LIFECYCLE_PREFIX
+
+//!!! AUTOGENERATED:lifecycle/unconfigure.m.h PREFIX:POTTERY_MPMC_QUEUE_LIFECYCLE
+    // This block is auto-generated. Do not modify until END_AUTOGENERATED.
+
+    // Undefines (forwardable/forwarded) lifecycle configuration on POTTERY_MPMC_QUEUE_LIFECYCLE
+
+    #undef POTTERY_MPMC_QUEUE_LIFECYCLE_BY_VALUE
+    #undef POTTERY_MPMC_QUEUE_LIFECYCLE_DESTROY
+    #undef POTTERY_MPMC_QUEUE_LIFECYCLE_DESTROY_BY_VALUE
+    #undef POTTERY_MPMC_QUEUE_LIFECYCLE_INIT
+    #undef POTTERY_MPMC_QUEUE_LIFECYCLE_INIT_BY_VALUE
+    #undef POTTERY_MPMC_QUEUE_LIFECYCLE_INIT_COPY
+    #undef POTTERY_MPMC_QUEUE_LIFECYCLE_INIT_COPY_BY_VALUE
+    #undef POTTERY_MPMC_QUEUE_LIFECYCLE_INIT_STEAL
+    #undef POTTERY_MPMC_QUEUE_LIFECYCLE_INIT_STEAL_BY_VALUE
+    #undef POTTERY_MPMC_QUEUE_LIFECYCLE_MOVE
+    #undef POTTERY_MPMC_QUEUE_LIFECYCLE_MOVE_BY_VALUE
+    #undef POTTERY_MPMC_QUEUE_LIFECYCLE_COPY
+    #undef POTTERY_MPMC_QUEUE_LIFECYCLE_COPY_BY_VALUE
+    #undef POTTERY_MPMC_QUEUE_LIFECYCLE_STEAL
+    #undef POTTERY_MPMC_QUEUE_LIFECYCLE_STEAL_BY_VALUE
+    #undef POTTERY_MPMC_QUEUE_LIFECYCLE_SWAP
+    #undef POTTERY_MPMC_QUEUE_LIFECYCLE_SWAP_BY_VALUE
+//!!! END_AUTOGENERATED
+
+//!!! AUTOGENERATED:alloc/unconfigure.m.h PREFIX:POTTERY_MPMC_QUEUE_ALLOC
+    // This block is auto-generated. Do not modify until END_AUTOGENERATED.
+    // Undefines (forwardable/forwarded) alloc configuration on POTTERY_MPMC_QUEUE_ALLOC
+    #undef POTTERY_MPMC_QUEUE_ALLOC_CONTEXT_TYPE
+
+    #undef POTTERY_MPMC_QUEUE_ALLOC_FREE
+    #undef POTTERY_MPMC_QUEUE_ALLOC_MALLOC
+    #undef POTTERY_MPMC_QUEUE_ALLOC_ZALLOC
+    #undef POTTERY_MPMC_QUEUE_ALLOC_REALLOC
+    #undef POTTERY_MPMC_QUEUE_ALLOC_MALLOC_GOOD_SIZE
+
+    #undef POTTERY_MPMC_QUEUE_ALLOC_ALIGNED_FREE
+    #undef POTTERY_MPMC_QUEUE_ALLOC_ALIGNED_MALLOC
+    #undef POTTERY_MPMC_QUEUE_ALLOC_ALIGNED_ZALLOC
+    #undef POTTERY_MPMC_QUEUE_ALLOC_ALIGNED_REALLOC
+    #undef POTTERY_MPMC_QUEUE_ALLOC_ALIGNED_MALLOC_GOOD_SIZE
+//!!! END_AUTOGENERATED
+
+//!!! AUTOGENERATED:lifecycle/unrename.m.h PREFIX:pottery_mpmc_queue_lifecycle
+    // This block is auto-generated. Do not modify until END_AUTOGENERATED.
+    // Un-renames lifecycle identifiers with prefix "pottery_mpmc_queue_lifecycle"
+
+    #undef pottery_mpmc_queue_lifecycle_init_steal
+    #undef pottery_mpmc_queue_lifecycle_init_copy
+    #undef pottery_mpmc_queue_lifecycle_init
+    #undef pottery_mpmc_queue_lifecycle_destroy
+    #undef pottery_mpmc_queue_lifecycle_swap
+    #undef pottery_mpmc_queue_lifecycle_move
+    #undef pottery_mpmc_queue_lifecycle_steal
+    #undef pottery_mpmc_queue_lifecycle_copy
+
+    #undef pottery_mpmc_queue_lifecycle_move_bulk
+    #undef pottery_mpmc_queue_lifecycle_move_bulk_restrict
+    #undef pottery_mpmc_queue_lifecycle_move_bulk_restrict_impl
+    #undef pottery_mpmc_queue_lifecycle_move_bulk_up
+    #undef pottery_mpmc_queue_lifecycle_move_bulk_up_impl
+    #undef pottery_mpmc_queue_lifecycle_move_bulk_down
+    #undef pottery_mpmc_queue_lifecycle_move_bulk_down_impl
+    #undef pottery_mpmc_queue_lifecycle_destroy_bulk
+//!!! END_AUTOGENERATED
+
+
+
+// alloc
+
+#undef POTTERY_MPMC_QUEUE_ALLOC_PREFIX
+
+//!!! AUTOGENERATED:alloc/unrename.m.h PREFIX:pottery_mpmc_queue_alloc
+    // This block is auto-generated. Do not modify until END_AUTOGENERATED.
+    // Un-renames alloc identifiers with prefix "pottery_mpmc_queue_alloc"
+
+    #undef pottery_mpmc_queue_alloc_free
+    #undef pottery_mpmc_queue_alloc_impl_free_ea
+    #undef pottery_mpmc_queue_alloc_impl_free_fa
+
+    #undef pottery_mpmc_queue_alloc_malloc
+    #undef pottery_mpmc_queue_alloc_impl_malloc_ea
+    #undef pottery_mpmc_queue_alloc_impl_malloc_fa
+
+    #undef pottery_mpmc_queue_alloc_malloc_zero
+    #undef pottery_mpmc_queue_alloc_impl_malloc_zero_ea
+    #undef pottery_mpmc_queue_alloc_impl_malloc_zero_fa
+    #undef pottery_mpmc_queue_alloc_impl_malloc_zero_fa_wrap
+
+    #undef pottery_mpmc_queue_alloc_malloc_array_at_least
+    #undef pottery_mpmc_queue_alloc_impl_malloc_array_at_least_ea
+    #undef pottery_mpmc_queue_alloc_impl_malloc_array_at_least_fa
+
+    #undef pottery_mpmc_queue_alloc_malloc_array
+    #undef pottery_mpmc_queue_alloc_malloc_array_zero
+//!!! END_AUTOGENERATED
+
+
+
+#include "pottery/platform/pottery_platform_pragma_pop.t.h"
@@ -0,0 +1,43 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2020-2021 11037650 Canada Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef POTTERY_NODE_HASH_MAP_IMPL
+#error "This is header internal to Pottery. Do not include it."
+#endif
+
+#define POTTERY_CHAINED_HASH_TABLE_PREFIX POTTERY_CONCAT(POTTERY_NODE_HASH_MAP_PREFIX, _table)
+
+// The table will define its own container_types because we want our map as its
+// context.
+#define POTTERY_CHAINED_HASH_TABLE_CONTEXT_TYPE pottery_node_hash_map_t*
+#define POTTERY_CHAINED_HASH_TABLE_VALUE_TYPE pottery_node_hash_map_node_t
+#define POTTERY_CHAINED_HASH_TABLE_KEY_TYPE pottery_node_hash_map_key_t
+#define POTTERY_CHAINED_HASH_TABLE_REF_KEY pottery_node_hash_map_node_key
+#define POTTERY_CHAINED_HASH_TABLE_KEY_HASH pottery_node_hash_map_key_hash
+#define POTTERY_CHAINED_HASH_TABLE_KEY_EQUAL pottery_node_hash_map_key_equal
+
+#if POTTERY_NODE_HASH_MAP_STORE_HASH
+    #define POTTERY_CHAINED_HASH_TABLE_STORED_HASH(map, node) node->hash
+    #define POTTERY_CHAINED_HASH_TABLE_SET_STORED_HASH(map, node, h) node->hash = h
+#endif
@@ -0,0 +1,287 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2020-2021 11037650 Canada Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef POTTERY_NODE_HASH_MAP_IMPL
+#error "This is an internal header. Do not include it."
+#endif
+
+struct pottery_node_hash_map_t {
+    pottery_node_hash_map_table_t table;
+    #ifdef POTTERY_NODE_HASH_MAP_CONTEXT_TYPE
+    pottery_node_hash_map_context_t context;
+    #endif
+};
+
+static inline
+pottery_node_hash_map_key_t pottery_node_hash_map_node_key(pottery_node_hash_map_t* map, pottery_node_hash_map_node_t* node) {
+    (void)map;
+    #if defined(POTTERY_NODE_HASH_MAP_CONTEXT_TYPE)
+        return pottery_node_hash_map_ref_key(map->context, &node->value);
+    #else
+        return pottery_node_hash_map_ref_key(&node->value);
+    #endif
+}
+
+static inline
+size_t pottery_node_hash_map_key_hash(pottery_node_hash_map_t* map, pottery_node_hash_map_key_t key) {
+    (void)map;
+    #if defined(POTTERY_NODE_HASH_MAP_CONTEXT_TYPE)
+        return POTTERY_NODE_HASH_MAP_KEY_HASH(map->context, key);
+    #else
+        return POTTERY_NODE_HASH_MAP_KEY_HASH(key);
+    #endif
+}
+
+static inline
+bool pottery_node_hash_map_key_equal(pottery_node_hash_map_t* map,
+        pottery_node_hash_map_key_t left, pottery_node_hash_map_key_t right)
+{
+    (void)map;
+    #if defined(POTTERY_NODE_HASH_MAP_CONTEXT_TYPE)
+        return POTTERY_NODE_HASH_MAP_KEY_EQUAL(map->context, left, right);
+    #else
+        return POTTERY_NODE_HASH_MAP_KEY_EQUAL(left, right);
+    #endif
+}
+
+#if POTTERY_FORWARD_DECLARATIONS
+POTTERY_NODE_HASH_MAP_EXTERN
+void pottery_node_hash_map_init(pottery_node_hash_map_t* map
+        #ifdef POTTERY_NODE_HASH_MAP_CONTEXT_TYPE
+        , pottery_node_hash_map_context_t context
+        #endif
+        );
+
+POTTERY_NODE_HASH_MAP_EXTERN
+void pottery_node_hash_map_destroy(pottery_node_hash_map_t* map);
+
+/**
+ * Finds the value with the given key or allocates a node for it.
+ *
+ * If a new node is created, its value is uninitialized; you must construct
+ * it (with the given key) before calling any other function on the map.
+ */
+POTTERY_NODE_HASH_MAP_EXTERN
+pottery_error_t pottery_node_hash_map_emplace_key(pottery_node_hash_map_t* map, pottery_node_hash_map_key_t key,
+        pottery_node_hash_map_entry_t* entry, bool* /*nullable*/ out_created);
+
+/**
+ * Same as emplace_key() but with the given pre-computed hash of the key.
+ */
+POTTERY_NODE_HASH_MAP_EXTERN
+pottery_error_t pottery_node_hash_map_emplace_key_with_hash(pottery_node_hash_map_t* map,
+        pottery_node_hash_map_key_t key, size_t hash,
+        pottery_node_hash_map_entry_t* entry, bool* /*nullable*/ out_created);
+
+/**
+ * Makes room for at least the given total number of values so that the map
+ * doesn't need to grow until it holds more than that.
+ *
+ * This does nothing if the map is already large enough.
+ */
+POTTERY_NODE_HASH_MAP_EXTERN
+pottery_error_t pottery_node_hash_map_reserve(pottery_node_hash_map_t* map, size_t count);
+
+/**
+ * Shrinks the bucket array to the smallest size that can hold the map's
+ * values, or frees it if the map is empty.
+ */
+POTTERY_NODE_HASH_MAP_EXTERN
+pottery_error_t pottery_node_hash_map_shrink(pottery_node_hash_map_t* map);
+#endif
+
+static inline
+size_t pottery_node_hash_map_count(pottery_node_hash_map_t* map) {
+    return pottery_node_hash_map_table_count(&map->table);
+}
+
+static inline
+bool pottery_node_hash_map_is_empty(pottery_node_hash_map_t* map) {
+    return pottery_node_hash_map_count(map) == 0;
+}
+
+/**
+ * Returns the number of buckets currently in the map.
+ */
+static inline
+size_t pottery_node_hash_map_bucket_count(pottery_node_hash_map_t* map) {
+    return pottery_node_hash_map_table_bucket_count(&map->table);
+}
+
+/**
+ * Returns the number of values the map can hold before it grows, i.e. its
+ * bucket count (the map's maximum load factor is 1.)
+ */
+static inline
+size_t pottery_node_hash_map_capacity(pottery_node_hash_map_t* map) {
+    return pottery_node_hash_map_bucket_count(map);
+}
+
+static inline
+bool pottery_node_hash_map_entry_exists(pottery_node_hash_map_t* map, pottery_node_hash_map_entry_t entry) {
+    (void)map;
+    return entry != pottery_null;
+}
+
+static inline
+pottery_node_hash_map_entry_t pottery_node_hash_map_find_with_hash(pottery_node_hash_map_t* map,
+        pottery_node_hash_map_key_t key, size_t hash)
+{
+    return pottery_node_hash_map_node_ref(pottery_node_hash_map_table_find_with_hash(&map->table, key, hash));
+}
+
+static inline
+pottery_node_hash_map_entry_t pottery_node_hash_map_find(pottery_node_hash_map_t* map, pottery_node_hash_map_key_t key) {
+    return pottery_node_hash_map_find_with_hash(map, key, pottery_node_hash_map_key_hash(map, key));
+}
+
+POTTERY_NODE_HASH_MAP_EXTERN
+void pottery_node_hash_map_displace(pottery_node_hash_map_t* map, pottery_node_hash_map_entry_t entry);
+
+POTTERY_NODE_HASH_MAP_EXTERN
+void pottery_node_hash_map_displace_all(pottery_node_hash_map_t* map);
+
+/**
+ * Returns true if an entry matching the given key was displaced.
+ */
+POTTERY_NODE_HASH_MAP_EXTERN
+bool pottery_node_hash_map_displace_key(pottery_node_hash_map_t* map, pottery_node_hash_map_key_t key);
+
+#if POTTERY_NODE_HASH_MAP_CAN_DESTROY
+POTTERY_NODE_HASH_MAP_EXTERN
+void pottery_node_hash_map_remove(pottery_node_hash_map_t* map, pottery_node_hash_map_entry_t entry);
+
+POTTERY_NODE_HASH_MAP_EXTERN
+void pottery_node_hash_map_remove_all(pottery_node_hash_map_t* map);
+
+/**
+ * Returns true if an entry matching the given key was removed.
+ */
+POTTERY_NODE_HASH_MAP_EXTERN
+bool pottery_node_hash_map_remove_key(pottery_node_hash_map_t* map, pottery_node_hash_map_key_t key);
+#endif
+
+static inline
+pottery_node_hash_map_value_t* pottery_node_hash_map_entry_ref(pottery_node_hash_map_t* map, pottery_node_hash_map_entry_t entry) {
+    (void)map;
+    return entry;
+}
+
+/**
+ * Returns true if there is a value in the map with this key.
+ */
+static inline
+bool pottery_node_hash_map_contains_key(pottery_node_hash_map_t* map, pottery_node_hash_map_key_t key) {
+    return pottery_null != pottery_node_hash_map_find(map, key);
+}
+
+static inline
+bool pottery_node_hash_map_contains_key_with_hash(pottery_node_hash_map_t* map,
+        pottery_node_hash_map_key_t key, size_t hash)
+{
+    return pottery_null != pottery_node_hash_map_find_with_hash(map, key, hash);
+}
+
+/*
+ * Iteration visits values in bucket order. Entries are stable so they remain
+ * valid as long as their value is in the map, even when it grows or shrinks.
+ */
+
+static inline
+pottery_node_hash_map_entry_t pottery_node_hash_map_first(pottery_node_hash_map_t* map) {
+    return pottery_node_hash_map_node_ref(pottery_node_hash_map_table_first(&map->table));
+}
+
+static inline
+pottery_node_hash_map_entry_t pottery_node_hash_map_begin(pottery_node_hash_map_t* map) {
+    return pottery_node_hash_map_first(map);
+}
+
+static inline
+pottery_node_hash_map_entry_t pottery_node_hash_map_end(pottery_node_hash_map_t* map) {
+    (void)map;
+    return pottery_null;
+}
+
+static inline
+pottery_node_hash_map_entry_t pottery_node_hash_map_next(pottery_node_hash_map_t* map, pottery_node_hash_map_entry_t entry) {
+    return pottery_node_hash_map_node_ref(pottery_node_hash_map_table_next(&map->table, pottery_node_hash_map_ref_node(entry)));
+}
+
+#ifdef POTTERY_NODE_HASH_MAP_CONTEXT_TYPE
+static inline
+pottery_node_hash_map_context_t* pottery_node_hash_map_context(pottery_node_hash_map_t* map) {
+    return &map->context;
+}
+#endif
+/*
+ * insert()
+ */
+
+#if POTTERY_NODE_HASH_MAP_CAN_PASS && POTTERY_NODE_HASH_MAP_CAN_DESTROY
+/**
+ * Inserts a value.
+ *
+ * If a value with the same key already exists in the map, the old value is
+ * destroyed and replaced with the given value.
+ */
+POTTERY_NODE_HASH_MAP_EXTERN
+pottery_error_t pottery_node_hash_map_insert(pottery_node_hash_map_t* map,
+        pottery_node_hash_map_value_t value);
+#endif
+
+
+/*
+ * extract()
+ */
+
+#if POTTERY_NODE_HASH_MAP_CAN_PASS
+
+static inline
+pottery_node_hash_map_value_t pottery_node_hash_map_extract(pottery_node_hash_map_t* map,
+        pottery_node_hash_map_entry_t entry)
+{
+    pottery_node_hash_map_ref_t ref = pottery_node_hash_map_entry_ref(map, entry);
+    pottery_node_hash_map_value_t ret = pottery_move_if_cxx(*ref);
+    #ifdef __cplusplus
+    // We have to run the destructor. See note in pottery_vector_extract()
+    ref->~pottery_node_hash_map_value_t();
+    #endif
+    pottery_node_hash_map_displace(map, entry);
+    return ret;
+}
+
+/**
+ * Extracts a value by key. The value must exist.
+ */
+static inline
+pottery_node_hash_map_value_t pottery_node_hash_map_extract_key(pottery_node_hash_map_t* map,
+        pottery_node_hash_map_key_t key)
+{
+    pottery_node_hash_map_entry_t entry = pottery_node_hash_map_find(map, key);
+    pottery_assert(pottery_node_hash_map_entry_exists(map, entry));
+    return pottery_node_hash_map_extract(map, entry);
+}
+
+#endif
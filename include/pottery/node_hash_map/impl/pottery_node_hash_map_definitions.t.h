@@ -0,0 +1,316 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2020-2021 11037650 Canada Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef POTTERY_NODE_HASH_MAP_IMPL
+#error "This is an internal header. Do not include it."
+#endif
+
+// The smallest bucket array the map allocates
+#define POTTERY_NODE_HASH_MAP_MINIMUM_LOG_2_SIZE 3
+
+// Allocate a node
+static inline
+pottery_node_hash_map_node_t* pottery_node_hash_map_impl_alloc(pottery_node_hash_map_t* map) {
+    (void)map;
+    void* ptr = pottery_node_hash_map_alloc_malloc(POTTERY_NODE_HASH_MAP_CONTEXT_VAL
+                pottery_alignof(pottery_node_hash_map_node_t),
+                sizeof(pottery_node_hash_map_node_t));
+    return pottery_cast(pottery_node_hash_map_node_t*, ptr);
+}
+
+// Free a node
+static inline
+void pottery_node_hash_map_impl_free(pottery_node_hash_map_t* map, pottery_node_hash_map_node_t* node) {
+    (void)map;
+    pottery_node_hash_map_alloc_free(
+            POTTERY_NODE_HASH_MAP_CONTEXT_VAL
+            pottery_alignof(pottery_node_hash_map_node_t),
+            node);
+}
+
+// Allocate an array of buckets
+static inline
+pottery_node_hash_map_node_t** pottery_node_hash_map_impl_alloc_buckets(pottery_node_hash_map_t* map,
+        size_t log_2_size)
+{
+    (void)map;
+    void* ptr = pottery_node_hash_map_alloc_malloc_array(POTTERY_NODE_HASH_MAP_CONTEXT_VAL
+                pottery_alignof(pottery_node_hash_map_node_t*),
+                pottery_cast(size_t, 1) << log_2_size,
+                sizeof(pottery_node_hash_map_node_t*));
+    return pottery_cast(pottery_node_hash_map_node_t**, ptr);
+}
+
+// Free an array of buckets
+static inline
+void pottery_node_hash_map_impl_free_buckets(pottery_node_hash_map_t* map,
+        pottery_node_hash_map_node_t** /*nullable*/ buckets)
+{
+    (void)map;
+    if (buckets == pottery_null)
+        return;
+    pottery_node_hash_map_alloc_free(
+            POTTERY_NODE_HASH_MAP_CONTEXT_VAL
+            pottery_alignof(pottery_node_hash_map_node_t*),
+            buckets);
+}
+
+// Free all nodes, optionally destroying their values, and empty the table.
+// The bucket array is kept.
+static inline
+void pottery_node_hash_map_impl_destroy_nodes(pottery_node_hash_map_t* map, bool destroy) {
+    (void)destroy;
+    size_t bucket_count = pottery_node_hash_map_bucket_count(map);
+    size_t i;
+    for (i = 0; i < bucket_count && map->table.count != 0; ++i) {
+        pottery_node_hash_map_node_t* node = map->table.buckets[i];
+        while (node != pottery_null) {
+            pottery_node_hash_map_node_t* next = node->next;
+            #if POTTERY_NODE_HASH_MAP_CAN_DESTROY
+            if (destroy)
+                pottery_node_hash_map_lifecycle_destroy(POTTERY_NODE_HASH_MAP_CONTEXT_VAL &node->value);
+            #else
+            pottery_assert(!destroy);
+            #endif
+            pottery_node_hash_map_impl_free(map, node);
+            --map->table.count;
+            node = next;
+        }
+    }
+    pottery_node_hash_map_table_unlink_all(&map->table);
+}
+
+// Moves all nodes to a new bucket array of the given size. The nodes
+// themselves are not moved.
+static
+pottery_error_t pottery_node_hash_map_rehash(pottery_node_hash_map_t* map, size_t log_2_size) {
+    if (log_2_size >= sizeof(size_t) * CHAR_BIT - 1)
+        return POTTERY_ERROR_OVERFLOW;
+
+    pottery_node_hash_map_node_t** buckets = pottery_node_hash_map_impl_alloc_buckets(map, log_2_size);
+    if (buckets == pottery_null)
+        return POTTERY_ERROR_ALLOC;
+
+    pottery_node_hash_map_node_t** old_buckets = map->table.buckets;
+    pottery_node_hash_map_table_rehash(&map->table, buckets, log_2_size);
+    pottery_node_hash_map_impl_free_buckets(map, old_buckets);
+    return POTTERY_OK;
+}
+
+// Grows the map if it's full. The maximum load factor is 1.
+static inline
+pottery_error_t pottery_node_hash_map_grow_if_needed(pottery_node_hash_map_t* map) {
+    size_t bucket_count = pottery_node_hash_map_bucket_count(map);
+    if (pottery_node_hash_map_count(map) < bucket_count)
+        return POTTERY_OK;
+    return pottery_node_hash_map_rehash(map, bucket_count == 0 ?
+            POTTERY_NODE_HASH_MAP_MINIMUM_LOG_2_SIZE : map->table.log_2_size + 1);
+}
+
+// Shrinks the map by half if it has fallen below a quarter full.
+static inline
+void pottery_node_hash_map_shrink_if_needed(pottery_node_hash_map_t* map) {
+    if (map->table.log_2_size <= POTTERY_NODE_HASH_MAP_MINIMUM_LOG_2_SIZE)
+        return;
+    if (pottery_node_hash_map_count(map) >= pottery_node_hash_map_bucket_count(map) / 4)
+        return;
+
+    // Shrinking is optional so we ignore allocation failure.
+    (void)pottery_node_hash_map_rehash(map, map->table.log_2_size - 1);
+}
+
+POTTERY_NODE_HASH_MAP_EXTERN
+void pottery_node_hash_map_init(pottery_node_hash_map_t* map
+        #ifdef POTTERY_NODE_HASH_MAP_CONTEXT_TYPE
+        , pottery_node_hash_map_context_t context
+        #endif
+) {
+    #ifdef POTTERY_NODE_HASH_MAP_CONTEXT_TYPE
+    map->context = context;
+    #endif
+
+    // Buckets aren't allocated until the first value is inserted.
+    pottery_node_hash_map_table_init(&map->table, map, pottery_null, 0);
+}
+
+POTTERY_NODE_HASH_MAP_EXTERN
+void pottery_node_hash_map_destroy(pottery_node_hash_map_t* map) {
+
+    #if POTTERY_NODE_HASH_MAP_CAN_DESTROY
+    pottery_node_hash_map_remove_all(map);
+    #else
+    // If we don't have a destroy expression, you must manually empty the hash
+    // map before destroying it.
+    pottery_assert(pottery_node_hash_map_is_empty(map));
+    #endif
+
+    pottery_node_hash_map_impl_free_buckets(map, map->table.buckets);
+    pottery_node_hash_map_table_destroy(&map->table);
+}
+
+POTTERY_NODE_HASH_MAP_EXTERN
+pottery_error_t pottery_node_hash_map_reserve(pottery_node_hash_map_t* map, size_t count) {
+    if (count <= pottery_node_hash_map_capacity(map))
+        return POTTERY_OK;
+
+    size_t log_2_size = POTTERY_NODE_HASH_MAP_MINIMUM_LOG_2_SIZE;
+    while ((pottery_cast(size_t, 1) << log_2_size) < count)
+        if (++log_2_size >= sizeof(size_t) * CHAR_BIT - 1)
+            return POTTERY_ERROR_OVERFLOW;
+    return pottery_node_hash_map_rehash(map, log_2_size);
+}
+
+POTTERY_NODE_HASH_MAP_EXTERN
+pottery_error_t pottery_node_hash_map_shrink(pottery_node_hash_map_t* map) {
+    size_t count = pottery_node_hash_map_count(map);
+
+    // An empty map frees its buckets entirely.
+    if (count == 0) {
+        pottery_node_hash_map_node_t** old_buckets = map->table.buckets;
+        pottery_node_hash_map_table_rehash(&map->table, pottery_null, 0);
+        pottery_node_hash_map_impl_free_buckets(map, old_buckets);
+        return POTTERY_OK;
+    }
+
+    size_t log_2_size = POTTERY_NODE_HASH_MAP_MINIMUM_LOG_2_SIZE;
+    while ((pottery_cast(size_t, 1) << log_2_size) < count)
+        ++log_2_size;
+    if (log_2_size >= map->table.log_2_size)
+        return POTTERY_OK;
+    return pottery_node_hash_map_rehash(map, log_2_size);
+}
+
+POTTERY_NODE_HASH_MAP_EXTERN
+void pottery_node_hash_map_displace(pottery_node_hash_map_t* map, pottery_node_hash_map_entry_t entry) {
+    pottery_node_hash_map_node_t* node = pottery_node_hash_map_ref_node(entry);
+    pottery_node_hash_map_table_unlink(&map->table, node);
+    pottery_node_hash_map_impl_free(map, node);
+    pottery_node_hash_map_shrink_if_needed(map);
+}
+
+POTTERY_NODE_HASH_MAP_EXTERN
+void pottery_node_hash_map_displace_all(pottery_node_hash_map_t* map) {
+    pottery_node_hash_map_impl_destroy_nodes(map, false);
+}
+
+POTTERY_NODE_HASH_MAP_EXTERN
+bool pottery_node_hash_map_displace_key(pottery_node_hash_map_t* map, pottery_node_hash_map_key_t key) {
+    pottery_node_hash_map_node_t* node = pottery_node_hash_map_table_unlink_key(&map->table, key);
+    if (node == pottery_null)
+        return false;
+    pottery_node_hash_map_impl_free(map, node);
+    pottery_node_hash_map_shrink_if_needed(map);
+    return true;
+}
+
+#if POTTERY_NODE_HASH_MAP_CAN_DESTROY
+POTTERY_NODE_HASH_MAP_EXTERN
+void pottery_node_hash_map_remove(pottery_node_hash_map_t* map, pottery_node_hash_map_entry_t entry) {
+    pottery_node_hash_map_node_t* node = pottery_node_hash_map_ref_node(entry);
+    pottery_node_hash_map_table_unlink(&map->table, node);
+    pottery_node_hash_map_lifecycle_destroy(POTTERY_NODE_HASH_MAP_CONTEXT_VAL &node->value);
+    pottery_node_hash_map_impl_free(map, node);
+    pottery_node_hash_map_shrink_if_needed(map);
+}
+
+POTTERY_NODE_HASH_MAP_EXTERN
+void pottery_node_hash_map_remove_all(pottery_node_hash_map_t* map) {
+    pottery_node_hash_map_impl_destroy_nodes(map, true);
+}
+
+POTTERY_NODE_HASH_MAP_EXTERN
+bool pottery_node_hash_map_remove_key(pottery_node_hash_map_t* map, pottery_node_hash_map_key_t key) {
+    pottery_node_hash_map_node_t* node = pottery_node_hash_map_table_unlink_key(&map->table, key);
+    if (node == pottery_null)
+        return false;
+    pottery_node_hash_map_lifecycle_destroy(POTTERY_NODE_HASH_MAP_CONTEXT_VAL &node->value);
+    pottery_node_hash_map_impl_free(map, node);
+    pottery_node_hash_map_shrink_if_needed(map);
+    return true;
+}
+#endif
+
+#if POTTERY_NODE_HASH_MAP_CAN_PASS && POTTERY_NODE_HASH_MAP_CAN_DESTROY
+POTTERY_NODE_HASH_MAP_EXTERN
+pottery_error_t pottery_node_hash_map_insert(pottery_node_hash_map_t* map,
+        pottery_node_hash_map_value_t value)
+{
+    bool created;
+    pottery_node_hash_map_entry_t entry;
+    pottery_error_t error = pottery_node_hash_map_emplace_key(map,
+            pottery_node_hash_map_ref_key(&value), &entry, &created);
+    if (error == POTTERY_OK) {
+        if (!created)
+            pottery_node_hash_map_lifecycle_destroy(entry);
+        pottery_move_construct(pottery_node_hash_map_value_t, *entry, value);
+    }
+    return error;
+}
+#endif // insert criteria
+
+POTTERY_NODE_HASH_MAP_EXTERN
+pottery_error_t pottery_node_hash_map_emplace_key(pottery_node_hash_map_t* map, pottery_node_hash_map_key_t key,
+        pottery_node_hash_map_entry_t* out_entry, bool* /*nullable*/ out_created)
+{
+    return pottery_node_hash_map_emplace_key_with_hash(map, key,
+            pottery_node_hash_map_key_hash(map, key), out_entry, out_created);
+}
+
+POTTERY_NODE_HASH_MAP_EXTERN
+pottery_error_t pottery_node_hash_map_emplace_key_with_hash(pottery_node_hash_map_t* map,
+        pottery_node_hash_map_key_t key, size_t hash,
+        pottery_node_hash_map_entry_t* out_entry, bool* /*nullable*/ out_created)
+{
+    pottery_assert(hash == pottery_node_hash_map_key_hash(map, key));
+    pottery_node_hash_map_node_t* node = pottery_node_hash_map_table_find_with_hash(&map->table, key, hash);
+
+    if (node != pottery_null) {
+        // Found existing entry
+        *out_entry = pottery_node_hash_map_node_ref(node);
+        if (out_created != pottery_null)
+            *out_created = false;
+        return POTTERY_OK;
+    }
+
+    pottery_error_t error = pottery_node_hash_map_grow_if_needed(map);
+    if (error == POTTERY_OK) {
+        node = pottery_node_hash_map_impl_alloc(map);
+        if (node == pottery_null)
+            error = POTTERY_ERROR_ALLOC;
+    }
+    if (error != POTTERY_OK) {
+        *out_entry = pottery_null;
+        if (out_created != pottery_null)
+            *out_created = false;
+        return error;
+    }
+
+    // New entry created. Its value isn't initialized yet but the table
+    // doesn't need its key to link it since we have its hash.
+    pottery_node_hash_map_table_link_with_hash(&map->table, node, hash);
+    *out_entry = pottery_node_hash_map_node_ref(node);
+    if (out_created != pottery_null)
+        *out_created = true;
+    return POTTERY_OK;
+}
@@ -0,0 +1,74 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2020-2021 11037650 Canada Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef POTTERY_NODE_HASH_MAP_IMPL
+#error "This is an internal header. Do not include it."
+#endif
+
+typedef struct pottery_node_hash_map_node_t {
+
+    // value is the first field in node so that we can safely cast between node
+    // and value under strict aliasing rules. find all instances of
+    // pottery_reinterpret_cast() in node_hash_map if you want to change this.
+    pottery_node_hash_map_value_t value;
+
+    // the next node in this node's bucket chain
+    struct pottery_node_hash_map_node_t* next;
+
+    #if POTTERY_NODE_HASH_MAP_STORE_HASH
+    size_t hash;
+    #endif
+
+} pottery_node_hash_map_node_t;
+
+typedef struct pottery_node_hash_map_t pottery_node_hash_map_t;
+
+typedef pottery_node_hash_map_ref_t pottery_node_hash_map_entry_t;
+
+// Convert a node to a ref, correctly handling null
+static inline
+pottery_node_hash_map_ref_t pottery_node_hash_map_node_ref(pottery_node_hash_map_node_t* /*nullable*/ node) {
+    return pottery_reinterpret_cast(pottery_node_hash_map_ref_t, node);
+}
+
+// Convert a ref to a node, correctly handling null
+static inline
+pottery_node_hash_map_node_t* pottery_node_hash_map_ref_node(pottery_node_hash_map_ref_t /*nullable*/ ref) {
+    return pottery_reinterpret_cast(pottery_node_hash_map_node_t*, ref);
+}
+
+static inline
+pottery_node_hash_map_key_t pottery_node_hash_map_node_key(pottery_node_hash_map_t* map, pottery_node_hash_map_node_t* node);
+
+static inline
+size_t pottery_node_hash_map_key_hash(pottery_node_hash_map_t* map, pottery_node_hash_map_key_t key);
+
+static inline
+bool pottery_node_hash_map_key_equal(pottery_node_hash_map_t* map,
+        pottery_node_hash_map_key_t left, pottery_node_hash_map_key_t right);
+
+#ifdef POTTERY_NODE_HASH_MAP_CONTEXT_TYPE
+static inline
+pottery_node_hash_map_context_t* pottery_node_hash_map_context(pottery_node_hash_map_t* map);
+#endif
@@ -0,0 +1,571 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2020-2021 11037650 Canada Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef POTTERY_NODE_HASH_MAP_IMPL
+#error "This is an internal header. Do not include it."
+#endif
+
+
+
+/*
+ * Forwarded configurations
+ */
+
+//!!! AUTOGENERATED:alloc/unconfigure.m.h PREFIX:POTTERY_NODE_HASH_MAP_ALLOC
+    // This block is auto-generated. Do not modify until END_AUTOGENERATED.
+    // Undefines (forwardable/forwarded) alloc configuration on POTTERY_NODE_HASH_MAP_ALLOC
+    #undef POTTERY_NODE_HASH_MAP_ALLOC_CONTEXT_TYPE
+
+    #undef POTTERY_NODE_HASH_MAP_ALLOC_FREE
+    #undef POTTERY_NODE_HASH_MAP_ALLOC_MALLOC
+    #undef POTTERY_NODE_HASH_MAP_ALLOC_ZALLOC
+    #undef POTTERY_NODE_HASH_MAP_ALLOC_REALLOC
+    #undef POTTERY_NODE_HASH_MAP_ALLOC_MALLOC_GOOD_SIZE
+
+    #undef POTTERY_NODE_HASH_MAP_ALLOC_ALIGNED_FREE
+    #undef POTTERY_NODE_HASH_MAP_ALLOC_ALIGNED_MALLOC
+    #undef POTTERY_NODE_HASH_MAP_ALLOC_ALIGNED_ZALLOC
+    #undef POTTERY_NODE_HASH_MAP_ALLOC_ALIGNED_REALLOC
+    #undef POTTERY_NODE_HASH_MAP_ALLOC_ALIGNED_MALLOC_GOOD_SIZE
+//!!! END_AUTOGENERATED
+
+
+
+/*
+ * Configuration
+ */
+
+#undef POTTERY_NODE_HASH_MAP_PREFIX
+#undef POTTERY_NODE_HASH_MAP_VALUE_TYPE
+#undef POTTERY_NODE_HASH_MAP_KEY_HASH
+#undef POTTERY_NODE_HASH_MAP_KEY_EQUAL
+#undef POTTERY_NODE_HASH_MAP_STORE_HASH
+
+#undef POTTERY_NODE_HASH_MAP_EXTERN
+
+#undef POTTERY_NODE_HASH_MAP_CONTEXT_TYPE
+#undef POTTERY_NODE_HASH_MAP_CONTEXT_VAL
+
+#undef POTTERY_NODE_HASH_MAP_CAN_PASS
+#undef POTTERY_NODE_HASH_MAP_CAN_DESTROY
+
+#undef POTTERY_NODE_HASH_MAP_MINIMUM_LOG_2_SIZE
+
+
+
+/*
+ * Renaming
+ */
+
+#undef POTTERY_NODE_HASH_MAP_NAME
+
+#undef pottery_node_hash_map_node_t
+#undef pottery_node_hash_map_node_ref
+#undef pottery_node_hash_map_ref_node
+#undef pottery_node_hash_map_node_key
+#undef pottery_node_hash_map_key_hash
+#undef pottery_node_hash_map_key_equal
+#undef pottery_node_hash_map_context
+#undef pottery_node_hash_map_bucket_count
+#undef pottery_node_hash_map_impl_alloc
+#undef pottery_node_hash_map_impl_free
+#undef pottery_node_hash_map_impl_alloc_buckets
+#undef pottery_node_hash_map_impl_free_buckets
+#undef pottery_node_hash_map_impl_destroy_nodes
+#undef pottery_node_hash_map_rehash
+#undef pottery_node_hash_map_grow_if_needed
+#undef pottery_node_hash_map_shrink_if_needed
+
+
+
+//!!! AUTOGENERATED:container/unrename.m.h PREFIX:pottery_node_hash_map
+    // This block is auto-generated. Do not modify until END_AUTOGENERATED.
+    // Un-renames array identifiers with prefix "pottery_node_hash_map"
+
+    // types
+    #undef pottery_node_hash_map_t
+    #undef pottery_node_hash_map_entry_t
+    #undef pottery_node_hash_map_location_t // currently only used for intrusive maps
+
+    // lifecycle operations
+    #undef pottery_node_hash_map_copy
+    #undef pottery_node_hash_map_destroy
+    #undef pottery_node_hash_map_init
+    #undef pottery_node_hash_map_init_copy
+    #undef pottery_node_hash_map_init_steal
+    #undef pottery_node_hash_map_move
+    #undef pottery_node_hash_map_steal
+    #undef pottery_node_hash_map_swap
+
+    // entry operations
+    #undef pottery_node_hash_map_entry_exists
+    #undef pottery_node_hash_map_entry_equal
+    #undef pottery_node_hash_map_entry_ref
+
+    // lookup
+    #undef pottery_node_hash_map_count
+    #undef pottery_node_hash_map_is_empty
+    #undef pottery_node_hash_map_at
+    #undef pottery_node_hash_map_find
+    #undef pottery_node_hash_map_find_with_hash
+    #undef pottery_node_hash_map_contains_key
+    #undef pottery_node_hash_map_contains_key_with_hash
+    #undef pottery_node_hash_map_find_bulk
+    #undef pottery_node_hash_map_contains_bulk
+    #undef pottery_node_hash_map_first
+    #undef pottery_node_hash_map_last
+    #undef pottery_node_hash_map_any
+
+    // array access
+    #undef pottery_node_hash_map_select
+    #undef pottery_node_hash_map_index
+    #undef pottery_node_hash_map_shift
+    #undef pottery_node_hash_map_offset
+    #undef pottery_node_hash_map_begin
+    #undef pottery_node_hash_map_end
+    #undef pottery_node_hash_map_next
+    #undef pottery_node_hash_map_previous
+
+    // misc
+    #undef pottery_node_hash_map_capacity
+    #undef pottery_node_hash_map_reserve
+    #undef pottery_node_hash_map_shrink
+
+    // insert
+    #undef pottery_node_hash_map_insert
+    #undef pottery_node_hash_map_insert_at
+    #undef pottery_node_hash_map_insert_first
+    #undef pottery_node_hash_map_insert_last
+    #undef pottery_node_hash_map_insert_before
+    #undef pottery_node_hash_map_insert_after
+    #undef pottery_node_hash_map_insert_bulk
+    #undef pottery_node_hash_map_insert_at_bulk
+    #undef pottery_node_hash_map_insert_first_bulk
+    #undef pottery_node_hash_map_insert_last_bulk
+    #undef pottery_node_hash_map_insert_before_bulk
+    #undef pottery_node_hash_map_insert_after_bulk
+
+    // emplace
+    #undef pottery_node_hash_map_emplace
+    #undef pottery_node_hash_map_emplace_at
+    #undef pottery_node_hash_map_emplace_key
+    #undef pottery_node_hash_map_emplace_key_with_hash
+    #undef pottery_node_hash_map_emplace_first
+    #undef pottery_node_hash_map_emplace_last
+    #undef pottery_node_hash_map_emplace_before
+    #undef pottery_node_hash_map_emplace_after
+    #undef pottery_node_hash_map_emplace_bulk
+    #undef pottery_node_hash_map_emplace_at_bulk
+    #undef pottery_node_hash_map_emplace_first_bulk
+    #undef pottery_node_hash_map_emplace_last_bulk
+    #undef pottery_node_hash_map_emplace_before_bulk
+    #undef pottery_node_hash_map_emplace_after_bulk
+
+    // construct
+    #undef pottery_node_hash_map_construct
+    #undef pottery_node_hash_map_construct_at
+    #undef pottery_node_hash_map_construct_key
+    #undef pottery_node_hash_map_construct_first
+    #undef pottery_node_hash_map_construct_last
+    #undef pottery_node_hash_map_construct_before
+    #undef pottery_node_hash_map_construct_after
+
+    // extract
+    #undef pottery_node_hash_map_extract
+    #undef pottery_node_hash_map_extract_at
+    #undef pottery_node_hash_map_extract_key
+    #undef pottery_node_hash_map_extract_first
+    #undef pottery_node_hash_map_extract_first_bulk
+    #undef pottery_node_hash_map_extract_last
+    #undef pottery_node_hash_map_extract_last_bulk
+    #undef pottery_node_hash_map_extract_and_next
+    #undef pottery_node_hash_map_extract_and_previous
+
+    // remove
+    #undef pottery_node_hash_map_remove
+    #undef pottery_node_hash_map_remove_at
+    #undef pottery_node_hash_map_remove_key
+    #undef pottery_node_hash_map_remove_key_with_hash
+    #undef pottery_node_hash_map_remove_first
+    #undef pottery_node_hash_map_remove_last
+    #undef pottery_node_hash_map_remove_and_next
+    #undef pottery_node_hash_map_remove_and_previous
+    #undef pottery_node_hash_map_remove_all
+    #undef pottery_node_hash_map_remove_bulk
+    #undef pottery_node_hash_map_remove_at_bulk
+    #undef pottery_node_hash_map_remove_first_bulk
+    #undef pottery_node_hash_map_remove_last_bulk
+    #undef pottery_node_hash_map_remove_at_bulk
+    #undef pottery_node_hash_map_remove_and_next_bulk
+    #undef pottery_node_hash_map_remove_and_previous_bulk
+
+    // displace
+    #undef pottery_node_hash_map_displace
+    #undef pottery_node_hash_map_displace_at
+    #undef pottery_node_hash_map_displace_key
+    #undef pottery_node_hash_map_displace_first
+    #undef pottery_node_hash_map_displace_last
+    #undef pottery_node_hash_map_displace_and_next
+    #undef pottery_node_hash_map_displace_and_previous
+    #undef pottery_node_hash_map_displace_all
+    #undef pottery_node_hash_map_displace_bulk
+    #undef pottery_node_hash_map_displace_at_bulk
+    #undef pottery_node_hash_map_displace_first_bulk
+    #undef pottery_node_hash_map_displace_last_bulk
+    #undef pottery_node_hash_map_displace_and_next_bulk
+    #undef pottery_node_hash_map_displace_and_previous_bulk
+
+    // link
+    #undef pottery_node_hash_map_link
+    #undef pottery_node_hash_map_link_first
+    #undef pottery_node_hash_map_link_last
+    #undef pottery_node_hash_map_link_before
+    #undef pottery_node_hash_map_link_after
+
+    // unlink
+    #undef pottery_node_hash_map_unlink
+    #undef pottery_node_hash_map_unlink_at
+    #undef pottery_node_hash_map_unlink_key
+    #undef pottery_node_hash_map_unlink_first
+    #undef pottery_node_hash_map_unlink_last
+    #undef pottery_node_hash_map_unlink_and_next
+    #undef pottery_node_hash_map_unlink_and_previous
+    #undef pottery_node_hash_map_unlink_all
+
+    // special links
+    #undef pottery_node_hash_map_replace
+    #undef pottery_node_hash_map_find_location
+    #undef pottery_node_hash_map_link_location
+//!!! END_AUTOGENERATED
+
+
+
+// chained_hash_table
+
+#undef POTTERY_NODE_HASH_MAP_CHT_PREFIX
+
+//!!! AUTOGENERATED:container/unrename.m.h PREFIX:pottery_node_hash_map_table
+    // This block is auto-generated. Do not modify until END_AUTOGENERATED.
+    // Un-renames array identifiers with prefix "pottery_node_hash_map_table"
+
+    // types
+    #undef pottery_node_hash_map_table_t
+    #undef pottery_node_hash_map_table_entry_t
+    #undef pottery_node_hash_map_table_location_t // currently only used for intrusive maps
+
+    // lifecycle operations
+    #undef pottery_node_hash_map_table_copy
+    #undef pottery_node_hash_map_table_destroy
+    #undef pottery_node_hash_map_table_init
+    #undef pottery_node_hash_map_table_init_copy
+    #undef pottery_node_hash_map_table_init_steal
+    #undef pottery_node_hash_map_table_move
+    #undef pottery_node_hash_map_table_steal
+    #undef pottery_node_hash_map_table_swap
+
+    // entry operations
+    #undef pottery_node_hash_map_table_entry_exists
+    #undef pottery_node_hash_map_table_entry_equal
+    #undef pottery_node_hash_map_table_entry_ref
+
+    // lookup
+    #undef pottery_node_hash_map_table_count
+    #undef pottery_node_hash_map_table_is_empty
+    #undef pottery_node_hash_map_table_at
+    #undef pottery_node_hash_map_table_find
+    #undef pottery_node_hash_map_table_find_with_hash
+    #undef pottery_node_hash_map_table_contains_key
+    #undef pottery_node_hash_map_table_contains_key_with_hash
+    #undef pottery_node_hash_map_table_find_bulk
+    #undef pottery_node_hash_map_table_contains_bulk
+    #undef pottery_node_hash_map_table_first
+    #undef pottery_node_hash_map_table_last
+    #undef pottery_node_hash_map_table_any
+
+    // array access
+    #undef pottery_node_hash_map_table_select
+    #undef pottery_node_hash_map_table_index
+    #undef pottery_node_hash_map_table_shift
+    #undef pottery_node_hash_map_table_offset
+    #undef pottery_node_hash_map_table_begin
+    #undef pottery_node_hash_map_table_end
+    #undef pottery_node_hash_map_table_next
+    #undef pottery_node_hash_map_table_previous
+
+    // misc
+    #undef pottery_node_hash_map_table_capacity
+    #undef pottery_node_hash_map_table_reserve
+    #undef pottery_node_hash_map_table_shrink
+
+    // insert
+    #undef pottery_node_hash_map_table_insert
+    #undef pottery_node_hash_map_table_insert_at
+    #undef pottery_node_hash_map_table_insert_first
+    #undef pottery_node_hash_map_table_insert_last
+    #undef pottery_node_hash_map_table_insert_before
+    #undef pottery_node_hash_map_table_insert_after
+    #undef pottery_node_hash_map_table_insert_bulk
+    #undef pottery_node_hash_map_table_insert_at_bulk
+    #undef pottery_node_hash_map_table_insert_first_bulk
+    #undef pottery_node_hash_map_table_insert_last_bulk
+    #undef pottery_node_hash_map_table_insert_before_bulk
+    #undef pottery_node_hash_map_table_insert_after_bulk
+
+    // emplace
+    #undef pottery_node_hash_map_table_emplace
+    #undef pottery_node_hash_map_table_emplace_at
+    #undef pottery_node_hash_map_table_emplace_key
+    #undef pottery_node_hash_map_table_emplace_key_with_hash
+    #undef pottery_node_hash_map_table_emplace_first
+    #undef pottery_node_hash_map_table_emplace_last
+    #undef pottery_node_hash_map_table_emplace_before
+    #undef pottery_node_hash_map_table_emplace_after
+    #undef pottery_node_hash_map_table_emplace_bulk
+    #undef pottery_node_hash_map_table_emplace_at_bulk
+    #undef pottery_node_hash_map_table_emplace_first_bulk
+    #undef pottery_node_hash_map_table_emplace_last_bulk
+    #undef pottery_node_hash_map_table_emplace_before_bulk
+    #undef pottery_node_hash_map_table_emplace_after_bulk
+
+    // construct
+    #undef pottery_node_hash_map_table_construct
+    #undef pottery_node_hash_map_table_construct_at
+    #undef pottery_node_hash_map_table_construct_key
+    #undef pottery_node_hash_map_table_construct_first
+    #undef pottery_node_hash_map_table_construct_last
+    #undef pottery_node_hash_map_table_construct_before
+    #undef pottery_node_hash_map_table_construct_after
+
+    // extract
+    #undef pottery_node_hash_map_table_extract
+    #undef pottery_node_hash_map_table_extract_at
+    #undef pottery_node_hash_map_table_extract_key
+    #undef pottery_node_hash_map_table_extract_first
+    #undef pottery_node_hash_map_table_extract_first_bulk
+    #undef pottery_node_hash_map_table_extract_last
+    #undef pottery_node_hash_map_table_extract_last_bulk
+    #undef pottery_node_hash_map_table_extract_and_next
+    #undef pottery_node_hash_map_table_extract_and_previous
+
+    // remove
+    #undef pottery_node_hash_map_table_remove
+    #undef pottery_node_hash_map_table_remove_at
+    #undef pottery_node_hash_map_table_remove_key
+    #undef pottery_node_hash_map_table_remove_key_with_hash
+    #undef pottery_node_hash_map_table_remove_first
+    #undef pottery_node_hash_map_table_remove_last
+    #undef pottery_node_hash_map_table_remove_and_next
+    #undef pottery_node_hash_map_table_remove_and_previous
+    #undef pottery_node_hash_map_table_remove_all
+    #undef pottery_node_hash_map_table_remove_bulk
+    #undef pottery_node_hash_map_table_remove_at_bulk
+    #undef pottery_node_hash_map_table_remove_first_bulk
+    #undef pottery_node_hash_map_table_remove_last_bulk
+    #undef pottery_node_hash_map_table_remove_at_bulk
+    #undef pottery_node_hash_map_table_remove_and_next_bulk
+    #undef pottery_node_hash_map_table_remove_and_previous_bulk
+
+    // displace
+    #undef pottery_node_hash_map_table_displace
+    #undef pottery_node_hash_map_table_displace_at
+    #undef pottery_node_hash_map_table_displace_key
+    #undef pottery_node_hash_map_table_displace_first
+    #undef pottery_node_hash_map_table_displace_last
+    #undef pottery_node_hash_map_table_displace_and_next
+    #undef pottery_node_hash_map_table_displace_and_previous
+    #undef pottery_node_hash_map_table_displace_all
+    #undef pottery_node_hash_map_table_displace_bulk
+    #undef pottery_node_hash_map_table_displace_at_bulk
+    #undef pottery_node_hash_map_table_displace_first_bulk
+    #undef pottery_node_hash_map_table_displace_last_bulk
+    #undef pottery_node_hash_map_table_displace_and_next_bulk
+    #undef pottery_node_hash_map_table_displace_and_previous_bulk
+
+    // link
+    #undef pottery_node_hash_map_table_link
+    #undef pottery_node_hash_map_table_link_first
+    #undef pottery_node_hash_map_table_link_last
+    #undef pottery_node_hash_map_table_link_before
+    #undef pottery_node_hash_map_table_link_after
+
+    // unlink
+    #undef pottery_node_hash_map_table_unlink
+    #undef pottery_node_hash_map_table_unlink_at
+    #undef pottery_node_hash_map_table_unlink_key
+    #undef pottery_node_hash_map_table_unlink_first
+    #undef pottery_node_hash_map_table_unlink_last
+    #undef pottery_node_hash_map_table_unlink_and_next
+    #undef pottery_node_hash_map_table_unlink_and_previous
+    #undef pottery_node_hash_map_table_unlink_all
+
+    // special links
+    #undef pottery_node_hash_map_table_replace
+    #undef pottery_node_hash_map_table_find_location
+    #undef pottery_node_hash_map_table_link_location
+//!!! END_AUTOGENERATED
+#undef pottery_node_hash_map_table_bucket_count
+#undef pottery_node_hash_map_table_link_with_hash
+#undef pottery_node_hash_map_table_rehash
+
+
+
+// container types
+
+#undef POTTERY_NODE_HASH_MAP_CONTAINER_TYPES_PREFIX
+//!!! AUTOGENERATED:container_types/unrename.m.h PREFIX:pottery_node_hash_map
+    // This block is auto-generated. Do not modify until END_AUTOGENERATED.
+    // Unrenames container_types template identifiers from pottery_node_hash_map
+
+    #undef pottery_node_hash_map_value_t
+    #undef pottery_node_hash_map_ref_t
+    #undef pottery_node_hash_map_const_ref_t
+    #undef pottery_node_hash_map_key_t
+    #undef pottery_node_hash_map_context_t
+
+    #undef pottery_node_hash_map_ref_key
+    #undef pottery_node_hash_map_ref_equal
+//!!! END_AUTOGENERATED
+
+//!!! AUTOGENERATED:container_types/unconfigure.m.h CONFIG:POTTERY_NODE_HASH_MAP
+    // This block is auto-generated. Do not modify until END_AUTOGENERATED.
+    // Undefines (forwardable/forwarded) container_types configuration on POTTERY_NODE_HASH_MAP
+
+    // types
+    #undef POTTERY_NODE_HASH_MAP_VALUE_TYPE
+    #undef POTTERY_NODE_HASH_MAP_REF_TYPE
+    #undef POTTERY_NODE_HASH_MAP_ENTRY_TYPE
+    #undef POTTERY_NODE_HASH_MAP_KEY_TYPE
+    #undef POTTERY_NODE_HASH_MAP_CONTEXT_TYPE
+
+    // Conversion and comparison expressions
+    #undef POTTERY_NODE_HASH_MAP_ENTRY_REF
+    #undef POTTERY_NODE_HASH_MAP_REF_KEY
+    #undef POTTERY_NODE_HASH_MAP_REF_EQUAL
+//!!! END_AUTOGENERATED
+
+
+
+// lifecycle
+
+#undef POTTERY_NODE_HASH_MAP_LIFECYCLE_PREFIX
+
+//!!! AUTOGENERATED:lifecycle/unrename.m.h PREFIX:pottery_node_hash_map_lifecycle
+    // This block is auto-generated. Do not modify until END_AUTOGENERATED.
+    // Un-renames lifecycle identifiers with prefix "pottery_node_hash_map_lifecycle"
+
+    #undef pottery_node_hash_map_lifecycle_init_steal
+    #undef pottery_node_hash_map_lifecycle_init_copy
+    #undef pottery_node_hash_map_lifecycle_init
+    #undef pottery_node_hash_map_lifecycle_destroy
+    #undef pottery_node_hash_map_lifecycle_swap
+    #undef pottery_node_hash_map_lifecycle_move
+    #undef pottery_node_hash_map_lifecycle_steal
+    #undef pottery_node_hash_map_lifecycle_copy
+
+    #undef pottery_node_hash_map_lifecycle_move_bulk
+    #undef pottery_node_hash_map_lifecycle_move_bulk_restrict
+    #undef pottery_node_hash_map_lifecycle_move_bulk_restrict_impl
+    #undef pottery_node_hash_map_lifecycle_move_bulk_up
+    #undef pottery_node_hash_map_lifecycle_move_bulk_up_impl
+    #undef pottery_node_hash_map_lifecycle_move_bulk_down
+    #undef pottery_node_hash_map_lifecycle_move_bulk_down_impl
+    #undef pottery_node_hash_map_lifecycle_destroy_bulk
+//!!! END_AUTOGENERATED
+
+//!!! AUTOGENERATED:lifecycle/unconfigure.m.h PREFIX:POTTERY_NODE_HASH_MAP_LIFECYCLE
+    // This block is auto-generated. Do not modify until END_AUTOGENERATED.
+
+    // Undefines (forwardable/forwarded) lifecycle configuration on POTTERY_NODE_HASH_MAP_LIFECYCLE
+
+    #undef POTTERY_NODE_HASH_MAP_LIFECYCLE_BY_VALUE
+    #undef POTTERY_NODE_HASH_MAP_LIFECYCLE_DESTROY
+    #undef POTTERY_NODE_HASH_MAP_LIFECYCLE_DESTROY_BY_VALUE
+    #undef POTTERY_NODE_HASH_MAP_LIFECYCLE_INIT
+    #undef POTTERY_NODE_HASH_MAP_LIFECYCLE_INIT_BY_VALUE
+    #undef POTTERY_NODE_HASH_MAP_LIFECYCLE_INIT_COPY
+    #undef POTTERY_NODE_HASH_MAP_LIFECYCLE_INIT_COPY_BY_VALUE
+    #undef POTTERY_NODE_HASH_MAP_LIFECYCLE_INIT_STEAL
+    #undef POTTERY_NODE_HASH_MAP_LIFECYCLE_INIT_STEAL_BY_VALUE
+    #undef POTTERY_NODE_HASH_MAP_LIFECYCLE_MOVE
+    #undef POTTERY_NODE_HASH_MAP_LIFECYCLE_MOVE_BY_VALUE
+    #undef POTTERY_NODE_HASH_MAP_LIFECYCLE_COPY
+    #undef POTTERY_NODE_HASH_MAP_LIFECYCLE_COPY_BY_VALUE
+    #undef POTTERY_NODE_HASH_MAP_LIFECYCLE_STEAL
+    #undef POTTERY_NODE_HASH_MAP_LIFECYCLE_STEAL_BY_VALUE
+    #undef POTTERY_NODE_HASH_MAP_LIFECYCLE_SWAP
+    #undef POTTERY_NODE_HASH_MAP_LIFECYCLE_SWAP_BY_VALUE
+//!!! END_AUTOGENERATED
+
+
+
+// alloc
+
+#undef POTTERY_NODE_HASH_MAP_ALLOC_PREFIX
+
+//!!! AUTOGENERATED:alloc/unrename.m.h PREFIX:pottery_node_hash_map_alloc
+    // This block is auto-generated. Do not modify until END_AUTOGENERATED.
+    // Un-renames alloc identifiers with prefix "pottery_node_hash_map_alloc"
+
+    #undef pottery_node_hash_map_alloc_free
+    #undef pottery_node_hash_map_alloc_impl_free_ea
+    #undef pottery_node_hash_map_alloc_impl_free_fa
+
+    #undef pottery_node_hash_map_alloc_malloc
+    #undef pottery_node_hash_map_alloc_impl_malloc_ea
+    #undef pottery_node_hash_map_alloc_impl_malloc_fa
+
+    #undef pottery_node_hash_map_alloc_malloc_zero
+    #undef pottery_node_hash_map_alloc_impl_malloc_zero_ea
+    #undef pottery_node_hash_map_alloc_impl_malloc_zero_fa
+    #undef pottery_node_hash_map_alloc_impl_malloc_zero_fa_wrap
+
+    #undef pottery_node_hash_map_alloc_malloc_array_at_least
+    #undef pottery_node_hash_map_alloc_impl_malloc_array_at_least_ea
+    #undef pottery_node_hash_map_alloc_impl_malloc_array_at_least_fa
+
+    #undef pottery_node_hash_map_alloc_malloc_array
+    #undef pottery_node_hash_map_alloc_malloc_array_zero
+//!!! END_AUTOGENERATED
+
+//!!! AUTOGENERATED:alloc/unconfigure.m.h PREFIX:POTTERY_NODE_HASH_MAP_ALLOC
+    // This block is auto-generated. Do not modify until END_AUTOGENERATED.
+    // Undefines (forwardable/forwarded) alloc configuration on POTTERY_NODE_HASH_MAP_ALLOC
+    #undef POTTERY_NODE_HASH_MAP_ALLOC_CONTEXT_TYPE
+
+    #undef POTTERY_NODE_HASH_MAP_ALLOC_FREE
+    #undef POTTERY_NODE_HASH_MAP_ALLOC_MALLOC
+    #undef POTTERY_NODE_HASH_MAP_ALLOC_ZALLOC
+    #undef POTTERY_NODE_HASH_MAP_ALLOC_REALLOC
+    #undef POTTERY_NODE_HASH_MAP_ALLOC_MALLOC_GOOD_SIZE
+
+    #undef POTTERY_NODE_HASH_MAP_ALLOC_ALIGNED_FREE
+    #undef POTTERY_NODE_HASH_MAP_ALLOC_ALIGNED_MALLOC
+    #undef POTTERY_NODE_HASH_MAP_ALLOC_ALIGNED_ZALLOC
+    #undef POTTERY_NODE_HASH_MAP_ALLOC_ALIGNED_REALLOC
+    #undef POTTERY_NODE_HASH_MAP_ALLOC_ALIGNED_MALLOC_GOOD_SIZE
+//!!! END_AUTOGENERATED
+
+
+
+#include "pottery/platform/pottery_platform_pragma_pop.t.h"
@@ -105,7 +105,11 @@
     #define pottery_nl_is_empty POTTERY_CONCAT(POTTERY_NODE_LIST_PREFIX, _is_empty)
     #define pottery_nl_at POTTERY_CONCAT(POTTERY_NODE_LIST_PREFIX, _at)
     #define pottery_nl_find POTTERY_CONCAT(POTTERY_NODE_LIST_PREFIX, _find)
+    #define pottery_nl_find_with_hash POTTERY_CONCAT(POTTERY_NODE_LIST_PREFIX, _find_with_hash)
     #define pottery_nl_contains_key POTTERY_CONCAT(POTTERY_NODE_LIST_PREFIX, _contains_key)
+    #define pottery_nl_contains_key_with_hash POTTERY_CONCAT(POTTERY_NODE_LIST_PREFIX, _contains_key_with_hash)
+    #define pottery_nl_find_bulk POTTERY_CONCAT(POTTERY_NODE_LIST_PREFIX, _find_bulk)
+    #define pottery_nl_contains_bulk POTTERY_CONCAT(POTTERY_NODE_LIST_PREFIX, _contains_bulk)
     #define pottery_nl_first POTTERY_CONCAT(POTTERY_NODE_LIST_PREFIX, _first)
     #define pottery_nl_last POTTERY_CONCAT(POTTERY_NODE_LIST_PREFIX, _last)
     #define pottery_nl_any POTTERY_CONCAT(POTTERY_NODE_LIST_PREFIX, _any)
@@ -143,6 +147,7 @@
     #define pottery_nl_emplace POTTERY_CONCAT(POTTERY_NODE_LIST_PREFIX, _emplace)
     #define pottery_nl_emplace_at POTTERY_CONCAT(POTTERY_NODE_LIST_PREFIX, _emplace_at)
     #define pottery_nl_emplace_key POTTERY_CONCAT(POTTERY_NODE_LIST_PREFIX, _emplace_key)
+    #define pottery_nl_emplace_key_with_hash POTTERY_CONCAT(POTTERY_NODE_LIST_PREFIX, _emplace_key_with_hash)
     #define pottery_nl_emplace_first POTTERY_CONCAT(POTTERY_NODE_LIST_PREFIX, _emplace_first)
     #define pottery_nl_emplace_last POTTERY_CONCAT(POTTERY_NODE_LIST_PREFIX, _emplace_last)
     #define pottery_nl_emplace_before POTTERY_CONCAT(POTTERY_NODE_LIST_PREFIX, _emplace_before)
@@ -178,6 +183,7 @@
     #define pottery_nl_remove POTTERY_CONCAT(POTTERY_NODE_LIST_PREFIX, _remove)
     #define pottery_nl_remove_at POTTERY_CONCAT(POTTERY_NODE_LIST_PREFIX, _remove_at)
     #define pottery_nl_remove_key POTTERY_CONCAT(POTTERY_NODE_LIST_PREFIX, _remove_key)
+    #define pottery_nl_remove_key_with_hash POTTERY_CONCAT(POTTERY_NODE_LIST_PREFIX, _remove_key_with_hash)
     #define pottery_nl_remove_first POTTERY_CONCAT(POTTERY_NODE_LIST_PREFIX, _remove_first)
     #define pottery_nl_remove_last POTTERY_CONCAT(POTTERY_NODE_LIST_PREFIX, _remove_last)
     #define pottery_nl_remove_and_next POTTERY_CONCAT(POTTERY_NODE_LIST_PREFIX, _remove_and_next)
@@ -263,7 +269,11 @@
     #define pottery_nl_dll_is_empty POTTERY_CONCAT(POTTERY_NODE_LIST_DLL_PREFIX, _is_empty)
     #define pottery_nl_dll_at POTTERY_CONCAT(POTTERY_NODE_LIST_DLL_PREFIX, _at)
     #define pottery_nl_dll_find POTTERY_CONCAT(POTTERY_NODE_LIST_DLL_PREFIX, _find)
+    #define pottery_nl_dll_find_with_hash POTTERY_CONCAT(POTTERY_NODE_LIST_DLL_PREFIX, _find_with_hash)
     #define pottery_nl_dll_contains_key POTTERY_CONCAT(POTTERY_NODE_LIST_DLL_PREFIX, _contains_key)
+    #define pottery_nl_dll_contains_key_with_hash POTTERY_CONCAT(POTTERY_NODE_LIST_DLL_PREFIX, _contains_key_with_hash)
+    #define pottery_nl_dll_find_bulk POTTERY_CONCAT(POTTERY_NODE_LIST_DLL_PREFIX, _find_bulk)
+    #define pottery_nl_dll_contains_bulk POTTERY_CONCAT(POTTERY_NODE_LIST_DLL_PREFIX, _contains_bulk)
     #define pottery_nl_dll_first POTTERY_CONCAT(POTTERY_NODE_LIST_DLL_PREFIX, _first)
     #define pottery_nl_dll_last POTTERY_CONCAT(POTTERY_NODE_LIST_DLL_PREFIX, _last)
     #define pottery_nl_dll_any POTTERY_CONCAT(POTTERY_NODE_LIST_DLL_PREFIX, _any)
@@ -301,6 +311,7 @@
     #define pottery_nl_dll_emplace POTTERY_CONCAT(POTTERY_NODE_LIST_DLL_PREFIX, _emplace)
     #define pottery_nl_dll_emplace_at POTTERY_CONCAT(POTTERY_NODE_LIST_DLL_PREFIX, _emplace_at)
     #define pottery_nl_dll_emplace_key POTTERY_CONCAT(POTTERY_NODE_LIST_DLL_PREFIX, _emplace_key)
+    #define pottery_nl_dll_emplace_key_with_hash POTTERY_CONCAT(POTTERY_NODE_LIST_DLL_PREFIX, _emplace_key_with_hash)
     #define pottery_nl_dll_emplace_first POTTERY_CONCAT(POTTERY_NODE_LIST_DLL_PREFIX, _emplace_first)
     #define pottery_nl_dll_emplace_last POTTERY_CONCAT(POTTERY_NODE_LIST_DLL_PREFIX, _emplace_last)
     #define pottery_nl_dll_emplace_before POTTERY_CONCAT(POTTERY_NODE_LIST_DLL_PREFIX, _emplace_before)
@@ -336,6 +347,7 @@
     #define pottery_nl_dll_remove POTTERY_CONCAT(POTTERY_NODE_LIST_DLL_PREFIX, _remove)
     #define pottery_nl_dll_remove_at POTTERY_CONCAT(POTTERY_NODE_LIST_DLL_PREFIX, _remove_at)
     #define pottery_nl_dll_remove_key POTTERY_CONCAT(POTTERY_NODE_LIST_DLL_PREFIX, _remove_key)
+    #define pottery_nl_dll_remove_key_with_hash POTTERY_CONCAT(POTTERY_NODE_LIST_DLL_PREFIX, _remove_key_with_hash)
     #define pottery_nl_dll_remove_first POTTERY_CONCAT(POTTERY_NODE_LIST_DLL_PREFIX, _remove_first)
     #define pottery_nl_dll_remove_last POTTERY_CONCAT(POTTERY_NODE_LIST_DLL_PREFIX, _remove_last)
     #define pottery_nl_dll_remove_and_next POTTERY_CONCAT(POTTERY_NODE_LIST_DLL_PREFIX, _remove_and_next)
@@ -107,7 +107,11 @@
     #undef pottery_nl_is_empty
     #undef pottery_nl_at
     #undef pottery_nl_find
+    #undef pottery_nl_find_with_hash
     #undef pottery_nl_contains_key
+    #undef pottery_nl_contains_key_with_hash
+    #undef pottery_nl_find_bulk
+    #undef pottery_nl_contains_bulk
     #undef pottery_nl_first
     #undef pottery_nl_last
     #undef pottery_nl_any
@@ -145,6 +149,7 @@
     #undef pottery_nl_emplace
     #undef pottery_nl_emplace_at
     #undef pottery_nl_emplace_key
+    #undef pottery_nl_emplace_key_with_hash
     #undef pottery_nl_emplace_first
     #undef pottery_nl_emplace_last
     #undef pottery_nl_emplace_before
@@ -180,6 +185,7 @@
     #undef pottery_nl_remove
     #undef pottery_nl_remove_at
     #undef pottery_nl_remove_key
+    #undef pottery_nl_remove_key_with_hash
     #undef pottery_nl_remove_first
     #undef pottery_nl_remove_last
     #undef pottery_nl_remove_and_next
@@ -267,7 +273,11 @@
     #undef pottery_nl_dll_is_empty
     #undef pottery_nl_dll_at
     #undef pottery_nl_dll_find
+    #undef pottery_nl_dll_find_with_hash
     #undef pottery_nl_dll_contains_key
+    #undef pottery_nl_dll_contains_key_with_hash
+    #undef pottery_nl_dll_find_bulk
+    #undef pottery_nl_dll_contains_bulk
     #undef pottery_nl_dll_first
     #undef pottery_nl_dll_last
     #undef pottery_nl_dll_any
@@ -305,6 +315,7 @@
     #undef pottery_nl_dll_emplace
     #undef pottery_nl_dll_emplace_at
     #undef pottery_nl_dll_emplace_key
+    #undef pottery_nl_dll_emplace_key_with_hash
     #undef pottery_nl_dll_emplace_first
     #undef pottery_nl_dll_emplace_last
     #undef pottery_nl_dll_emplace_before
@@ -340,6 +351,7 @@
     #undef pottery_nl_dll_remove
     #undef pottery_nl_dll_remove_at
     #undef pottery_nl_dll_remove_key
+    #undef pottery_nl_dll_remove_key_with_hash
     #undef pottery_nl_dll_remove_first
     #undef pottery_nl_dll_remove_last
     #undef pottery_nl_dll_remove_and_next
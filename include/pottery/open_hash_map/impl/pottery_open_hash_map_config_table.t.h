@@ -63,9 +63,17 @@
 #define POTTERY_OPEN_HASH_TABLE_KEY_HASH pottery_ohm_entry_key_hash
 #define POTTERY_OPEN_HASH_TABLE_REF_KEY pottery_ohm_entry_key
 #define POTTERY_OPEN_HASH_TABLE_KEY_EQUAL pottery_ohm_entry_key_equal
-#ifdef POTTERY_OPEN_HASH_TABLE_KEY_DOUBLE_HASH
+#ifdef POTTERY_OPEN_HASH_MAP_KEY_DOUBLE_HASH
     #define POTTERY_OPEN_HASH_TABLE_KEY_DOUBLE_HASH pottery_ohm_entry_key_double_hash
 #endif
+#if POTTERY_OPEN_HASH_MAP_STORE_HASH
+    #define POTTERY_OPEN_HASH_TABLE_STORED_HASH pottery_ohm_entry_stored_hash
+    #define POTTERY_OPEN_HASH_TABLE_SET_STORED_HASH pottery_ohm_entry_set_stored_hash
+#endif
+
+#if POTTERY_OPEN_HASH_MAP_SEEDED
+    #define POTTERY_OPEN_HASH_TABLE_SEED pottery_ohm_entry_seed
+#endif
 
 #define POTTERY_OPEN_HASH_TABLE_IS_EMPTY pottery_ohm_entry_is_empty
 #define POTTERY_OPEN_HASH_TABLE_SET_EMPTY pottery_ohm_entry_set_empty
@@ -80,3 +88,20 @@
 #define POTTERY_OPEN_HASH_TABLE_LINEAR_PROBING POTTERY_OPEN_HASH_MAP_LINEAR_PROBING
 #define POTTERY_OPEN_HASH_TABLE_QUADRATIC_PROBING POTTERY_OPEN_HASH_MAP_QUADRATIC_PROBING
 #define POTTERY_OPEN_HASH_TABLE_DOUBLE_HASHING POTTERY_OPEN_HASH_MAP_DOUBLE_HASHING
+#define POTTERY_OPEN_HASH_TABLE_ROBIN_HOOD_HASHING POTTERY_OPEN_HASH_MAP_ROBIN_HOOD_HASHING
+
+// If we have metadata, we store the Robin Hood probe distance in it so the
+// table doesn't need to hash keys to figure it out.
+#if POTTERY_OPEN_HASH_MAP_ROBIN_HOOD_HASHING && POTTERY_OPEN_HASH_MAP_HAS_METADATA
+#define POTTERY_OPEN_HASH_TABLE_PROBE_DISTANCE pottery_ohm_entry_probe_distance
+#define POTTERY_OPEN_HASH_TABLE_SET_PROBE_DISTANCE pottery_ohm_entry_set_probe_distance
+#endif
+
+// Hop info is stored in a separate array so it stays with its bucket when
+// values are moved.
+#define POTTERY_OPEN_HASH_TABLE_HOPSCOTCH_HASHING POTTERY_OPEN_HASH_MAP_HOPSCOTCH_HASHING
+#if POTTERY_OPEN_HASH_MAP_HOPSCOTCH_HASHING
+#define POTTERY_OPEN_HASH_TABLE_HOPSCOTCH_NEIGHBORHOOD POTTERY_OPEN_HASH_MAP_HOPSCOTCH_NEIGHBORHOOD
+#define POTTERY_OPEN_HASH_TABLE_HOP_INFO pottery_ohm_entry_hop_info
+#define POTTERY_OPEN_HASH_TABLE_SET_HOP_INFO pottery_ohm_entry_set_hop_info
+#endif
@@ -40,11 +40,51 @@ struct pottery_ohm_t {
     #endif
 
     #if POTTERY_OPEN_HASH_MAP_HAS_METADATA
-    // For simplicity we store metadata as one byte per bucket. We could
-    // optimize this later to use the minimum number of bits. In the meantime
-    // if you really care about performance you should use in-band values for
-    // empty and tombstones.
-    uint8_t* metadata;
+    // By default we store metadata as one byte per bucket. GROUP_PROBING
+    // makes use of the rest of the byte to store a tag of the hash and
+    // ROBIN_HOOD_HASHING stores the probe distance. Otherwise you can enable
+    // PACKED_METADATA to store only one or two bits per bucket, packed into
+    // 64-bit words.
+    pottery_ohm_metadata_t* metadata;
+    #endif
+
+    #if POTTERY_OPEN_HASH_MAP_STORE_HASH
+    // The full hash of each value. This is only valid for buckets that
+    // contain values.
+    size_t* hashes;
+    #endif
+
+    #if POTTERY_OPEN_HASH_MAP_HOPSCOTCH_HASHING
+    // The hop info of each bucket: a bitmap of the values within the
+    // neighborhood that belong to it, and a count of those that overflowed.
+    uint32_t* hop_info;
+    bool hop_overflow; // a value overflowed its neighborhood; maybe grow on the next insertion
+    #endif
+
+    #if POTTERY_OPEN_HASH_MAP_SEEDED
+    // The seed mixed into hashes to choose their buckets. It's kept when the
+    // map grows or shrinks and replaced by the probe watchdog.
+    uint64_t seed;
+    #if POTTERY_OPEN_HASH_MAP_PROBE_LIMIT
+    bool long_probe; // an insertion probed too far; reseed on the next one
+    bool reseeded; // we've already reseeded at this size
+    #endif
+    #endif
+
+    #if POTTERY_OPEN_HASH_MAP_INCREMENTAL_REHASH
+    // While the map is growing incrementally, the old buckets are kept here
+    // until all of their values have been migrated to the new buckets above.
+    // old_values is null if the map is not migrating.
+    pottery_ohm_value_t* old_values;
+    size_t old_log_2_size;
+    size_t old_count;
+    size_t migrate_index; // the next old bucket to migrate
+    #if POTTERY_OPEN_HASH_MAP_HAS_METADATA
+    pottery_ohm_metadata_t* old_metadata;
+    #endif
+    #if POTTERY_OPEN_HASH_MAP_STORE_HASH
+    size_t* old_hashes;
+    #endif
     #endif
 };
 
@@ -65,33 +105,94 @@ POTTERY_OPEN_HASH_MAP_EXTERN
 pottery_error_t pottery_ohm_emplace_key(pottery_ohm_t* map, pottery_ohm_key_t key,
         pottery_ohm_entry_t* entry, bool* /*nullable*/ created);
 
+/**
+ * Emplaces a key whose hash has already been computed.
+ *
+ * The hash must be the result of the map's KEY_HASH expression on the key.
+ * This lets you hash a key once and use it with several maps of the same key
+ * type, or keep a hash from an earlier stage of processing.
+ */
+POTTERY_OPEN_HASH_MAP_EXTERN
+pottery_error_t pottery_ohm_emplace_key_with_hash(pottery_ohm_t* map, pottery_ohm_key_t key,
+        size_t hash, pottery_ohm_entry_t* entry, bool* /*nullable*/ created);
+
 static inline
 size_t pottery_ohm_count(pottery_ohm_t* map) {
+    #if POTTERY_OPEN_HASH_MAP_INCREMENTAL_REHASH
+    return map->count + map->old_count;
+    #else
     return map->count;
+    #endif
 }
 
+// Returns the load on the buckets, i.e. the values plus tombstones. (While
+// migrating, this includes the values that are yet to be migrated.)
 static inline
 size_t pottery_ohm_load(pottery_ohm_t* map) {
-    return map->count
+    return pottery_ohm_count(map)
             #if POTTERY_OPEN_HASH_MAP_TOMBSTONES
             + map->tombstones
             #endif
             ;
 }
 
+// Returns the given bucket count times the given load factor, rounded down.
+static inline
+size_t pottery_ohm_load_factor_count(size_t size, size_t numerator, size_t denominator) {
+    // Split the multiplication so it can't overflow.
+    return (size / denominator) * numerator + (size % denominator) * numerator / denominator;
+}
+
+// Returns the capacity of a table with the given bucket count.
+static inline
+size_t pottery_ohm_impl_size_capacity(size_t size) {
+    size_t capacity = pottery_ohm_load_factor_count(size,
+            POTTERY_OPEN_HASH_MAP_MAX_LOAD_FACTOR_NUMERATOR,
+            POTTERY_OPEN_HASH_MAP_MAX_LOAD_FACTOR_DENOMINATOR);
+
+    // The map grows only once its load exceeds its capacity so the table
+    // can briefly hold one more than this. We make sure that still leaves an
+    // empty bucket to end probes.
+    return (capacity < size - 1) ? capacity : size - 2;
+}
+
 /**
  * Returns the current capacity of the map, i.e. the bucket count times the
- * load factor.
+ * max load factor.
  */
 static inline
 size_t pottery_ohm_capacity(pottery_ohm_t* map) {
-    size_t size = pottery_ohm_bucket_count(map);
+    return pottery_ohm_impl_size_capacity(pottery_ohm_bucket_count(map));
+}
+
+/**
+ * Makes room for at least the given total number of values so that the map
+ * doesn't need to grow until it holds more than that.
+ *
+ * This does nothing if the map is already large enough. It never shrinks the
+ * map (but the map may still shrink automatically on removal.)
+ */
+POTTERY_OPEN_HASH_MAP_EXTERN
+pottery_error_t pottery_ohm_reserve(pottery_ohm_t* map, size_t count);
+
+/**
+ * Shrinks the map to the smallest size that can hold its values, clearing all
+ * tombstones.
+ *
+ * If the map is already that size but has tombstones, it is rehashed at the
+ * same size. This is done in place without allocating if the map stores its
+ * own empty and tombstone states. If allocating a smaller table fails, an
+ * error is returned and the map is unchanged.
+ */
+POTTERY_OPEN_HASH_MAP_EXTERN
+pottery_error_t pottery_ohm_shrink(pottery_ohm_t* map);
 
-    // Currently the max load factor is 4/7 (~57%). This should be
-    // configurable, and we should benchmark this to choose a reasonable
-    // default.
-    size_t divisor = 7;
-    return size - (divisor / 2) * (size / divisor);
+// Returns the count below which the map will shrink.
+static inline
+size_t pottery_ohm_min_count(pottery_ohm_t* map) {
+    return pottery_ohm_load_factor_count(pottery_ohm_bucket_count(map),
+            POTTERY_OPEN_HASH_MAP_MIN_LOAD_FACTOR_NUMERATOR,
+            POTTERY_OPEN_HASH_MAP_MIN_LOAD_FACTOR_DENOMINATOR);
 }
 
 static inline
@@ -99,29 +200,167 @@ bool pottery_ohm_is_empty(pottery_ohm_t* map) {
     return pottery_ohm_count(map) == 0;
 }
 
+#if POTTERY_OPEN_HASH_MAP_GROUP_PROBING || POTTERY_OPEN_HASH_MAP_INCREMENTAL_REHASH
+POTTERY_OPEN_HASH_MAP_EXTERN
+pottery_ohm_entry_t pottery_ohm_find(pottery_ohm_t* map, pottery_ohm_key_t key);
+
+/**
+ * Finds a key whose hash has already been computed.
+ *
+ * The hash must be the result of the map's KEY_HASH expression on the key.
+ */
+POTTERY_OPEN_HASH_MAP_EXTERN
+pottery_ohm_entry_t pottery_ohm_find_with_hash(pottery_ohm_t* map, pottery_ohm_key_t key,
+        size_t hash);
+#else
 static inline
 pottery_ohm_entry_t pottery_ohm_find(pottery_ohm_t* map, pottery_ohm_key_t key) {
     return pottery_ohm_table_find(map, map->log_2_size, key);
 }
 
+/**
+ * Finds a key whose hash has already been computed.
+ *
+ * The hash must be the result of the map's KEY_HASH expression on the key.
+ */
+static inline
+pottery_ohm_entry_t pottery_ohm_find_with_hash(pottery_ohm_t* map, pottery_ohm_key_t key,
+        size_t hash)
+{
+    return pottery_ohm_table_find_with_hash(map, map->log_2_size, key, hash);
+}
+#endif
+
+/**
+ * Finds the entries for an array of keys, storing them in the given array of
+ * entries. Entries for keys that aren't in the map are set to the end of the
+ * map.
+ *
+ * This is faster than calling find() in a loop on large maps because it
+ * prefetches the buckets of several keys before probing for any of them.
+ */
+POTTERY_OPEN_HASH_MAP_EXTERN
+void pottery_ohm_find_bulk(pottery_ohm_t* map, const pottery_ohm_key_t* keys,
+        size_t count, pottery_ohm_entry_t* entries);
+
+/**
+ * Checks whether the map contains each of an array of keys, returning the
+ * number of keys found.
+ *
+ * If results is not null, whether each key was found is stored in it.
+ */
+POTTERY_OPEN_HASH_MAP_EXTERN
+size_t pottery_ohm_contains_bulk(pottery_ohm_t* map, const pottery_ohm_key_t* keys,
+        size_t count, bool* /*nullable*/ results);
+
+/**
+ * Statistics on the layout of a map. See pottery_ohm_stats().
+ *
+ * A probe length is the number of buckets a lookup visits before the one that
+ * ends it (or the number of groups, with group probing.) Averages are given as
+ * totals so that no floating point is needed.
+ */
+struct pottery_ohm_stats_t {
+    size_t count;
+    size_t tombstones;
+    size_t load; // values plus tombstones
+    size_t bucket_count; // the load factor is load / bucket_count
+    size_t capacity;
+
+    // Probe lengths of lookups of the values in the map. The average is
+    // probe_length_total / count.
+    size_t probe_length_total;
+    size_t probe_length_max;
+
+    // The number of values with each probe length. The last element counts
+    // all values with that probe length or longer.
+    size_t probe_length_histogram[POTTERY_OPEN_HASH_MAP_STATS_HISTOGRAM_SIZE];
+
+    // The total probe length of lookups of missing keys starting from each
+    // home bucket (or group.) The average is miss_probe_length_total /
+    // miss_probe_starts. With double hashing, the probing sequence depends on
+    // the key so this is estimated from the load factor instead. With
+    // hopscotch hashing, a lookup only visits the buckets in the hop info of
+    // its home bucket, plus the rest of the table if any of them overflowed.
+    size_t miss_probe_length_total;
+    size_t miss_probe_starts;
+
+    size_t value_bytes; // bytes allocated for buckets
+    size_t metadata_bytes; // bytes allocated for metadata, stored hashes and hop info
+};
+
+/**
+ * Gathers statistics on the layout of the map: its probe lengths, tombstones
+ * and memory use.
+ *
+ * This is meant for choosing a hash function and load factors. It visits
+ * every bucket of the map (and walks the probing sequence from each one to
+ * measure misses) so it's much slower than a lookup.
+ */
+POTTERY_OPEN_HASH_MAP_EXTERN
+void pottery_ohm_stats(pottery_ohm_t* map, pottery_ohm_stats_t* stats);
+
 POTTERY_OPEN_HASH_MAP_EXTERN
 void pottery_ohm_displace(pottery_ohm_t* map, pottery_ohm_entry_t entry);
 
+/**
+ * Displaces all values from the map and shrinks it back to its minimum size.
+ */
 POTTERY_OPEN_HASH_MAP_EXTERN
 void pottery_ohm_displace_all(pottery_ohm_t* map);
 
+/**
+ * Displaces all values from the map, keeping its buckets allocated so that it
+ * can be refilled to the same size without growing.
+ */
+POTTERY_OPEN_HASH_MAP_EXTERN
+void pottery_ohm_displace_all_keep_capacity(pottery_ohm_t* map);
+
 #if POTTERY_OPEN_HASH_MAP_CAN_DESTROY
 POTTERY_OPEN_HASH_MAP_EXTERN
 void pottery_ohm_remove(pottery_ohm_t* map, pottery_ohm_entry_t entry);
 
+/**
+ * Removes all values from the map and shrinks it back to its minimum size.
+ */
 POTTERY_OPEN_HASH_MAP_EXTERN
 void pottery_ohm_remove_all(pottery_ohm_t* map);
 
+/**
+ * Removes all values from the map, keeping its buckets allocated so that it
+ * can be refilled to the same size without growing.
+ */
+POTTERY_OPEN_HASH_MAP_EXTERN
+void pottery_ohm_remove_all_keep_capacity(pottery_ohm_t* map);
+
 /**
  * Returns true if an entry matching the given key was removed.
  */
 POTTERY_OPEN_HASH_MAP_EXTERN
 bool pottery_ohm_remove_key(pottery_ohm_t* map, pottery_ohm_key_t key);
+
+/**
+ * Removes a key whose hash has already been computed, returning true if an
+ * entry matching it was removed.
+ */
+POTTERY_OPEN_HASH_MAP_EXTERN
+bool pottery_ohm_remove_key_with_hash(pottery_ohm_t* map, pottery_ohm_key_t key,
+        size_t hash);
+
+/**
+ * Moves an array of values into the map.
+ *
+ * The map is grown once up front to fit all of the values. If a value with
+ * the same key as one of them already exists in the map, the old value is
+ * destroyed and replaced.
+ *
+ * The values are moved out of the given array so they must not be destroyed
+ * afterwards. If an error occurs, the values before the one that failed have
+ * been moved into the map and the rest remain in the array.
+ */
+POTTERY_OPEN_HASH_MAP_EXTERN
+pottery_error_t pottery_ohm_insert_bulk(pottery_ohm_t* map, pottery_ohm_value_t* values,
+        size_t count);
 #endif
 
 static inline
@@ -143,7 +382,22 @@ bool pottery_ohm_entry_exists(pottery_ohm_t* map, pottery_ohm_entry_t entry) {
  */
 static inline
 bool pottery_ohm_contains_key(pottery_ohm_t* map, pottery_ohm_key_t key) {
+    #if POTTERY_OPEN_HASH_MAP_GROUP_PROBING || POTTERY_OPEN_HASH_MAP_INCREMENTAL_REHASH
+    return pottery_ohm_entry_exists(map, pottery_ohm_find(map, key));
+    #else
     return pottery_ohm_table_contains_key(map, map->log_2_size, key);
+    #endif
+}
+
+/**
+ * Returns true if there is a value in the map with this key, whose hash has
+ * already been computed.
+ */
+static inline
+bool pottery_ohm_contains_key_with_hash(pottery_ohm_t* map, pottery_ohm_key_t key,
+        size_t hash)
+{
+    return pottery_ohm_entry_exists(map, pottery_ohm_find_with_hash(map, key, hash));
 }
 
 static inline
@@ -166,7 +420,7 @@ size_t pottery_ohm_entry_key_hash(pottery_ohm_t* map, pottery_ohm_key_t key) {
     #endif
 }
 
-#ifdef POTTERY_OPEN_HASH_TABLE_KEY_DOUBLE_HASH
+#ifdef POTTERY_OPEN_HASH_MAP_KEY_DOUBLE_HASH
 static inline
 size_t pottery_ohm_entry_key_double_hash(pottery_ohm_t* map, pottery_ohm_key_t key) {
     (void)map;
@@ -178,17 +432,137 @@ size_t pottery_ohm_entry_key_double_hash(pottery_ohm_t* map, pottery_ohm_key_t k
 }
 #endif
 
+#if POTTERY_OPEN_HASH_MAP_SEEDED
+static inline
+uint64_t pottery_ohm_entry_seed(pottery_ohm_t* map) {
+    return map->seed;
+}
+#endif
+
 #if POTTERY_OPEN_HASH_MAP_HAS_METADATA
+#if POTTERY_OPEN_HASH_MAP_PACKED_METADATA
+// Gets the bucket state of an entry in the map from its bits in our packed
+// metadata.
+static inline
+pottery_ohm_bucket_state_t pottery_ohm_entry_state(pottery_ohm_t* map, pottery_ohm_entry_t entry) {
+    size_t index = pottery_cast(size_t, entry - map->values);
+    uint64_t bits = (map->metadata[index / POTTERY_OPEN_HASH_MAP_METADATA_PER_WORD] >>
+            (index % POTTERY_OPEN_HASH_MAP_METADATA_PER_WORD * POTTERY_OPEN_HASH_MAP_METADATA_BITS)) &
+            ((pottery_cast(uint64_t, 1) << POTTERY_OPEN_HASH_MAP_METADATA_BITS) - 1);
+
+    #if POTTERY_OPEN_HASH_MAP_INTERNAL_EMPTY
+    return pottery_cast(pottery_ohm_bucket_state_t, bits);
+    #else
+    // With a single bit for tombstones, a clear bit means other.
+    return bits ? pottery_ohm_bucket_state_tombstone : pottery_ohm_bucket_state_other;
+    #endif
+}
+
+static inline
+void pottery_ohm_entry_set_state(pottery_ohm_t* map, pottery_ohm_entry_t entry,
+        pottery_ohm_bucket_state_t state)
+{
+    size_t index = pottery_cast(size_t, entry - map->values);
+    size_t shift = index % POTTERY_OPEN_HASH_MAP_METADATA_PER_WORD * POTTERY_OPEN_HASH_MAP_METADATA_BITS;
+    uint64_t* word = map->metadata + index / POTTERY_OPEN_HASH_MAP_METADATA_PER_WORD;
+
+    #if POTTERY_OPEN_HASH_MAP_INTERNAL_EMPTY
+    uint64_t bits = pottery_cast(uint64_t, state);
+    #else
+    uint64_t bits = (state == pottery_ohm_bucket_state_tombstone) ? 1 : 0;
+    #endif
+
+    *word = (*word & ~(((pottery_cast(uint64_t, 1) << POTTERY_OPEN_HASH_MAP_METADATA_BITS) - 1) << shift)) |
+            (bits << shift);
+}
+#else
 // Gets a pointer to the metadata byte for an entry in the map.
 static inline
 uint8_t* pottery_ohm_entry_metadata(pottery_ohm_t* map, pottery_ohm_entry_t entry) {
     return map->metadata + pottery_cast(size_t, entry - map->values);
 }
 
+static inline
+pottery_ohm_bucket_state_t pottery_ohm_entry_state(pottery_ohm_t* map, pottery_ohm_entry_t entry) {
+    return pottery_cast(pottery_ohm_bucket_state_t, *pottery_ohm_entry_metadata(map, entry));
+}
+
+static inline
+void pottery_ohm_entry_set_state(pottery_ohm_t* map, pottery_ohm_entry_t entry,
+        pottery_ohm_bucket_state_t state)
+{
+    *pottery_ohm_entry_metadata(map, entry) = pottery_cast(uint8_t, state);
+}
+#endif
+
 static inline
 void pottery_ohm_entry_set_other(pottery_ohm_t* map, pottery_ohm_entry_t entry) {
-    *pottery_ohm_entry_metadata(map, entry) =
-            pottery_cast(uint8_t, pottery_ohm_bucket_state_other);
+    pottery_ohm_entry_set_state(map, entry, pottery_ohm_bucket_state_other);
+}
+#endif
+
+#if POTTERY_OPEN_HASH_MAP_STORE_HASH
+static inline
+size_t pottery_ohm_entry_stored_hash(pottery_ohm_t* map, pottery_ohm_entry_t entry) {
+    return map->hashes[pottery_cast(size_t, entry - map->values)];
+}
+
+static inline
+void pottery_ohm_entry_set_stored_hash(pottery_ohm_t* map, pottery_ohm_entry_t entry,
+        size_t hash)
+{
+    map->hashes[pottery_cast(size_t, entry - map->values)] = hash;
+}
+#endif
+
+#if POTTERY_OPEN_HASH_MAP_HOPSCOTCH_HASHING
+static inline
+uint32_t pottery_ohm_entry_hop_info(pottery_ohm_t* map, pottery_ohm_entry_t entry) {
+    return map->hop_info[pottery_cast(size_t, entry - map->values)];
+}
+
+static inline
+void pottery_ohm_entry_set_hop_info(pottery_ohm_t* map, pottery_ohm_entry_t entry,
+        uint32_t hop_info)
+{
+    map->hop_info[pottery_cast(size_t, entry - map->values)] = hop_info;
+}
+#endif
+
+#if POTTERY_OPEN_HASH_MAP_ROBIN_HOOD_HASHING && POTTERY_OPEN_HASH_MAP_HAS_METADATA
+static inline
+size_t pottery_ohm_entry_probe_distance(pottery_ohm_t* map, pottery_ohm_entry_t entry) {
+    uint8_t metadata = *pottery_ohm_entry_metadata(map, entry);
+
+    // The caller has checked that the bucket isn't empty but an optimistic
+    // reader of a sharded_hash_map may be probing while a writer changes the
+    // buckets. If the bucket has been emptied since, we treat it as being in
+    // its own bucket. Whatever the probe finds is discarded when the reader
+    // retries.
+    if (pottery_unlikely(metadata == pottery_cast(uint8_t, pottery_ohm_bucket_state_empty)))
+        return 0;
+    if (metadata != pottery_cast(uint8_t, pottery_ohm_bucket_state_far))
+        return pottery_cast(size_t, metadata - 1);
+
+    // The distance is too far to store so we compute it from the hash.
+    size_t index = pottery_cast(size_t, entry - map->values);
+    size_t bucket = pottery_ohm_table_bucket_for_hash(map, map->log_2_size,
+            #if POTTERY_OPEN_HASH_MAP_STORE_HASH
+            pottery_ohm_entry_stored_hash(map, entry)
+            #else
+            pottery_ohm_entry_key_hash(map, pottery_ohm_entry_key(map, entry))
+            #endif
+            );
+    return (index - bucket) & (pottery_ohm_bucket_count(map) - 1);
+}
+
+static inline
+void pottery_ohm_entry_set_probe_distance(pottery_ohm_t* map, pottery_ohm_entry_t entry,
+        size_t distance)
+{
+    size_t far = pottery_cast(size_t, pottery_ohm_bucket_state_far);
+    *pottery_ohm_entry_metadata(map, entry) = pottery_cast(uint8_t,
+            (distance < far - 1) ? distance + 1 : far);
 }
 #endif
 
@@ -208,8 +582,7 @@ static inline
 bool pottery_ohm_entry_is_empty(pottery_ohm_t* map, pottery_ohm_entry_t entry) {
     (void)map;
     #if POTTERY_OPEN_HASH_MAP_INTERNAL_EMPTY
-        return *pottery_ohm_entry_metadata(map, entry) ==
-                pottery_cast(uint8_t, pottery_ohm_bucket_state_empty);
+        return pottery_ohm_entry_state(map, entry) == pottery_ohm_bucket_state_empty;
     #elif defined(POTTERY_OPEN_HASH_MAP_IS_EMPTY)
         #if defined(POTTERY_OPEN_HASH_MAP_CONTEXT_TYPE)
             return POTTERY_OPEN_HASH_MAP_IS_EMPTY(map->context, entry);
@@ -231,8 +604,7 @@ static inline
 void pottery_ohm_entry_set_empty(pottery_ohm_t* map, pottery_ohm_entry_t entry) {
     (void)map;
     #if POTTERY_OPEN_HASH_MAP_INTERNAL_EMPTY
-        *pottery_ohm_entry_metadata(map, entry) =
-                pottery_cast(uint8_t, pottery_ohm_bucket_state_empty);
+        pottery_ohm_entry_set_state(map, entry, pottery_ohm_bucket_state_empty);
     #elif defined(POTTERY_OPEN_HASH_MAP_SET_EMPTY)
         #if defined(POTTERY_OPEN_HASH_MAP_CONTEXT_TYPE)
             POTTERY_OPEN_HASH_MAP_SET_EMPTY(map->context, entry);
@@ -260,8 +632,7 @@ static inline
 bool pottery_ohm_entry_is_tombstone(pottery_ohm_t* map, pottery_ohm_entry_t entry) {
     (void)map;
     #if POTTERY_OPEN_HASH_MAP_INTERNAL_TOMBSTONE
-        return *pottery_ohm_entry_metadata(map, entry) ==
-                pottery_cast(uint8_t, pottery_ohm_bucket_state_tombstone);
+        return pottery_ohm_entry_state(map, entry) == pottery_ohm_bucket_state_tombstone;
     #else
         #if defined(POTTERY_OPEN_HASH_MAP_CONTEXT_TYPE)
             return POTTERY_OPEN_HASH_MAP_IS_TOMBSTONE(map->context, entry);
@@ -275,8 +646,7 @@ static inline
 void pottery_ohm_entry_set_tombstone(pottery_ohm_t* map, pottery_ohm_entry_t entry) {
     (void)map;
     #if POTTERY_OPEN_HASH_MAP_INTERNAL_TOMBSTONE
-        *pottery_ohm_entry_metadata(map, entry) =
-                pottery_cast(uint8_t, pottery_ohm_bucket_state_tombstone);
+        pottery_ohm_entry_set_state(map, entry, pottery_ohm_bucket_state_tombstone);
     #else
         #if defined(POTTERY_OPEN_HASH_MAP_CONTEXT_TYPE)
             POTTERY_OPEN_HASH_MAP_SET_TOMBSTONE(map->context, entry);
@@ -291,12 +661,23 @@ static inline
 bool pottery_ohm_entry_is_value(pottery_ohm_t* map, pottery_ohm_entry_t entry) {
     (void)map;
 
+    // With group probing, all states are in our metadata.
+    #if POTTERY_OPEN_HASH_MAP_GROUP_PROBING
+    return (*pottery_ohm_entry_metadata(map, entry) &
+            pottery_cast(uint8_t, pottery_ohm_bucket_state_value)) != 0;
+
     // If we have metadata, we check it first. We can't rely on it exclusively
     // because the user might have configured empty or tombstones in-band.
-    #if POTTERY_OPEN_HASH_MAP_HAS_METADATA
-    if (*pottery_ohm_entry_metadata(map, entry) !=
-            pottery_cast(uint8_t, pottery_ohm_bucket_state_other))
-        return false;
+    #elif POTTERY_OPEN_HASH_MAP_HAS_METADATA
+        #if POTTERY_OPEN_HASH_MAP_ROBIN_HOOD_HASHING
+        // Our metadata stores the probe distance of values.
+        if (*pottery_ohm_entry_metadata(map, entry) ==
+                pottery_cast(uint8_t, pottery_ohm_bucket_state_empty))
+            return false;
+        #else
+        if (pottery_ohm_entry_state(map, entry) != pottery_ohm_bucket_state_other)
+            return false;
+        #endif
 
     // We can't use IS_VALUE if we have metadata because that means something
     // is not in-band: the user can't possibly tell whether something is empty
@@ -346,9 +727,16 @@ void pottery_ohm_entry_move(pottery_ohm_t* map, pottery_ohm_entry_t to, pottery_
             to,
             from);
 
-    #if POTTERY_OPEN_HASH_MAP_HAS_METADATA
-    *pottery_ohm_entry_metadata(map, to) =
-            pottery_cast(uint8_t, pottery_ohm_bucket_state_other);
+    #if POTTERY_OPEN_HASH_MAP_GROUP_PROBING || POTTERY_OPEN_HASH_MAP_ROBIN_HOOD_HASHING
+    // The tag or probe distance moves along with the value. (The table will
+    // update the probe distance if needed.)
+    *pottery_ohm_entry_metadata(map, to) = *pottery_ohm_entry_metadata(map, from);
+    #elif POTTERY_OPEN_HASH_MAP_HAS_METADATA
+    pottery_ohm_entry_set_other(map, to);
+    #endif
+
+    #if POTTERY_OPEN_HASH_MAP_STORE_HASH
+    pottery_ohm_entry_set_stored_hash(map, to, pottery_ohm_entry_stored_hash(map, from));
     #endif
 }
 
@@ -365,9 +753,166 @@ void pottery_ohm_entry_destroy(pottery_ohm_t* map, pottery_ohm_entry_t entry)
 }
 #endif
 
+#if POTTERY_OPEN_HASH_MAP_INCREMENTAL_REHASH
+/*
+ * Incremental rehashing
+ *
+ * While migrating, values can be in either the new or the old buckets. We
+ * iterate over the new buckets first, then the old ones. Old entries are
+ * accessed through a temporary map struct that views the old buckets.
+ */
+
 static inline
-pottery_ohm_entry_t pottery_ohm_begin(pottery_ohm_t* map) {
+bool pottery_ohm_impl_is_migrating(pottery_ohm_t* map) {
+    return map->old_values != pottery_null;
+}
+
+static inline
+void pottery_ohm_impl_old_map(pottery_ohm_t* map, pottery_ohm_t* old_map) {
+    *old_map = *map;
+    old_map->values = map->old_values;
+    old_map->log_2_size = map->old_log_2_size;
+    old_map->count = map->old_count;
+    old_map->old_values = pottery_null;
+    old_map->old_count = 0;
+    #if POTTERY_OPEN_HASH_MAP_HAS_METADATA
+    old_map->metadata = map->old_metadata;
+    #endif
+    #if POTTERY_OPEN_HASH_MAP_STORE_HASH
+    old_map->hashes = map->old_hashes;
+    #endif
+}
+
+static inline
+bool pottery_ohm_impl_is_old_entry(pottery_ohm_t* map, pottery_ohm_entry_t entry) {
+    return pottery_ohm_impl_is_migrating(map) &&
+            entry >= map->old_values &&
+            entry < map->old_values + (pottery_cast(size_t, 1) << map->old_log_2_size);
+}
+#endif
+
+#if POTTERY_OPEN_HASH_MAP_METADATA_SCAN
+// Returns a mask with the lowest bit of each value bucket in a word of
+// metadata set. Values are in the other state and the other states are empty
+// or tombstone so this is just the low bit of each bucket.
+static inline
+uint64_t pottery_ohm_impl_value_bits(uint64_t word) {
+    #if POTTERY_OPEN_HASH_MAP_METADATA_BITS == 2
+    return word & UINT64_C(0x5555555555555555);
+    #else
+    return word;
+    #endif
+}
+
+// Returns the index of the first value at or after the given index, or the
+// bucket count if there isn't one.
+static inline
+size_t pottery_ohm_impl_next_value_index(pottery_ohm_t* map, size_t index) {
+    size_t count = pottery_ohm_bucket_count(map);
+    size_t words = (count + POTTERY_OPEN_HASH_MAP_METADATA_PER_WORD - 1) /
+            POTTERY_OPEN_HASH_MAP_METADATA_PER_WORD;
+    size_t word = index / POTTERY_OPEN_HASH_MAP_METADATA_PER_WORD;
+    uint64_t bits;
+
+    if (index >= count)
+        return count;
+
+    // Buckets past the end of a partial last word are always zero.
+    bits = pottery_ohm_impl_value_bits(map->metadata[word]) &
+            (~pottery_cast(uint64_t, 0) << (index % POTTERY_OPEN_HASH_MAP_METADATA_PER_WORD *
+                POTTERY_OPEN_HASH_MAP_METADATA_BITS));
+    while (bits == 0) {
+        if (++word == words)
+            return count;
+        bits = pottery_ohm_impl_value_bits(map->metadata[word]);
+    }
+
+    return word * POTTERY_OPEN_HASH_MAP_METADATA_PER_WORD +
+            pottery_ctz_u64(bits) / POTTERY_OPEN_HASH_MAP_METADATA_BITS;
+}
+
+// Returns the index of the last value before the given index. There must be
+// one.
+static inline
+size_t pottery_ohm_impl_previous_value_index(pottery_ohm_t* map, size_t index) {
+    size_t word = index / POTTERY_OPEN_HASH_MAP_METADATA_PER_WORD;
+    size_t shift = index % POTTERY_OPEN_HASH_MAP_METADATA_PER_WORD *
+            POTTERY_OPEN_HASH_MAP_METADATA_BITS;
+    uint64_t bits = 0;
+
+    if (shift != 0)
+        bits = pottery_ohm_impl_value_bits(map->metadata[word]) &
+                ((pottery_cast(uint64_t, 1) << shift) - 1);
+    while (bits == 0) {
+        pottery_assert(word != 0);
+        bits = pottery_ohm_impl_value_bits(map->metadata[--word]);
+    }
+
+    return word * POTTERY_OPEN_HASH_MAP_METADATA_PER_WORD +
+            (63 - pottery_clz_u64(bits)) / POTTERY_OPEN_HASH_MAP_METADATA_BITS;
+}
+#endif
+
+// These iterate over the values of a single array of buckets (i.e. the new or
+// old buckets while migrating.) With packed metadata they skip whole words of
+// empty buckets at a time; otherwise they check each bucket in turn.
+
+static inline
+pottery_ohm_entry_t pottery_ohm_impl_scan_begin(pottery_ohm_t* map) {
+    #if POTTERY_OPEN_HASH_MAP_METADATA_SCAN
+    return map->values + pottery_ohm_impl_next_value_index(map, 0);
+    #else
     return pottery_ohm_table_begin(map, map->log_2_size);
+    #endif
+}
+
+static inline
+pottery_ohm_entry_t pottery_ohm_impl_scan_last(pottery_ohm_t* map) {
+    #if POTTERY_OPEN_HASH_MAP_METADATA_SCAN
+    return map->values + pottery_ohm_impl_previous_value_index(map,
+            pottery_ohm_bucket_count(map));
+    #else
+    return pottery_ohm_table_last(map, map->log_2_size);
+    #endif
+}
+
+static inline
+pottery_ohm_entry_t pottery_ohm_impl_scan_next(pottery_ohm_t* map, pottery_ohm_entry_t entry) {
+    #if POTTERY_OPEN_HASH_MAP_METADATA_SCAN
+    return map->values + pottery_ohm_impl_next_value_index(map,
+            pottery_cast(size_t, entry - map->values) + 1);
+    #else
+    return pottery_ohm_table_next(map, map->log_2_size, entry);
+    #endif
+}
+
+static inline
+pottery_ohm_entry_t pottery_ohm_impl_scan_previous(pottery_ohm_t* map, pottery_ohm_entry_t entry) {
+    #if POTTERY_OPEN_HASH_MAP_METADATA_SCAN
+    return map->values + pottery_ohm_impl_previous_value_index(map,
+            pottery_cast(size_t, entry - map->values));
+    #else
+    return pottery_ohm_table_previous(map, map->log_2_size, entry);
+    #endif
+}
+
+static inline
+pottery_ohm_entry_t pottery_ohm_begin(pottery_ohm_t* map) {
+    pottery_ohm_entry_t entry = pottery_ohm_impl_scan_begin(map);
+
+    #if POTTERY_OPEN_HASH_MAP_INCREMENTAL_REHASH
+    // If the new buckets are empty, start with the old ones. (The old buckets
+    // always have values while we're migrating.)
+    if (entry == pottery_ohm_table_end(map, map->log_2_size) &&
+            pottery_ohm_impl_is_migrating(map))
+    {
+        pottery_ohm_t old_map;
+        pottery_ohm_impl_old_map(map, &old_map);
+        entry = pottery_ohm_impl_scan_begin(&old_map);
+    }
+    #endif
+
+    return entry;
 }
 
 static inline
@@ -377,20 +922,62 @@ pottery_ohm_entry_t pottery_ohm_end(pottery_ohm_t* map) {
 
 static inline
 pottery_ohm_entry_t pottery_ohm_first(pottery_ohm_t* map) {
-    return pottery_ohm_table_first(map, map->log_2_size);
+    pottery_ohm_entry_t entry = pottery_ohm_begin(map);
+    pottery_assert(entry != pottery_ohm_end(map));
+    return entry;
 }
 
 static inline
 pottery_ohm_entry_t pottery_ohm_last(pottery_ohm_t* map) {
-    return pottery_ohm_table_last(map, map->log_2_size);
+    #if POTTERY_OPEN_HASH_MAP_INCREMENTAL_REHASH
+    if (pottery_ohm_impl_is_migrating(map)) {
+        pottery_ohm_t old_map;
+        pottery_ohm_impl_old_map(map, &old_map);
+        return pottery_ohm_impl_scan_last(&old_map);
+    }
+    #endif
+    return pottery_ohm_impl_scan_last(map);
 }
 
 static inline
 pottery_ohm_entry_t pottery_ohm_next(pottery_ohm_t* map, pottery_ohm_entry_t entry) {
-    return pottery_ohm_table_next(map, map->log_2_size, entry);
+    #if POTTERY_OPEN_HASH_MAP_INCREMENTAL_REHASH
+    if (pottery_ohm_impl_is_migrating(map)) {
+        pottery_ohm_t old_map;
+        pottery_ohm_impl_old_map(map, &old_map);
+
+        // After the last old value comes the end of the map.
+        if (pottery_ohm_impl_is_old_entry(map, entry)) {
+            entry = pottery_ohm_impl_scan_next(&old_map, entry);
+            if (entry == pottery_ohm_table_end(&old_map, old_map.log_2_size))
+                return pottery_ohm_end(map);
+            return entry;
+        }
+
+        // After the last new value comes the first old value.
+        entry = pottery_ohm_impl_scan_next(map, entry);
+        if (entry == pottery_ohm_end(map))
+            return pottery_ohm_impl_scan_begin(&old_map);
+        return entry;
+    }
+    #endif
+    return pottery_ohm_impl_scan_next(map, entry);
 }
 
 static inline
 pottery_ohm_entry_t pottery_ohm_previous(pottery_ohm_t* map, pottery_ohm_entry_t entry) {
-    return pottery_ohm_table_previous(map, map->log_2_size, entry);
+    #if POTTERY_OPEN_HASH_MAP_INCREMENTAL_REHASH
+    // Before the first old value comes the last new value.
+    if (pottery_ohm_impl_is_old_entry(map, entry)) {
+        pottery_ohm_t old_map;
+        pottery_ohm_impl_old_map(map, &old_map);
+        while (entry != old_map.values) {
+            --entry;
+            if (pottery_ohm_entry_is_value(&old_map, entry))
+                return entry;
+        }
+        return pottery_ohm_impl_scan_last(map);
+    }
+    #endif
+    return pottery_ohm_impl_scan_previous(map, entry);
 }
@@ -59,34 +59,92 @@ void pottery_ohm_impl_free(pottery_ohm_t* map, pottery_ohm_value_t* values) {
 }
 
 #if POTTERY_OPEN_HASH_MAP_HAS_METADATA
+// Returns the length of the metadata array for the given number of buckets
+static inline
+size_t pottery_ohm_impl_metadata_size(size_t size) {
+    #if POTTERY_OPEN_HASH_MAP_PACKED_METADATA
+    return (size + POTTERY_OPEN_HASH_MAP_METADATA_PER_WORD - 1) /
+            POTTERY_OPEN_HASH_MAP_METADATA_PER_WORD;
+    #else
+    return size;
+    #endif
+}
+
 // Allocate an array of metadata
 static inline
-uint8_t* pottery_ohm_impl_alloc_metadata(pottery_ohm_t* map, size_t size) {
+pottery_ohm_metadata_t* pottery_ohm_impl_alloc_metadata(pottery_ohm_t* map, size_t size) {
     (void)map;
-    void* ptr =
-            #if POTTERY_OPEN_HASH_MAP_INTERNAL_EMPTY
-            pottery_ohm_alloc_malloc_array_zero
-            #else
-            pottery_ohm_alloc_malloc_array
-            #endif
-                (POTTERY_OPEN_HASH_MAP_CONTEXT_VAL
-                pottery_alignof(uint8_t),
-                size,
-                sizeof(uint8_t));
-    return pottery_cast(uint8_t*, ptr);
+    // Metadata is always zeroed. Zero is our empty state, and if empty is
+    // in-band, zero means not a tombstone; setting a value empty doesn't touch
+    // our metadata so it must start out clear. Packed metadata also needs the
+    // unused bits past the last bucket to be clear.
+    void* ptr = pottery_ohm_alloc_malloc_array_zero(
+                POTTERY_OPEN_HASH_MAP_CONTEXT_VAL
+                pottery_alignof(pottery_ohm_metadata_t),
+                pottery_ohm_impl_metadata_size(size),
+                sizeof(pottery_ohm_metadata_t));
+    return pottery_cast(pottery_ohm_metadata_t*, ptr);
 }
 
 // Free an array of metadata
 static inline
-void pottery_ohm_impl_free_metadata(pottery_ohm_t* map, uint8_t* metadata) {
+void pottery_ohm_impl_free_metadata(pottery_ohm_t* map, pottery_ohm_metadata_t* metadata) {
     (void)map;
     pottery_ohm_alloc_free(
             POTTERY_OPEN_HASH_MAP_CONTEXT_VAL
-            pottery_alignof(uint8_t),
+            pottery_alignof(pottery_ohm_metadata_t),
             metadata);
 }
 #endif
 
+#if POTTERY_OPEN_HASH_MAP_STORE_HASH
+// Allocate an array of hashes
+static inline
+size_t* pottery_ohm_impl_alloc_hashes(pottery_ohm_t* map, size_t size) {
+    (void)map;
+    void* ptr = pottery_ohm_alloc_malloc_array(
+                POTTERY_OPEN_HASH_MAP_CONTEXT_VAL
+                pottery_alignof(size_t),
+                size,
+                sizeof(size_t));
+    return pottery_cast(size_t*, ptr);
+}
+
+// Free an array of hashes
+static inline
+void pottery_ohm_impl_free_hashes(pottery_ohm_t* map, size_t* hashes) {
+    (void)map;
+    pottery_ohm_alloc_free(
+            POTTERY_OPEN_HASH_MAP_CONTEXT_VAL
+            pottery_alignof(size_t),
+            hashes);
+}
+#endif
+
+#if POTTERY_OPEN_HASH_MAP_HOPSCOTCH_HASHING
+// Allocate an array of hop info. It must start out zeroed.
+static inline
+uint32_t* pottery_ohm_impl_alloc_hop_info(pottery_ohm_t* map, size_t size) {
+    (void)map;
+    void* ptr = pottery_ohm_alloc_malloc_array_zero(
+                POTTERY_OPEN_HASH_MAP_CONTEXT_VAL
+                pottery_alignof(uint32_t),
+                size,
+                sizeof(uint32_t));
+    return pottery_cast(uint32_t*, ptr);
+}
+
+// Free an array of hop info
+static inline
+void pottery_ohm_impl_free_hop_info(pottery_ohm_t* map, uint32_t* hop_info) {
+    (void)map;
+    pottery_ohm_alloc_free(
+            POTTERY_OPEN_HASH_MAP_CONTEXT_VAL
+            pottery_alignof(uint32_t),
+            hop_info);
+}
+#endif
+
 static
 pottery_error_t pottery_ohm_init_impl(pottery_ohm_t* map,
         #ifdef POTTERY_OPEN_HASH_MAP_CONTEXT_TYPE
@@ -110,6 +168,34 @@ pottery_error_t pottery_ohm_init_impl(pottery_ohm_t* map,
     }
     #endif
 
+    // Allocate hashes
+    #if POTTERY_OPEN_HASH_MAP_STORE_HASH
+    map->hashes = pottery_ohm_impl_alloc_hashes(map, size);
+    if (map->hashes == pottery_null) {
+        #if POTTERY_OPEN_HASH_MAP_HAS_METADATA
+        pottery_ohm_impl_free_metadata(map, map->metadata);
+        #endif
+        pottery_ohm_impl_free(map, map->values);
+        return POTTERY_ERROR_ALLOC;
+    }
+    #endif
+
+    // Allocate hop info
+    #if POTTERY_OPEN_HASH_MAP_HOPSCOTCH_HASHING
+    map->hop_info = pottery_ohm_impl_alloc_hop_info(map, size);
+    if (map->hop_info == pottery_null) {
+        #if POTTERY_OPEN_HASH_MAP_STORE_HASH
+        pottery_ohm_impl_free_hashes(map, map->hashes);
+        #endif
+        #if POTTERY_OPEN_HASH_MAP_HAS_METADATA
+        pottery_ohm_impl_free_metadata(map, map->metadata);
+        #endif
+        pottery_ohm_impl_free(map, map->values);
+        return POTTERY_ERROR_ALLOC;
+    }
+    map->hop_overflow = false;
+    #endif
+
     // Configure the table
     #ifdef POTTERY_OPEN_HASH_MAP_CONTEXT_TYPE
     map->context = context;
@@ -119,6 +205,10 @@ pottery_error_t pottery_ohm_init_impl(pottery_ohm_t* map,
     #if POTTERY_OPEN_HASH_MAP_TOMBSTONES
     map->tombstones = 0;
     #endif
+    #if POTTERY_OPEN_HASH_MAP_INCREMENTAL_REHASH
+    map->old_values = pottery_null;
+    map->old_count = 0;
+    #endif
 
     #if !POTTERY_OPEN_HASH_MAP_EMPTY_IS_ZERO && !POTTERY_OPEN_HASH_MAP_INTERNAL_EMPTY
     // Clear the new values
@@ -136,36 +226,533 @@ pottery_error_t pottery_ohm_init(pottery_ohm_t* map
         , pottery_ohm_context_t context
         #endif
 ) {
+    #if POTTERY_OPEN_HASH_MAP_SEEDED
+    map->seed = pottery_random_seed(map);
+    #if POTTERY_OPEN_HASH_MAP_PROBE_LIMIT
+    map->long_probe = false;
+    map->reseeded = false;
+    #endif
+    #endif
+
     return pottery_ohm_init_impl(map,
             POTTERY_OPEN_HASH_MAP_CONTEXT_VAL
             POTTERY_OPEN_HASH_MAP_MINIMUM_LOG_2_SIZE);
 }
 
+// Frees the arrays of allocs, which is either the map itself or a temporary
+// copy of it holding arrays the map has replaced.
+//
+// If a RETIRE expression is configured, the arrays are passed to it instead.
+// It takes ownership of them and must eventually free them with our alloc.
 static
-void pottery_ohm_impl_free_allocs(pottery_ohm_t* map) {
-    pottery_ohm_impl_free(map, map->values);
+void pottery_ohm_impl_free_allocs(pottery_ohm_t* map, pottery_ohm_t* allocs) {
+    #ifdef POTTERY_OPEN_HASH_MAP_RETIRE
+    POTTERY_OPEN_HASH_MAP_RETIRE(map, pottery_alignof(pottery_ohm_value_t), allocs->values);
+    #if POTTERY_OPEN_HASH_MAP_HAS_METADATA
+    POTTERY_OPEN_HASH_MAP_RETIRE(map, pottery_alignof(pottery_ohm_metadata_t), allocs->metadata);
+    #endif
+    #if POTTERY_OPEN_HASH_MAP_STORE_HASH
+    POTTERY_OPEN_HASH_MAP_RETIRE(map, pottery_alignof(size_t), allocs->hashes);
+    #endif
+    #if POTTERY_OPEN_HASH_MAP_HOPSCOTCH_HASHING
+    POTTERY_OPEN_HASH_MAP_RETIRE(map, pottery_alignof(uint32_t), allocs->hop_info);
+    #endif
+    #else
+    pottery_ohm_impl_free(map, allocs->values);
     #if POTTERY_OPEN_HASH_MAP_HAS_METADATA
-    pottery_ohm_alloc_free(POTTERY_OPEN_HASH_MAP_CONTEXT_VAL 1, map->metadata);
+    pottery_ohm_impl_free_metadata(map, allocs->metadata);
+    #endif
+    #if POTTERY_OPEN_HASH_MAP_STORE_HASH
+    pottery_ohm_impl_free_hashes(map, allocs->hashes);
+    #endif
+    #if POTTERY_OPEN_HASH_MAP_HOPSCOTCH_HASHING
+    pottery_ohm_impl_free_hop_info(map, allocs->hop_info);
+    #endif
+    #endif
+}
+
+#if POTTERY_OPEN_HASH_MAP_CAN_DESTROY
+// Destroys all values in a single array of buckets without changing their
+// states.
+static
+void pottery_ohm_impl_destroy_all(pottery_ohm_t* map) {
+    #if POTTERY_OPEN_HASH_MAP_METADATA_SCAN
+    pottery_ohm_entry_t entry = pottery_ohm_impl_scan_begin(map);
+    pottery_ohm_entry_t end = pottery_ohm_table_end(map, map->log_2_size);
+    while (entry != end) {
+        pottery_ohm_entry_destroy(map, entry);
+        entry = pottery_ohm_impl_scan_next(map, entry);
+    }
+    #else
+    pottery_ohm_table_destroy_all(map, map->log_2_size);
+    #endif
+}
+#endif
+
+// Sets all buckets to empty, keeping the allocation.
+//
+// If an empty bucket is zero (in our metadata or in the value itself), we
+// zero whole arrays at once as though they were newly allocated rather than
+// setting each bucket empty. Buckets that don't contain values are
+// uninitialized storage so this is fine in C++ as well.
+static
+void pottery_ohm_impl_clear(pottery_ohm_t* map) {
+    size_t size = pottery_ohm_bucket_count(map);
+    (void)size;
+
+    #if !POTTERY_OPEN_HASH_MAP_INTERNAL_EMPTY
+    #if POTTERY_OPEN_HASH_MAP_EMPTY_IS_ZERO
+    pottery_memset(pottery_cast(void*, map->values), 0, sizeof(pottery_ohm_value_t) * size);
+    #else
+    pottery_ohm_table_displace_all(map, map->log_2_size);
+    #endif
+    #endif
+
+    #if POTTERY_OPEN_HASH_MAP_HAS_METADATA
+    // Zero is our empty state. If empty is in-band, our metadata only tracks
+    // tombstones and zero is not a tombstone.
+    pottery_memset(map->metadata, 0, sizeof(pottery_ohm_metadata_t) *
+            pottery_ohm_impl_metadata_size(size));
+    #endif
+
+    #if POTTERY_OPEN_HASH_MAP_HOPSCOTCH_HASHING
+    pottery_memset(map->hop_info, 0, sizeof(uint32_t) * size);
+    map->hop_overflow = false;
     #endif
 }
 
 POTTERY_OPEN_HASH_MAP_EXTERN
 void pottery_ohm_destroy(pottery_ohm_t* map) {
 
+    #if POTTERY_OPEN_HASH_MAP_INCREMENTAL_REHASH
+    if (pottery_ohm_impl_is_migrating(map)) {
+        pottery_ohm_t old_map;
+        pottery_ohm_impl_old_map(map, &old_map);
+        #if POTTERY_OPEN_HASH_MAP_CAN_DESTROY
+        pottery_ohm_impl_destroy_all(&old_map);
+        #endif
+        pottery_ohm_impl_free_allocs(map, &old_map);
+    }
+    #endif
+
     #if POTTERY_OPEN_HASH_MAP_CAN_DESTROY
-    pottery_ohm_table_destroy_all(map, map->log_2_size);
+    pottery_ohm_impl_destroy_all(map);
     #else
     // If we don't have a destroy expression, you must manually empty the hash
     // map before destroying it.
     pottery_assert(pottery_ohm_is_empty(map));
     #endif
 
-    pottery_ohm_impl_free_allocs(map);
+    pottery_ohm_impl_free_allocs(map, map);
 }
 
+#if POTTERY_OPEN_HASH_MAP_GROUP_PROBING
+/*
+ * Group probing
+ *
+ * The table is divided into aligned groups of POTTERY_GROUP_SIZE buckets. A
+ * key hashes to a group and we probe groups in a triangular sequence (like
+ * quadratic probing) until we find the key or a group with an empty bucket.
+ *
+ * Each metadata byte of a value holds a 7-bit tag of the hash so that we can
+ * match the whole group against the tag of our key at once. We only compare
+ * keys when the tags match so most failed key comparisons are avoided, and
+ * we usually don't touch the values of a group at all unless the key is
+ * there.
+ *
+ * When displacing a value we can make its bucket empty (rather than a
+ * tombstone) if its group already contains an empty bucket. Probing for any
+ * key stops at such a group so no probing sequence can pass through it.
+ */
+
+// Returns the metadata tag for a hash. We take the bits of the Knuth hash
+// (or of the seeded mix) just below those that choose the bucket.
+static inline
+uint8_t pottery_ohm_group_tag(pottery_ohm_t* map, size_t hash) {
+    size_t bits = map->log_2_size + 7;
+    #if POTTERY_OPEN_HASH_MAP_SEEDED
+    size_t tag = pottery_cast(size_t, pottery_ohm_table_mix_seed(map, hash) >> (64 - bits));
+    #else
+    size_t tag = (bits <= 8 * sizeof(size_t)) ?
+            pottery_knuth_hash_s(hash, bits) :
+            hash; // only on 32-bit with gigantic tables
+    #endif
+    return pottery_cast(uint8_t, pottery_ohm_bucket_state_value | (tag & 0x7F));
+}
+
+// Probes for the given key. If found, *found is set to true and its entry is
+// returned. Otherwise *found is set to false and the first empty or tombstone
+// bucket in the probing sequence is returned.
+static
+pottery_ohm_entry_t pottery_ohm_group_probe(pottery_ohm_t* map, size_t hash,
+        pottery_ohm_key_t key, bool* found)
+{
+    size_t group_mask = (pottery_ohm_bucket_count(map) / POTTERY_GROUP_SIZE) - 1;
+    size_t group = pottery_ohm_table_bucket_for_hash(map, map->log_2_size, hash) /
+            POTTERY_GROUP_SIZE;
+    uint8_t tag = pottery_ohm_group_tag(map, hash);
+    uint8_t empty = pottery_cast(uint8_t, pottery_ohm_bucket_state_empty);
+
+    pottery_ohm_entry_t available = pottery_null;
+    size_t probe = 0;
+
+    while (true) {
+        size_t base = group * POTTERY_GROUP_SIZE;
+        const uint8_t* metadata = map->metadata + base;
+
+        // compare keys of all buckets with a matching tag
+        uint32_t matches = pottery_group_match(metadata, tag);
+        while (matches != 0) {
+            pottery_ohm_entry_t entry = map->values + base + pottery_ctz_u32(matches);
+            if (
+                    #if POTTERY_OPEN_HASH_MAP_STORE_HASH
+                    pottery_ohm_entry_stored_hash(map, entry) == hash &&
+                    #endif
+                    pottery_ohm_entry_key_equal(map, key, pottery_ohm_entry_key(map, entry)))
+            {
+                *found = true;
+                return entry;
+            }
+            matches &= matches - 1;
+        }
+
+        // remember the first free bucket in case the key doesn't exist
+        if (available == pottery_null) {
+            uint32_t free_buckets = pottery_group_match_high_clear(metadata);
+            if (free_buckets != 0)
+                available = map->values + base + pottery_ctz_u32(free_buckets);
+        }
+
+        // an empty bucket ends the probing sequence
+        if (pottery_group_match(metadata, empty) != 0)
+            break;
+
+        ++probe;
+        pottery_assert(probe <= group_mask); // assert against full table
+        group = (group + probe) & group_mask;
+    }
+
+    *found = false;
+    return available;
+}
+
+// Finds the first empty or tombstone bucket in the probing sequence of a hash
+// without comparing any keys.
+static
+pottery_ohm_entry_t pottery_ohm_group_probe_free(pottery_ohm_t* map, size_t hash) {
+    size_t group_mask = (pottery_ohm_bucket_count(map) / POTTERY_GROUP_SIZE) - 1;
+    size_t group = pottery_ohm_table_bucket_for_hash(map, map->log_2_size, hash) /
+            POTTERY_GROUP_SIZE;
+    size_t probe = 0;
+
+    while (true) {
+        size_t base = group * POTTERY_GROUP_SIZE;
+        uint32_t free_buckets = pottery_group_match_high_clear(map->metadata + base);
+        if (free_buckets != 0)
+            return map->values + base + pottery_ctz_u32(free_buckets);
+
+        ++probe;
+        pottery_assert(probe <= group_mask); // assert against full table
+        group = (group + probe) & group_mask;
+    }
+}
+
+// Finds an empty or tombstone bucket for a value that is known not to be in
+// the map and marks it with the tag of the hash. This is used to migrate
+// values into a new table so it doesn't need to compare any keys.
+static
+pottery_ohm_entry_t pottery_ohm_group_insert_new(pottery_ohm_t* map, size_t hash) {
+    pottery_ohm_entry_t entry = pottery_ohm_group_probe_free(map, hash);
+    size_t index = pottery_cast(size_t, entry - map->values);
+    if (map->metadata[index] == pottery_cast(uint8_t, pottery_ohm_bucket_state_tombstone))
+        --map->tombstones;
+    map->metadata[index] = pottery_ohm_group_tag(map, hash);
+    #if POTTERY_OPEN_HASH_MAP_STORE_HASH
+    map->hashes[index] = hash;
+    #endif
+    return entry;
+}
+
+// Returns the number of groups probed before reaching the group of the given
+// entry, up to the given limit.
+static
+size_t pottery_ohm_group_probe_length(pottery_ohm_t* map, size_t hash,
+        pottery_ohm_entry_t entry, size_t limit)
+{
+    size_t group_mask = (pottery_ohm_bucket_count(map) / POTTERY_GROUP_SIZE) - 1;
+    size_t group = pottery_ohm_table_bucket_for_hash(map, map->log_2_size, hash) /
+            POTTERY_GROUP_SIZE;
+    size_t target = pottery_cast(size_t, entry - map->values) / POTTERY_GROUP_SIZE;
+    size_t probe = 0;
+
+    while (group != target && probe < limit) {
+        ++probe;
+        group = (group + probe) & group_mask;
+    }
+    return probe;
+}
+
+#endif
+
+// Finds the entry for a key with the given hash, or returns the end of the
+// table if it doesn't exist.
+static inline
+pottery_ohm_entry_t pottery_ohm_impl_find_hash(pottery_ohm_t* map, pottery_ohm_key_t key,
+        size_t hash)
+{
+    #if POTTERY_OPEN_HASH_MAP_GROUP_PROBING
+    bool found;
+    pottery_ohm_entry_t entry = pottery_ohm_group_probe(map, hash, key, &found);
+    return found ? entry : pottery_ohm_table_end(map, map->log_2_size);
+    #else
+    return pottery_ohm_table_find_with_hash(map, map->log_2_size, key, hash);
+    #endif
+}
+
+// Finds the entry for a key with the given hash, or returns the end of the
+// map if it doesn't exist. This checks the old buckets if we're migrating.
+static inline
+pottery_ohm_entry_t pottery_ohm_impl_find_with_hash(pottery_ohm_t* map,
+        pottery_ohm_key_t key, size_t hash)
+{
+    pottery_ohm_entry_t entry = pottery_ohm_impl_find_hash(map, key, hash);
+
+    #if POTTERY_OPEN_HASH_MAP_INCREMENTAL_REHASH
+    // If it's not in the new buckets, it might not have been migrated yet.
+    if (entry == pottery_ohm_end(map) && pottery_ohm_impl_is_migrating(map)) {
+        pottery_ohm_t old_map;
+        pottery_ohm_impl_old_map(map, &old_map);
+        pottery_ohm_entry_t old_entry = pottery_ohm_impl_find_hash(&old_map, key, hash);
+        if (old_entry != pottery_ohm_table_end(&old_map, old_map.log_2_size))
+            return old_entry;
+    }
+    #endif
+
+    return entry;
+}
+
+#if POTTERY_OPEN_HASH_MAP_GROUP_PROBING || POTTERY_OPEN_HASH_MAP_INCREMENTAL_REHASH
+POTTERY_OPEN_HASH_MAP_EXTERN
+pottery_ohm_entry_t pottery_ohm_find(pottery_ohm_t* map, pottery_ohm_key_t key) {
+    return pottery_ohm_impl_find_with_hash(map, key,
+            pottery_ohm_entry_key_hash(map, key));
+}
+
+POTTERY_OPEN_HASH_MAP_EXTERN
+pottery_ohm_entry_t pottery_ohm_find_with_hash(pottery_ohm_t* map, pottery_ohm_key_t key,
+        size_t hash)
+{
+    return pottery_ohm_impl_find_with_hash(map, key, hash);
+}
+#endif
+
+// Prefetches the home bucket of a hash.
+static inline
+void pottery_ohm_impl_prefetch(pottery_ohm_t* map, size_t hash) {
+    size_t bucket = pottery_ohm_table_bucket_for_hash(map, map->log_2_size, hash);
+
+    #if POTTERY_OPEN_HASH_MAP_GROUP_PROBING
+    // We'll check the metadata of the whole group before touching any values.
+    pottery_prefetch(map->metadata + (bucket & ~pottery_cast(size_t, POTTERY_GROUP_SIZE - 1)));
+    #else
+    #if POTTERY_OPEN_HASH_MAP_PACKED_METADATA
+    pottery_prefetch(map->metadata + bucket / POTTERY_OPEN_HASH_MAP_METADATA_PER_WORD);
+    #elif POTTERY_OPEN_HASH_MAP_HAS_METADATA
+    pottery_prefetch(map->metadata + bucket);
+    #endif
+    #if POTTERY_OPEN_HASH_MAP_STORE_HASH
+    pottery_prefetch(map->hashes + bucket);
+    #endif
+    pottery_prefetch(map->values + bucket);
+    #endif
+}
+
+POTTERY_OPEN_HASH_MAP_EXTERN
+void pottery_ohm_find_bulk(pottery_ohm_t* map, const pottery_ohm_key_t* keys,
+        size_t count, pottery_ohm_entry_t* entries)
+{
+    size_t hashes[POTTERY_OPEN_HASH_MAP_PREFETCH_BATCH];
+
+    while (count > 0) {
+        size_t batch = (count < POTTERY_OPEN_HASH_MAP_PREFETCH_BATCH) ?
+                count : POTTERY_OPEN_HASH_MAP_PREFETCH_BATCH;
+        size_t i;
+
+        // Hash the whole batch and prefetch the buckets so that the cache
+        // misses overlap.
+        for (i = 0; i < batch; ++i) {
+            hashes[i] = pottery_ohm_entry_key_hash(map, keys[i]);
+            pottery_ohm_impl_prefetch(map, hashes[i]);
+        }
+
+        // Probe for them
+        for (i = 0; i < batch; ++i)
+            entries[i] = pottery_ohm_impl_find_with_hash(map, keys[i], hashes[i]);
+
+        keys += batch;
+        entries += batch;
+        count -= batch;
+    }
+}
+
+POTTERY_OPEN_HASH_MAP_EXTERN
+size_t pottery_ohm_contains_bulk(pottery_ohm_t* map, const pottery_ohm_key_t* keys,
+        size_t count, bool* /*nullable*/ results)
+{
+    pottery_ohm_entry_t entries[POTTERY_OPEN_HASH_MAP_PREFETCH_BATCH];
+    size_t found = 0;
+
+    while (count > 0) {
+        size_t batch = (count < POTTERY_OPEN_HASH_MAP_PREFETCH_BATCH) ?
+                count : POTTERY_OPEN_HASH_MAP_PREFETCH_BATCH;
+        pottery_ohm_find_bulk(map, keys, batch, entries);
+
+        size_t i;
+        for (i = 0; i < batch; ++i) {
+            bool exists = pottery_ohm_entry_exists(map, entries[i]);
+            if (results != pottery_null)
+                results[i] = exists;
+            found += exists;
+        }
+
+        keys += batch;
+        if (results != pottery_null)
+            results += batch;
+        count -= batch;
+    }
+
+    return found;
+}
+
+// Moves a value from the given old map (which is not the map's own table)
+// into the map.
+static
+void pottery_ohm_impl_migrate_value(pottery_ohm_t* map, pottery_ohm_t* old_map,
+        pottery_ohm_entry_t source)
+{
+    #if POTTERY_OPEN_HASH_MAP_STORE_HASH
+    // We don't need to re-hash the key.
+    size_t hash = pottery_ohm_entry_stored_hash(old_map, source);
+    #else
+    size_t hash = pottery_ohm_entry_key_hash(map, pottery_ohm_entry_key(old_map, source));
+    #endif
+
+    #if POTTERY_OPEN_HASH_MAP_GROUP_PROBING
+    pottery_ohm_entry_t target = pottery_ohm_group_insert_new(map, hash);
+    #else
+    pottery_ohm_entry_t target = pottery_ohm_table_emplace_key_with_hash(
+            map,
+            map->log_2_size,
+            #if POTTERY_OPEN_HASH_MAP_TOMBSTONES
+            &map->tombstones,
+            #endif
+            pottery_ohm_table_key(old_map, source),
+            hash,
+            pottery_null);
+    #endif
+
+    pottery_ohm_lifecycle_move_restrict(
+            POTTERY_OPEN_HASH_MAP_CONTEXT_VAL
+            target, source);
+
+    #if POTTERY_OPEN_HASH_MAP_HAS_METADATA && !POTTERY_OPEN_HASH_MAP_GROUP_PROBING && \
+            !POTTERY_OPEN_HASH_MAP_ROBIN_HOOD_HASHING
+    pottery_ohm_entry_set_other(map, target);
+    #endif
+    ++map->count;
+}
+
+#if POTTERY_OPEN_HASH_MAP_PURGE_IN_PLACE
+// Re-hashes the table in place at the same size, clearing all tombstones.
+// This doesn't allocate so it can't fail.
+//
+// All values are first marked as tombstones (and all tombstones as empty.)
+// We then re-insert each marked value into the first empty or marked bucket
+// in its probing sequence. If that bucket is marked, we swap the values and
+// continue with the one we've swapped out. Every step places one value so
+// this takes one probe per value.
+static
+void pottery_ohm_impl_purge(pottery_ohm_t* map) {
+    size_t size = pottery_ohm_bucket_count(map);
+    size_t i;
+
+    for (i = 0; i < size; ++i) {
+        pottery_ohm_entry_t entry = map->values + i;
+        if (pottery_ohm_entry_is_value(map, entry))
+            pottery_ohm_entry_set_tombstone(map, entry);
+        else
+            pottery_ohm_entry_set_empty(map, entry);
+    }
+    map->tombstones = map->count;
+
+    for (i = 0; i < size; ++i) {
+        pottery_ohm_entry_t source = map->values + i;
+        while (pottery_ohm_entry_is_tombstone(map, source)) {
+            #if POTTERY_OPEN_HASH_MAP_STORE_HASH
+            size_t hash = pottery_ohm_entry_stored_hash(map, source);
+            #else
+            size_t hash = pottery_ohm_entry_key_hash(map, pottery_ohm_entry_key(map, source));
+            #endif
+
+            #if POTTERY_OPEN_HASH_MAP_GROUP_PROBING
+            pottery_ohm_entry_t target = pottery_ohm_group_probe_free(map, hash);
+            #else
+            pottery_ohm_entry_t target = pottery_ohm_table_probe_free(map, map->log_2_size,
+                    pottery_ohm_entry_key(map, source), hash);
+            #endif
+
+            if (target != source) {
+                if (pottery_ohm_entry_is_tombstone(map, target)) {
+                    // The target is waiting to be placed too. We take its
+                    // bucket and place it next.
+                    pottery_ohm_lifecycle_swap_restrict(
+                            POTTERY_OPEN_HASH_MAP_CONTEXT_VAL
+                            target, source);
+                    #if POTTERY_OPEN_HASH_MAP_STORE_HASH
+                    pottery_ohm_entry_set_stored_hash(map, source,
+                            pottery_ohm_entry_stored_hash(map, target));
+                    #endif
+                } else {
+                    pottery_ohm_lifecycle_move_restrict(
+                            POTTERY_OPEN_HASH_MAP_CONTEXT_VAL
+                            target, source);
+                    pottery_ohm_entry_set_empty(map, source);
+                }
+            }
+
+            #if POTTERY_OPEN_HASH_MAP_GROUP_PROBING
+            *pottery_ohm_entry_metadata(map, target) = pottery_ohm_group_tag(map, hash);
+            #else
+            pottery_ohm_entry_set_other(map, target);
+            #endif
+            #if POTTERY_OPEN_HASH_MAP_STORE_HASH
+            pottery_ohm_entry_set_stored_hash(map, target, hash);
+            #endif
+            --map->tombstones;
+        }
+    }
+
+    pottery_assert(map->tombstones == 0);
+}
+#endif
+
 // Re-hashes the table, possibly resizing in the process.
 pottery_noinline static
 pottery_error_t pottery_ohm_rehash(pottery_ohm_t* map, size_t new_log_2_size) {
+    #if POTTERY_OPEN_HASH_MAP_INCREMENTAL_REHASH
+    pottery_assert(!pottery_ohm_impl_is_migrating(map));
+    #endif
+
+    #if POTTERY_OPEN_HASH_MAP_PURGE_IN_PLACE
+    // If we're not resizing, we don't need a second table.
+    if (new_log_2_size == map->log_2_size) {
+        #if POTTERY_OPEN_HASH_MAP_SEEDED && POTTERY_OPEN_HASH_MAP_PROBE_LIMIT
+        map->long_probe = false;
+        #endif
+        pottery_ohm_impl_purge(map);
+        return POTTERY_OK;
+    }
+    #endif
 
     // Allocate a new map with the new size
     pottery_ohm_t new_map;
@@ -177,48 +764,164 @@ pottery_error_t pottery_ohm_rehash(pottery_ohm_t* map, size_t new_log_2_size) {
     if (error != POTTERY_OK)
         return error;
 
+    #if POTTERY_OPEN_HASH_MAP_SEEDED
+    // The new buckets keep our seed.
+    new_map.seed = map->seed;
+    #if POTTERY_OPEN_HASH_MAP_PROBE_LIMIT
+    new_map.long_probe = false;
+    new_map.reseeded = map->reseeded && new_log_2_size == map->log_2_size;
+    #endif
+    #endif
+
     // Replace our map, saving the old values
     pottery_ohm_t old_map = *map;
     *map = new_map;
 
     // Migrate all values from old table into new one
-    pottery_ohm_entry_t source = pottery_ohm_begin(&old_map);
-    while (pottery_ohm_entry_exists(&old_map, source)) {
-        //printf("migrating bucket %zi\n", source - old_map.values);
-
-        pottery_ohm_entry_t target = pottery_ohm_table_emplace_key(
-                map,
-                map->log_2_size,
-                #if POTTERY_OPEN_HASH_MAP_TOMBSTONES
-                pottery_null,
-                #endif
-                pottery_ohm_table_key(&old_map, source),
-                pottery_null);
-
-        pottery_ohm_lifecycle_move_restrict(
-                POTTERY_OPEN_HASH_MAP_CONTEXT_VAL
-                target, source);
+    pottery_ohm_entry_t source = pottery_ohm_impl_scan_begin(&old_map);
+    while (pottery_ohm_table_entry_exists(&old_map, old_map.log_2_size, source)) {
+        pottery_ohm_impl_migrate_value(map, &old_map, source);
+        source = pottery_ohm_impl_scan_next(&old_map, source);
+    }
 
-        #if POTTERY_OPEN_HASH_MAP_HAS_METADATA
-        pottery_ohm_entry_set_other(map, target);
+    // Free the old map
+    pottery_ohm_impl_free_allocs(map, &old_map);
+    return POTTERY_OK;
+}
+
+#if POTTERY_OPEN_HASH_MAP_INCREMENTAL_REHASH
+// Frees the old buckets. Any values remaining in them must have been
+// destroyed or displaced.
+static
+void pottery_ohm_impl_end_migration(pottery_ohm_t* map) {
+    pottery_ohm_t old_map;
+    pottery_ohm_impl_old_map(map, &old_map);
+    pottery_ohm_impl_free_allocs(map, &old_map);
+    map->old_values = pottery_null;
+    map->old_count = 0;
+}
+
+// Migrates values from the old buckets to the new ones. At least the given
+// number of old buckets are visited (or all of them if steps is SIZE_MAX.)
+//
+// If the old buckets have tombstones, migrated values are replaced with
+// tombstones so that the probing sequences of the remaining values stay
+// intact. Otherwise (linear probing without tombstones) we only stop at an
+// empty bucket, i.e. between clusters, so the remaining clusters are intact.
+static
+void pottery_ohm_impl_migrate(pottery_ohm_t* map, size_t steps) {
+    pottery_ohm_t old_map;
+    pottery_ohm_impl_old_map(map, &old_map);
+    size_t mask = pottery_ohm_bucket_count(&old_map) - 1;
+
+    size_t i;
+    for (i = 0; map->old_count != 0; ++i) {
+        pottery_ohm_entry_t source = old_map.values + map->migrate_index;
+        bool is_value = pottery_ohm_entry_is_value(&old_map, source);
+
+        #if POTTERY_OPEN_HASH_MAP_TOMBSTONES
+        if (i >= steps)
+            break;
+        #else
+        if (i >= steps && !is_value)
+            break;
         #endif
-        ++map->count;
 
-        source = pottery_ohm_next(&old_map, source);
+        if (is_value) {
+            pottery_ohm_impl_migrate_value(map, &old_map, source);
+            #if POTTERY_OPEN_HASH_MAP_TOMBSTONES
+            pottery_ohm_entry_set_tombstone(&old_map, source);
+            #else
+            pottery_ohm_entry_set_empty(&old_map, source);
+            #endif
+            --map->old_count;
+        }
+
+        map->migrate_index = (map->migrate_index + 1) & mask;
     }
 
-    // Free the old map
-    pottery_ohm_impl_free_allocs(&old_map);
+    if (map->old_count == 0)
+        pottery_ohm_impl_end_migration(map);
+}
+
+// Allocates new buckets of the given size and starts migrating to them.
+static
+pottery_error_t pottery_ohm_impl_begin_migration(pottery_ohm_t* map, size_t new_log_2_size) {
+    pottery_assert(!pottery_ohm_impl_is_migrating(map));
+
+    pottery_ohm_t new_map;
+    pottery_error_t error = pottery_ohm_init_impl(&new_map,
+            #ifdef POTTERY_OPEN_HASH_MAP_CONTEXT_TYPE
+            map->context,
+            #endif
+            new_log_2_size);
+    if (error != POTTERY_OK)
+        return error;
+
+    #if POTTERY_OPEN_HASH_MAP_SEEDED
+    // The new buckets keep our seed.
+    new_map.seed = map->seed;
+    #if POTTERY_OPEN_HASH_MAP_PROBE_LIMIT
+    new_map.long_probe = false;
+    new_map.reseeded = map->reseeded && new_log_2_size == map->log_2_size;
+    #endif
+    #endif
+
+    // The current buckets become the old buckets.
+    new_map.old_values = map->values;
+    new_map.old_log_2_size = map->log_2_size;
+    new_map.old_count = map->count;
+    #if POTTERY_OPEN_HASH_MAP_HAS_METADATA
+    new_map.old_metadata = map->metadata;
+    #endif
+    #if POTTERY_OPEN_HASH_MAP_STORE_HASH
+    new_map.old_hashes = map->hashes;
+    #endif
+    *map = new_map;
+
+    // Without tombstones we need to start at an empty bucket so that we
+    // never stop in the middle of a cluster. There is always one.
+    map->migrate_index = 0;
+    #if !POTTERY_OPEN_HASH_MAP_TOMBSTONES
+    {
+        pottery_ohm_t old_map;
+        pottery_ohm_impl_old_map(map, &old_map);
+        while (pottery_ohm_entry_is_value(&old_map, old_map.values + map->migrate_index))
+            ++map->migrate_index;
+    }
+    #endif
+
+    if (map->old_count == 0)
+        pottery_ohm_impl_end_migration(map);
     return POTTERY_OK;
 }
+#endif
 
 static inline
 pottery_error_t pottery_ohm_grow_if_needed(pottery_ohm_t* map) {
     if (pottery_ohm_load(map) <= pottery_ohm_capacity(map)) {
+        #if POTTERY_OPEN_HASH_MAP_HOPSCOTCH_HASHING
+        // A value was placed outside the neighborhood of its home bucket. We
+        // grow early if we're at least half full; otherwise the keys are
+        // colliding too much for growing to help and we leave it in overflow.
+        if (map->hop_overflow) {
+            map->hop_overflow = false;
+            if (pottery_ohm_count(map) >= pottery_ohm_bucket_count(map) / 2)
+                return pottery_ohm_rehash(map, map->log_2_size + 1);
+        }
+        #endif
+
         // no need to grow
         return POTTERY_OK;
     }
 
+    #if POTTERY_OPEN_HASH_MAP_INCREMENTAL_REHASH
+    // If we're still migrating, we have to finish before we can grow again.
+    // This only happens if the step is too small for the load factor.
+    if (pottery_ohm_impl_is_migrating(map))
+        pottery_ohm_impl_migrate(map, SIZE_MAX);
+    #endif
+
     // If the table is full of tombstones, we don't grow; we just rehash to
     // the same size. Otherwise we double in size.
     size_t new_log_2_size = map->log_2_size + (
@@ -227,28 +930,147 @@ pottery_error_t pottery_ohm_grow_if_needed(pottery_ohm_t* map) {
         #endif
         1);
 
+    #if POTTERY_OPEN_HASH_MAP_INCREMENTAL_REHASH
+    #if POTTERY_OPEN_HASH_MAP_PURGE_IN_PLACE
+    // Tombstones are purged in place all at once since this doesn't need
+    // new buckets to migrate to.
+    if (new_log_2_size != map->log_2_size)
+    #endif
+        return pottery_ohm_impl_begin_migration(map, new_log_2_size);
+    #endif
+
     return pottery_ohm_rehash(map, new_log_2_size);
 }
 
 static inline
 void pottery_ohm_shrink_if_needed(pottery_ohm_t* map) {
 
-    // We shrink by half if the count is less than a quarter of our capacity.
+    // We shrink by half if the count falls below the min load factor.
     if (map->log_2_size <= POTTERY_OPEN_HASH_MAP_MINIMUM_LOG_2_SIZE ||
-            pottery_ohm_count(map) > pottery_ohm_capacity(map) / 4) {
+            pottery_ohm_count(map) >= pottery_ohm_min_count(map)) {
         // no need to shrink
         return;
     }
 
+    #if POTTERY_OPEN_HASH_MAP_INCREMENTAL_REHASH
+    // We don't shrink while migrating. We'll shrink on a later removal once
+    // the migration is done.
+    if (pottery_ohm_impl_is_migrating(map))
+        return;
+    #endif
+
     // Note: we ignore the return value here. If allocating the smaller table
     // fails, we just keep our larger table, this way displace can't fail.
     (void)pottery_ohm_rehash(map, map->log_2_size - 1);
 }
 
+POTTERY_OPEN_HASH_MAP_EXTERN
+pottery_error_t pottery_ohm_reserve(pottery_ohm_t* map, size_t count) {
+    size_t log_2_size = map->log_2_size;
+    while (pottery_ohm_impl_size_capacity(pottery_cast(size_t, 1) << log_2_size) < count) {
+        if (log_2_size + 2 >= sizeof(size_t) * 8)
+            return POTTERY_ERROR_OVERFLOW;
+        ++log_2_size;
+    }
+    if (log_2_size == map->log_2_size)
+        return POTTERY_OK;
+
+    #if POTTERY_OPEN_HASH_MAP_INCREMENTAL_REHASH
+    // We finish any migration and rehash all at once. The caller presumably
+    // wants to pay for growth now rather than while inserting.
+    if (pottery_ohm_impl_is_migrating(map))
+        pottery_ohm_impl_migrate(map, SIZE_MAX);
+    #endif
+
+    return pottery_ohm_rehash(map, log_2_size);
+}
+
+POTTERY_OPEN_HASH_MAP_EXTERN
+pottery_error_t pottery_ohm_shrink(pottery_ohm_t* map) {
+    #if POTTERY_OPEN_HASH_MAP_INCREMENTAL_REHASH
+    if (pottery_ohm_impl_is_migrating(map))
+        pottery_ohm_impl_migrate(map, SIZE_MAX);
+    #endif
+
+    // Find the smallest size that can hold our values.
+    size_t log_2_size = POTTERY_OPEN_HASH_MAP_MINIMUM_LOG_2_SIZE;
+    while (pottery_ohm_impl_size_capacity(pottery_cast(size_t, 1) << log_2_size) < map->count)
+        ++log_2_size;
+
+    if (log_2_size < map->log_2_size)
+        return pottery_ohm_rehash(map, log_2_size);
+
+    // If we're already as small as we can be, we still clear our tombstones.
+    #if POTTERY_OPEN_HASH_MAP_TOMBSTONES
+    if (map->tombstones != 0)
+        return pottery_ohm_rehash(map, map->log_2_size);
+    #endif
+
+    return POTTERY_OK;
+}
+
+#if POTTERY_OPEN_HASH_MAP_PROBE_LIMIT
+// Rehashes the map with a new seed if the last insertion probed too far.
+//
+// We only do this once per size. If the map is still degenerate after a
+// reseed, the keys probably have the same full hashes and no seed will
+// separate them, so we don't keep trying until the map grows or shrinks.
+static
+void pottery_ohm_impl_reseed(pottery_ohm_t* map) {
+    map->long_probe = false;
+    if (map->reseeded)
+        return;
+
+    #if POTTERY_OPEN_HASH_MAP_INCREMENTAL_REHASH
+    if (pottery_ohm_impl_is_migrating(map))
+        pottery_ohm_impl_migrate(map, SIZE_MAX);
+    #endif
+
+    // Note: we ignore allocation failure here as in shrinking. The map just
+    // keeps its seed.
+    uint64_t old_seed = map->seed;
+    map->seed = pottery_hash_mix_u64(old_seed ^ pottery_random_seed(map),
+            UINT64_C(0x9E3779B97F4A7C15));
+    if (POTTERY_OK != pottery_ohm_rehash(map, map->log_2_size)) {
+        map->seed = old_seed;
+        return;
+    }
+    map->reseeded = true;
+}
+
+// Checks how far a new entry is from its home bucket.
+static inline
+void pottery_ohm_impl_watch_probe(pottery_ohm_t* map, pottery_ohm_entry_t entry, size_t hash) {
+    size_t length =
+            #if POTTERY_OPEN_HASH_MAP_GROUP_PROBING
+            pottery_ohm_group_probe_length(
+                    map, hash, entry, POTTERY_OPEN_HASH_MAP_PROBE_LIMIT);
+            #else
+            pottery_ohm_table_entry_probe_length(
+                    map, map->log_2_size, entry, hash, POTTERY_OPEN_HASH_MAP_PROBE_LIMIT);
+            #endif
+    if (length >= POTTERY_OPEN_HASH_MAP_PROBE_LIMIT)
+        map->long_probe = true;
+}
+#endif
+
 POTTERY_OPEN_HASH_MAP_EXTERN
 pottery_error_t pottery_ohm_emplace_key(pottery_ohm_t* map, pottery_ohm_key_t key,
-        pottery_ohm_entry_t* entry, bool* /*nullable*/ out_created)
+        pottery_ohm_entry_t* entry, bool* /*nullable*/ created)
 {
+    return pottery_ohm_emplace_key_with_hash(map, key,
+            pottery_ohm_entry_key_hash(map, key), entry, created);
+}
+
+POTTERY_OPEN_HASH_MAP_EXTERN
+pottery_error_t pottery_ohm_emplace_key_with_hash(pottery_ohm_t* map, pottery_ohm_key_t key,
+        size_t hash, pottery_ohm_entry_t* entry, bool* /*nullable*/ out_created)
+{
+    #if POTTERY_OPEN_HASH_MAP_PROBE_LIMIT
+    if (map->long_probe)
+        pottery_ohm_impl_reseed(map);
+    #endif
+
     // If we're full we grow regardless of whether the element already exists
     // in order to make sure there's enough room for it.
     pottery_error_t error = pottery_ohm_grow_if_needed(map);
@@ -256,28 +1078,141 @@ pottery_error_t pottery_ohm_emplace_key(pottery_ohm_t* map, pottery_ohm_key_t ke
         return error;
 
     bool created;
-    *entry = pottery_ohm_table_emplace_key(
+    pottery_assert(hash == pottery_ohm_entry_key_hash(map, key));
+
+    #if POTTERY_OPEN_HASH_MAP_INCREMENTAL_REHASH
+    if (pottery_ohm_impl_is_migrating(map)) {
+        pottery_ohm_impl_migrate(map, POTTERY_OPEN_HASH_MAP_INCREMENTAL_REHASH_STEP);
+
+        // If the key hasn't been migrated yet, we return it where it is.
+        if (pottery_ohm_impl_is_migrating(map)) {
+            pottery_ohm_t old_map;
+            pottery_ohm_impl_old_map(map, &old_map);
+            *entry = pottery_ohm_impl_find_hash(&old_map, key, hash);
+            if (*entry != pottery_ohm_table_end(&old_map, old_map.log_2_size)) {
+                if (out_created)
+                    *out_created = false;
+                return POTTERY_OK;
+            }
+        }
+    }
+    #endif
+
+    #if POTTERY_OPEN_HASH_MAP_GROUP_PROBING
+    bool found;
+    *entry = pottery_ohm_group_probe(map, hash, key, &found);
+    created = !found;
+    if (created) {
+        uint8_t* metadata = pottery_ohm_entry_metadata(map, *entry);
+        if (*metadata == pottery_cast(uint8_t, pottery_ohm_bucket_state_tombstone))
+            --map->tombstones;
+        *metadata = pottery_ohm_group_tag(map, hash);
+        #if POTTERY_OPEN_HASH_MAP_STORE_HASH
+        pottery_ohm_entry_set_stored_hash(map, *entry, hash);
+        #endif
+    }
+
+    #else
+    *entry = pottery_ohm_table_emplace_key_with_hash(
             map,
             map->log_2_size,
             #if POTTERY_OPEN_HASH_MAP_TOMBSTONES
             &map->tombstones,
             #endif
             key,
+            hash,
             &created);
 
-    #if POTTERY_OPEN_HASH_MAP_HAS_METADATA
+    // (With Robin Hood hashing, the table has already stored the probe
+    // distance in our metadata.)
+    #if POTTERY_OPEN_HASH_MAP_HAS_METADATA && !POTTERY_OPEN_HASH_MAP_ROBIN_HOOD_HASHING
     pottery_ohm_entry_set_other(map, *entry);
     #endif
+    #endif
 
-    if (created)
+    if (created) {
         ++map->count;
+        #if POTTERY_OPEN_HASH_MAP_PROBE_LIMIT
+        pottery_ohm_impl_watch_probe(map, *entry, hash);
+        #endif
+        #if POTTERY_OPEN_HASH_MAP_HOPSCOTCH_HASHING
+        if (pottery_ohm_table_entry_probe_length(map, map->log_2_size, *entry, hash,
+                    POTTERY_OPEN_HASH_MAP_HOPSCOTCH_NEIGHBORHOOD)
+                >= POTTERY_OPEN_HASH_MAP_HOPSCOTCH_NEIGHBORHOOD)
+            map->hop_overflow = true;
+        #endif
+    }
     if (out_created)
         *out_created = created;
     return POTTERY_OK;
 }
 
+#if POTTERY_OPEN_HASH_MAP_CAN_DESTROY
 POTTERY_OPEN_HASH_MAP_EXTERN
-void pottery_ohm_displace(pottery_ohm_t* map, pottery_ohm_entry_t entry) {
+pottery_error_t pottery_ohm_insert_bulk(pottery_ohm_t* map, pottery_ohm_value_t* values,
+        size_t count)
+{
+    size_t hashes[POTTERY_OPEN_HASH_MAP_PREFETCH_BATCH];
+    pottery_error_t error;
+
+    // Grow once for all of the values. (If some of their keys are already in
+    // the map, this reserves more than we need.)
+    if (count > SIZE_MAX - pottery_ohm_count(map))
+        return POTTERY_ERROR_OVERFLOW;
+    error = pottery_ohm_reserve(map, pottery_ohm_count(map) + count);
+    if (error != POTTERY_OK)
+        return error;
+
+    while (count > 0) {
+        size_t batch = (count < POTTERY_OPEN_HASH_MAP_PREFETCH_BATCH) ?
+                count : POTTERY_OPEN_HASH_MAP_PREFETCH_BATCH;
+        size_t i;
+
+        // As in find_bulk(), hash the whole batch and prefetch the buckets
+        // so that the cache misses overlap.
+        for (i = 0; i < batch; ++i) {
+            hashes[i] = pottery_ohm_entry_key_hash(map, pottery_ohm_entry_key(map, values + i));
+            pottery_ohm_impl_prefetch(map, hashes[i]);
+        }
+
+        for (i = 0; i < batch; ++i) {
+            pottery_ohm_entry_t entry;
+            bool created;
+            error = pottery_ohm_emplace_key_with_hash(map,
+                    pottery_ohm_entry_key(map, values + i), hashes[i], &entry, &created);
+            if (error != POTTERY_OK)
+                return error;
+            if (!created)
+                pottery_ohm_entry_destroy(map, entry);
+            pottery_ohm_lifecycle_move_restrict(
+                    POTTERY_OPEN_HASH_MAP_CONTEXT_VAL
+                    entry, values + i);
+        }
+
+        values += batch;
+        count -= batch;
+    }
+
+    return POTTERY_OK;
+}
+#endif
+
+// Displaces an entry from the buckets of the given map without updating its
+// count.
+static
+void pottery_ohm_impl_displace(pottery_ohm_t* map, pottery_ohm_entry_t entry) {
+    #if POTTERY_OPEN_HASH_MAP_GROUP_PROBING
+    pottery_assert(pottery_ohm_entry_is_value(map, entry));
+    size_t index = pottery_cast(size_t, entry - map->values);
+    const uint8_t* group = map->metadata +
+            (index & ~pottery_cast(size_t, POTTERY_GROUP_SIZE - 1));
+    if (pottery_group_match(group, pottery_cast(uint8_t, pottery_ohm_bucket_state_empty)) != 0) {
+        pottery_ohm_entry_set_empty(map, entry);
+    } else {
+        pottery_ohm_entry_set_tombstone(map, entry);
+        ++map->tombstones;
+    }
+    #else
     pottery_ohm_table_displace(
             map,
             map->log_2_size,
@@ -285,6 +1220,31 @@ void pottery_ohm_displace(pottery_ohm_t* map, pottery_ohm_entry_t entry) {
             &map->tombstones,
             #endif
             entry);
+    #endif
+}
+
+POTTERY_OPEN_HASH_MAP_EXTERN
+void pottery_ohm_displace(pottery_ohm_t* map, pottery_ohm_entry_t entry) {
+    #if POTTERY_OPEN_HASH_MAP_INCREMENTAL_REHASH
+    if (pottery_ohm_impl_is_migrating(map)) {
+        if (pottery_ohm_impl_is_old_entry(map, entry)) {
+            // (Displacing from the old buckets doesn't break the migration.
+            // Tombstones stay where they are, and without tombstones values
+            // are only shifted back within their cluster.)
+            pottery_ohm_t old_map;
+            pottery_ohm_impl_old_map(map, &old_map);
+            pottery_ohm_impl_displace(&old_map, entry);
+            --map->old_count;
+        } else {
+            pottery_ohm_impl_displace(map, entry);
+            --map->count;
+        }
+        pottery_ohm_impl_migrate(map, POTTERY_OPEN_HASH_MAP_INCREMENTAL_REHASH_STEP);
+        return;
+    }
+    #endif
+
+    pottery_ohm_impl_displace(map, entry);
     --map->count;
     pottery_ohm_shrink_if_needed(map);
 }
@@ -292,6 +1252,10 @@ void pottery_ohm_displace(pottery_ohm_t* map, pottery_ohm_entry_t entry) {
 #if POTTERY_OPEN_HASH_MAP_CAN_DESTROY
 POTTERY_OPEN_HASH_MAP_EXTERN
 void pottery_ohm_remove(pottery_ohm_t* map, pottery_ohm_entry_t entry) {
+    #if POTTERY_OPEN_HASH_MAP_GROUP_PROBING || POTTERY_OPEN_HASH_MAP_INCREMENTAL_REHASH
+    pottery_ohm_entry_destroy(map, entry);
+    pottery_ohm_displace(map, entry);
+    #else
     pottery_ohm_table_remove(
             map,
             map->log_2_size,
@@ -301,41 +1265,50 @@ void pottery_ohm_remove(pottery_ohm_t* map, pottery_ohm_entry_t entry) {
             entry);
     --map->count;
     pottery_ohm_shrink_if_needed(map);
+    #endif
 }
 
 POTTERY_OPEN_HASH_MAP_EXTERN
 bool pottery_ohm_remove_key(pottery_ohm_t* map, pottery_ohm_key_t key) {
-    bool removed = pottery_ohm_table_remove_key(
-            map,
-            map->log_2_size,
-            #if POTTERY_OPEN_HASH_MAP_TOMBSTONES
-            &map->tombstones,
-            #endif
-            key);
-    if (removed) {
-        --map->count;
-        pottery_ohm_shrink_if_needed(map);
-    }
-    return removed;
+    return pottery_ohm_remove_key_with_hash(map, key,
+            pottery_ohm_entry_key_hash(map, key));
 }
-#endif
 
 POTTERY_OPEN_HASH_MAP_EXTERN
-void pottery_ohm_displace_all(pottery_ohm_t* map) {
+bool pottery_ohm_remove_key_with_hash(pottery_ohm_t* map, pottery_ohm_key_t key,
+        size_t hash)
+{
+    pottery_ohm_entry_t entry = pottery_ohm_find_with_hash(map, key, hash);
+    if (!pottery_ohm_entry_exists(map, entry))
+        return false;
+    pottery_ohm_remove(map, entry);
+    return true;
+}
+#endif
+
+static
+void pottery_ohm_impl_displace_all(pottery_ohm_t* map, bool keep_capacity) {
+    #if POTTERY_OPEN_HASH_MAP_INCREMENTAL_REHASH
+    // The remaining old values have been displaced by the caller.
+    if (pottery_ohm_impl_is_migrating(map))
+        pottery_ohm_impl_end_migration(map);
+    #endif
+
     map->count = 0;
     #if POTTERY_OPEN_HASH_MAP_TOMBSTONES
     map->tombstones = 0;
     #endif
 
     // If the size is larger than the minimum, we re-allocate to the minimum
-    // size; otherwise we clear and keep the existing allocation.
+    // size unless asked to keep it; otherwise we clear and keep the existing
+    // allocation.
 
     // (Eventually it might be nice if open_hash_map didn't need to allocate
     // memory if it has no elements, like vector does. If/when we implement
     // this later, this should just free and null the buckets instead.)
 
-    if (map->log_2_size == POTTERY_OPEN_HASH_MAP_MINIMUM_LOG_2_SIZE) {
-        pottery_ohm_table_displace_all(map, map->log_2_size);
+    if (keep_capacity || map->log_2_size == POTTERY_OPEN_HASH_MAP_MINIMUM_LOG_2_SIZE) {
+        pottery_ohm_impl_clear(map);
         return;
     }
 
@@ -348,21 +1321,204 @@ void pottery_ohm_displace_all(pottery_ohm_t* map) {
             POTTERY_OPEN_HASH_MAP_MINIMUM_LOG_2_SIZE)))
     {
         *map = old_map;
-        pottery_ohm_table_displace_all(map, map->log_2_size);
+        pottery_ohm_impl_clear(map);
         return;
     }
 
-    pottery_ohm_impl_free_allocs(&old_map);
+    pottery_ohm_impl_free_allocs(map, &old_map);
+}
+
+POTTERY_OPEN_HASH_MAP_EXTERN
+void pottery_ohm_displace_all(pottery_ohm_t* map) {
+    pottery_ohm_impl_displace_all(map, false);
+}
+
+POTTERY_OPEN_HASH_MAP_EXTERN
+void pottery_ohm_displace_all_keep_capacity(pottery_ohm_t* map) {
+    pottery_ohm_impl_displace_all(map, true);
 }
 
 #if POTTERY_OPEN_HASH_MAP_CAN_DESTROY
+static
+void pottery_ohm_impl_remove_all(pottery_ohm_t* map, bool keep_capacity) {
+    // destroy_all() followed by displace_all() could iterate twice over the
+    // whole map if it doesn't resize. Clearing usually just zeroes our
+    // metadata or values so this isn't much slower than a single pass.
+    #if POTTERY_OPEN_HASH_MAP_INCREMENTAL_REHASH
+    if (pottery_ohm_impl_is_migrating(map)) {
+        pottery_ohm_t old_map;
+        pottery_ohm_impl_old_map(map, &old_map);
+        pottery_ohm_impl_destroy_all(&old_map);
+    }
+    #endif
+    pottery_ohm_impl_destroy_all(map);
+    pottery_ohm_impl_displace_all(map, keep_capacity);
+}
+
 POTTERY_OPEN_HASH_MAP_EXTERN
 void pottery_ohm_remove_all(pottery_ohm_t* map) {
-    // destroy_all() followed by displace_all() could iterate twice over the
-    // whole map if it doesn't resize. This will only happen if allocation
-    // fails or if it's the minimum size, and in both cases performance is
-    // irrelevant.
-    pottery_ohm_table_destroy_all(map, map->log_2_size);
-    pottery_ohm_displace_all(map);
+    pottery_ohm_impl_remove_all(map, false);
+}
+
+POTTERY_OPEN_HASH_MAP_EXTERN
+void pottery_ohm_remove_all_keep_capacity(pottery_ohm_t* map) {
+    pottery_ohm_impl_remove_all(map, true);
 }
 #endif
+
+#if POTTERY_OPEN_HASH_MAP_HOPSCOTCH_HASHING
+// Returns the number of bits set in the given hop info bits.
+static inline
+size_t pottery_ohm_impl_bit_count(uint32_t bits) {
+    size_t count = 0;
+    for (; bits != 0; bits &= bits - 1)
+        ++count;
+    return count;
+}
+#endif
+
+// Accumulates the stats of a single array of buckets, which is either the map
+// itself or a temporary copy of it describing its old buckets.
+static
+void pottery_ohm_impl_stats_table(pottery_ohm_t* map, pottery_ohm_stats_t* stats) {
+    size_t size = pottery_ohm_bucket_count(map);
+    size_t used = 0;
+    size_t i;
+
+    stats->value_bytes += size * sizeof(pottery_ohm_value_t);
+    #if POTTERY_OPEN_HASH_MAP_HAS_METADATA
+    stats->metadata_bytes += pottery_ohm_impl_metadata_size(size) * sizeof(pottery_ohm_metadata_t);
+    #endif
+    #if POTTERY_OPEN_HASH_MAP_STORE_HASH
+    stats->metadata_bytes += size * sizeof(size_t);
+    #endif
+    #if POTTERY_OPEN_HASH_MAP_HOPSCOTCH_HASHING
+    stats->metadata_bytes += size * sizeof(uint32_t);
+    size_t neighborhood = pottery_ohm_table_hopscotch_neighborhood(map->log_2_size);
+    uint32_t hop_mask = (UINT32_C(1) << POTTERY_OPEN_HASH_MAP_HOPSCOTCH_NEIGHBORHOOD) - 1;
+    #endif
+
+    // Measure the probe length of each value.
+    for (i = 0; i < size; ++i) {
+        pottery_ohm_entry_t entry = map->values + i;
+        if (!pottery_ohm_entry_is_empty(map, entry))
+            ++used;
+        if (!pottery_ohm_entry_is_value(map, entry))
+            continue;
+
+        #if POTTERY_OPEN_HASH_MAP_STORE_HASH
+        size_t hash = pottery_ohm_entry_stored_hash(map, entry);
+        #else
+        size_t hash = pottery_ohm_entry_key_hash(map, pottery_ohm_entry_key(map, entry));
+        #endif
+        #if POTTERY_OPEN_HASH_MAP_GROUP_PROBING
+        size_t length = pottery_ohm_group_probe_length(map, hash, entry, SIZE_MAX);
+        #elif POTTERY_OPEN_HASH_MAP_HOPSCOTCH_HASHING
+        // A lookup only visits the buckets whose bits are set in the hop
+        // info of the home bucket so the probe length is the rank of this
+        // element's bit. An overflowed element is found by scanning on past
+        // the neighborhood after those.
+        size_t home = pottery_ohm_table_bucket_for_hash(map, map->log_2_size, hash);
+        size_t distance = (i - home) & (size - 1);
+        size_t length;
+        if (distance < neighborhood)
+            length = pottery_ohm_impl_bit_count(map->hop_info[home] &
+                    ((UINT32_C(1) << distance) - 1));
+        else
+            length = pottery_ohm_impl_bit_count(map->hop_info[home] & hop_mask) +
+                    distance - neighborhood;
+        #else
+        size_t length = pottery_ohm_table_entry_probe_length(map, map->log_2_size,
+                entry, hash, SIZE_MAX);
+        #endif
+
+        stats->probe_length_total += length;
+        if (stats->probe_length_max < length)
+            stats->probe_length_max = length;
+        ++stats->probe_length_histogram[
+                (length < POTTERY_OPEN_HASH_MAP_STATS_HISTOGRAM_SIZE - 1) ?
+                length : POTTERY_OPEN_HASH_MAP_STATS_HISTOGRAM_SIZE - 1];
+    }
+
+    // Measure misses.
+    #if POTTERY_OPEN_HASH_MAP_GROUP_PROBING
+    // A miss ends at the first group with an empty bucket.
+    {
+        size_t group_count = size / POTTERY_GROUP_SIZE;
+        uint8_t empty = pottery_cast(uint8_t, pottery_ohm_bucket_state_empty);
+        for (i = 0; i < group_count; ++i) {
+            size_t group = i;
+            size_t probe = 0;
+            while (pottery_group_match(map->metadata + group * POTTERY_GROUP_SIZE, empty) == 0) {
+                ++probe;
+                group = (group + probe) & (group_count - 1);
+            }
+            stats->miss_probe_length_total += probe;
+        }
+        stats->miss_probe_starts += group_count;
+    }
+
+    #elif POTTERY_OPEN_HASH_MAP_HOPSCOTCH_HASHING
+    // A miss visits the buckets whose bits are set in the hop info of its home
+    // bucket. If any element of that home has overflowed, it also scans the
+    // rest of the table.
+    for (i = 0; i < size; ++i) {
+        uint32_t hop_info = map->hop_info[i];
+        stats->miss_probe_length_total += pottery_ohm_impl_bit_count(hop_info & hop_mask);
+        if ((hop_info & ~hop_mask) != 0)
+            stats->miss_probe_length_total += size - neighborhood;
+    }
+    stats->miss_probe_starts += size;
+
+    #elif POTTERY_OPEN_HASH_MAP_DOUBLE_HASHING
+    // Every key has its own interval so we can't walk the sequences. Under
+    // uniform hashing, a miss visits used / (size - used) used buckets on
+    // average before finding an empty one.
+    stats->miss_probe_length_total += pottery_ohm_load_factor_count(size, used, size - used);
+    stats->miss_probe_starts += size;
+
+    #else
+    // A miss ends at the first empty bucket (or with Robin Hood hashing, at
+    // the first value closer to its home than the key would be.)
+    for (i = 0; i < size; ++i) {
+        size_t index = i;
+        size_t length = 0;
+        while (!pottery_ohm_entry_is_empty(map, map->values + index)) {
+            #if POTTERY_OPEN_HASH_MAP_ROBIN_HOOD_HASHING
+            if (pottery_ohm_table_entry_probe_distance(map, map->log_2_size,
+                        index, map->values + index) < length)
+                break;
+            #endif
+            ++length;
+            index = pottery_ohm_table_next_probe(map->log_2_size, index, length);
+            pottery_assert(length < size);
+        }
+        stats->miss_probe_length_total += length;
+    }
+    stats->miss_probe_starts += size;
+    #endif
+
+    (void)used;
+}
+
+POTTERY_OPEN_HASH_MAP_EXTERN
+void pottery_ohm_stats(pottery_ohm_t* map, pottery_ohm_stats_t* stats) {
+    pottery_memset(stats, 0, sizeof(*stats));
+    stats->count = pottery_ohm_count(map);
+    #if POTTERY_OPEN_HASH_MAP_TOMBSTONES
+    stats->tombstones = map->tombstones;
+    #endif
+    stats->load = pottery_ohm_load(map);
+    stats->bucket_count = pottery_ohm_bucket_count(map);
+    stats->capacity = pottery_ohm_capacity(map);
+
+    pottery_ohm_impl_stats_table(map, stats);
+
+    #if POTTERY_OPEN_HASH_MAP_INCREMENTAL_REHASH
+    if (pottery_ohm_impl_is_migrating(map)) {
+        pottery_ohm_t old_map;
+        pottery_ohm_impl_old_map(map, &old_map);
+        pottery_ohm_impl_stats_table(&old_map, stats);
+    }
+    #endif
+}
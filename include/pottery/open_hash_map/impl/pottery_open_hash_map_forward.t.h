@@ -37,15 +37,39 @@ typedef enum pottery_ohm_bucket_state_t {
 
     // This is not necessarily a value since the user might have declared only
     // in-band tombstones and not in-band empty or vice versa.
+    //
+    // With Robin Hood hashing, this is the state of a value in its own bucket.
+    // Values further along store their probe distance plus one, up to
+    // bucket_state_far.
     pottery_ohm_bucket_state_other = 1,
 
+    #if POTTERY_OPEN_HASH_MAP_ROBIN_HOOD_HASHING
+    pottery_ohm_bucket_state_far = 255,
+    #endif
+
     #if POTTERY_OPEN_HASH_MAP_INTERNAL_TOMBSTONE
     pottery_ohm_bucket_state_tombstone = 2,
     #endif
+
+    #if POTTERY_OPEN_HASH_MAP_GROUP_PROBING
+    // With group probing, a value has this bit set along with a 7-bit tag of
+    // its hash. Empty and tombstone buckets have it clear so we can find free
+    // buckets in a whole group at once.
+    pottery_ohm_bucket_state_value = 0x80,
+    #endif
 } pottery_ohm_bucket_state_t;
+
+// The unit of our metadata array. Packed metadata stores the states of
+// several buckets in each word.
+#if POTTERY_OPEN_HASH_MAP_PACKED_METADATA
+typedef uint64_t pottery_ohm_metadata_t;
+#else
+typedef uint8_t pottery_ohm_metadata_t;
+#endif
 #endif
 
 typedef struct pottery_ohm_t pottery_ohm_t;
+typedef struct pottery_ohm_stats_t pottery_ohm_stats_t;
 
 typedef pottery_ohm_ref_t pottery_ohm_entry_t;
 
@@ -73,6 +97,16 @@ bool pottery_ohm_entry_key_equal(pottery_ohm_t* map, pottery_ohm_key_t left, pot
 static inline
 size_t pottery_ohm_entry_key_hash(pottery_ohm_t* map, pottery_ohm_key_t key);
 
+#ifdef POTTERY_OPEN_HASH_MAP_KEY_DOUBLE_HASH
+static inline
+size_t pottery_ohm_entry_key_double_hash(pottery_ohm_t* map, pottery_ohm_key_t key);
+#endif
+
+#if POTTERY_OPEN_HASH_MAP_SEEDED
+static inline
+uint64_t pottery_ohm_entry_seed(pottery_ohm_t* map);
+#endif
+
 static inline
 bool pottery_ohm_entry_is_empty(pottery_ohm_t* map, pottery_ohm_entry_t entry);
 
@@ -90,6 +124,33 @@ void pottery_ohm_entry_set_tombstone(pottery_ohm_t* map, pottery_ohm_entry_t ent
 static inline
 bool pottery_ohm_entry_is_value(pottery_ohm_t* map, pottery_ohm_entry_t entry);
 
+#if POTTERY_OPEN_HASH_MAP_ROBIN_HOOD_HASHING && POTTERY_OPEN_HASH_MAP_HAS_METADATA
+static inline
+size_t pottery_ohm_entry_probe_distance(pottery_ohm_t* map, pottery_ohm_entry_t entry);
+
+static inline
+void pottery_ohm_entry_set_probe_distance(pottery_ohm_t* map, pottery_ohm_entry_t entry,
+        size_t distance);
+#endif
+
+#if POTTERY_OPEN_HASH_MAP_STORE_HASH
+static inline
+size_t pottery_ohm_entry_stored_hash(pottery_ohm_t* map, pottery_ohm_entry_t entry);
+
+static inline
+void pottery_ohm_entry_set_stored_hash(pottery_ohm_t* map, pottery_ohm_entry_t entry,
+        size_t hash);
+#endif
+
+#if POTTERY_OPEN_HASH_MAP_HOPSCOTCH_HASHING
+static inline
+uint32_t pottery_ohm_entry_hop_info(pottery_ohm_t* map, pottery_ohm_entry_t entry);
+
+static inline
+void pottery_ohm_entry_set_hop_info(pottery_ohm_t* map, pottery_ohm_entry_t entry,
+        uint32_t hop_info);
+#endif
+
 static inline
 pottery_ohm_entry_t pottery_ohm_impl_values(pottery_ohm_t* map);
 
@@ -65,6 +65,173 @@
     #endif
 #endif
 
+// Robin Hood hashing
+// This is a variant of linear probing that doesn't need tombstones. If we
+// store metadata, we store the probe distance in it.
+#ifndef POTTERY_OPEN_HASH_MAP_ROBIN_HOOD_HASHING
+    #define POTTERY_OPEN_HASH_MAP_ROBIN_HOOD_HASHING 0
+#endif
+#if POTTERY_OPEN_HASH_MAP_ROBIN_HOOD_HASHING
+    #if !POTTERY_OPEN_HASH_MAP_LINEAR_PROBING
+        #error "ROBIN_HOOD_HASHING requires linear probing."
+    #endif
+    #if defined(POTTERY_OPEN_HASH_MAP_IS_TOMBSTONE) || defined(POTTERY_OPEN_HASH_MAP_SET_TOMBSTONE)
+        #error "ROBIN_HOOD_HASHING does not use tombstones."
+    #endif
+#endif
+
+// Hopscotch hashing
+// This is another variant of linear probing that doesn't need tombstones. We
+// store a 32-bit hop info word for each bucket in a separate array. If a
+// value can't be placed within the neighborhood of its home bucket, we grow
+// on the next insertion.
+#ifndef POTTERY_OPEN_HASH_MAP_HOPSCOTCH_HASHING
+    #define POTTERY_OPEN_HASH_MAP_HOPSCOTCH_HASHING 0
+#endif
+#if POTTERY_OPEN_HASH_MAP_HOPSCOTCH_HASHING
+    #if !POTTERY_OPEN_HASH_MAP_LINEAR_PROBING
+        #error "HOPSCOTCH_HASHING requires linear probing."
+    #endif
+    #if defined(POTTERY_OPEN_HASH_MAP_IS_TOMBSTONE) || defined(POTTERY_OPEN_HASH_MAP_SET_TOMBSTONE)
+        #error "HOPSCOTCH_HASHING does not use tombstones."
+    #endif
+    #if POTTERY_OPEN_HASH_MAP_ROBIN_HOOD_HASHING
+        #error "HOPSCOTCH_HASHING cannot be combined with ROBIN_HOOD_HASHING."
+    #endif
+    #ifndef POTTERY_OPEN_HASH_MAP_HOPSCOTCH_NEIGHBORHOOD
+        #define POTTERY_OPEN_HASH_MAP_HOPSCOTCH_NEIGHBORHOOD 24
+    #endif
+#endif
+#if defined(POTTERY_OPEN_HASH_MAP_HOP_INFO) || defined(POTTERY_OPEN_HASH_MAP_SET_HOP_INFO)
+    #error "The open_hash_map stores hop info itself. HOP_INFO cannot be configured."
+#endif
+
+// Group probing
+// This stores a tag of the hash of each value in our metadata so that groups
+// of buckets can be matched all at once. This requires that we manage empty
+// and tombstone buckets ourselves and it has its own probing sequence.
+#ifndef POTTERY_OPEN_HASH_MAP_GROUP_PROBING
+    #define POTTERY_OPEN_HASH_MAP_GROUP_PROBING 0
+#endif
+#if POTTERY_OPEN_HASH_MAP_GROUP_PROBING
+    #if defined(POTTERY_OPEN_HASH_MAP_IS_EMPTY) || \
+            defined(POTTERY_OPEN_HASH_MAP_SET_EMPTY) || \
+            defined(POTTERY_OPEN_HASH_MAP_EMPTY_IS_ZERO) || \
+            defined(POTTERY_OPEN_HASH_MAP_IS_TOMBSTONE) || \
+            defined(POTTERY_OPEN_HASH_MAP_SET_TOMBSTONE) || \
+            defined(POTTERY_OPEN_HASH_MAP_IS_VALUE)
+        #error "GROUP_PROBING stores empty and tombstone states in metadata. In-band states cannot be used."
+    #endif
+    #if POTTERY_OPEN_HASH_MAP_QUADRATIC_PROBING || POTTERY_OPEN_HASH_MAP_DOUBLE_HASHING || \
+            POTTERY_OPEN_HASH_MAP_ROBIN_HOOD_HASHING || POTTERY_OPEN_HASH_MAP_HOPSCOTCH_HASHING
+        #error "GROUP_PROBING has its own probing sequence. It cannot be combined with another."
+    #endif
+#endif
+
+// Stored hash
+// This stores the full hash of each value alongside it. It costs memory but
+// keys don't need to be re-hashed when the map grows, and keys are only
+// compared when their hashes match.
+#ifndef POTTERY_OPEN_HASH_MAP_STORE_HASH
+    #define POTTERY_OPEN_HASH_MAP_STORE_HASH 0
+#endif
+
+// Seeding
+// This gives each map a random seed that is mixed into hashes when choosing
+// their buckets so that keys can't be chosen to collide in the map without
+// knowing its seed. PROBE_LIMIT enables a watchdog: if an insertion probes at
+// least this many buckets (or groups), the map picks a new seed and rehashes
+// on the next insertion. 0 disables it.
+#ifndef POTTERY_OPEN_HASH_MAP_SEEDED
+    #define POTTERY_OPEN_HASH_MAP_SEEDED 0
+#endif
+#ifndef POTTERY_OPEN_HASH_MAP_PROBE_LIMIT
+    #define POTTERY_OPEN_HASH_MAP_PROBE_LIMIT 0
+#endif
+#if POTTERY_OPEN_HASH_MAP_PROBE_LIMIT < 0
+    #error "PROBE_LIMIT cannot be negative."
+#endif
+#if POTTERY_OPEN_HASH_MAP_PROBE_LIMIT > 0 && !POTTERY_OPEN_HASH_MAP_SEEDED
+    #error "PROBE_LIMIT requires SEEDED."
+#endif
+
+// Incremental rehashing
+// When the map grows, it keeps its old buckets alongside the new ones and
+// migrates a few buckets on each insert or removal instead of rehashing the
+// whole table at once. INCREMENTAL_REHASH_STEP is the number of old buckets
+// to migrate per operation.
+#ifndef POTTERY_OPEN_HASH_MAP_INCREMENTAL_REHASH
+    #define POTTERY_OPEN_HASH_MAP_INCREMENTAL_REHASH 0
+#endif
+#ifndef POTTERY_OPEN_HASH_MAP_INCREMENTAL_REHASH_STEP
+    #define POTTERY_OPEN_HASH_MAP_INCREMENTAL_REHASH_STEP 32
+#endif
+#if POTTERY_OPEN_HASH_MAP_INCREMENTAL_REHASH_STEP < 1
+    #error "INCREMENTAL_REHASH_STEP must be at least 1."
+#endif
+#if POTTERY_OPEN_HASH_MAP_INCREMENTAL_REHASH && POTTERY_OPEN_HASH_MAP_HOPSCOTCH_HASHING
+    #error "INCREMENTAL_REHASH cannot be combined with HOPSCOTCH_HASHING."
+#endif
+
+// Bulk lookups
+// find_bulk() and contains_bulk() hash and prefetch this many keys at a time
+// before probing for them.
+#ifndef POTTERY_OPEN_HASH_MAP_PREFETCH_BATCH
+    #define POTTERY_OPEN_HASH_MAP_PREFETCH_BATCH 16
+#endif
+#if POTTERY_OPEN_HASH_MAP_PREFETCH_BATCH < 1
+    #error "PREFETCH_BATCH must be at least 1."
+#endif
+
+// Statistics
+// stats() counts values with each probe length up to this many. The last
+// element of the histogram counts all longer probes.
+#ifndef POTTERY_OPEN_HASH_MAP_STATS_HISTOGRAM_SIZE
+    #define POTTERY_OPEN_HASH_MAP_STATS_HISTOGRAM_SIZE 16
+#endif
+#if POTTERY_OPEN_HASH_MAP_STATS_HISTOGRAM_SIZE < 1
+    #error "STATS_HISTOGRAM_SIZE must be at least 1."
+#endif
+
+// Retiring arrays
+// RETIRE(map, alignment, ptr) is an optional expression that is given the
+// arrays the map would otherwise free, so that a wrapping container can defer
+// freeing them (see sharded_hash_map.) It must eventually free them with the
+// map's alloc.
+
+// Load factors
+// The map grows when its load (values plus tombstones) would exceed the
+// maximum load factor, and it shrinks when its count falls below the minimum
+// load factor. These are given as fractions. The default maximum is 4/7
+// (~57%) and the default minimum is 1/7 (~14%). Set the minimum numerator to
+// 0 to disable automatic shrinking.
+#ifndef POTTERY_OPEN_HASH_MAP_MAX_LOAD_FACTOR_NUMERATOR
+    #define POTTERY_OPEN_HASH_MAP_MAX_LOAD_FACTOR_NUMERATOR 4
+#endif
+#ifndef POTTERY_OPEN_HASH_MAP_MAX_LOAD_FACTOR_DENOMINATOR
+    #define POTTERY_OPEN_HASH_MAP_MAX_LOAD_FACTOR_DENOMINATOR 7
+#endif
+#ifndef POTTERY_OPEN_HASH_MAP_MIN_LOAD_FACTOR_NUMERATOR
+    #define POTTERY_OPEN_HASH_MAP_MIN_LOAD_FACTOR_NUMERATOR 1
+#endif
+#ifndef POTTERY_OPEN_HASH_MAP_MIN_LOAD_FACTOR_DENOMINATOR
+    #define POTTERY_OPEN_HASH_MAP_MIN_LOAD_FACTOR_DENOMINATOR 7
+#endif
+#if POTTERY_OPEN_HASH_MAP_MAX_LOAD_FACTOR_NUMERATOR <= 0 || \
+        POTTERY_OPEN_HASH_MAP_MAX_LOAD_FACTOR_NUMERATOR >= POTTERY_OPEN_HASH_MAP_MAX_LOAD_FACTOR_DENOMINATOR
+    #error "The MAX_LOAD_FACTOR must be greater than 0 and less than 1."
+#endif
+#if POTTERY_OPEN_HASH_MAP_MIN_LOAD_FACTOR_NUMERATOR < 0 || \
+        POTTERY_OPEN_HASH_MAP_MIN_LOAD_FACTOR_DENOMINATOR <= 0
+    #error "The MIN_LOAD_FACTOR cannot be negative."
+#endif
+// Shrinking halves the bucket count so it doubles the load factor. If the
+// minimum were half the maximum or more, the map could thrash between sizes.
+#if 2 * POTTERY_OPEN_HASH_MAP_MIN_LOAD_FACTOR_NUMERATOR * POTTERY_OPEN_HASH_MAP_MAX_LOAD_FACTOR_DENOMINATOR >= \
+        POTTERY_OPEN_HASH_MAP_MAX_LOAD_FACTOR_NUMERATOR * POTTERY_OPEN_HASH_MAP_MIN_LOAD_FACTOR_DENOMINATOR
+    #error "The MIN_LOAD_FACTOR must be less than half the MAX_LOAD_FACTOR."
+#endif
+
 // Empty
 #if !defined(POTTERY_OPEN_HASH_MAP_IS_EMPTY) && \
         !defined(POTTERY_OPEN_HASH_MAP_SET_EMPTY) && \
@@ -80,7 +247,7 @@
 // Tombstones
 #if !defined(POTTERY_OPEN_HASH_MAP_IS_TOMBSTONE) && \
         !defined(POTTERY_OPEN_HASH_MAP_SET_TOMBSTONE) && \
-        !POTTERY_OPEN_HASH_MAP_LINEAR_PROBING
+        (!POTTERY_OPEN_HASH_MAP_LINEAR_PROBING || POTTERY_OPEN_HASH_MAP_GROUP_PROBING)
     #define POTTERY_OPEN_HASH_MAP_TOMBSTONES 1
     #define POTTERY_OPEN_HASH_MAP_INTERNAL_TOMBSTONE 1
 #elif defined(POTTERY_OPEN_HASH_MAP_IS_TOMBSTONE)
@@ -92,13 +259,53 @@
 #endif
 
 // Metadata
-#if POTTERY_OPEN_HASH_MAP_INTERNAL_EMPTY || \
-        (!POTTERY_OPEN_HASH_MAP_LINEAR_PROBING && POTTERY_OPEN_HASH_MAP_INTERNAL_TOMBSTONE)
+#if POTTERY_OPEN_HASH_MAP_INTERNAL_EMPTY || POTTERY_OPEN_HASH_MAP_INTERNAL_TOMBSTONE
     #define POTTERY_OPEN_HASH_MAP_HAS_METADATA 1
 #else
     #define POTTERY_OPEN_HASH_MAP_HAS_METADATA 0
 #endif
 
+// Packed metadata
+// This stores our metadata as 64-bit words of the minimum number of bits per
+// bucket: one bit if we only track one of empty or tombstone, two bits if we
+// track both. Robin Hood hashing and group probing store more than the bucket
+// state in the metadata so they need a whole byte.
+#ifndef POTTERY_OPEN_HASH_MAP_PACKED_METADATA
+    #define POTTERY_OPEN_HASH_MAP_PACKED_METADATA 0
+#endif
+#if POTTERY_OPEN_HASH_MAP_PACKED_METADATA
+    #if !POTTERY_OPEN_HASH_MAP_HAS_METADATA
+        #error "PACKED_METADATA requires metadata. Empty and tombstone states are both in-band."
+    #endif
+    #if POTTERY_OPEN_HASH_MAP_ROBIN_HOOD_HASHING || POTTERY_OPEN_HASH_MAP_GROUP_PROBING
+        #error "PACKED_METADATA cannot be used with ROBIN_HOOD_HASHING or GROUP_PROBING."
+    #endif
+    #if POTTERY_OPEN_HASH_MAP_INTERNAL_EMPTY && POTTERY_OPEN_HASH_MAP_INTERNAL_TOMBSTONE
+        #define POTTERY_OPEN_HASH_MAP_METADATA_BITS 2
+    #else
+        #define POTTERY_OPEN_HASH_MAP_METADATA_BITS 1
+    #endif
+    #define POTTERY_OPEN_HASH_MAP_METADATA_PER_WORD (64 / POTTERY_OPEN_HASH_MAP_METADATA_BITS)
+
+    // If empty is in our metadata, we can find values by scanning whole words
+    // of metadata without touching the values.
+    #define POTTERY_OPEN_HASH_MAP_METADATA_SCAN POTTERY_OPEN_HASH_MAP_INTERNAL_EMPTY
+#else
+    #define POTTERY_OPEN_HASH_MAP_METADATA_SCAN 0
+#endif
+
+// In-place purge
+// If the map stores both the empty and tombstone states itself, it can clear
+// its tombstones by rehashing in place rather than into a new table. Values
+// waiting to be re-inserted are marked as tombstones while it works. This
+// isn't done if arrays are retired since readers may still be probing them.
+#if POTTERY_OPEN_HASH_MAP_INTERNAL_EMPTY && POTTERY_OPEN_HASH_MAP_INTERNAL_TOMBSTONE && \
+        !defined(POTTERY_OPEN_HASH_MAP_RETIRE)
+    #define POTTERY_OPEN_HASH_MAP_PURGE_IN_PLACE 1
+#else
+    #define POTTERY_OPEN_HASH_MAP_PURGE_IN_PLACE 0
+#endif
+
 // Context forwarding
 #ifdef POTTERY_OPEN_HASH_MAP_CONTEXT_TYPE
     #define POTTERY_OPEN_HASH_MAP_CONTEXT_VAL context,
@@ -130,25 +337,85 @@
 #define pottery_ohm_impl_free_allocs POTTERY_OPEN_HASH_MAP_NAME(_impl_free_allocs)
 #define pottery_ohm_impl_alloc_metadata POTTERY_OPEN_HASH_MAP_NAME(_impl_alloc_metadata)
 #define pottery_ohm_impl_free_metadata POTTERY_OPEN_HASH_MAP_NAME(_impl_free_metadata)
+#define pottery_ohm_impl_metadata_size POTTERY_OPEN_HASH_MAP_NAME(_impl_metadata_size)
+#define pottery_ohm_impl_alloc_hashes POTTERY_OPEN_HASH_MAP_NAME(_impl_alloc_hashes)
+#define pottery_ohm_impl_free_hashes POTTERY_OPEN_HASH_MAP_NAME(_impl_free_hashes)
 #define pottery_ohm_grow_if_needed POTTERY_OPEN_HASH_MAP_NAME(_grow_if_needed)
 #define pottery_ohm_shrink_if_needed POTTERY_OPEN_HASH_MAP_NAME(_shrink_if_needed)
 #define pottery_ohm_rehash POTTERY_OPEN_HASH_MAP_NAME(_rehash)
 #define pottery_ohm_load POTTERY_OPEN_HASH_MAP_NAME(_load)
+#define pottery_ohm_load_factor_count POTTERY_OPEN_HASH_MAP_NAME(_load_factor_count)
+#define pottery_ohm_min_count POTTERY_OPEN_HASH_MAP_NAME(_min_count)
 #define pottery_ohm_init_impl POTTERY_OPEN_HASH_MAP_NAME(_init_impl)
 #define pottery_ohm_entry_move POTTERY_OPEN_HASH_MAP_NAME(_entry_move)
 #define pottery_ohm_entry_key POTTERY_OPEN_HASH_MAP_NAME(_entry_key)
 #define pottery_ohm_entry_key_equal POTTERY_OPEN_HASH_MAP_NAME(_entry_key_equal)
 #define pottery_ohm_entry_key_hash POTTERY_OPEN_HASH_MAP_NAME(_entry_key_hash)
+#define pottery_ohm_entry_key_double_hash POTTERY_OPEN_HASH_MAP_NAME(_entry_key_double_hash)
+#define pottery_ohm_entry_seed POTTERY_OPEN_HASH_MAP_NAME(_entry_seed)
 #define pottery_ohm_entry_is_empty POTTERY_OPEN_HASH_MAP_NAME(_entry_is_empty)
 #define pottery_ohm_entry_is_value POTTERY_OPEN_HASH_MAP_NAME(_entry_is_value)
 #define pottery_ohm_entry_set_empty POTTERY_OPEN_HASH_MAP_NAME(_entry_set_empty)
+#define pottery_ohm_entry_is_tombstone POTTERY_OPEN_HASH_MAP_NAME(_entry_is_tombstone)
+#define pottery_ohm_entry_set_tombstone POTTERY_OPEN_HASH_MAP_NAME(_entry_set_tombstone)
+#define pottery_ohm_entry_destroy POTTERY_OPEN_HASH_MAP_NAME(_entry_destroy)
 #define pottery_ohm_entry_set_other POTTERY_OPEN_HASH_MAP_NAME(_entry_set_other)
 #define pottery_ohm_entry_metadata POTTERY_OPEN_HASH_MAP_NAME(_entry_metadata)
+#define pottery_ohm_entry_state POTTERY_OPEN_HASH_MAP_NAME(_entry_state)
+#define pottery_ohm_entry_set_state POTTERY_OPEN_HASH_MAP_NAME(_entry_set_state)
+#define pottery_ohm_metadata_t POTTERY_OPEN_HASH_MAP_NAME(_metadata_t)
+#define pottery_ohm_impl_value_bits POTTERY_OPEN_HASH_MAP_NAME(_impl_value_bits)
+#define pottery_ohm_impl_next_value_index POTTERY_OPEN_HASH_MAP_NAME(_impl_next_value_index)
+#define pottery_ohm_impl_previous_value_index POTTERY_OPEN_HASH_MAP_NAME(_impl_previous_value_index)
+#define pottery_ohm_impl_scan_begin POTTERY_OPEN_HASH_MAP_NAME(_impl_scan_begin)
+#define pottery_ohm_impl_scan_last POTTERY_OPEN_HASH_MAP_NAME(_impl_scan_last)
+#define pottery_ohm_impl_scan_next POTTERY_OPEN_HASH_MAP_NAME(_impl_scan_next)
+#define pottery_ohm_impl_scan_previous POTTERY_OPEN_HASH_MAP_NAME(_impl_scan_previous)
+#define pottery_ohm_impl_destroy_all POTTERY_OPEN_HASH_MAP_NAME(_impl_destroy_all)
+#define pottery_ohm_impl_clear POTTERY_OPEN_HASH_MAP_NAME(_impl_clear)
+#define pottery_ohm_impl_displace_all POTTERY_OPEN_HASH_MAP_NAME(_impl_displace_all)
+#define pottery_ohm_impl_remove_all POTTERY_OPEN_HASH_MAP_NAME(_impl_remove_all)
+#define pottery_ohm_entry_probe_distance POTTERY_OPEN_HASH_MAP_NAME(_entry_probe_distance)
+#define pottery_ohm_entry_set_probe_distance POTTERY_OPEN_HASH_MAP_NAME(_entry_set_probe_distance)
+#define pottery_ohm_entry_stored_hash POTTERY_OPEN_HASH_MAP_NAME(_entry_stored_hash)
+#define pottery_ohm_entry_set_stored_hash POTTERY_OPEN_HASH_MAP_NAME(_entry_set_stored_hash)
+#define pottery_ohm_entry_hop_info POTTERY_OPEN_HASH_MAP_NAME(_entry_hop_info)
+#define pottery_ohm_entry_set_hop_info POTTERY_OPEN_HASH_MAP_NAME(_entry_set_hop_info)
+#define pottery_ohm_impl_alloc_hop_info POTTERY_OPEN_HASH_MAP_NAME(_impl_alloc_hop_info)
+#define pottery_ohm_impl_free_hop_info POTTERY_OPEN_HASH_MAP_NAME(_impl_free_hop_info)
 #define pottery_ohm_rehash POTTERY_OPEN_HASH_MAP_NAME(_rehash)
 #define pottery_ohm_bucket_state_t POTTERY_OPEN_HASH_MAP_NAME(_bucket_state_t)
 #define pottery_ohm_bucket_state_empty POTTERY_OPEN_HASH_MAP_NAME(_bucket_state_empty)
 #define pottery_ohm_bucket_state_other POTTERY_OPEN_HASH_MAP_NAME(_bucket_state_other)
 #define pottery_ohm_bucket_state_tombstone POTTERY_OPEN_HASH_MAP_NAME(_bucket_state_tombstone)
+#define pottery_ohm_bucket_state_value POTTERY_OPEN_HASH_MAP_NAME(_bucket_state_value)
+#define pottery_ohm_bucket_state_far POTTERY_OPEN_HASH_MAP_NAME(_bucket_state_far)
+#define pottery_ohm_group_tag POTTERY_OPEN_HASH_MAP_NAME(_group_tag)
+#define pottery_ohm_group_probe POTTERY_OPEN_HASH_MAP_NAME(_group_probe)
+#define pottery_ohm_group_probe_free POTTERY_OPEN_HASH_MAP_NAME(_group_probe_free)
+#define pottery_ohm_group_insert_new POTTERY_OPEN_HASH_MAP_NAME(_group_insert_new)
+#define pottery_ohm_impl_find_hash POTTERY_OPEN_HASH_MAP_NAME(_impl_find_hash)
+#define pottery_ohm_impl_find_with_hash POTTERY_OPEN_HASH_MAP_NAME(_impl_find_with_hash)
+#define pottery_ohm_impl_prefetch POTTERY_OPEN_HASH_MAP_NAME(_impl_prefetch)
+#define pottery_ohm_stats_t POTTERY_OPEN_HASH_MAP_NAME(_stats_t)
+#define pottery_ohm_stats POTTERY_OPEN_HASH_MAP_NAME(_stats)
+#define pottery_ohm_displace_all_keep_capacity POTTERY_OPEN_HASH_MAP_NAME(_displace_all_keep_capacity)
+#define pottery_ohm_remove_all_keep_capacity POTTERY_OPEN_HASH_MAP_NAME(_remove_all_keep_capacity)
+#define pottery_ohm_impl_stats_table POTTERY_OPEN_HASH_MAP_NAME(_impl_stats_table)
+#define pottery_ohm_impl_bit_count POTTERY_OPEN_HASH_MAP_NAME(_impl_bit_count)
+#define pottery_ohm_impl_size_capacity POTTERY_OPEN_HASH_MAP_NAME(_impl_size_capacity)
+#define pottery_ohm_impl_displace POTTERY_OPEN_HASH_MAP_NAME(_impl_displace)
+#define pottery_ohm_impl_migrate_value POTTERY_OPEN_HASH_MAP_NAME(_impl_migrate_value)
+#define pottery_ohm_impl_is_migrating POTTERY_OPEN_HASH_MAP_NAME(_impl_is_migrating)
+#define pottery_ohm_impl_is_old_entry POTTERY_OPEN_HASH_MAP_NAME(_impl_is_old_entry)
+#define pottery_ohm_impl_old_map POTTERY_OPEN_HASH_MAP_NAME(_impl_old_map)
+#define pottery_ohm_impl_purge POTTERY_OPEN_HASH_MAP_NAME(_impl_purge)
+#define pottery_ohm_impl_reseed POTTERY_OPEN_HASH_MAP_NAME(_impl_reseed)
+#define pottery_ohm_impl_watch_probe POTTERY_OPEN_HASH_MAP_NAME(_impl_watch_probe)
+#define pottery_ohm_group_probe_length POTTERY_OPEN_HASH_MAP_NAME(_group_probe_length)
+#define pottery_ohm_impl_begin_migration POTTERY_OPEN_HASH_MAP_NAME(_impl_begin_migration)
+#define pottery_ohm_impl_end_migration POTTERY_OPEN_HASH_MAP_NAME(_impl_end_migration)
+#define pottery_ohm_impl_migrate POTTERY_OPEN_HASH_MAP_NAME(_impl_migrate)
 
 
 
@@ -182,7 +449,11 @@
     #define pottery_ohm_is_empty POTTERY_CONCAT(POTTERY_OPEN_HASH_MAP_PREFIX, _is_empty)
     #define pottery_ohm_at POTTERY_CONCAT(POTTERY_OPEN_HASH_MAP_PREFIX, _at)
     #define pottery_ohm_find POTTERY_CONCAT(POTTERY_OPEN_HASH_MAP_PREFIX, _find)
+    #define pottery_ohm_find_with_hash POTTERY_CONCAT(POTTERY_OPEN_HASH_MAP_PREFIX, _find_with_hash)
     #define pottery_ohm_contains_key POTTERY_CONCAT(POTTERY_OPEN_HASH_MAP_PREFIX, _contains_key)
+    #define pottery_ohm_contains_key_with_hash POTTERY_CONCAT(POTTERY_OPEN_HASH_MAP_PREFIX, _contains_key_with_hash)
+    #define pottery_ohm_find_bulk POTTERY_CONCAT(POTTERY_OPEN_HASH_MAP_PREFIX, _find_bulk)
+    #define pottery_ohm_contains_bulk POTTERY_CONCAT(POTTERY_OPEN_HASH_MAP_PREFIX, _contains_bulk)
     #define pottery_ohm_first POTTERY_CONCAT(POTTERY_OPEN_HASH_MAP_PREFIX, _first)
     #define pottery_ohm_last POTTERY_CONCAT(POTTERY_OPEN_HASH_MAP_PREFIX, _last)
     #define pottery_ohm_any POTTERY_CONCAT(POTTERY_OPEN_HASH_MAP_PREFIX, _any)
@@ -220,6 +491,7 @@
     #define pottery_ohm_emplace POTTERY_CONCAT(POTTERY_OPEN_HASH_MAP_PREFIX, _emplace)
     #define pottery_ohm_emplace_at POTTERY_CONCAT(POTTERY_OPEN_HASH_MAP_PREFIX, _emplace_at)
     #define pottery_ohm_emplace_key POTTERY_CONCAT(POTTERY_OPEN_HASH_MAP_PREFIX, _emplace_key)
+    #define pottery_ohm_emplace_key_with_hash POTTERY_CONCAT(POTTERY_OPEN_HASH_MAP_PREFIX, _emplace_key_with_hash)
     #define pottery_ohm_emplace_first POTTERY_CONCAT(POTTERY_OPEN_HASH_MAP_PREFIX, _emplace_first)
     #define pottery_ohm_emplace_last POTTERY_CONCAT(POTTERY_OPEN_HASH_MAP_PREFIX, _emplace_last)
     #define pottery_ohm_emplace_before POTTERY_CONCAT(POTTERY_OPEN_HASH_MAP_PREFIX, _emplace_before)
@@ -255,6 +527,7 @@
     #define pottery_ohm_remove POTTERY_CONCAT(POTTERY_OPEN_HASH_MAP_PREFIX, _remove)
     #define pottery_ohm_remove_at POTTERY_CONCAT(POTTERY_OPEN_HASH_MAP_PREFIX, _remove_at)
     #define pottery_ohm_remove_key POTTERY_CONCAT(POTTERY_OPEN_HASH_MAP_PREFIX, _remove_key)
+    #define pottery_ohm_remove_key_with_hash POTTERY_CONCAT(POTTERY_OPEN_HASH_MAP_PREFIX, _remove_key_with_hash)
     #define pottery_ohm_remove_first POTTERY_CONCAT(POTTERY_OPEN_HASH_MAP_PREFIX, _remove_first)
     #define pottery_ohm_remove_last POTTERY_CONCAT(POTTERY_OPEN_HASH_MAP_PREFIX, _remove_last)
     #define pottery_ohm_remove_and_next POTTERY_CONCAT(POTTERY_OPEN_HASH_MAP_PREFIX, _remove_and_next)
@@ -316,8 +589,10 @@
     // Renames open_hash_table identifiers from pottery_ohm_table to POTTERY_OPEN_HASH_MAP_OHT_PREFIX
 
     #define pottery_ohm_table_emplace_key POTTERY_CONCAT(POTTERY_OPEN_HASH_MAP_OHT_PREFIX, _emplace_key)
+    #define pottery_ohm_table_emplace_key_with_hash POTTERY_CONCAT(POTTERY_OPEN_HASH_MAP_OHT_PREFIX, _emplace_key_with_hash)
     #define pottery_ohm_table_insert POTTERY_CONCAT(POTTERY_OPEN_HASH_MAP_OHT_PREFIX, _insert)
     #define pottery_ohm_table_find POTTERY_CONCAT(POTTERY_OPEN_HASH_MAP_OHT_PREFIX, _find)
+    #define pottery_ohm_table_find_with_hash POTTERY_CONCAT(POTTERY_OPEN_HASH_MAP_OHT_PREFIX, _find_with_hash)
     #define pottery_ohm_table_displace POTTERY_CONCAT(POTTERY_OPEN_HASH_MAP_OHT_PREFIX, _displace)
     #define pottery_ohm_table_displace_all POTTERY_CONCAT(POTTERY_OPEN_HASH_MAP_OHT_PREFIX, _displace_all)
     #define pottery_ohm_table_remove POTTERY_CONCAT(POTTERY_OPEN_HASH_MAP_OHT_PREFIX, _remove)
@@ -335,6 +610,7 @@
 
     #define pottery_ohm_table_key POTTERY_CONCAT(POTTERY_OPEN_HASH_MAP_OHT_PREFIX, _key)
     #define pottery_ohm_table_key_hash POTTERY_CONCAT(POTTERY_OPEN_HASH_MAP_OHT_PREFIX, _key_hash)
+    #define pottery_ohm_table_key_double_hash_interval POTTERY_CONCAT(POTTERY_OPEN_HASH_MAP_OHT_PREFIX, _key_double_hash_interval)
     #define pottery_ohm_table_key_equal POTTERY_CONCAT(POTTERY_OPEN_HASH_MAP_OHT_PREFIX, _key_equal)
     #define pottery_ohm_table_double_hash_interval POTTERY_CONCAT(POTTERY_OPEN_HASH_MAP_OHT_PREFIX, _double_hash_interval)
     #define pottery_ohm_table_entry_is_tombstone POTTERY_CONCAT(POTTERY_OPEN_HASH_MAP_OHT_PREFIX, _entry_is_tombstone)
@@ -346,8 +622,26 @@
     #define pottery_ohm_table_entry_exists POTTERY_CONCAT(POTTERY_OPEN_HASH_MAP_OHT_PREFIX, _entry_exists)
 
     #define pottery_ohm_table_bucket_for_hash POTTERY_CONCAT(POTTERY_OPEN_HASH_MAP_OHT_PREFIX, _bucket_for_hash)
+    #define pottery_ohm_table_mix_seed POTTERY_CONCAT(POTTERY_OPEN_HASH_MAP_OHT_PREFIX, _mix_seed)
     #define pottery_ohm_table_next_probe POTTERY_CONCAT(POTTERY_OPEN_HASH_MAP_OHT_PREFIX, _next_probe)
     #define pottery_ohm_table_probe POTTERY_CONCAT(POTTERY_OPEN_HASH_MAP_OHT_PREFIX, _probe)
+    #define pottery_ohm_table_probe_free POTTERY_CONCAT(POTTERY_OPEN_HASH_MAP_OHT_PREFIX, _probe_free)
+    #define pottery_ohm_table_entry_probe_length POTTERY_CONCAT(POTTERY_OPEN_HASH_MAP_OHT_PREFIX, _entry_probe_length)
+
+    #define pottery_ohm_table_entry_probe_distance POTTERY_CONCAT(POTTERY_OPEN_HASH_MAP_OHT_PREFIX, _entry_probe_distance)
+    #define pottery_ohm_table_entry_set_probe_distance POTTERY_CONCAT(POTTERY_OPEN_HASH_MAP_OHT_PREFIX, _entry_set_probe_distance)
+    #define pottery_ohm_table_entry_hash POTTERY_CONCAT(POTTERY_OPEN_HASH_MAP_OHT_PREFIX, _entry_hash)
+    #define pottery_ohm_table_entry_set_hash POTTERY_CONCAT(POTTERY_OPEN_HASH_MAP_OHT_PREFIX, _entry_set_hash)
+    #define pottery_ohm_table_entry_has_key POTTERY_CONCAT(POTTERY_OPEN_HASH_MAP_OHT_PREFIX, _entry_has_key)
+    #define pottery_ohm_table_robin_hood_probe POTTERY_CONCAT(POTTERY_OPEN_HASH_MAP_OHT_PREFIX, _robin_hood_probe)
+    #define pottery_ohm_table_robin_hood_shift POTTERY_CONCAT(POTTERY_OPEN_HASH_MAP_OHT_PREFIX, _robin_hood_shift)
+    #define pottery_ohm_table_hop_info POTTERY_CONCAT(POTTERY_OPEN_HASH_MAP_OHT_PREFIX, _hop_info)
+    #define pottery_ohm_table_set_hop_info POTTERY_CONCAT(POTTERY_OPEN_HASH_MAP_OHT_PREFIX, _set_hop_info)
+    #define pottery_ohm_table_hopscotch_neighborhood POTTERY_CONCAT(POTTERY_OPEN_HASH_MAP_OHT_PREFIX, _hopscotch_neighborhood)
+    #define pottery_ohm_table_hopscotch_find POTTERY_CONCAT(POTTERY_OPEN_HASH_MAP_OHT_PREFIX, _hopscotch_find)
+    #define pottery_ohm_table_hopscotch_find_overflow POTTERY_CONCAT(POTTERY_OPEN_HASH_MAP_OHT_PREFIX, _hopscotch_find_overflow)
+    #define pottery_ohm_table_hopscotch_insert POTTERY_CONCAT(POTTERY_OPEN_HASH_MAP_OHT_PREFIX, _hopscotch_insert)
+    #define pottery_ohm_table_hopscotch_unlink POTTERY_CONCAT(POTTERY_OPEN_HASH_MAP_OHT_PREFIX, _hopscotch_unlink)
 //!!! END_AUTOGENERATED
 
 
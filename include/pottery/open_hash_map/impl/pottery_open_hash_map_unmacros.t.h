@@ -61,6 +61,7 @@
 
     #undef POTTERY_OPEN_HASH_MAP_KEY_HASH
     #undef POTTERY_OPEN_HASH_MAP_KEY_EQUAL
+    #undef POTTERY_OPEN_HASH_MAP_KEY_DOUBLE_HASH
     #undef POTTERY_OPEN_HASH_MAP_REF_KEY
 
     #undef POTTERY_OPEN_HASH_MAP_IS_EMPTY
@@ -76,6 +77,17 @@
     #undef POTTERY_OPEN_HASH_MAP_QUADRATIC_PROBING
     #undef POTTERY_OPEN_HASH_MAP_DOUBLE_HASHING
     #undef POTTERY_OPEN_HASH_MAP_DOUBLE_HASH_PROBE
+    #undef POTTERY_OPEN_HASH_MAP_ROBIN_HOOD_HASHING
+
+    #undef POTTERY_OPEN_HASH_MAP_PROBE_DISTANCE
+    #undef POTTERY_OPEN_HASH_MAP_SET_PROBE_DISTANCE
+    #undef POTTERY_OPEN_HASH_MAP_HOPSCOTCH_HASHING
+    #undef POTTERY_OPEN_HASH_MAP_HOPSCOTCH_NEIGHBORHOOD
+    #undef POTTERY_OPEN_HASH_MAP_HOP_INFO
+    #undef POTTERY_OPEN_HASH_MAP_SET_HOP_INFO
+    #undef POTTERY_OPEN_HASH_MAP_STORED_HASH
+    #undef POTTERY_OPEN_HASH_MAP_SET_STORED_HASH
+    #undef POTTERY_OPEN_HASH_MAP_SEED
 //!!! END_AUTOGENERATED
 
 
@@ -100,7 +112,26 @@
 #undef POTTERY_OPEN_HASH_MAP_TABLE_CONTEXT_UNUSED
 #undef POTTERY_OPEN_HASH_MAP_HAS_TABLE_CONTEXT
 
+#undef POTTERY_OPEN_HASH_MAP_GROUP_PROBING
+#undef POTTERY_OPEN_HASH_MAP_ROBIN_HOOD_HASHING
+#undef POTTERY_OPEN_HASH_MAP_STORE_HASH
+#undef POTTERY_OPEN_HASH_MAP_SEEDED
+#undef POTTERY_OPEN_HASH_MAP_PROBE_LIMIT
+#undef POTTERY_OPEN_HASH_MAP_INCREMENTAL_REHASH
+#undef POTTERY_OPEN_HASH_MAP_INCREMENTAL_REHASH_STEP
+#undef POTTERY_OPEN_HASH_MAP_PREFETCH_BATCH
+#undef POTTERY_OPEN_HASH_MAP_STATS_HISTOGRAM_SIZE
+#undef POTTERY_OPEN_HASH_MAP_RETIRE
 #undef POTTERY_OPEN_HASH_MAP_HAS_METADATA
+#undef POTTERY_OPEN_HASH_MAP_PACKED_METADATA
+#undef POTTERY_OPEN_HASH_MAP_METADATA_BITS
+#undef POTTERY_OPEN_HASH_MAP_METADATA_PER_WORD
+#undef POTTERY_OPEN_HASH_MAP_METADATA_SCAN
+#undef POTTERY_OPEN_HASH_MAP_PURGE_IN_PLACE
+#undef POTTERY_OPEN_HASH_MAP_MAX_LOAD_FACTOR_NUMERATOR
+#undef POTTERY_OPEN_HASH_MAP_MAX_LOAD_FACTOR_DENOMINATOR
+#undef POTTERY_OPEN_HASH_MAP_MIN_LOAD_FACTOR_NUMERATOR
+#undef POTTERY_OPEN_HASH_MAP_MIN_LOAD_FACTOR_DENOMINATOR
 #undef POTTERY_OPEN_HASH_MAP_HAS_TABLE_CONTEXT
 #undef POTTERY_OPEN_HASH_MAP_INTERNAL_EMPTY
 #undef POTTERY_OPEN_HASH_MAP_INTERNAL_TOMBSTONE
@@ -123,26 +154,86 @@
 #undef pottery_ohm_impl_free
 #undef pottery_ohm_impl_free_allocs
 #undef pottery_ohm_impl_alloc_metadata
+#undef pottery_ohm_impl_metadata_size
 #undef pottery_ohm_impl_free_metadata
+#undef pottery_ohm_impl_alloc_hashes
+#undef pottery_ohm_impl_free_hashes
 #undef pottery_ohm_grow_if_needed
 #undef pottery_ohm_shrink_if_needed
 #undef pottery_ohm_rehash
 #undef pottery_ohm_load
+#undef pottery_ohm_load_factor_count
+#undef pottery_ohm_min_count
 #undef pottery_ohm_init_impl
 #undef pottery_ohm_entry_move
 #undef pottery_ohm_entry_key
 #undef pottery_ohm_entry_key_equal
 #undef pottery_ohm_entry_key_hash
+#undef pottery_ohm_entry_key_double_hash
+#undef pottery_ohm_entry_seed
 #undef pottery_ohm_entry_is_empty
 #undef pottery_ohm_entry_is_value
 #undef pottery_ohm_entry_set_empty
+#undef pottery_ohm_entry_is_tombstone
+#undef pottery_ohm_entry_set_tombstone
+#undef pottery_ohm_entry_destroy
 #undef pottery_ohm_entry_set_other
 #undef pottery_ohm_entry_metadata
+#undef pottery_ohm_entry_state
+#undef pottery_ohm_entry_set_state
+#undef pottery_ohm_metadata_t
+#undef pottery_ohm_impl_value_bits
+#undef pottery_ohm_impl_next_value_index
+#undef pottery_ohm_impl_previous_value_index
+#undef pottery_ohm_impl_scan_begin
+#undef pottery_ohm_impl_scan_last
+#undef pottery_ohm_impl_scan_next
+#undef pottery_ohm_impl_scan_previous
+#undef pottery_ohm_impl_destroy_all
+#undef pottery_ohm_impl_clear
+#undef pottery_ohm_impl_displace_all
+#undef pottery_ohm_impl_remove_all
+#undef pottery_ohm_entry_probe_distance
+#undef pottery_ohm_entry_set_probe_distance
+#undef pottery_ohm_entry_stored_hash
+#undef pottery_ohm_entry_set_stored_hash
+#undef pottery_ohm_entry_hop_info
+#undef pottery_ohm_entry_set_hop_info
+#undef pottery_ohm_impl_alloc_hop_info
+#undef pottery_ohm_impl_free_hop_info
 #undef pottery_ohm_rehash
 #undef pottery_ohm_bucket_state_t
 #undef pottery_ohm_bucket_state_empty
 #undef pottery_ohm_bucket_state_other
 #undef pottery_ohm_bucket_state_tombstone
+#undef pottery_ohm_bucket_state_value
+#undef pottery_ohm_bucket_state_far
+#undef pottery_ohm_group_tag
+#undef pottery_ohm_group_probe
+#undef pottery_ohm_group_probe_free
+#undef pottery_ohm_group_insert_new
+#undef pottery_ohm_impl_find_hash
+#undef pottery_ohm_impl_find_with_hash
+#undef pottery_ohm_impl_prefetch
+#undef pottery_ohm_stats_t
+#undef pottery_ohm_stats
+#undef pottery_ohm_displace_all_keep_capacity
+#undef pottery_ohm_remove_all_keep_capacity
+#undef pottery_ohm_impl_stats_table
+#undef pottery_ohm_impl_bit_count
+#undef pottery_ohm_impl_size_capacity
+#undef pottery_ohm_impl_displace
+#undef pottery_ohm_impl_migrate_value
+#undef pottery_ohm_impl_is_migrating
+#undef pottery_ohm_impl_is_old_entry
+#undef pottery_ohm_impl_old_map
+#undef pottery_ohm_impl_purge
+#undef pottery_ohm_impl_reseed
+#undef pottery_ohm_impl_watch_probe
+#undef pottery_ohm_group_probe_length
+#undef pottery_ohm_impl_begin_migration
+#undef pottery_ohm_impl_end_migration
+#undef pottery_ohm_impl_migrate
 
 
 
@@ -175,7 +266,11 @@
     #undef pottery_ohm_is_empty
     #undef pottery_ohm_at
     #undef pottery_ohm_find
+    #undef pottery_ohm_find_with_hash
     #undef pottery_ohm_contains_key
+    #undef pottery_ohm_contains_key_with_hash
+    #undef pottery_ohm_find_bulk
+    #undef pottery_ohm_contains_bulk
     #undef pottery_ohm_first
     #undef pottery_ohm_last
     #undef pottery_ohm_any
@@ -213,6 +308,7 @@
     #undef pottery_ohm_emplace
     #undef pottery_ohm_emplace_at
     #undef pottery_ohm_emplace_key
+    #undef pottery_ohm_emplace_key_with_hash
     #undef pottery_ohm_emplace_first
     #undef pottery_ohm_emplace_last
     #undef pottery_ohm_emplace_before
@@ -248,6 +344,7 @@
     #undef pottery_ohm_remove
     #undef pottery_ohm_remove_at
     #undef pottery_ohm_remove_key
+    #undef pottery_ohm_remove_key_with_hash
     #undef pottery_ohm_remove_first
     #undef pottery_ohm_remove_last
     #undef pottery_ohm_remove_and_next
@@ -310,9 +407,11 @@
     // This block is auto-generated. Do not modify until END_AUTOGENERATED.
     // Un-renames open_hash_table identifiers with prefix "pottery_ohm_table"
 
-    #undef pottery_ohm_table_emplace
+    #undef pottery_ohm_table_emplace_key
+    #undef pottery_ohm_table_emplace_key_with_hash
     #undef pottery_ohm_table_insert
     #undef pottery_ohm_table_find
+    #undef pottery_ohm_table_find_with_hash
     #undef pottery_ohm_table_displace
     #undef pottery_ohm_table_displace_all
     #undef pottery_ohm_table_remove
@@ -330,6 +429,7 @@
 
     #undef pottery_ohm_table_key
     #undef pottery_ohm_table_key_hash
+    #undef pottery_ohm_table_key_double_hash_interval
     #undef pottery_ohm_table_key_equal
     #undef pottery_ohm_table_double_hash_interval
     #undef pottery_ohm_table_entry_is_tombstone
@@ -341,8 +441,26 @@
     #undef pottery_ohm_table_entry_exists
 
     #undef pottery_ohm_table_bucket_for_hash
+    #undef pottery_ohm_table_mix_seed
     #undef pottery_ohm_table_next_probe
     #undef pottery_ohm_table_probe
+    #undef pottery_ohm_table_probe_free
+    #undef pottery_ohm_table_entry_probe_length
+
+    #undef pottery_ohm_table_entry_probe_distance
+    #undef pottery_ohm_table_entry_set_probe_distance
+    #undef pottery_ohm_table_entry_hash
+    #undef pottery_ohm_table_entry_set_hash
+    #undef pottery_ohm_table_entry_has_key
+    #undef pottery_ohm_table_robin_hood_probe
+    #undef pottery_ohm_table_robin_hood_shift
+    #undef pottery_ohm_table_hop_info
+    #undef pottery_ohm_table_set_hop_info
+    #undef pottery_ohm_table_hopscotch_neighborhood
+    #undef pottery_ohm_table_hopscotch_find
+    #undef pottery_ohm_table_hopscotch_find_overflow
+    #undef pottery_ohm_table_hopscotch_insert
+    #undef pottery_ohm_table_hopscotch_unlink
 //!!! END_AUTOGENERATED
 
 
@@ -98,6 +98,24 @@ pottery_oht_entry_t pottery_oht_emplace_key(
         pottery_oht_key_t key,
         bool* /*nullable*/ created);
 
+/**
+ * Ensures there is an entry for the given key, adding it if necessary and
+ * returning it, where the hash of the key has already been computed.
+ *
+ * The hash must be the hash of the key, i.e. what KEY_HASH would return.
+ * This is otherwise identical to emplace_key().
+ */
+POTTERY_OPEN_HASH_TABLE_EXTERN
+pottery_oht_entry_t pottery_oht_emplace_key_with_hash(
+        POTTERY_OPEN_HASH_TABLE_ARGS
+        size_t log_2_size,
+        #if POTTERY_OPEN_HASH_TABLE_TOMBSTONES
+        size_t* /*nullable*/ tombstones,
+        #endif
+        pottery_oht_key_t key,
+        size_t hash,
+        bool* /*nullable*/ created);
+
 #if POTTERY_LIFECYCLE_CAN_PASS && POTTERY_LIFECYCLE_CAN_DESTROY
 /**
  * Inserts a value.
@@ -143,6 +161,19 @@ pottery_oht_entry_t pottery_oht_find(
         size_t log_2_size,
         pottery_oht_key_t key);
 
+/**
+ * Finds an entry with the given key, where the hash of the key has already
+ * been computed.
+ *
+ * The hash must be the hash of the key, i.e. what KEY_HASH would return.
+ */
+POTTERY_OPEN_HASH_TABLE_EXTERN
+pottery_oht_entry_t pottery_oht_find_with_hash(
+        POTTERY_OPEN_HASH_TABLE_ARGS
+        size_t log_2_size,
+        pottery_oht_key_t key,
+        size_t hash);
+
 /**
  * Displaces (removes without destroying) the given uninitialized entry from
  * the hash table.
@@ -56,30 +56,128 @@ size_t pottery_oht_key_equal(
 }
 
 /**
- * Returns the probing sequence interval of the given key for double hashing.
+ * Returns the hash of the key of the given element.
+ *
+ * If hashes are stored, this returns the stored hash rather than re-hashing
+ * the key.
+ */
+static inline
+size_t pottery_oht_entry_hash(
+        POTTERY_OPEN_HASH_TABLE_ARGS
+        pottery_oht_entry_t entry)
+{
+    #ifdef POTTERY_OPEN_HASH_TABLE_STORED_HASH
+        #if defined(POTTERY_OPEN_HASH_TABLE_CONTEXT_TYPE)
+            return POTTERY_OPEN_HASH_TABLE_STORED_HASH(context, entry);
+        #else
+            return POTTERY_OPEN_HASH_TABLE_STORED_HASH(entry);
+        #endif
+    #else
+        return pottery_oht_key_hash(POTTERY_OPEN_HASH_TABLE_VALS
+                pottery_oht_key(POTTERY_OPEN_HASH_TABLE_VALS entry));
+    #endif
+}
+
+static inline
+void pottery_oht_entry_set_hash(
+        POTTERY_OPEN_HASH_TABLE_ARGS
+        pottery_oht_entry_t entry,
+        size_t hash)
+{
+    #ifdef POTTERY_OPEN_HASH_TABLE_SET_STORED_HASH
+        #if defined(POTTERY_OPEN_HASH_TABLE_CONTEXT_TYPE)
+            POTTERY_OPEN_HASH_TABLE_SET_STORED_HASH(context, entry, hash);
+        #else
+            POTTERY_OPEN_HASH_TABLE_SET_STORED_HASH(entry, hash);
+        #endif
+    #else
+        POTTERY_OPEN_HASH_TABLE_ARGS_UNUSED;
+        (void)entry;
+        (void)hash;
+    #endif
+}
+
+/**
+ * Returns true if the given element has the given key (whose hash is given.)
+ *
+ * If hashes are stored, we compare them first so that keys are only compared
+ * when their hashes match.
+ */
+static inline
+bool pottery_oht_entry_has_key(
+        POTTERY_OPEN_HASH_TABLE_ARGS
+        pottery_oht_entry_t entry,
+        pottery_oht_key_t key,
+        size_t hash)
+{
+    #ifdef POTTERY_OPEN_HASH_TABLE_STORED_HASH
+    if (pottery_oht_entry_hash(POTTERY_OPEN_HASH_TABLE_VALS entry) != hash)
+        return false;
+    #else
+    (void)hash;
+    #endif
+    return pottery_oht_key_equal(POTTERY_OPEN_HASH_TABLE_VALS key,
+            pottery_oht_key(POTTERY_OPEN_HASH_TABLE_VALS entry));
+}
+
+#ifdef POTTERY_OPEN_HASH_TABLE_SEED
+/**
+ * Mixes the seed of the table into the given hash.
+ *
+ * The home bucket of a hash is taken from the high bits of the result. Unlike
+ * a Knuth multiplicative hash the mix is not linear so hashes that collide in
+ * one table won't collide in a table with a different seed.
+ */
+static inline
+uint64_t pottery_oht_mix_seed(
+        POTTERY_OPEN_HASH_TABLE_ARGS
+        size_t hash)
+{
+    POTTERY_OPEN_HASH_TABLE_ARGS_UNUSED;
+    #if defined(POTTERY_OPEN_HASH_TABLE_CONTEXT_TYPE)
+        uint64_t seed = POTTERY_OPEN_HASH_TABLE_SEED(context);
+    #else
+        uint64_t seed = POTTERY_OPEN_HASH_TABLE_SEED();
+    #endif
+    return pottery_hash_mix_u64(pottery_cast(uint64_t, hash) ^ seed,
+            UINT64_C(0x9E3779B97F4A7C15));
+}
+#endif
+
+/**
+ * Returns the probing sequence interval of the given key (whose hash is
+ * given) for double hashing.
  */
 #if POTTERY_OPEN_HASH_TABLE_DOUBLE_HASHING
 static inline
 size_t pottery_oht_key_double_hash_interval(
         POTTERY_OPEN_HASH_TABLE_ARGS
-        pottery_oht_key_t key)
+        pottery_oht_key_t key,
+        size_t hash)
 {
     // If the user hasn't given us a double hashing function, we just use the
-    // same hash function, but we're using it differently since we're not
+    // hash we already have, but we're using it differently since we're not
     // passing it through a Knuth multiplicative hash. We force the low bit on
     // to make it relatively prime with the size of the table.
-    // (This means the hash function is unnecessarily re-computed. This can be
-    // fixed later.)
-    return 1 |
-            #ifdef POTTERY_OPEN_HASH_TABLE_KEY_DOUBLE_HASH
-                #if defined(POTTERY_OPEN_HASH_TABLE_CONTEXT_TYPE)
-                    POTTERY_OPEN_HASH_TABLE_KEY_DOUBLE_HASH(context, key);
-                #else
-                    POTTERY_OPEN_HASH_TABLE_KEY_DOUBLE_HASH(key);
-                #endif
-            #else
-                pottery_oht_key_hash(POTTERY_OPEN_HASH_TABLE_VALS key);
-            #endif
+    #ifdef POTTERY_OPEN_HASH_TABLE_KEY_DOUBLE_HASH
+        (void)hash;
+        #if defined(POTTERY_OPEN_HASH_TABLE_CONTEXT_TYPE)
+            return 1 | POTTERY_OPEN_HASH_TABLE_KEY_DOUBLE_HASH(context, key);
+        #else
+            return 1 | POTTERY_OPEN_HASH_TABLE_KEY_DOUBLE_HASH(key);
+        #endif
+    #elif defined(POTTERY_OPEN_HASH_TABLE_SEED)
+        // The interval is seeded as well so that keys can't be chosen to
+        // share it. (We take the low bits of the mix; the bucket is chosen
+        // by the high bits.)
+        (void)key;
+        return 1 | pottery_cast(size_t, pottery_oht_mix_seed(
+                POTTERY_OPEN_HASH_TABLE_VALS hash));
+    #else
+        POTTERY_OPEN_HASH_TABLE_ARGS_UNUSED;
+        (void)key;
+        return 1 | hash;
+    #endif
 }
 #endif
 
@@ -154,9 +252,20 @@ bool pottery_oht_entry_is_element(
  */
 
 static inline
-size_t pottery_oht_bucket_for_hash(size_t log_2_size, size_t hash) {
-    //printf("re-hashed %zi to %zi\n", hash, pottery_knuth_hash_s(hash, log_2_size));
-    return pottery_knuth_hash_s(hash, log_2_size);
+size_t pottery_oht_bucket_for_hash(
+        POTTERY_OPEN_HASH_TABLE_ARGS
+        size_t log_2_size,
+        size_t hash)
+{
+    #ifdef POTTERY_OPEN_HASH_TABLE_SEED
+        pottery_assert(log_2_size > 0 && log_2_size < 64);
+        return pottery_cast(size_t, pottery_oht_mix_seed(
+                POTTERY_OPEN_HASH_TABLE_VALS hash) >> (64 - log_2_size));
+    #else
+        POTTERY_OPEN_HASH_TABLE_ARGS_UNUSED;
+        //printf("re-hashed %zi to %zi\n", hash, pottery_knuth_hash_s(hash, log_2_size));
+        return pottery_knuth_hash_s(hash, log_2_size);
+    #endif
 }
 
 static inline
@@ -177,16 +286,11 @@ size_t pottery_oht_next_probe(size_t log_2_size, size_t index, size_t probe) {
         // These are guaranteed to cycle over all buckets in the table since our
         // table is power-of-two sized.
 
-        // This is 1/2*probe + 1/2*probe^2, with proper fractions and overflow checks
-        size_t probe_total;
-        if (pottery_mul_overflow_s(probe, probe + 1, &probe_total))
-            pottery_abort();
-        probe_total /= 2;
-
-        // More overflow checks
-        size_t next = index + probe_total;
-        if (next < index)
-            pottery_abort();
+        // The offset from the home bucket after probe steps is 1/2*probe +
+        // 1/2*probe^2, so each step adds probe to the previous index. (Adding
+        // the whole triangular number to the previous index instead would
+        // visit the tetrahedral numbers, which don't cover the table.)
+        size_t next = index + probe;
 
     #elif POTTERY_OPEN_HASH_TABLE_DOUBLE_HASHING
         // Probe is the double hashing interval
@@ -201,27 +305,470 @@ size_t pottery_oht_next_probe(size_t log_2_size, size_t index, size_t probe) {
 }
 
 /**
- * Probes the hash table looking for either an element with the given key or an
- * empty or tombstone bucket in which it can be inserted.
+ * Returns the number of probes it takes to reach the given element from the
+ * home bucket of its hash, i.e. the number of other buckets a lookup of its
+ * key visits first. Counting stops at the given limit.
+ *
+ * This can be used to detect pathological collisions, for example to rehash
+ * the table with a new seed when an insertion probes too far.
+ */
+static inline
+size_t pottery_oht_entry_probe_length(
+        POTTERY_OPEN_HASH_TABLE_ARGS
+        size_t log_2_size,
+        pottery_oht_entry_t entry,
+        size_t hash,
+        size_t limit)
+{
+    size_t target = pottery_oht_array_access_index(POTTERY_OPEN_HASH_TABLE_VALS entry);
+    size_t index = pottery_oht_bucket_for_hash(POTTERY_OPEN_HASH_TABLE_VALS log_2_size, hash);
+
+    #if POTTERY_OPEN_HASH_TABLE_LINEAR_PROBING
+    size_t mask = (pottery_cast(size_t, 1) << log_2_size) - 1;
+    size_t length = (target - index) & mask;
+    return (length < limit) ? length : limit;
+
+    #else
+    size_t probe = 1;
+    #if POTTERY_OPEN_HASH_TABLE_DOUBLE_HASHING
+    probe = pottery_oht_key_double_hash_interval(POTTERY_OPEN_HASH_TABLE_VALS
+            pottery_oht_key(POTTERY_OPEN_HASH_TABLE_VALS entry), hash);
+    #endif
+
+    size_t length = 0;
+    while (index != target && length < limit) {
+        index = pottery_oht_next_probe(log_2_size, index, probe);
+        #if !POTTERY_OPEN_HASH_TABLE_DOUBLE_HASHING
+        ++probe;
+        #endif
+        ++length;
+    }
+    return length;
+    #endif
+}
+
+#if POTTERY_OPEN_HASH_TABLE_ROBIN_HOOD_HASHING
+/**
+ * Returns the probe distance of the element in the given bucket, i.e. how far
+ * it is from the bucket its hash maps to.
+ */
+static inline
+size_t pottery_oht_entry_probe_distance(
+        POTTERY_OPEN_HASH_TABLE_ARGS
+        size_t log_2_size,
+        size_t index,
+        pottery_oht_entry_t entry)
+{
+    #ifdef POTTERY_OPEN_HASH_TABLE_PROBE_DISTANCE
+        (void)log_2_size;
+        (void)index;
+        #if defined(POTTERY_OPEN_HASH_TABLE_CONTEXT_TYPE)
+            return POTTERY_OPEN_HASH_TABLE_PROBE_DISTANCE(context, entry);
+        #else
+            return POTTERY_OPEN_HASH_TABLE_PROBE_DISTANCE(entry);
+        #endif
+    #else
+        // The probe distance isn't stored so we derive it from the hash.
+        size_t mask = (pottery_cast(size_t, 1) << log_2_size) - 1;
+        size_t bucket = pottery_oht_bucket_for_hash(POTTERY_OPEN_HASH_TABLE_VALS log_2_size,
+                pottery_oht_entry_hash(POTTERY_OPEN_HASH_TABLE_VALS entry));
+        return (index - bucket) & mask;
+    #endif
+}
+
+static inline
+void pottery_oht_entry_set_probe_distance(
+        POTTERY_OPEN_HASH_TABLE_ARGS
+        pottery_oht_entry_t entry,
+        size_t distance)
+{
+    #ifdef POTTERY_OPEN_HASH_TABLE_SET_PROBE_DISTANCE
+        #if defined(POTTERY_OPEN_HASH_TABLE_CONTEXT_TYPE)
+            POTTERY_OPEN_HASH_TABLE_SET_PROBE_DISTANCE(context, entry, distance);
+        #else
+            POTTERY_OPEN_HASH_TABLE_SET_PROBE_DISTANCE(entry, distance);
+        #endif
+    #else
+        POTTERY_OPEN_HASH_TABLE_ARGS_UNUSED;
+        (void)entry;
+        (void)distance;
+    #endif
+}
+
+/**
+ * Probes a Robin Hood hash table for the given key.
+ *
+ * If the key is found, found is set to true and its entry is returned.
+ * Otherwise found is set to false and the bucket where the key should be
+ * inserted is returned, along with its probe distance. This bucket may
+ * contain an element that needs to be shifted forward to make room.
+ */
+static
+pottery_oht_entry_t pottery_oht_robin_hood_probe(
+        POTTERY_OPEN_HASH_TABLE_ARGS
+        size_t log_2_size,
+        pottery_oht_key_t key,
+        size_t hash,
+        bool* found,
+        size_t* /*nullable*/ out_distance)
+{
+    size_t mask = (pottery_cast(size_t, 1) << log_2_size) - 1;
+    size_t index = pottery_oht_bucket_for_hash(POTTERY_OPEN_HASH_TABLE_VALS log_2_size, hash);
+    size_t distance = 0;
+
+    while (true) {
+        pottery_oht_entry_t entry = pottery_oht_array_access_select(
+                POTTERY_OPEN_HASH_TABLE_VALS index);
+
+        // An empty bucket or an element closer to its own bucket than we are
+        // to ours means the key isn't in the table, and this is where it
+        // should go.
+        if (pottery_oht_entry_is_empty(POTTERY_OPEN_HASH_TABLE_VALS entry) ||
+                pottery_oht_entry_probe_distance(POTTERY_OPEN_HASH_TABLE_VALS
+                    log_2_size, index, entry) < distance)
+        {
+            *found = false;
+            if (out_distance != pottery_null)
+                *out_distance = distance;
+            return entry;
+        }
+
+        if (pottery_oht_entry_has_key(POTTERY_OPEN_HASH_TABLE_VALS entry, key, hash)) {
+            *found = true;
+            return entry;
+        }
+
+        index = (index + 1) & mask;
+        ++distance;
+        pottery_assert(distance <= mask); // assert against full table
+    }
+}
+
+/**
+ * Shifts the elements in the collision sequence starting at the given bucket
+ * forward by one bucket, leaving the given bucket empty.
+ */
+static
+void pottery_oht_robin_hood_shift(
+        POTTERY_OPEN_HASH_TABLE_ARGS
+        size_t log_2_size,
+        size_t index)
+{
+    size_t mask = (pottery_cast(size_t, 1) << log_2_size) - 1;
+
+    // find the end of the sequence
+    size_t last = index;
+    do {
+        last = (last + 1) & mask;
+        pottery_assert(last != index); // assert against full table
+    } while (!pottery_oht_entry_is_empty(POTTERY_OPEN_HASH_TABLE_VALS
+                pottery_oht_array_access_select(POTTERY_OPEN_HASH_TABLE_VALS last)));
+
+    // move elements forward starting from the end
+    while (last != index) {
+        size_t previous = (last + mask) & mask;
+        pottery_oht_entry_t from = pottery_oht_array_access_select(
+                POTTERY_OPEN_HASH_TABLE_VALS previous);
+        pottery_oht_entry_t to = pottery_oht_array_access_select(
+                POTTERY_OPEN_HASH_TABLE_VALS last);
+        size_t distance = pottery_oht_entry_probe_distance(
+                POTTERY_OPEN_HASH_TABLE_VALS log_2_size, previous, from);
+        pottery_oht_lifecycle_move_restrict(
+                POTTERY_OPEN_HASH_TABLE_CONTEXT_VAL to, from);
+        pottery_oht_entry_set_probe_distance(
+                POTTERY_OPEN_HASH_TABLE_VALS to, distance + 1);
+        last = previous;
+    }
+
+    pottery_oht_entry_set_empty(POTTERY_OPEN_HASH_TABLE_VALS
+            pottery_oht_array_access_select(POTTERY_OPEN_HASH_TABLE_VALS index));
+}
+#endif
+
+#if POTTERY_OPEN_HASH_TABLE_HOPSCOTCH_HASHING
+/*
+ * Hopscotch hashing
+ *
+ * Every element is kept within NEIGHBORHOOD buckets of its home bucket. The
+ * hop info of a bucket has a bit for each bucket of its neighborhood that
+ * holds an element whose home is this bucket, so a lookup only visits those
+ * buckets. An insertion takes the first empty bucket as in linear probing; if
+ * that's outside the neighborhood, elements in between are hopped forward
+ * into it (staying within their own neighborhoods) to move the empty bucket
+ * closer until it's in range.
+ *
+ * If no element can be hopped, the new element stays where it is and is
+ * counted in the upper bits of the hop info of its home bucket. Lookups scan
+ * the rest of the table for these overflowed elements. This only happens
+ * when a large number of keys have colliding hashes. If the count saturates,
+ * it's never decremented; lookups scan the whole table for that home bucket
+ * until the elements are rehashed into a new array.
+ */
+
+#define POTTERY_OPEN_HASH_TABLE_HOPSCOTCH_MASK \
+        ((UINT32_C(1) << POTTERY_OPEN_HASH_TABLE_HOPSCOTCH_NEIGHBORHOOD) - 1)
+#define POTTERY_OPEN_HASH_TABLE_HOPSCOTCH_OVERFLOW_MAX \
+        (UINT32_C(0xFFFFFFFF) >> POTTERY_OPEN_HASH_TABLE_HOPSCOTCH_NEIGHBORHOOD)
+
+static inline
+uint32_t pottery_oht_hop_info(
+        POTTERY_OPEN_HASH_TABLE_ARGS
+        size_t index)
+{
+    pottery_oht_entry_t entry = pottery_oht_array_access_select(
+            POTTERY_OPEN_HASH_TABLE_VALS index);
+    #if defined(POTTERY_OPEN_HASH_TABLE_CONTEXT_TYPE)
+        return POTTERY_OPEN_HASH_TABLE_HOP_INFO(context, entry);
+    #else
+        return POTTERY_OPEN_HASH_TABLE_HOP_INFO(entry);
+    #endif
+}
+
+static inline
+void pottery_oht_set_hop_info(
+        POTTERY_OPEN_HASH_TABLE_ARGS
+        size_t index,
+        uint32_t hop_info)
+{
+    pottery_oht_entry_t entry = pottery_oht_array_access_select(
+            POTTERY_OPEN_HASH_TABLE_VALS index);
+    #if defined(POTTERY_OPEN_HASH_TABLE_CONTEXT_TYPE)
+        POTTERY_OPEN_HASH_TABLE_SET_HOP_INFO(context, entry, hop_info);
+    #else
+        POTTERY_OPEN_HASH_TABLE_SET_HOP_INFO(entry, hop_info);
+    #endif
+}
+
+/**
+ * Returns the size of the neighborhood for a table of the given size. (In a
+ * table smaller than the neighborhood, every bucket is in range.)
+ */
+static inline
+size_t pottery_oht_hopscotch_neighborhood(size_t log_2_size) {
+    size_t size = pottery_cast(size_t, 1) << log_2_size;
+    return (size < POTTERY_OPEN_HASH_TABLE_HOPSCOTCH_NEIGHBORHOOD) ?
+            size : POTTERY_OPEN_HASH_TABLE_HOPSCOTCH_NEIGHBORHOOD;
+}
+
+/**
+ * Scans the buckets past the neighborhood of the given home bucket for an
+ * overflowed element with the given key, of which there are the given count
+ * (or an unknown number if it's saturated.)
+ */
+static
+pottery_oht_entry_t pottery_oht_hopscotch_find_overflow(
+        POTTERY_OPEN_HASH_TABLE_ARGS
+        size_t log_2_size,
+        pottery_oht_key_t key,
+        size_t hash,
+        size_t home,
+        uint32_t overflow)
+{
+    size_t size = pottery_cast(size_t, 1) << log_2_size;
+    size_t mask = size - 1;
+    size_t distance;
+
+    for (distance = pottery_oht_hopscotch_neighborhood(log_2_size); distance < size; ++distance) {
+        pottery_oht_entry_t entry = pottery_oht_array_access_select(
+                POTTERY_OPEN_HASH_TABLE_VALS (home + distance) & mask);
+        if (!pottery_oht_entry_is_element(POTTERY_OPEN_HASH_TABLE_VALS entry))
+            continue;
+        size_t element_hash = pottery_oht_entry_hash(POTTERY_OPEN_HASH_TABLE_VALS entry);
+        if (pottery_oht_bucket_for_hash(POTTERY_OPEN_HASH_TABLE_VALS
+                    log_2_size, element_hash) != home)
+            continue;
+        if (element_hash == hash && pottery_oht_key_equal(POTTERY_OPEN_HASH_TABLE_VALS
+                    key, pottery_oht_key(POTTERY_OPEN_HASH_TABLE_VALS entry)))
+            return entry;
+        if (overflow != POTTERY_OPEN_HASH_TABLE_HOPSCOTCH_OVERFLOW_MAX && --overflow == 0)
+            break;
+    }
+
+    return pottery_oht_end(POTTERY_OPEN_HASH_TABLE_VALS log_2_size);
+}
+
+/**
+ * Finds the element with the given key (whose hash is given), or returns the
+ * end of the table if it doesn't exist.
+ */
+static inline
+pottery_oht_entry_t pottery_oht_hopscotch_find(
+        POTTERY_OPEN_HASH_TABLE_ARGS
+        size_t log_2_size,
+        pottery_oht_key_t key,
+        size_t hash)
+{
+    size_t mask = (pottery_cast(size_t, 1) << log_2_size) - 1;
+    size_t home = pottery_oht_bucket_for_hash(POTTERY_OPEN_HASH_TABLE_VALS log_2_size, hash);
+    uint32_t hop_info = pottery_oht_hop_info(POTTERY_OPEN_HASH_TABLE_VALS home);
+
+    uint32_t bits = hop_info & POTTERY_OPEN_HASH_TABLE_HOPSCOTCH_MASK;
+    while (bits != 0) {
+        pottery_oht_entry_t entry = pottery_oht_array_access_select(
+                POTTERY_OPEN_HASH_TABLE_VALS (home + pottery_ctz_u32(bits)) & mask);
+        if (pottery_oht_entry_has_key(POTTERY_OPEN_HASH_TABLE_VALS entry, key, hash))
+            return entry;
+        bits &= bits - 1;
+    }
+
+    uint32_t overflow = hop_info >> POTTERY_OPEN_HASH_TABLE_HOPSCOTCH_NEIGHBORHOOD;
+    if (pottery_unlikely(overflow != 0))
+        return pottery_oht_hopscotch_find_overflow(POTTERY_OPEN_HASH_TABLE_VALS
+                log_2_size, key, hash, home, overflow);
+    return pottery_oht_end(POTTERY_OPEN_HASH_TABLE_VALS log_2_size);
+}
+
+/**
+ * Makes room for a new element with the given hash, returning its empty
+ * bucket. The key must not already be in the table.
+ */
+static
+pottery_oht_entry_t pottery_oht_hopscotch_insert(
+        POTTERY_OPEN_HASH_TABLE_ARGS
+        size_t log_2_size,
+        size_t hash)
+{
+    size_t mask = (pottery_cast(size_t, 1) << log_2_size) - 1;
+    size_t neighborhood = pottery_oht_hopscotch_neighborhood(log_2_size);
+    size_t home = pottery_oht_bucket_for_hash(POTTERY_OPEN_HASH_TABLE_VALS log_2_size, hash);
+
+    // find the first empty bucket
+    size_t distance = 0;
+    while (!pottery_oht_entry_is_empty(POTTERY_OPEN_HASH_TABLE_VALS
+                pottery_oht_array_access_select(POTTERY_OPEN_HASH_TABLE_VALS
+                    (home + distance) & mask)))
+    {
+        ++distance;
+        pottery_assert(distance <= mask); // assert against full table
+    }
+
+    // hop it back into our neighborhood
+    while (distance >= neighborhood) {
+        size_t free_index = (home + distance) & mask;
+
+        // Look for an element between the free bucket and the earliest home
+        // bucket that could reach it. Earlier homes let us hop further.
+        size_t back;
+        for (back = neighborhood - 1; back > 0; --back) {
+            size_t candidate = (free_index - back) & mask;
+            uint32_t hop_info = pottery_oht_hop_info(POTTERY_OPEN_HASH_TABLE_VALS candidate);
+            uint32_t bits = hop_info & ((UINT32_C(1) << back) - 1);
+            if (bits == 0)
+                continue;
+
+            size_t offset = pottery_ctz_u32(bits);
+            pottery_oht_entry_t from = pottery_oht_array_access_select(
+                    POTTERY_OPEN_HASH_TABLE_VALS (candidate + offset) & mask);
+            pottery_oht_lifecycle_move_restrict(POTTERY_OPEN_HASH_TABLE_CONTEXT_VAL
+                    pottery_oht_array_access_select(POTTERY_OPEN_HASH_TABLE_VALS free_index),
+                    from);
+            pottery_oht_entry_set_empty(POTTERY_OPEN_HASH_TABLE_VALS from);
+            pottery_oht_set_hop_info(POTTERY_OPEN_HASH_TABLE_VALS candidate,
+                    (hop_info & ~(UINT32_C(1) << offset)) | (UINT32_C(1) << back));
+
+            distance -= back - offset;
+            break;
+        }
+
+        if (back == 0) {
+            // Nothing can be hopped. The element overflows its neighborhood.
+            uint32_t hop_info = pottery_oht_hop_info(POTTERY_OPEN_HASH_TABLE_VALS home);
+            if ((hop_info >> POTTERY_OPEN_HASH_TABLE_HOPSCOTCH_NEIGHBORHOOD) !=
+                    POTTERY_OPEN_HASH_TABLE_HOPSCOTCH_OVERFLOW_MAX)
+                hop_info += UINT32_C(1) << POTTERY_OPEN_HASH_TABLE_HOPSCOTCH_NEIGHBORHOOD;
+            pottery_oht_set_hop_info(POTTERY_OPEN_HASH_TABLE_VALS home, hop_info);
+            return pottery_oht_array_access_select(POTTERY_OPEN_HASH_TABLE_VALS free_index);
+        }
+    }
+
+    pottery_oht_set_hop_info(POTTERY_OPEN_HASH_TABLE_VALS home,
+            pottery_oht_hop_info(POTTERY_OPEN_HASH_TABLE_VALS home) |
+            (UINT32_C(1) << distance));
+    return pottery_oht_array_access_select(POTTERY_OPEN_HASH_TABLE_VALS
+            (home + distance) & mask);
+}
+
+/**
+ * Clears the given element from the hop info of its home bucket, i.e. its bit
+ * or its overflow count. The element is left in place.
+ */
+static inline
+void pottery_oht_hopscotch_unlink(
+        POTTERY_OPEN_HASH_TABLE_ARGS
+        size_t log_2_size,
+        pottery_oht_entry_t entry)
+{
+    size_t mask = (pottery_cast(size_t, 1) << log_2_size) - 1;
+    size_t index = pottery_oht_array_access_index(POTTERY_OPEN_HASH_TABLE_VALS entry);
+    size_t home = pottery_oht_bucket_for_hash(POTTERY_OPEN_HASH_TABLE_VALS log_2_size,
+            pottery_oht_entry_hash(POTTERY_OPEN_HASH_TABLE_VALS entry));
+    size_t distance = (index - home) & mask;
+
+    uint32_t hop_info = pottery_oht_hop_info(POTTERY_OPEN_HASH_TABLE_VALS home);
+    if (distance < pottery_oht_hopscotch_neighborhood(log_2_size)) {
+        pottery_assert(0 != (hop_info & (UINT32_C(1) << distance)));
+        hop_info &= ~(UINT32_C(1) << distance);
+    } else {
+        pottery_assert(0 != (hop_info >> POTTERY_OPEN_HASH_TABLE_HOPSCOTCH_NEIGHBORHOOD));
+        if ((hop_info >> POTTERY_OPEN_HASH_TABLE_HOPSCOTCH_NEIGHBORHOOD) !=
+                POTTERY_OPEN_HASH_TABLE_HOPSCOTCH_OVERFLOW_MAX)
+            hop_info -= UINT32_C(1) << POTTERY_OPEN_HASH_TABLE_HOPSCOTCH_NEIGHBORHOOD;
+    }
+    pottery_oht_set_hop_info(POTTERY_OPEN_HASH_TABLE_VALS home, hop_info);
+}
+#endif
+
+/**
+ * Probes the hash table looking for either an element with the given key (whose
+ * hash is given) or an empty or tombstone bucket in which it can be inserted.
+ *
+ * With Robin Hood hashing, the bucket in which the key can be inserted might
+ * not be empty.
  */
 static
 pottery_oht_entry_t pottery_oht_probe(
         POTTERY_OPEN_HASH_TABLE_ARGS
         size_t log_2_size,
         pottery_oht_key_t key,
+        size_t hash,
         bool* /*nullable*/ empty_or_tombstone)
 {
-    size_t hash = pottery_oht_key_hash(
-            POTTERY_OPEN_HASH_TABLE_VALS key);
-    size_t bucket = pottery_oht_bucket_for_hash(log_2_size, hash);
+    #if POTTERY_OPEN_HASH_TABLE_HOPSCOTCH_HASHING
+    // We only look up existing keys with this. Insertion has to make room
+    // for the key separately so we return the end of the table if it's not
+    // found.
+    pottery_oht_entry_t found_entry = pottery_oht_hopscotch_find(
+            POTTERY_OPEN_HASH_TABLE_VALS
+            log_2_size, key, hash);
+    if (empty_or_tombstone != pottery_null)
+        *empty_or_tombstone = !pottery_oht_entry_exists(POTTERY_OPEN_HASH_TABLE_VALS
+                log_2_size, found_entry);
+    return found_entry;
+    #elif POTTERY_OPEN_HASH_TABLE_ROBIN_HOOD_HASHING
+    bool found;
+    pottery_oht_entry_t found_entry = pottery_oht_robin_hood_probe(
+            POTTERY_OPEN_HASH_TABLE_VALS
+            log_2_size, key, hash, &found, pottery_null);
+    if (empty_or_tombstone != pottery_null)
+        *empty_or_tombstone = !found;
+    return found_entry;
+    #else
+
+    size_t bucket = pottery_oht_bucket_for_hash(POTTERY_OPEN_HASH_TABLE_VALS log_2_size, hash);
     size_t probe = 1;
     #if POTTERY_OPEN_HASH_TABLE_DOUBLE_HASHING
     probe = pottery_oht_key_double_hash_interval(
-            POTTERY_OPEN_HASH_TABLE_VALS key);
+            POTTERY_OPEN_HASH_TABLE_VALS key, hash);
     #endif
 
     size_t index = bucket;
 
+    #if POTTERY_OPEN_HASH_TABLE_TOMBSTONES
+    // The first tombstone we find is where the key would be inserted, but we
+    // have to keep probing past it since the key may exist further along.
+    pottery_oht_entry_t tombstone = pottery_null;
+    #endif
+
     while (true) {
         //printf("probing at %zi\n", index);
         pottery_oht_entry_t entry = pottery_oht_array_access_select(
@@ -229,17 +776,26 @@ pottery_oht_entry_t pottery_oht_probe(
 
         // see if we found an empty or tombstone bucket
         if (!pottery_oht_entry_is_element(POTTERY_OPEN_HASH_TABLE_VALS entry)) {
-            //printf("found empty or tombstone\n");
-            if (empty_or_tombstone != pottery_null)
-                *empty_or_tombstone = true;
-            return entry;
-        }
+            #if POTTERY_OPEN_HASH_TABLE_TOMBSTONES
+            if (pottery_oht_entry_is_tombstone(POTTERY_OPEN_HASH_TABLE_VALS entry)) {
+                if (tombstone == pottery_null)
+                    tombstone = entry;
+            } else
+            #endif
+            {
+                #if POTTERY_OPEN_HASH_TABLE_TOMBSTONES
+                if (tombstone != pottery_null)
+                    entry = tombstone;
+                #endif
+
+                //printf("found empty or tombstone\n");
+                if (empty_or_tombstone != pottery_null)
+                    *empty_or_tombstone = true;
+                return entry;
+            }
 
         // see if we found a matching key
-        //printf("comparing keys %s %s %i\n", key, pottery_oht_key(POTTERY_OPEN_HASH_TABLE_VALS entry), strcmp(key, pottery_oht_key(POTTERY_OPEN_HASH_TABLE_CONTEXT_VAL entry)));
-        if (pottery_oht_key_equal(POTTERY_OPEN_HASH_TABLE_VALS key,
-                    pottery_oht_key(POTTERY_OPEN_HASH_TABLE_VALS entry)))
-        {
+        } else if (pottery_oht_entry_has_key(POTTERY_OPEN_HASH_TABLE_VALS entry, key, hash)) {
             //printf("found key at %zi\n", index);
             if (empty_or_tombstone != pottery_null)
                 *empty_or_tombstone = false;
@@ -252,51 +808,171 @@ pottery_oht_entry_t pottery_oht_probe(
         #if !POTTERY_OPEN_HASH_TABLE_DOUBLE_HASHING
         ++probe;
         #endif
+
+        if (index == bucket) {
+            // We've wrapped around. The table has no empty buckets so the key
+            // can only be inserted in a tombstone.
+            #if POTTERY_OPEN_HASH_TABLE_TOMBSTONES
+            if (tombstone != pottery_null) {
+                if (empty_or_tombstone != pottery_null)
+                    *empty_or_tombstone = true;
+                return tombstone;
+            }
+            #endif
+            pottery_assert(false); // assert against full table
+        }
+    }
+    #endif
+}
+
+#if !POTTERY_OPEN_HASH_TABLE_ROBIN_HOOD_HASHING && !POTTERY_OPEN_HASH_TABLE_HOPSCOTCH_HASHING
+/**
+ * Returns the first empty or tombstone bucket in the probing sequence of the
+ * given key (whose hash is given) without comparing any keys.
+ *
+ * This is for re-inserting an element that is known not to be in the table,
+ * for example when rehashing a table in place. The bucket's state and stored
+ * hash are not changed.
+ */
+static inline
+pottery_oht_entry_t pottery_oht_probe_free(
+        POTTERY_OPEN_HASH_TABLE_ARGS
+        size_t log_2_size,
+        pottery_oht_key_t key,
+        size_t hash)
+{
+    size_t bucket = pottery_oht_bucket_for_hash(POTTERY_OPEN_HASH_TABLE_VALS log_2_size, hash);
+    size_t probe = 1;
+    #if POTTERY_OPEN_HASH_TABLE_DOUBLE_HASHING
+    probe = pottery_oht_key_double_hash_interval(
+            POTTERY_OPEN_HASH_TABLE_VALS key, hash);
+    #else
+    (void)key;
+    #endif
+
+    size_t index = bucket;
+    while (true) {
+        pottery_oht_entry_t entry = pottery_oht_array_access_select(
+                POTTERY_OPEN_HASH_TABLE_VALS index);
+        if (!pottery_oht_entry_is_element(POTTERY_OPEN_HASH_TABLE_VALS entry))
+            return entry;
+
+        index = pottery_oht_next_probe(log_2_size, index, probe);
+        #if !POTTERY_OPEN_HASH_TABLE_DOUBLE_HASHING
+        ++probe;
+        #endif
         pottery_assert(index != bucket); // assert against full table
     }
 }
+#endif
 
 POTTERY_OPEN_HASH_TABLE_EXTERN
-pottery_oht_entry_t pottery_oht_emplace_key(
+pottery_oht_entry_t pottery_oht_emplace_key_with_hash(
         POTTERY_OPEN_HASH_TABLE_ARGS
         size_t log_2_size,
         #if POTTERY_OPEN_HASH_TABLE_TOMBSTONES
         size_t* tombstones,
         #endif
         pottery_oht_key_t key,
+        size_t hash,
         bool* /*nullable*/ created)
 {
+    #if POTTERY_OPEN_HASH_TABLE_ROBIN_HOOD_HASHING
+    bool found;
+    size_t distance;
+    pottery_oht_entry_t entry = pottery_oht_robin_hood_probe(
+            POTTERY_OPEN_HASH_TABLE_VALS
+            log_2_size, key, hash, &found, &distance);
+    bool empty_or_tombstone = !found;
+
+    // If the bucket is taken by an element closer to home, we take it and
+    // shift the rest of the collision sequence forward.
+    if (!found) {
+        if (!pottery_oht_entry_is_empty(POTTERY_OPEN_HASH_TABLE_VALS entry))
+            pottery_oht_robin_hood_shift(POTTERY_OPEN_HASH_TABLE_VALS log_2_size,
+                    pottery_oht_array_access_index(POTTERY_OPEN_HASH_TABLE_VALS entry));
+        pottery_oht_entry_set_probe_distance(POTTERY_OPEN_HASH_TABLE_VALS entry, distance);
+    }
+
+    #elif POTTERY_OPEN_HASH_TABLE_HOPSCOTCH_HASHING
+    pottery_oht_entry_t entry = pottery_oht_hopscotch_find(
+            POTTERY_OPEN_HASH_TABLE_VALS
+            log_2_size, key, hash);
+    bool empty_or_tombstone = !pottery_oht_entry_exists(POTTERY_OPEN_HASH_TABLE_VALS
+            log_2_size, entry);
+    if (empty_or_tombstone)
+        entry = pottery_oht_hopscotch_insert(POTTERY_OPEN_HASH_TABLE_VALS
+                log_2_size, hash);
+
+    #else
     bool empty_or_tombstone;
     pottery_oht_entry_t entry = pottery_oht_probe(
             POTTERY_OPEN_HASH_TABLE_VALS
-            log_2_size, key, &empty_or_tombstone);
+            log_2_size, key, hash, &empty_or_tombstone);
+    #endif
 
     #if POTTERY_OPEN_HASH_TABLE_TOMBSTONES
+    // If we're re-using a tombstone, there's one fewer.
     if (tombstones != pottery_null && empty_or_tombstone &&
             pottery_oht_entry_is_tombstone(POTTERY_OPEN_HASH_TABLE_VALS entry))
-        (*tombstones)++;
+        --*tombstones;
     #endif
 
+    if (empty_or_tombstone)
+        pottery_oht_entry_set_hash(POTTERY_OPEN_HASH_TABLE_VALS entry, hash);
+
     if (created != pottery_null)
         *created = empty_or_tombstone;
     return entry;
 }
 
 POTTERY_OPEN_HASH_TABLE_EXTERN
-pottery_oht_entry_t pottery_oht_find(
+pottery_oht_entry_t pottery_oht_emplace_key(
         POTTERY_OPEN_HASH_TABLE_ARGS
         size_t log_2_size,
-        pottery_oht_key_t key)
+        #if POTTERY_OPEN_HASH_TABLE_TOMBSTONES
+        size_t* tombstones,
+        #endif
+        pottery_oht_key_t key,
+        bool* /*nullable*/ created)
+{
+    return pottery_oht_emplace_key_with_hash(
+            POTTERY_OPEN_HASH_TABLE_VALS
+            log_2_size,
+            #if POTTERY_OPEN_HASH_TABLE_TOMBSTONES
+            tombstones,
+            #endif
+            key,
+            pottery_oht_key_hash(POTTERY_OPEN_HASH_TABLE_VALS key),
+            created);
+}
+
+POTTERY_OPEN_HASH_TABLE_EXTERN
+pottery_oht_entry_t pottery_oht_find_with_hash(
+        POTTERY_OPEN_HASH_TABLE_ARGS
+        size_t log_2_size,
+        pottery_oht_key_t key,
+        size_t hash)
 {
     bool empty;
     pottery_oht_entry_t entry = pottery_oht_probe(
             POTTERY_OPEN_HASH_TABLE_VALS
-            log_2_size, key, &empty);
+            log_2_size, key, hash, &empty);
     //printf("empty %i\n",empty);
     return empty ? pottery_oht_end(POTTERY_OPEN_HASH_TABLE_VALS
             log_2_size) : entry;
 }
 
+POTTERY_OPEN_HASH_TABLE_EXTERN
+pottery_oht_entry_t pottery_oht_find(
+        POTTERY_OPEN_HASH_TABLE_ARGS
+        size_t log_2_size,
+        pottery_oht_key_t key)
+{
+    return pottery_oht_find_with_hash(POTTERY_OPEN_HASH_TABLE_VALS
+            log_2_size, key, pottery_oht_key_hash(POTTERY_OPEN_HASH_TABLE_VALS key));
+}
+
 POTTERY_OPEN_HASH_TABLE_EXTERN
 void pottery_oht_displace(
         POTTERY_OPEN_HASH_TABLE_ARGS
@@ -315,7 +991,54 @@ void pottery_oht_displace(
 
 
 
-    #if POTTERY_OPEN_HASH_TABLE_TOMBSTONES
+    #if POTTERY_OPEN_HASH_TABLE_HOPSCOTCH_HASHING
+
+    /*
+     * Hopscotch hashing
+     */
+
+    // We clear the element from the hop info of its home bucket. Nothing else
+    // needs to move.
+    (void)mask;
+    (void)index;
+    pottery_oht_hopscotch_unlink(POTTERY_OPEN_HASH_TABLE_VALS log_2_size, entry);
+    pottery_oht_entry_set_empty(POTTERY_OPEN_HASH_TABLE_VALS entry);
+
+
+
+    #elif POTTERY_OPEN_HASH_TABLE_ROBIN_HOOD_HASHING
+
+    /*
+     * Robin Hood hashing
+     */
+
+    // We shift subsequent elements back by one bucket until we reach an empty
+    // bucket or an element that is already in its own bucket. The order of
+    // the collision sequence is preserved so we never need tombstones.
+
+    while (true) {
+        size_t next_index = (index + 1) & mask;
+        pottery_oht_entry_t next = pottery_oht_array_access_select(
+                POTTERY_OPEN_HASH_TABLE_VALS next_index);
+        if (pottery_oht_entry_is_empty(POTTERY_OPEN_HASH_TABLE_VALS next))
+            break;
+        size_t distance = pottery_oht_entry_probe_distance(
+                POTTERY_OPEN_HASH_TABLE_VALS log_2_size, next_index, next);
+        if (distance == 0)
+            break;
+
+        pottery_oht_lifecycle_move_restrict(
+                POTTERY_OPEN_HASH_TABLE_CONTEXT_VAL entry, next);
+        pottery_oht_entry_set_probe_distance(
+                POTTERY_OPEN_HASH_TABLE_VALS entry, distance - 1);
+        entry = next;
+        index = next_index;
+    }
+    pottery_oht_entry_set_empty(POTTERY_OPEN_HASH_TABLE_VALS entry);
+
+
+
+    #elif POTTERY_OPEN_HASH_TABLE_TOMBSTONES
 
     /*
      * Linear probing with tombstones
@@ -342,11 +1065,11 @@ void pottery_oht_displace(
         pottery_oht_entry_set_empty(POTTERY_OPEN_HASH_TABLE_VALS entry);
         index = (index + 1) & mask;
         entry = pottery_oht_array_access_select(
-                POTTERY_OPEN_HASH_TABLE_ARGS index);
+                POTTERY_OPEN_HASH_TABLE_VALS index);
         if (!pottery_oht_entry_is_tombstone(POTTERY_OPEN_HASH_TABLE_VALS entry))
             break;
         if (tombstones != pottery_null)
-            --tombstones;
+            --*tombstones;
     }
 
 
@@ -381,6 +1104,7 @@ void pottery_oht_displace(
                 POTTERY_OPEN_HASH_TABLE_VALS
                 log_2_size,
                 pottery_oht_key(POTTERY_OPEN_HASH_TABLE_VALS test),
+                pottery_oht_entry_hash(POTTERY_OPEN_HASH_TABLE_VALS test),
                 &empty);
         if (target == entry) {
             (void)empty;
@@ -522,13 +1246,17 @@ void pottery_oht_displace_all(
     // - REF_TYPE needs to be undefined, since otherwise it might not even be a
     //   pointer
     //
-    // This is not worth doing right now.
+    // This is not worth doing here. The open_hash_map owns contiguous arrays
+    // so it clears them with memset() itself when an empty bucket is zero.
 
     size_t size = pottery_cast(size_t, 1) << log_2_size;
     size_t i;
     pottery_oht_entry_t entry = base;
     for (i = 0; i < size; ++i) {
         pottery_oht_entry_set_empty(POTTERY_OPEN_HASH_TABLE_VALS entry);
+        #if POTTERY_OPEN_HASH_TABLE_HOPSCOTCH_HASHING
+        pottery_oht_set_hop_info(POTTERY_OPEN_HASH_TABLE_VALS i, 0);
+        #endif
         entry = pottery_oht_array_access_next(POTTERY_OPEN_HASH_TABLE_VALS entry);
     }
 }
@@ -572,6 +1300,9 @@ void pottery_oht_remove_all(
             pottery_oht_lifecycle_destroy(POTTERY_OPEN_HASH_TABLE_CONTEXT_VAL entry);
         // Clear it even if it wasn't an element since it might be a tombstone
         pottery_oht_entry_set_empty(POTTERY_OPEN_HASH_TABLE_VALS entry);
+        #if POTTERY_OPEN_HASH_TABLE_HOPSCOTCH_HASHING
+        pottery_oht_set_hop_info(POTTERY_OPEN_HASH_TABLE_VALS i, 0);
+        #endif
         entry = pottery_oht_array_access_next(POTTERY_OPEN_HASH_TABLE_VALS entry);
     }
 }
@@ -585,6 +1316,13 @@ void pottery_oht_remove(
         #endif
         pottery_oht_entry_t entry)
 {
+    #if POTTERY_OPEN_HASH_TABLE_HOPSCOTCH_HASHING
+    // We need the element's key to find its home bucket so we unlink it
+    // before destroying it.
+    pottery_oht_hopscotch_unlink(POTTERY_OPEN_HASH_TABLE_VALS log_2_size, entry);
+    pottery_oht_lifecycle_destroy(POTTERY_OPEN_HASH_TABLE_CONTEXT_VAL entry);
+    pottery_oht_entry_set_empty(POTTERY_OPEN_HASH_TABLE_VALS entry);
+    #else
     pottery_oht_lifecycle_destroy(POTTERY_OPEN_HASH_TABLE_CONTEXT_VAL entry);
     pottery_oht_displace(
             POTTERY_OPEN_HASH_TABLE_VALS
@@ -593,6 +1331,7 @@ void pottery_oht_remove(
             tombstones,
             #endif
             entry);
+    #endif
 }
 
 POTTERY_OPEN_HASH_TABLE_EXTERN
@@ -94,6 +94,71 @@
     #error "Either a move expression or tombstones are required."
 #endif
 
+// Robin Hood hashing
+// This is a variant of linear probing that keeps collision sequences ordered
+// by probe distance. Lookups can stop early and removal shifts elements back,
+// so it doesn't use tombstones.
+#ifndef POTTERY_OPEN_HASH_TABLE_ROBIN_HOOD_HASHING
+    #define POTTERY_OPEN_HASH_TABLE_ROBIN_HOOD_HASHING 0
+#endif
+#if POTTERY_OPEN_HASH_TABLE_ROBIN_HOOD_HASHING
+    #if !POTTERY_OPEN_HASH_TABLE_LINEAR_PROBING
+        #error "Robin Hood hashing requires linear probing."
+    #endif
+    #if POTTERY_OPEN_HASH_TABLE_TOMBSTONES
+        #error "Robin Hood hashing does not use tombstones."
+    #endif
+    #if defined(POTTERY_OPEN_HASH_TABLE_PROBE_DISTANCE) != defined(POTTERY_OPEN_HASH_TABLE_SET_PROBE_DISTANCE)
+        #error "You must define both or neither of PROBE_DISTANCE and SET_PROBE_DISTANCE."
+    #endif
+#elif defined(POTTERY_OPEN_HASH_TABLE_PROBE_DISTANCE) || defined(POTTERY_OPEN_HASH_TABLE_SET_PROBE_DISTANCE)
+    #error "PROBE_DISTANCE is only used by Robin Hood hashing."
+#endif
+
+// Hopscotch hashing
+// This is a variant of linear probing that keeps every element within a
+// neighborhood of NEIGHBORHOOD buckets of its home bucket. Each bucket stores
+// a 32-bit hop info word: the low NEIGHBORHOOD bits say which buckets of its
+// neighborhood hold elements that hash to it, and the remaining bits count
+// elements that couldn't be moved into it (which only happens with heavily
+// colliding hashes.)
+#ifndef POTTERY_OPEN_HASH_TABLE_HOPSCOTCH_HASHING
+    #define POTTERY_OPEN_HASH_TABLE_HOPSCOTCH_HASHING 0
+#endif
+#if POTTERY_OPEN_HASH_TABLE_HOPSCOTCH_HASHING
+    #if !POTTERY_OPEN_HASH_TABLE_LINEAR_PROBING
+        #error "Hopscotch hashing requires linear probing."
+    #endif
+    #if POTTERY_OPEN_HASH_TABLE_TOMBSTONES
+        #error "Hopscotch hashing does not use tombstones."
+    #endif
+    #if POTTERY_OPEN_HASH_TABLE_ROBIN_HOOD_HASHING
+        #error "Hopscotch hashing cannot be combined with Robin Hood hashing."
+    #endif
+    #if !defined(POTTERY_OPEN_HASH_TABLE_HOP_INFO) || !defined(POTTERY_OPEN_HASH_TABLE_SET_HOP_INFO)
+        #error "Hopscotch hashing requires HOP_INFO and SET_HOP_INFO."
+    #endif
+    #ifndef POTTERY_OPEN_HASH_TABLE_HOPSCOTCH_NEIGHBORHOOD
+        #define POTTERY_OPEN_HASH_TABLE_HOPSCOTCH_NEIGHBORHOOD 24
+    #endif
+    #if POTTERY_OPEN_HASH_TABLE_HOPSCOTCH_NEIGHBORHOOD < 2 || POTTERY_OPEN_HASH_TABLE_HOPSCOTCH_NEIGHBORHOOD > 31
+        #error "HOPSCOTCH_NEIGHBORHOOD must be between 2 and 31."
+    #endif
+#elif defined(POTTERY_OPEN_HASH_TABLE_HOP_INFO) || defined(POTTERY_OPEN_HASH_TABLE_SET_HOP_INFO)
+    #error "HOP_INFO is only used by hopscotch hashing."
+#endif
+
+// Stored hash
+// If you have somewhere to store the hash of each element, the table will use
+// it to avoid re-hashing keys and to skip comparing keys whose hashes differ.
+#if defined(POTTERY_OPEN_HASH_TABLE_STORED_HASH) != defined(POTTERY_OPEN_HASH_TABLE_SET_STORED_HASH)
+    #error "You must define both or neither of STORED_HASH and SET_STORED_HASH."
+#endif
+
+// Seed
+// If you define a SEED expression, it's mixed into hashes when choosing their
+// buckets so that the buckets of keys can't be predicted without it.
+
 
 
 /*
@@ -157,8 +222,10 @@
     // Renames open_hash_table identifiers from pottery_oht to POTTERY_OPEN_HASH_TABLE_PREFIX
 
     #define pottery_oht_emplace_key POTTERY_CONCAT(POTTERY_OPEN_HASH_TABLE_PREFIX, _emplace_key)
+    #define pottery_oht_emplace_key_with_hash POTTERY_CONCAT(POTTERY_OPEN_HASH_TABLE_PREFIX, _emplace_key_with_hash)
     #define pottery_oht_insert POTTERY_CONCAT(POTTERY_OPEN_HASH_TABLE_PREFIX, _insert)
     #define pottery_oht_find POTTERY_CONCAT(POTTERY_OPEN_HASH_TABLE_PREFIX, _find)
+    #define pottery_oht_find_with_hash POTTERY_CONCAT(POTTERY_OPEN_HASH_TABLE_PREFIX, _find_with_hash)
     #define pottery_oht_displace POTTERY_CONCAT(POTTERY_OPEN_HASH_TABLE_PREFIX, _displace)
     #define pottery_oht_displace_all POTTERY_CONCAT(POTTERY_OPEN_HASH_TABLE_PREFIX, _displace_all)
     #define pottery_oht_remove POTTERY_CONCAT(POTTERY_OPEN_HASH_TABLE_PREFIX, _remove)
@@ -176,6 +243,7 @@
 
     #define pottery_oht_key POTTERY_CONCAT(POTTERY_OPEN_HASH_TABLE_PREFIX, _key)
     #define pottery_oht_key_hash POTTERY_CONCAT(POTTERY_OPEN_HASH_TABLE_PREFIX, _key_hash)
+    #define pottery_oht_key_double_hash_interval POTTERY_CONCAT(POTTERY_OPEN_HASH_TABLE_PREFIX, _key_double_hash_interval)
     #define pottery_oht_key_equal POTTERY_CONCAT(POTTERY_OPEN_HASH_TABLE_PREFIX, _key_equal)
     #define pottery_oht_double_hash_interval POTTERY_CONCAT(POTTERY_OPEN_HASH_TABLE_PREFIX, _double_hash_interval)
     #define pottery_oht_entry_is_tombstone POTTERY_CONCAT(POTTERY_OPEN_HASH_TABLE_PREFIX, _entry_is_tombstone)
@@ -187,8 +255,26 @@
     #define pottery_oht_entry_exists POTTERY_CONCAT(POTTERY_OPEN_HASH_TABLE_PREFIX, _entry_exists)
 
     #define pottery_oht_bucket_for_hash POTTERY_CONCAT(POTTERY_OPEN_HASH_TABLE_PREFIX, _bucket_for_hash)
+    #define pottery_oht_mix_seed POTTERY_CONCAT(POTTERY_OPEN_HASH_TABLE_PREFIX, _mix_seed)
     #define pottery_oht_next_probe POTTERY_CONCAT(POTTERY_OPEN_HASH_TABLE_PREFIX, _next_probe)
     #define pottery_oht_probe POTTERY_CONCAT(POTTERY_OPEN_HASH_TABLE_PREFIX, _probe)
+    #define pottery_oht_probe_free POTTERY_CONCAT(POTTERY_OPEN_HASH_TABLE_PREFIX, _probe_free)
+    #define pottery_oht_entry_probe_length POTTERY_CONCAT(POTTERY_OPEN_HASH_TABLE_PREFIX, _entry_probe_length)
+
+    #define pottery_oht_entry_probe_distance POTTERY_CONCAT(POTTERY_OPEN_HASH_TABLE_PREFIX, _entry_probe_distance)
+    #define pottery_oht_entry_set_probe_distance POTTERY_CONCAT(POTTERY_OPEN_HASH_TABLE_PREFIX, _entry_set_probe_distance)
+    #define pottery_oht_entry_hash POTTERY_CONCAT(POTTERY_OPEN_HASH_TABLE_PREFIX, _entry_hash)
+    #define pottery_oht_entry_set_hash POTTERY_CONCAT(POTTERY_OPEN_HASH_TABLE_PREFIX, _entry_set_hash)
+    #define pottery_oht_entry_has_key POTTERY_CONCAT(POTTERY_OPEN_HASH_TABLE_PREFIX, _entry_has_key)
+    #define pottery_oht_robin_hood_probe POTTERY_CONCAT(POTTERY_OPEN_HASH_TABLE_PREFIX, _robin_hood_probe)
+    #define pottery_oht_robin_hood_shift POTTERY_CONCAT(POTTERY_OPEN_HASH_TABLE_PREFIX, _robin_hood_shift)
+    #define pottery_oht_hop_info POTTERY_CONCAT(POTTERY_OPEN_HASH_TABLE_PREFIX, _hop_info)
+    #define pottery_oht_set_hop_info POTTERY_CONCAT(POTTERY_OPEN_HASH_TABLE_PREFIX, _set_hop_info)
+    #define pottery_oht_hopscotch_neighborhood POTTERY_CONCAT(POTTERY_OPEN_HASH_TABLE_PREFIX, _hopscotch_neighborhood)
+    #define pottery_oht_hopscotch_find POTTERY_CONCAT(POTTERY_OPEN_HASH_TABLE_PREFIX, _hopscotch_find)
+    #define pottery_oht_hopscotch_find_overflow POTTERY_CONCAT(POTTERY_OPEN_HASH_TABLE_PREFIX, _hopscotch_find_overflow)
+    #define pottery_oht_hopscotch_insert POTTERY_CONCAT(POTTERY_OPEN_HASH_TABLE_PREFIX, _hopscotch_insert)
+    #define pottery_oht_hopscotch_unlink POTTERY_CONCAT(POTTERY_OPEN_HASH_TABLE_PREFIX, _hopscotch_unlink)
 //!!! END_AUTOGENERATED
 
 
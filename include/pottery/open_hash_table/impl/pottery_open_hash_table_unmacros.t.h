@@ -53,6 +53,7 @@
 
     #undef POTTERY_OPEN_HASH_TABLE_KEY_HASH
     #undef POTTERY_OPEN_HASH_TABLE_KEY_EQUAL
+    #undef POTTERY_OPEN_HASH_TABLE_KEY_DOUBLE_HASH
     #undef POTTERY_OPEN_HASH_TABLE_REF_KEY
 
     #undef POTTERY_OPEN_HASH_TABLE_IS_EMPTY
@@ -68,6 +69,17 @@
     #undef POTTERY_OPEN_HASH_TABLE_QUADRATIC_PROBING
     #undef POTTERY_OPEN_HASH_TABLE_DOUBLE_HASHING
     #undef POTTERY_OPEN_HASH_TABLE_DOUBLE_HASH_PROBE
+    #undef POTTERY_OPEN_HASH_TABLE_ROBIN_HOOD_HASHING
+
+    #undef POTTERY_OPEN_HASH_TABLE_PROBE_DISTANCE
+    #undef POTTERY_OPEN_HASH_TABLE_SET_PROBE_DISTANCE
+    #undef POTTERY_OPEN_HASH_TABLE_HOPSCOTCH_HASHING
+    #undef POTTERY_OPEN_HASH_TABLE_HOPSCOTCH_NEIGHBORHOOD
+    #undef POTTERY_OPEN_HASH_TABLE_HOP_INFO
+    #undef POTTERY_OPEN_HASH_TABLE_SET_HOP_INFO
+    #undef POTTERY_OPEN_HASH_TABLE_STORED_HASH
+    #undef POTTERY_OPEN_HASH_TABLE_SET_STORED_HASH
+    #undef POTTERY_OPEN_HASH_TABLE_SEED
 //!!! END_AUTOGENERATED
 
 
@@ -79,13 +91,18 @@
 
 #undef POTTERY_OPEN_HASH_TABLE_NAME
 
+#undef POTTERY_OPEN_HASH_TABLE_HOPSCOTCH_MASK
+#undef POTTERY_OPEN_HASH_TABLE_HOPSCOTCH_OVERFLOW_MAX
+
 //!!! AUTOGENERATED:open_hash_table/unrename.m.h PREFIX:pottery_oht
     // This block is auto-generated. Do not modify until END_AUTOGENERATED.
     // Un-renames open_hash_table identifiers with prefix "pottery_oht"
 
-    #undef pottery_oht_emplace
+    #undef pottery_oht_emplace_key
+    #undef pottery_oht_emplace_key_with_hash
     #undef pottery_oht_insert
     #undef pottery_oht_find
+    #undef pottery_oht_find_with_hash
     #undef pottery_oht_displace
     #undef pottery_oht_displace_all
     #undef pottery_oht_remove
@@ -103,6 +120,7 @@
 
     #undef pottery_oht_key
     #undef pottery_oht_key_hash
+    #undef pottery_oht_key_double_hash_interval
     #undef pottery_oht_key_equal
     #undef pottery_oht_double_hash_interval
     #undef pottery_oht_entry_is_tombstone
@@ -114,8 +132,26 @@
     #undef pottery_oht_entry_exists
 
     #undef pottery_oht_bucket_for_hash
+    #undef pottery_oht_mix_seed
     #undef pottery_oht_next_probe
     #undef pottery_oht_probe
+    #undef pottery_oht_probe_free
+    #undef pottery_oht_entry_probe_length
+
+    #undef pottery_oht_entry_probe_distance
+    #undef pottery_oht_entry_set_probe_distance
+    #undef pottery_oht_entry_hash
+    #undef pottery_oht_entry_set_hash
+    #undef pottery_oht_entry_has_key
+    #undef pottery_oht_robin_hood_probe
+    #undef pottery_oht_robin_hood_shift
+    #undef pottery_oht_hop_info
+    #undef pottery_oht_set_hop_info
+    #undef pottery_oht_hopscotch_neighborhood
+    #undef pottery_oht_hopscotch_find
+    #undef pottery_oht_hopscotch_find_overflow
+    #undef pottery_oht_hopscotch_insert
+    #undef pottery_oht_hopscotch_unlink
 //!!! END_AUTOGENERATED
 
 
@@ -31,5 +31,9 @@
 #define POTTERY_RING_EXTERNAL_ALLOC POTTERY_PAGER_NAME(_alloc)
 #define POTTERY_RING_LIFECYCLE_BY_VALUE 1
 
+// Pager entries point into the page ring so it must not move its pages when
+// pages are removed at the other end.
+#define POTTERY_RING_AUTO_SHRINK 0
+
 // This makes pager not bitwise movable. Maybe this should be configurable.
 #define POTTERY_RING_INTERNAL_CAPACITY 4
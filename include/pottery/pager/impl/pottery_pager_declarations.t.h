@@ -162,6 +162,80 @@ POTTERY_PAGER_EXTERN
 size_t pottery_pager_index(pottery_pager_t* pager, pottery_pager_entry_t entry);
 #endif
 
+#if POTTERY_LIFECYCLE_CAN_MOVE
+#if POTTERY_FORWARD_DECLARATIONS
+/**
+ * Makes room for count uninitialized values at the given index, returning an
+ * entry for the first of them.
+ *
+ * Space is added at whichever end of the pager is closer to the index and the
+ * values in between are moved over, so this moves at most half the values in
+ * the pager. Unlike insertion at the ends, this invalidates entries to any
+ * values that are moved.
+ */
+POTTERY_PAGER_EXTERN
+pottery_error_t pottery_pager_emplace_at_bulk(pottery_pager_t* pager, size_t index,
+        size_t count, pottery_pager_entry_t* entry);
+
+/**
+ * Removes count values at the given index without destroying them.
+ *
+ * The values between the gap and whichever end of the pager is closer are
+ * moved over to close it, so this moves at most half the values in the pager.
+ */
+POTTERY_PAGER_EXTERN
+void pottery_pager_displace_at_bulk(pottery_pager_t* pager, size_t index, size_t count);
+
+#if POTTERY_LIFECYCLE_CAN_DESTROY
+POTTERY_PAGER_EXTERN
+void pottery_pager_remove_at_bulk(pottery_pager_t* pager, size_t index, size_t count);
+#endif
+#endif
+
+static inline
+pottery_error_t pottery_pager_emplace_at(pottery_pager_t* pager, size_t index,
+        pottery_pager_entry_t* entry)
+{
+    return pottery_pager_emplace_at_bulk(pager, index, 1, entry);
+}
+
+static inline
+void pottery_pager_displace_at(pottery_pager_t* pager, size_t index) {
+    pottery_pager_displace_at_bulk(pager, index, 1);
+}
+
+#if POTTERY_LIFECYCLE_CAN_DESTROY
+static inline
+void pottery_pager_remove_at(pottery_pager_t* pager, size_t index) {
+    pottery_pager_remove_at_bulk(pager, index, 1);
+}
+#endif
+
+#if POTTERY_LIFECYCLE_CAN_PASS
+static inline
+pottery_error_t pottery_pager_insert_at(pottery_pager_t* pager, size_t index, pottery_pager_value_t value) {
+    pottery_pager_entry_t entry;
+    pottery_error_t error = pottery_pager_emplace_at(pager, index, &entry);
+    if (error != POTTERY_OK)
+        return error;
+    pottery_move_construct(pottery_pager_value_t, *pottery_pager_entry_ref(pager, entry), value);
+    return POTTERY_OK;
+}
+
+static inline
+pottery_pager_value_t pottery_pager_extract_at(pottery_pager_t* pager, size_t index) {
+    pottery_pager_value_t* p = pottery_pager_entry_ref(pager, pottery_pager_select(pager, index));
+    pottery_pager_value_t ret = pottery_move_if_cxx(*p);
+    #ifdef __cplusplus
+    // We have to run the destructor. See note in pottery_vector_extract()
+    p->~pottery_pager_value_t();
+    #endif
+    pottery_pager_displace_at(pager, index);
+    return ret;
+}
+#endif
+#endif
+
 static inline
 pottery_pager_entry_t pottery_pager_at(pottery_pager_t* pager, size_t index) {
     pottery_assert(index < pottery_pager_count(pager));
@@ -486,6 +486,111 @@ pottery_error_t pottery_pager_emplace_last_bulk(pottery_pager_t* pager, pottery_
     return POTTERY_OK;
 }
 
+#if POTTERY_LIFECYCLE_CAN_MOVE
+/*
+ * Moves count values from one index of the pager to another. The ranges may
+ * overlap. Values are moved in runs that are contiguous within a page, from
+ * the front if they're moving down and from the back if they're moving up, so
+ * that no value is overwritten before it has been moved.
+ */
+static void pottery_pager_move_range(pottery_pager_t* pager, size_t to, size_t from, size_t count) {
+    size_t per_page = pottery_pager_per_page();
+
+    if (to < from) {
+        while (count > 0) {
+            pottery_pager_entry_t to_entry = pottery_pager_select(pager, to);
+            pottery_pager_entry_t from_entry = pottery_pager_select(pager, from);
+            size_t to_left = per_page - pottery_cast(size_t, to_entry.value - *to_entry.page);
+            size_t from_left = per_page - pottery_cast(size_t, from_entry.value - *from_entry.page);
+            size_t step = pottery_min_s(count, pottery_min_s(to_left, from_left));
+            pottery_pager_lifecycle_move_bulk(to_entry.value, from_entry.value, step);
+            to += step;
+            from += step;
+            count -= step;
+        }
+
+    } else if (to > from) {
+        while (count > 0) {
+            // entries for the last value of each range
+            pottery_pager_entry_t to_entry = pottery_pager_select(pager, to + count - 1);
+            pottery_pager_entry_t from_entry = pottery_pager_select(pager, from + count - 1);
+            size_t to_left = pottery_cast(size_t, to_entry.value - *to_entry.page) + 1;
+            size_t from_left = pottery_cast(size_t, from_entry.value - *from_entry.page) + 1;
+            size_t step = pottery_min_s(count, pottery_min_s(to_left, from_left));
+            pottery_pager_lifecycle_move_bulk(to_entry.value + 1 - step,
+                    from_entry.value + 1 - step, step);
+            count -= step;
+        }
+    }
+}
+
+POTTERY_PAGER_EXTERN
+pottery_error_t pottery_pager_emplace_at_bulk(pottery_pager_t* pager, size_t index,
+        size_t count, pottery_pager_entry_t* entry)
+{
+    pottery_pager_sanity_check(pager);
+    size_t old_count = pottery_pager_count(pager);
+    pottery_assert(index <= old_count);
+
+    if (count == 0) {
+        *entry = pottery_pager_select(pager, index);
+        return POTTERY_OK;
+    }
+
+    // We make room at whichever end of the pager is closer to the index and
+    // move the values in between.
+    size_t after = old_count - index;
+    pottery_pager_entry_t ignored;
+    if (index < after) {
+        pottery_error_t error = pottery_pager_emplace_first_bulk(pager, &ignored, count);
+        if (error != POTTERY_OK)
+            return error;
+        pottery_pager_move_range(pager, 0, count, index);
+    } else {
+        pottery_error_t error = pottery_pager_emplace_last_bulk(pager, &ignored, count);
+        if (error != POTTERY_OK)
+            return error;
+        pottery_pager_move_range(pager, index + count, index, after);
+    }
+
+    *entry = pottery_pager_select(pager, index);
+    pottery_pager_sanity_check(pager);
+    return POTTERY_OK;
+}
+
+POTTERY_PAGER_EXTERN
+void pottery_pager_displace_at_bulk(pottery_pager_t* pager, size_t index, size_t count) {
+    pottery_pager_sanity_check(pager);
+    size_t old_count = pottery_pager_count(pager);
+    pottery_assert(count <= old_count);
+    pottery_assert(index <= old_count - count);
+
+    // We close the gap by moving the values between it and whichever end of
+    // the pager is closer.
+    size_t after = old_count - index - count;
+    if (index < after) {
+        pottery_pager_move_range(pager, count, 0, index);
+        pottery_pager_displace_first_bulk(pager, count);
+    } else {
+        pottery_pager_move_range(pager, index, index + count, after);
+        pottery_pager_displace_last_bulk(pager, count);
+    }
+}
+
+#if POTTERY_LIFECYCLE_CAN_DESTROY
+POTTERY_PAGER_EXTERN
+void pottery_pager_remove_at_bulk(pottery_pager_t* pager, size_t index, size_t count) {
+    pottery_pager_entry_t entry = pottery_pager_select(pager, index);
+    size_t i;
+    for (i = 0; i < count; ++i) {
+        pottery_pager_lifecycle_destroy(pottery_pager_entry_ref(pager, entry));
+        entry = pottery_pager_next(pager, entry);
+    }
+    pottery_pager_displace_at_bulk(pager, index, count);
+}
+#endif
+#endif
+
 #if POTTERY_LIFECYCLE_CAN_PASS
 POTTERY_PAGER_EXTERN
 pottery_error_t pottery_pager_insert_last_bulk(pottery_pager_t* pager,
@@ -55,6 +55,7 @@
 #define pottery_pager_release_page POTTERY_PAGER_NAME(_release_page)
 #define pottery_pager_destroy_all POTTERY_PAGER_NAME(_destroy_all)
 #define pottery_pager_set_clear POTTERY_PAGER_NAME(_set_clear)
+#define pottery_pager_move_range POTTERY_PAGER_NAME(_move_range)
 
 // common array types and functions
 //!!! AUTOGENERATED:container/rename.m.h SRC:pottery_pager DEST:POTTERY_PAGER_PREFIX
@@ -86,7 +87,11 @@
     #define pottery_pager_is_empty POTTERY_CONCAT(POTTERY_PAGER_PREFIX, _is_empty)
     #define pottery_pager_at POTTERY_CONCAT(POTTERY_PAGER_PREFIX, _at)
     #define pottery_pager_find POTTERY_CONCAT(POTTERY_PAGER_PREFIX, _find)
+    #define pottery_pager_find_with_hash POTTERY_CONCAT(POTTERY_PAGER_PREFIX, _find_with_hash)
     #define pottery_pager_contains_key POTTERY_CONCAT(POTTERY_PAGER_PREFIX, _contains_key)
+    #define pottery_pager_contains_key_with_hash POTTERY_CONCAT(POTTERY_PAGER_PREFIX, _contains_key_with_hash)
+    #define pottery_pager_find_bulk POTTERY_CONCAT(POTTERY_PAGER_PREFIX, _find_bulk)
+    #define pottery_pager_contains_bulk POTTERY_CONCAT(POTTERY_PAGER_PREFIX, _contains_bulk)
     #define pottery_pager_first POTTERY_CONCAT(POTTERY_PAGER_PREFIX, _first)
     #define pottery_pager_last POTTERY_CONCAT(POTTERY_PAGER_PREFIX, _last)
     #define pottery_pager_any POTTERY_CONCAT(POTTERY_PAGER_PREFIX, _any)
@@ -124,6 +129,7 @@
     #define pottery_pager_emplace POTTERY_CONCAT(POTTERY_PAGER_PREFIX, _emplace)
     #define pottery_pager_emplace_at POTTERY_CONCAT(POTTERY_PAGER_PREFIX, _emplace_at)
     #define pottery_pager_emplace_key POTTERY_CONCAT(POTTERY_PAGER_PREFIX, _emplace_key)
+    #define pottery_pager_emplace_key_with_hash POTTERY_CONCAT(POTTERY_PAGER_PREFIX, _emplace_key_with_hash)
     #define pottery_pager_emplace_first POTTERY_CONCAT(POTTERY_PAGER_PREFIX, _emplace_first)
     #define pottery_pager_emplace_last POTTERY_CONCAT(POTTERY_PAGER_PREFIX, _emplace_last)
     #define pottery_pager_emplace_before POTTERY_CONCAT(POTTERY_PAGER_PREFIX, _emplace_before)
@@ -159,6 +165,7 @@
     #define pottery_pager_remove POTTERY_CONCAT(POTTERY_PAGER_PREFIX, _remove)
     #define pottery_pager_remove_at POTTERY_CONCAT(POTTERY_PAGER_PREFIX, _remove_at)
     #define pottery_pager_remove_key POTTERY_CONCAT(POTTERY_PAGER_PREFIX, _remove_key)
+    #define pottery_pager_remove_key_with_hash POTTERY_CONCAT(POTTERY_PAGER_PREFIX, _remove_key_with_hash)
     #define pottery_pager_remove_first POTTERY_CONCAT(POTTERY_PAGER_PREFIX, _remove_first)
     #define pottery_pager_remove_last POTTERY_CONCAT(POTTERY_PAGER_PREFIX, _remove_last)
     #define pottery_pager_remove_and_next POTTERY_CONCAT(POTTERY_PAGER_PREFIX, _remove_and_next)
@@ -242,7 +249,11 @@
     #define pottery_pager_page_ring_is_empty POTTERY_CONCAT(POTTERY_PAGER_NAME(_page_ring), _is_empty)
     #define pottery_pager_page_ring_at POTTERY_CONCAT(POTTERY_PAGER_NAME(_page_ring), _at)
     #define pottery_pager_page_ring_find POTTERY_CONCAT(POTTERY_PAGER_NAME(_page_ring), _find)
+    #define pottery_pager_page_ring_find_with_hash POTTERY_CONCAT(POTTERY_PAGER_NAME(_page_ring), _find_with_hash)
     #define pottery_pager_page_ring_contains_key POTTERY_CONCAT(POTTERY_PAGER_NAME(_page_ring), _contains_key)
+    #define pottery_pager_page_ring_contains_key_with_hash POTTERY_CONCAT(POTTERY_PAGER_NAME(_page_ring), _contains_key_with_hash)
+    #define pottery_pager_page_ring_find_bulk POTTERY_CONCAT(POTTERY_PAGER_NAME(_page_ring), _find_bulk)
+    #define pottery_pager_page_ring_contains_bulk POTTERY_CONCAT(POTTERY_PAGER_NAME(_page_ring), _contains_bulk)
     #define pottery_pager_page_ring_first POTTERY_CONCAT(POTTERY_PAGER_NAME(_page_ring), _first)
     #define pottery_pager_page_ring_last POTTERY_CONCAT(POTTERY_PAGER_NAME(_page_ring), _last)
     #define pottery_pager_page_ring_any POTTERY_CONCAT(POTTERY_PAGER_NAME(_page_ring), _any)
@@ -280,6 +291,7 @@
     #define pottery_pager_page_ring_emplace POTTERY_CONCAT(POTTERY_PAGER_NAME(_page_ring), _emplace)
     #define pottery_pager_page_ring_emplace_at POTTERY_CONCAT(POTTERY_PAGER_NAME(_page_ring), _emplace_at)
     #define pottery_pager_page_ring_emplace_key POTTERY_CONCAT(POTTERY_PAGER_NAME(_page_ring), _emplace_key)
+    #define pottery_pager_page_ring_emplace_key_with_hash POTTERY_CONCAT(POTTERY_PAGER_NAME(_page_ring), _emplace_key_with_hash)
     #define pottery_pager_page_ring_emplace_first POTTERY_CONCAT(POTTERY_PAGER_NAME(_page_ring), _emplace_first)
     #define pottery_pager_page_ring_emplace_last POTTERY_CONCAT(POTTERY_PAGER_NAME(_page_ring), _emplace_last)
     #define pottery_pager_page_ring_emplace_before POTTERY_CONCAT(POTTERY_PAGER_NAME(_page_ring), _emplace_before)
@@ -315,6 +327,7 @@
     #define pottery_pager_page_ring_remove POTTERY_CONCAT(POTTERY_PAGER_NAME(_page_ring), _remove)
     #define pottery_pager_page_ring_remove_at POTTERY_CONCAT(POTTERY_PAGER_NAME(_page_ring), _remove_at)
     #define pottery_pager_page_ring_remove_key POTTERY_CONCAT(POTTERY_PAGER_NAME(_page_ring), _remove_key)
+    #define pottery_pager_page_ring_remove_key_with_hash POTTERY_CONCAT(POTTERY_PAGER_NAME(_page_ring), _remove_key_with_hash)
     #define pottery_pager_page_ring_remove_first POTTERY_CONCAT(POTTERY_PAGER_NAME(_page_ring), _remove_first)
     #define pottery_pager_page_ring_remove_last POTTERY_CONCAT(POTTERY_PAGER_NAME(_page_ring), _remove_last)
     #define pottery_pager_page_ring_remove_and_next POTTERY_CONCAT(POTTERY_PAGER_NAME(_page_ring), _remove_and_next)
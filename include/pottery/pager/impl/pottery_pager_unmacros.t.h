@@ -44,6 +44,7 @@
 #undef pottery_pager_release_page
 #undef pottery_pager_destroy_all
 #undef pottery_pager_set_clear
+#undef pottery_pager_move_range
 
 // common array types and functions
 //!!! AUTOGENERATED:container/unrename.m.h PREFIX:pottery_pager
@@ -75,7 +76,11 @@
     #undef pottery_pager_is_empty
     #undef pottery_pager_at
     #undef pottery_pager_find
+    #undef pottery_pager_find_with_hash
     #undef pottery_pager_contains_key
+    #undef pottery_pager_contains_key_with_hash
+    #undef pottery_pager_find_bulk
+    #undef pottery_pager_contains_bulk
     #undef pottery_pager_first
     #undef pottery_pager_last
     #undef pottery_pager_any
@@ -113,6 +118,7 @@
     #undef pottery_pager_emplace
     #undef pottery_pager_emplace_at
     #undef pottery_pager_emplace_key
+    #undef pottery_pager_emplace_key_with_hash
     #undef pottery_pager_emplace_first
     #undef pottery_pager_emplace_last
     #undef pottery_pager_emplace_before
@@ -148,6 +154,7 @@
     #undef pottery_pager_remove
     #undef pottery_pager_remove_at
     #undef pottery_pager_remove_key
+    #undef pottery_pager_remove_key_with_hash
     #undef pottery_pager_remove_first
     #undef pottery_pager_remove_last
     #undef pottery_pager_remove_and_next
@@ -270,7 +277,11 @@
     #undef pottery_pager_page_ring_is_empty
     #undef pottery_pager_page_ring_at
     #undef pottery_pager_page_ring_find
+    #undef pottery_pager_page_ring_find_with_hash
     #undef pottery_pager_page_ring_contains_key
+    #undef pottery_pager_page_ring_contains_key_with_hash
+    #undef pottery_pager_page_ring_find_bulk
+    #undef pottery_pager_page_ring_contains_bulk
     #undef pottery_pager_page_ring_first
     #undef pottery_pager_page_ring_last
     #undef pottery_pager_page_ring_any
@@ -308,6 +319,7 @@
     #undef pottery_pager_page_ring_emplace
     #undef pottery_pager_page_ring_emplace_at
     #undef pottery_pager_page_ring_emplace_key
+    #undef pottery_pager_page_ring_emplace_key_with_hash
     #undef pottery_pager_page_ring_emplace_first
     #undef pottery_pager_page_ring_emplace_last
     #undef pottery_pager_page_ring_emplace_before
@@ -343,6 +355,7 @@
     #undef pottery_pager_page_ring_remove
     #undef pottery_pager_page_ring_remove_at
     #undef pottery_pager_page_ring_remove_key
+    #undef pottery_pager_page_ring_remove_key_with_hash
     #undef pottery_pager_page_ring_remove_first
     #undef pottery_pager_page_ring_remove_last
     #undef pottery_pager_page_ring_remove_and_next
@@ -0,0 +1,208 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2020-2021 11037650 Canada Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef POTTERY_PERFECT_HASH_MAP_IMPL
+#error "This is an internal header. Do not include it."
+#endif
+
+typedef pottery_phm_ref_t pottery_phm_entry_t;
+
+/*
+ * A static minimal perfect hash map.
+ *
+ * The values are stored densely in an array of exactly `count` slots. Keys are
+ * hashed into buckets and each bucket stores a pilot which, combined with the
+ * hash of a key, gives the slot of its value. A lookup hashes the key, reads
+ * the pilot of its bucket and compares the key in a single slot.
+ *
+ * If `owned` is false, the arrays point into a serialized buffer that the map
+ * doesn't own.
+ */
+typedef struct pottery_phm_t {
+    pottery_phm_value_t* values;
+    uint32_t* pilots;
+    size_t count;
+    size_t bucket_count;
+    uint64_t seed;
+    bool owned;
+} pottery_phm_t;
+
+/**
+ * Initializes an empty map.
+ */
+POTTERY_PERFECT_HASH_MAP_EXTERN
+void pottery_phm_init(pottery_phm_t* map);
+
+POTTERY_PERFECT_HASH_MAP_EXTERN
+void pottery_phm_destroy(pottery_phm_t* map);
+
+/**
+ * Builds the map from an array of values, replacing its contents.
+ *
+ * On success the values are moved into the map; the array is left
+ * uninitialized. On failure the map and the array are unchanged.
+ *
+ * The keys of the values must be unique and must have distinct hashes. This
+ * returns POTTERY_ERROR_FULL if they don't (or if no perfect hash could be
+ * found with the configured number of seeds, which is extremely unlikely with
+ * a good hash function.) It returns POTTERY_ERROR_OVERFLOW if there are 2^31
+ * or more values.
+ */
+POTTERY_PERFECT_HASH_MAP_EXTERN
+pottery_error_t pottery_phm_build(pottery_phm_t* map, pottery_phm_value_t* values, size_t count);
+
+/**
+ * Returns the entry for the given key, or an entry that doesn't exist if the
+ * key is not in the map.
+ *
+ * This compares exactly one key.
+ */
+POTTERY_PERFECT_HASH_MAP_EXTERN
+pottery_phm_entry_t pottery_phm_find(pottery_phm_t* map, pottery_phm_key_t key);
+
+static inline
+bool pottery_phm_entry_exists(pottery_phm_t* map, pottery_phm_entry_t entry) {
+    (void)map;
+    return entry != pottery_null;
+}
+
+static inline
+pottery_phm_value_t* pottery_phm_entry_ref(pottery_phm_t* map, pottery_phm_entry_t entry) {
+    (void)map;
+    return entry;
+}
+
+/**
+ * Returns true if there is a value in the map with this key.
+ */
+static inline
+bool pottery_phm_contains_key(pottery_phm_t* map, pottery_phm_key_t key) {
+    return pottery_phm_entry_exists(map, pottery_phm_find(map, key));
+}
+
+static inline
+size_t pottery_phm_count(pottery_phm_t* map) {
+    return map->count;
+}
+
+static inline
+bool pottery_phm_is_empty(pottery_phm_t* map) {
+    return map->count == 0;
+}
+
+/**
+ * Returns the number of buckets (i.e. pilots) in the map.
+ */
+static inline
+size_t pottery_phm_bucket_count(pottery_phm_t* map) {
+    return map->bucket_count;
+}
+
+
+
+/*
+ * Serialization
+ *
+ * The map can be written to a flat buffer and later used in place from that
+ * buffer (for example one mapped from a file) without building it again. The
+ * values are copied byte for byte so this only makes sense for values that
+ * don't contain pointers. The buffer is only readable on platforms with the
+ * same byte order and value layout.
+ */
+
+/**
+ * Returns the size in bytes of the serialized map.
+ */
+POTTERY_PERFECT_HASH_MAP_EXTERN
+size_t pottery_phm_serialized_size(pottery_phm_t* map);
+
+/**
+ * Writes the map to the given buffer, which must be at least
+ * serialized_size() bytes.
+ */
+POTTERY_PERFECT_HASH_MAP_EXTERN
+void pottery_phm_serialize(pottery_phm_t* map, void* buffer);
+
+/**
+ * Initializes a map that reads from a serialized buffer in place.
+ *
+ * The buffer must be aligned for the value type and must outlive the map. The
+ * values are not destroyed when the map is destroyed. The map must not be
+ * modified (i.e. rebuilt) while it refers to the buffer.
+ *
+ * This returns POTTERY_ERROR_INVALID if the buffer is misaligned, too small or
+ * was not serialized by a map of the same value type.
+ */
+POTTERY_PERFECT_HASH_MAP_EXTERN
+pottery_error_t pottery_phm_init_serialized(pottery_phm_t* map,
+        const void* buffer, size_t size);
+
+
+
+/*
+ * Iteration
+ *
+ * Values are visited in slot order. The end entry is null.
+ */
+
+static inline
+pottery_phm_entry_t pottery_phm_begin(pottery_phm_t* map) {
+    if (map->count == 0)
+        return pottery_null;
+    return map->values;
+}
+
+static inline
+pottery_phm_entry_t pottery_phm_end(pottery_phm_t* map) {
+    (void)map;
+    return pottery_null;
+}
+
+static inline
+pottery_phm_entry_t pottery_phm_first(pottery_phm_t* map) {
+    pottery_assert(map->count != 0);
+    return map->values;
+}
+
+static inline
+pottery_phm_entry_t pottery_phm_last(pottery_phm_t* map) {
+    pottery_assert(map->count != 0);
+    return map->values + map->count - 1;
+}
+
+static inline
+pottery_phm_entry_t pottery_phm_next(pottery_phm_t* map, pottery_phm_entry_t entry) {
+    pottery_assert(entry != pottery_null);
+    if (entry == map->values + map->count - 1)
+        return pottery_null;
+    return entry + 1;
+}
+
+static inline
+pottery_phm_entry_t pottery_phm_previous(pottery_phm_t* map, pottery_phm_entry_t entry) {
+    pottery_assert(entry != pottery_null);
+    pottery_assert(entry != map->values);
+    (void)map;
+    return entry - 1;
+}
@@ -0,0 +1,552 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2020-2021 11037650 Canada Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef POTTERY_PERFECT_HASH_MAP_IMPL
+#error "This is an internal header. Do not include it."
+#endif
+
+// A pilot with this bit set stores the slot of its bucket's only key
+// directly.
+#define POTTERY_PERFECT_HASH_MAP_DIRECT 0x80000000u
+
+// The serialized header: magic, value size, count, bucket count and seed.
+#define POTTERY_PERFECT_HASH_MAP_MAGIC 0x314D4850u // "PHM1" little-endian
+#define POTTERY_PERFECT_HASH_MAP_HEADER_SIZE 32
+
+static inline
+size_t pottery_phm_impl_key_hash(pottery_phm_key_t key) {
+    return POTTERY_PERFECT_HASH_MAP_KEY_HASH(key);
+}
+
+static inline
+bool pottery_phm_impl_key_equal(pottery_phm_key_t left, pottery_phm_key_t right) {
+    return POTTERY_PERFECT_HASH_MAP_KEY_EQUAL(left, right);
+}
+
+static inline
+pottery_phm_key_t pottery_phm_impl_key(pottery_phm_value_t* value) {
+    return pottery_phm_ref_key(value);
+}
+
+
+
+/*
+ * Hashing
+ *
+ * The hash of a key is mixed with the seed of the map. The high 32 bits of the
+ * result choose its bucket and the low 32 bits, mixed again with a hash of
+ * the bucket's pilot, choose its slot. Building the map is a search for a pilot
+ * for each bucket that sends all of its keys to free slots.
+ *
+ * Buckets are placed largest first so that the hardest ones are placed while
+ * the table is mostly empty. Buckets with a single key are placed last and
+ * store their slot directly in their pilot so that the last few free slots
+ * don't have to be found by chance.
+ */
+
+// The MurmurHash3 64-bit finalizer
+static inline
+uint64_t pottery_phm_impl_mix(uint64_t seed, uint64_t hash) {
+    uint64_t x = hash ^ seed;
+    x ^= x >> 33;
+    x *= UINT64_C(0xff51afd7ed558ccd);
+    x ^= x >> 33;
+    x *= UINT64_C(0xc4ceb9fe1a85ec53);
+    x ^= x >> 33;
+    return x;
+}
+
+// Maps a 32-bit hash onto [0, range) with a multiply and shift (range must
+// fit in 32 bits.)
+static inline
+size_t pottery_phm_impl_reduce(uint32_t hash, size_t range) {
+    return pottery_cast(size_t, (pottery_cast(uint64_t, hash) * pottery_cast(uint64_t, range)) >> 32);
+}
+
+static inline
+uint32_t pottery_phm_impl_pilot_hash(uint32_t pilot) {
+    return pottery_cast(uint32_t, pottery_phm_impl_mix(0, pilot));
+}
+
+static inline
+size_t pottery_phm_impl_bucket(uint64_t mixed, size_t bucket_count) {
+    return pottery_phm_impl_reduce(pottery_cast(uint32_t, mixed >> 32), bucket_count);
+}
+
+static inline
+size_t pottery_phm_impl_slot(uint64_t mixed, uint32_t pilot, size_t count) {
+    if (pilot & POTTERY_PERFECT_HASH_MAP_DIRECT)
+        return pottery_cast(size_t, pilot & ~POTTERY_PERFECT_HASH_MAP_DIRECT);
+    // The XOR must be mixed again, otherwise keys that share their high bits
+    // would land together with every pilot.
+    return pottery_phm_impl_reduce(pottery_cast(uint32_t, pottery_phm_impl_mix(
+            pottery_phm_impl_pilot_hash(pilot), pottery_cast(uint32_t, mixed))), count);
+}
+
+
+
+/*
+ * Building
+ */
+
+// Temporary arrays used while building the map.
+typedef struct pottery_phm_impl_build_t {
+    size_t* hashes; // the hash of each key
+    size_t* order;  // the index of each key, grouped by bucket
+    size_t* starts; // the start of each bucket in order, plus the end
+    size_t* sorted; // the buckets sorted by decreasing size
+    size_t* sizes;  // a histogram of bucket sizes
+    uint32_t* slots; // the slot of each key
+    uint32_t* pilots;
+    uint64_t* taken; // a bit for each slot
+} pottery_phm_impl_build_t;
+
+static inline
+void pottery_phm_impl_free(void* ptr, size_t alignment) {
+    if (ptr != pottery_null)
+        pottery_phm_alloc_free(alignment, ptr);
+}
+
+static
+void pottery_phm_impl_free_build(pottery_phm_impl_build_t* build) {
+    pottery_phm_impl_free(build->hashes, pottery_alignof(size_t));
+    pottery_phm_impl_free(build->order, pottery_alignof(size_t));
+    pottery_phm_impl_free(build->starts, pottery_alignof(size_t));
+    pottery_phm_impl_free(build->sorted, pottery_alignof(size_t));
+    pottery_phm_impl_free(build->sizes, pottery_alignof(size_t));
+    pottery_phm_impl_free(build->slots, pottery_alignof(uint32_t));
+    pottery_phm_impl_free(build->pilots, pottery_alignof(uint32_t));
+    pottery_phm_impl_free(build->taken, pottery_alignof(uint64_t));
+}
+
+// Searches for a pilot that sends all keys of a bucket to free slots. Returns
+// false if none is found within the pilot limit.
+//
+// If two keys in the bucket have the same hash they can never be separated so
+// we set collision.
+static
+bool pottery_phm_impl_place_bucket(pottery_phm_impl_build_t* build,
+        size_t bucket, size_t count, uint64_t seed, bool* collision)
+{
+    size_t start = build->starts[bucket];
+    size_t size = build->starts[bucket + 1] - start;
+    uint32_t pilot;
+    size_t i, j;
+
+    // Keys with the same low bits will collide with every pilot.
+    for (i = 1; i < size; ++i) {
+        size_t hash_i = build->hashes[build->order[start + i]];
+        uint32_t low_i = pottery_cast(uint32_t, pottery_phm_impl_mix(seed, hash_i));
+        for (j = 0; j < i; ++j) {
+            size_t hash_j = build->hashes[build->order[start + j]];
+            if (low_i == pottery_cast(uint32_t, pottery_phm_impl_mix(seed, hash_j))) {
+                if (hash_i == hash_j)
+                    *collision = true;
+                return false;
+            }
+        }
+    }
+
+    for (pilot = 0; pilot < POTTERY_PERFECT_HASH_MAP_PILOT_LIMIT; ++pilot) {
+        for (i = 0; i < size; ++i) {
+            size_t key = build->order[start + i];
+            size_t slot = pottery_phm_impl_slot(
+                    pottery_phm_impl_mix(seed, build->hashes[key]), pilot, count);
+            if (build->taken[slot / 64] & (pottery_cast(uint64_t, 1) << (slot % 64)))
+                break;
+            for (j = 0; j < i; ++j)
+                if (build->slots[build->order[start + j]] == slot)
+                    break;
+            if (j != i)
+                break;
+            build->slots[key] = pottery_cast(uint32_t, slot);
+        }
+
+        if (i == size) {
+            for (i = 0; i < size; ++i) {
+                size_t slot = build->slots[build->order[start + i]];
+                build->taken[slot / 64] |= pottery_cast(uint64_t, 1) << (slot % 64);
+            }
+            build->pilots[bucket] = pilot;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+// Gives each bucket with a single key one of the remaining free slots. The
+// number of free slots is exactly the number of these buckets.
+static
+void pottery_phm_impl_place_singletons(pottery_phm_impl_build_t* build,
+        size_t first, size_t bucket_count)
+{
+    size_t word = 0;
+    size_t i;
+
+    for (i = first; i < bucket_count; ++i) {
+        size_t bucket = build->sorted[i];
+        size_t start = build->starts[bucket];
+        uint64_t free_bits;
+        size_t slot;
+
+        if (build->starts[bucket + 1] == start) {
+            // The remaining buckets are empty.
+            for (; i < bucket_count; ++i)
+                build->pilots[build->sorted[i]] = 0;
+            return;
+        }
+
+        while ((free_bits = ~build->taken[word]) == 0)
+            ++word;
+        slot = word * 64 + pottery_ctz_u64(free_bits);
+        build->taken[word] |= pottery_cast(uint64_t, 1) << (slot % 64);
+        build->slots[build->order[start]] = pottery_cast(uint32_t, slot);
+        build->pilots[bucket] = POTTERY_PERFECT_HASH_MAP_DIRECT | pottery_cast(uint32_t, slot);
+    }
+}
+
+// Tries to find pilots for all buckets with the given seed.
+static
+bool pottery_phm_impl_try_seed(pottery_phm_impl_build_t* build,
+        size_t count, size_t bucket_count, uint64_t seed, bool* collision)
+{
+    size_t i, max_size;
+
+    // Group the keys by bucket with a counting sort. Each start is
+    // incremented past its bucket while filling so we shift them back after.
+    for (i = 0; i <= bucket_count; ++i)
+        build->starts[i] = 0;
+    for (i = 0; i < count; ++i)
+        ++build->starts[pottery_phm_impl_bucket(
+                pottery_phm_impl_mix(seed, build->hashes[i]), bucket_count)];
+    {
+        size_t total = 0;
+        for (i = 0; i < bucket_count; ++i) {
+            size_t size = build->starts[i];
+            build->starts[i] = total;
+            total += size;
+        }
+    }
+    for (i = 0; i < count; ++i) {
+        size_t bucket = pottery_phm_impl_bucket(
+                pottery_phm_impl_mix(seed, build->hashes[i]), bucket_count);
+        build->order[build->starts[bucket]++] = i;
+    }
+    for (i = bucket_count; i > 0; --i)
+        build->starts[i] = build->starts[i - 1];
+    build->starts[0] = 0;
+
+    // Sort the buckets by decreasing size with another counting sort.
+    max_size = 0;
+    for (i = 0; i <= count; ++i)
+        build->sizes[i] = 0;
+    for (i = 0; i < bucket_count; ++i) {
+        size_t size = build->starts[i + 1] - build->starts[i];
+        ++build->sizes[size];
+        if (size > max_size)
+            max_size = size;
+    }
+    {
+        size_t total = 0;
+        size_t size = max_size + 1;
+        while (size-- > 0) {
+            size_t buckets = build->sizes[size];
+            build->sizes[size] = total;
+            total += buckets;
+        }
+    }
+    for (i = 0; i < bucket_count; ++i)
+        build->sorted[build->sizes[build->starts[i + 1] - build->starts[i]]++] = i;
+
+    // Place the buckets.
+    pottery_memset(build->taken, 0, sizeof(uint64_t) * ((count + 63) / 64));
+    for (i = 0; i < bucket_count; ++i) {
+        size_t bucket = build->sorted[i];
+        if (build->starts[bucket + 1] - build->starts[bucket] < 2)
+            break;
+        if (!pottery_phm_impl_place_bucket(build, bucket, count, seed, collision))
+            return false;
+    }
+    pottery_phm_impl_place_singletons(build, i, bucket_count);
+    return true;
+}
+
+POTTERY_PERFECT_HASH_MAP_EXTERN
+void pottery_phm_init(pottery_phm_t* map) {
+    map->values = pottery_null;
+    map->pilots = pottery_null;
+    map->count = 0;
+    map->bucket_count = 0;
+    map->seed = 0;
+    map->owned = true;
+}
+
+POTTERY_PERFECT_HASH_MAP_EXTERN
+void pottery_phm_destroy(pottery_phm_t* map) {
+    if (!map->owned)
+        return;
+
+    #if POTTERY_PERFECT_HASH_MAP_CAN_DESTROY
+    {
+        size_t i;
+        for (i = 0; i < map->count; ++i)
+            pottery_phm_lifecycle_destroy(map->values + i);
+    }
+    #endif
+
+    pottery_phm_impl_free(map->values, pottery_alignof(pottery_phm_value_t));
+    pottery_phm_impl_free(map->pilots, pottery_alignof(uint32_t));
+}
+
+POTTERY_PERFECT_HASH_MAP_EXTERN
+pottery_error_t pottery_phm_build(pottery_phm_t* map, pottery_phm_value_t* values, size_t count) {
+    pottery_phm_impl_build_t build;
+    pottery_phm_value_t* new_values;
+    size_t bucket_count;
+    size_t attempt;
+    bool collision = false;
+    size_t i;
+
+    pottery_assert(map->owned);
+
+    if (count > pottery_cast(size_t, POTTERY_PERFECT_HASH_MAP_DIRECT - 1))
+        return POTTERY_ERROR_OVERFLOW;
+
+    if (count == 0) {
+        pottery_phm_destroy(map);
+        pottery_phm_init(map);
+        return POTTERY_OK;
+    }
+
+    bucket_count = (count + POTTERY_PERFECT_HASH_MAP_BUCKET_SIZE - 1) /
+            POTTERY_PERFECT_HASH_MAP_BUCKET_SIZE;
+
+    build.hashes = pottery_cast(size_t*, pottery_phm_alloc_malloc_array(
+            pottery_alignof(size_t), count, sizeof(size_t)));
+    build.order = pottery_cast(size_t*, pottery_phm_alloc_malloc_array(
+            pottery_alignof(size_t), count, sizeof(size_t)));
+    build.starts = pottery_cast(size_t*, pottery_phm_alloc_malloc_array(
+            pottery_alignof(size_t), bucket_count + 1, sizeof(size_t)));
+    build.sorted = pottery_cast(size_t*, pottery_phm_alloc_malloc_array(
+            pottery_alignof(size_t), bucket_count, sizeof(size_t)));
+    build.sizes = pottery_cast(size_t*, pottery_phm_alloc_malloc_array(
+            pottery_alignof(size_t), count + 1, sizeof(size_t)));
+    build.slots = pottery_cast(uint32_t*, pottery_phm_alloc_malloc_array(
+            pottery_alignof(uint32_t), count, sizeof(uint32_t)));
+    build.pilots = pottery_cast(uint32_t*, pottery_phm_alloc_malloc_array(
+            pottery_alignof(uint32_t), bucket_count, sizeof(uint32_t)));
+    build.taken = pottery_cast(uint64_t*, pottery_phm_alloc_malloc_array(
+            pottery_alignof(uint64_t), (count + 63) / 64, sizeof(uint64_t)));
+    new_values = pottery_cast(pottery_phm_value_t*, pottery_phm_alloc_malloc_array(
+            pottery_alignof(pottery_phm_value_t), count, sizeof(pottery_phm_value_t)));
+
+    if (build.hashes == pottery_null || build.order == pottery_null ||
+            build.starts == pottery_null || build.sorted == pottery_null ||
+            build.sizes == pottery_null || build.slots == pottery_null ||
+            build.pilots == pottery_null || build.taken == pottery_null ||
+            new_values == pottery_null)
+    {
+        pottery_phm_impl_free(new_values, pottery_alignof(pottery_phm_value_t));
+        pottery_phm_impl_free_build(&build);
+        return POTTERY_ERROR_ALLOC;
+    }
+
+    for (i = 0; i < count; ++i)
+        build.hashes[i] = pottery_phm_impl_key_hash(pottery_phm_impl_key(values + i));
+
+    for (attempt = 0; attempt < POTTERY_PERFECT_HASH_MAP_SEED_ATTEMPTS; ++attempt) {
+        uint64_t seed = pottery_cast(uint64_t, attempt) * UINT64_C(0x9E3779B97F4A7C15);
+        if (pottery_phm_impl_try_seed(&build, count, bucket_count, seed, &collision))
+            break;
+        if (collision)
+            break;
+    }
+    if (collision || attempt == POTTERY_PERFECT_HASH_MAP_SEED_ATTEMPTS) {
+        pottery_phm_impl_free(new_values, pottery_alignof(pottery_phm_value_t));
+        pottery_phm_impl_free_build(&build);
+        return POTTERY_ERROR_FULL;
+    }
+
+    // Move the values into their slots.
+    for (i = 0; i < count; ++i)
+        pottery_phm_lifecycle_move_restrict(new_values + build.slots[i], values + i);
+
+    pottery_phm_destroy(map);
+    map->values = new_values;
+    map->pilots = build.pilots;
+    map->count = count;
+    map->bucket_count = bucket_count;
+    map->seed = pottery_cast(uint64_t, attempt) * UINT64_C(0x9E3779B97F4A7C15);
+    map->owned = true;
+
+    build.pilots = pottery_null;
+    pottery_phm_impl_free_build(&build);
+    return POTTERY_OK;
+}
+
+POTTERY_PERFECT_HASH_MAP_EXTERN
+pottery_phm_entry_t pottery_phm_find(pottery_phm_t* map, pottery_phm_key_t key) {
+    uint64_t mixed;
+    pottery_phm_value_t* value;
+
+    if (map->count == 0)
+        return pottery_null;
+
+    mixed = pottery_phm_impl_mix(map->seed, pottery_phm_impl_key_hash(key));
+    value = map->values + pottery_phm_impl_slot(mixed,
+            map->pilots[pottery_phm_impl_bucket(mixed, map->bucket_count)],
+            map->count);
+    if (!pottery_phm_impl_key_equal(key, pottery_phm_impl_key(value)))
+        return pottery_null;
+    return value;
+}
+
+
+
+/*
+ * Serialization
+ */
+
+static inline
+void pottery_phm_impl_write_u32(char* buffer, uint32_t value) {
+    pottery_memcpy(buffer, &value, sizeof(value));
+}
+
+static inline
+void pottery_phm_impl_write_u64(char* buffer, uint64_t value) {
+    pottery_memcpy(buffer, &value, sizeof(value));
+}
+
+static inline
+uint32_t pottery_phm_impl_read_u32(const char* buffer) {
+    uint32_t value;
+    pottery_memcpy(&value, buffer, sizeof(value));
+    return value;
+}
+
+static inline
+uint64_t pottery_phm_impl_read_u64(const char* buffer) {
+    uint64_t value;
+    pottery_memcpy(&value, buffer, sizeof(value));
+    return value;
+}
+
+// Gets the offset of the values in a serialized buffer. They follow the
+// pilots, aligned for the value type.
+//
+// The bucket count may come from an untrusted buffer so this checks for
+// overflow (which is possible on 32-bit platforms.)
+static inline
+pottery_error_t pottery_phm_impl_values_offset(size_t bucket_count, size_t* offset) {
+    size_t align = pottery_alignof(pottery_phm_value_t);
+    size_t pilots_size;
+    *offset = 0;
+    if (pottery_mul_overflow_s(bucket_count, sizeof(uint32_t), &pilots_size) ||
+            pottery_add_overflow_s(pilots_size, POTTERY_PERFECT_HASH_MAP_HEADER_SIZE + align - 1, offset))
+        return POTTERY_ERROR_OVERFLOW;
+    *offset &= ~(align - 1);
+    return POTTERY_OK;
+}
+
+POTTERY_PERFECT_HASH_MAP_EXTERN
+size_t pottery_phm_serialized_size(pottery_phm_t* map) {
+    size_t offset;
+    pottery_error_t error = pottery_phm_impl_values_offset(map->bucket_count, &offset);
+    (void)error;
+    // The map's arrays are in memory so their sizes can't overflow.
+    pottery_assert(error == POTTERY_OK);
+    return offset + map->count * sizeof(pottery_phm_value_t);
+}
+
+POTTERY_PERFECT_HASH_MAP_EXTERN
+void pottery_phm_serialize(pottery_phm_t* map, void* vbuffer) {
+    char* buffer = pottery_cast(char*, vbuffer);
+    size_t offset;
+    pottery_error_t error = pottery_phm_impl_values_offset(map->bucket_count, &offset);
+    (void)error;
+    pottery_assert(error == POTTERY_OK);
+
+    pottery_phm_impl_write_u32(buffer, POTTERY_PERFECT_HASH_MAP_MAGIC);
+    pottery_phm_impl_write_u32(buffer + 4, pottery_cast(uint32_t, sizeof(pottery_phm_value_t)));
+    pottery_phm_impl_write_u64(buffer + 8, pottery_cast(uint64_t, map->count));
+    pottery_phm_impl_write_u64(buffer + 16, pottery_cast(uint64_t, map->bucket_count));
+    pottery_phm_impl_write_u64(buffer + 24, map->seed);
+
+    // Zero the padding so the output is deterministic.
+    pottery_memset(buffer + POTTERY_PERFECT_HASH_MAP_HEADER_SIZE, 0,
+            offset - POTTERY_PERFECT_HASH_MAP_HEADER_SIZE);
+    if (map->count != 0) {
+        pottery_memcpy(buffer + POTTERY_PERFECT_HASH_MAP_HEADER_SIZE, map->pilots,
+                map->bucket_count * sizeof(uint32_t));
+        pottery_memcpy(buffer + offset, map->values,
+                map->count * sizeof(pottery_phm_value_t));
+    }
+}
+
+POTTERY_PERFECT_HASH_MAP_EXTERN
+pottery_error_t pottery_phm_init_serialized(pottery_phm_t* map,
+        const void* vbuffer, size_t size)
+{
+    const char* buffer = pottery_cast(const char*, vbuffer);
+    uint64_t count, bucket_count;
+    size_t offset, values_size, i;
+    uint32_t* pilots;
+
+    if (size < POTTERY_PERFECT_HASH_MAP_HEADER_SIZE ||
+            pottery_reinterpret_cast(uintptr_t, buffer) % pottery_alignof(pottery_phm_value_t) != 0 ||
+            pottery_reinterpret_cast(uintptr_t, buffer) % pottery_alignof(uint32_t) != 0 ||
+            pottery_phm_impl_read_u32(buffer) != POTTERY_PERFECT_HASH_MAP_MAGIC ||
+            pottery_phm_impl_read_u32(buffer + 4) != sizeof(pottery_phm_value_t))
+        return POTTERY_ERROR_INVALID;
+
+    count = pottery_phm_impl_read_u64(buffer + 8);
+    bucket_count = pottery_phm_impl_read_u64(buffer + 16);
+    if (count >= POTTERY_PERFECT_HASH_MAP_DIRECT || bucket_count > count ||
+            (count == 0) != (bucket_count == 0))
+        return POTTERY_ERROR_INVALID;
+
+    if (pottery_phm_impl_values_offset(pottery_cast(size_t, bucket_count), &offset) != POTTERY_OK ||
+            pottery_mul_overflow_s(pottery_cast(size_t, count), sizeof(pottery_phm_value_t), &values_size) ||
+            offset > size || values_size > size - offset)
+        return POTTERY_ERROR_INVALID;
+
+    // Direct pilots must point within the values so that lookups stay in
+    // bounds.
+    pilots = pottery_const_cast(uint32_t*, pottery_reinterpret_cast(const uint32_t*,
+            buffer + POTTERY_PERFECT_HASH_MAP_HEADER_SIZE));
+    for (i = 0; i < bucket_count; ++i)
+        if ((pilots[i] & POTTERY_PERFECT_HASH_MAP_DIRECT) &&
+                (pilots[i] & ~POTTERY_PERFECT_HASH_MAP_DIRECT) >= count)
+            return POTTERY_ERROR_INVALID;
+
+    map->values = count == 0 ? pottery_null : pottery_const_cast(pottery_phm_value_t*,
+            pottery_reinterpret_cast(const pottery_phm_value_t*, buffer + offset));
+    map->pilots = count == 0 ? pottery_null : pilots;
+    map->count = pottery_cast(size_t, count);
+    map->bucket_count = pottery_cast(size_t, bucket_count);
+    map->seed = pottery_phm_impl_read_u64(buffer + 24);
+    map->owned = false;
+    return POTTERY_OK;
+}
@@ -0,0 +1,229 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2020-2021 11037650 Canada Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef POTTERY_PERFECT_HASH_MAP_IMPL
+#error "This is an internal header. Do not include it."
+#endif
+
+#include "pottery/pottery_dependencies.h"
+#include "pottery/platform/pottery_platform_pragma_push.t.h"
+
+
+
+/*
+ * Configuration
+ */
+
+#ifndef POTTERY_PERFECT_HASH_MAP_PREFIX
+#error "POTTERY_PERFECT_HASH_MAP_PREFIX is not defined."
+#endif
+
+#ifndef POTTERY_PERFECT_HASH_MAP_VALUE_TYPE
+#error "POTTERY_PERFECT_HASH_MAP_VALUE_TYPE is not defined."
+#endif
+
+#ifndef POTTERY_PERFECT_HASH_MAP_KEY_HASH
+#error "POTTERY_PERFECT_HASH_MAP_KEY_HASH is not defined."
+#endif
+
+#ifndef POTTERY_PERFECT_HASH_MAP_KEY_EQUAL
+#error "POTTERY_PERFECT_HASH_MAP_KEY_EQUAL is not defined."
+#endif
+
+#ifdef POTTERY_PERFECT_HASH_MAP_CONTEXT_TYPE
+#error "perfect_hash_map does not support a context yet."
+#endif
+
+#ifndef POTTERY_PERFECT_HASH_MAP_EXTERN
+#define POTTERY_PERFECT_HASH_MAP_EXTERN /*nothing*/
+#endif
+
+// Values are moved from the array they're built from into their slots.
+#if !POTTERY_LIFECYCLE_CAN_MOVE
+    #error "perfect_hash_map requires a move expression."
+#endif
+
+// Bucket size
+// Keys are divided into buckets of this many keys on average and each bucket
+// stores a 32-bit pilot. Larger buckets use less memory but take longer to
+// build.
+#ifndef POTTERY_PERFECT_HASH_MAP_BUCKET_SIZE
+    #define POTTERY_PERFECT_HASH_MAP_BUCKET_SIZE 4
+#endif
+#if POTTERY_PERFECT_HASH_MAP_BUCKET_SIZE < 1
+    #error "BUCKET_SIZE must be at least 1."
+#endif
+
+// Pilot limit
+// This is the number of pilots we try for a bucket before giving up on a seed
+// and starting over with the next one.
+#ifndef POTTERY_PERFECT_HASH_MAP_PILOT_LIMIT
+    #define POTTERY_PERFECT_HASH_MAP_PILOT_LIMIT 1048576
+#endif
+#if POTTERY_PERFECT_HASH_MAP_PILOT_LIMIT < 1 || POTTERY_PERFECT_HASH_MAP_PILOT_LIMIT > 0x7FFFFFFF
+    #error "PILOT_LIMIT must be between 1 and 2^31-1."
+#endif
+
+// Seed attempts
+// This is the number of seeds we try before the build fails.
+#ifndef POTTERY_PERFECT_HASH_MAP_SEED_ATTEMPTS
+    #define POTTERY_PERFECT_HASH_MAP_SEED_ATTEMPTS 8
+#endif
+#if POTTERY_PERFECT_HASH_MAP_SEED_ATTEMPTS < 1
+    #error "SEED_ATTEMPTS must be at least 1."
+#endif
+
+#if POTTERY_LIFECYCLE_CAN_DESTROY
+    #define POTTERY_PERFECT_HASH_MAP_CAN_DESTROY 1
+#else
+    #define POTTERY_PERFECT_HASH_MAP_CAN_DESTROY 0
+#endif
+
+
+
+/*
+ * Renaming
+ */
+
+#define POTTERY_PERFECT_HASH_MAP_NAME(name) \
+    POTTERY_CONCAT(POTTERY_PERFECT_HASH_MAP_PREFIX, name)
+
+#define pottery_phm_t POTTERY_PERFECT_HASH_MAP_NAME(_t)
+#define pottery_phm_entry_t POTTERY_PERFECT_HASH_MAP_NAME(_entry_t)
+#define pottery_phm_impl_build_t POTTERY_PERFECT_HASH_MAP_NAME(_impl_build_t)
+#define pottery_phm_impl_key_hash POTTERY_PERFECT_HASH_MAP_NAME(_impl_key_hash)
+#define pottery_phm_impl_key_equal POTTERY_PERFECT_HASH_MAP_NAME(_impl_key_equal)
+#define pottery_phm_impl_key POTTERY_PERFECT_HASH_MAP_NAME(_impl_key)
+#define pottery_phm_impl_mix POTTERY_PERFECT_HASH_MAP_NAME(_impl_mix)
+#define pottery_phm_impl_reduce POTTERY_PERFECT_HASH_MAP_NAME(_impl_reduce)
+#define pottery_phm_impl_pilot_hash POTTERY_PERFECT_HASH_MAP_NAME(_impl_pilot_hash)
+#define pottery_phm_impl_bucket POTTERY_PERFECT_HASH_MAP_NAME(_impl_bucket)
+#define pottery_phm_impl_slot POTTERY_PERFECT_HASH_MAP_NAME(_impl_slot)
+#define pottery_phm_impl_free_build POTTERY_PERFECT_HASH_MAP_NAME(_impl_free_build)
+#define pottery_phm_impl_try_seed POTTERY_PERFECT_HASH_MAP_NAME(_impl_try_seed)
+#define pottery_phm_impl_place_bucket POTTERY_PERFECT_HASH_MAP_NAME(_impl_place_bucket)
+#define pottery_phm_impl_place_singletons POTTERY_PERFECT_HASH_MAP_NAME(_impl_place_singletons)
+#define pottery_phm_impl_values_offset POTTERY_PERFECT_HASH_MAP_NAME(_impl_values_offset)
+#define pottery_phm_impl_read_u32 POTTERY_PERFECT_HASH_MAP_NAME(_impl_read_u32)
+#define pottery_phm_impl_read_u64 POTTERY_PERFECT_HASH_MAP_NAME(_impl_read_u64)
+#define pottery_phm_impl_write_u32 POTTERY_PERFECT_HASH_MAP_NAME(_impl_write_u32)
+#define pottery_phm_impl_write_u64 POTTERY_PERFECT_HASH_MAP_NAME(_impl_write_u64)
+#define pottery_phm_impl_free POTTERY_PERFECT_HASH_MAP_NAME(_impl_free)
+#define pottery_phm_init POTTERY_PERFECT_HASH_MAP_NAME(_init)
+#define pottery_phm_destroy POTTERY_PERFECT_HASH_MAP_NAME(_destroy)
+#define pottery_phm_build POTTERY_PERFECT_HASH_MAP_NAME(_build)
+#define pottery_phm_find POTTERY_PERFECT_HASH_MAP_NAME(_find)
+#define pottery_phm_contains_key POTTERY_PERFECT_HASH_MAP_NAME(_contains_key)
+#define pottery_phm_count POTTERY_PERFECT_HASH_MAP_NAME(_count)
+#define pottery_phm_is_empty POTTERY_PERFECT_HASH_MAP_NAME(_is_empty)
+#define pottery_phm_bucket_count POTTERY_PERFECT_HASH_MAP_NAME(_bucket_count)
+#define pottery_phm_entry_exists POTTERY_PERFECT_HASH_MAP_NAME(_entry_exists)
+#define pottery_phm_entry_ref POTTERY_PERFECT_HASH_MAP_NAME(_entry_ref)
+#define pottery_phm_begin POTTERY_PERFECT_HASH_MAP_NAME(_begin)
+#define pottery_phm_end POTTERY_PERFECT_HASH_MAP_NAME(_end)
+#define pottery_phm_first POTTERY_PERFECT_HASH_MAP_NAME(_first)
+#define pottery_phm_last POTTERY_PERFECT_HASH_MAP_NAME(_last)
+#define pottery_phm_next POTTERY_PERFECT_HASH_MAP_NAME(_next)
+#define pottery_phm_previous POTTERY_PERFECT_HASH_MAP_NAME(_previous)
+#define pottery_phm_serialized_size POTTERY_PERFECT_HASH_MAP_NAME(_serialized_size)
+#define pottery_phm_serialize POTTERY_PERFECT_HASH_MAP_NAME(_serialize)
+#define pottery_phm_init_serialized POTTERY_PERFECT_HASH_MAP_NAME(_init_serialized)
+
+
+
+// alloc functions
+#define POTTERY_PERFECT_HASH_MAP_ALLOC_PREFIX POTTERY_CONCAT(POTTERY_PERFECT_HASH_MAP_PREFIX, _alloc)
+//!!! AUTOGENERATED:alloc/rename.m.h SRC:pottery_phm_alloc DEST:POTTERY_PERFECT_HASH_MAP_ALLOC_PREFIX
+    // This block is auto-generated. Do not modify until END_AUTOGENERATED.
+    // Renames alloc identifiers from pottery_phm_alloc to POTTERY_PERFECT_HASH_MAP_ALLOC_PREFIX
+
+    #define pottery_phm_alloc_free POTTERY_CONCAT(POTTERY_PERFECT_HASH_MAP_ALLOC_PREFIX, _free)
+    #define pottery_phm_alloc_impl_free_ea POTTERY_CONCAT(POTTERY_PERFECT_HASH_MAP_ALLOC_PREFIX, _impl_free_ea)
+    #define pottery_phm_alloc_impl_free_fa POTTERY_CONCAT(POTTERY_PERFECT_HASH_MAP_ALLOC_PREFIX, _impl_free_fa)
+
+    #define pottery_phm_alloc_malloc POTTERY_CONCAT(POTTERY_PERFECT_HASH_MAP_ALLOC_PREFIX, _malloc)
+    #define pottery_phm_alloc_impl_malloc_ea POTTERY_CONCAT(POTTERY_PERFECT_HASH_MAP_ALLOC_PREFIX, _impl_malloc_ea)
+    #define pottery_phm_alloc_impl_malloc_fa POTTERY_CONCAT(POTTERY_PERFECT_HASH_MAP_ALLOC_PREFIX, _impl_malloc_fa)
+
+    #define pottery_phm_alloc_malloc_zero POTTERY_CONCAT(POTTERY_PERFECT_HASH_MAP_ALLOC_PREFIX, _malloc_zero)
+    #define pottery_phm_alloc_impl_malloc_zero_ea POTTERY_CONCAT(POTTERY_PERFECT_HASH_MAP_ALLOC_PREFIX, _impl_malloc_zero_ea)
+    #define pottery_phm_alloc_impl_malloc_zero_fa POTTERY_CONCAT(POTTERY_PERFECT_HASH_MAP_ALLOC_PREFIX, _impl_malloc_zero_fa)
+    #define pottery_phm_alloc_impl_malloc_zero_fa_wrap POTTERY_CONCAT(POTTERY_PERFECT_HASH_MAP_ALLOC_PREFIX, _impl_malloc_zero_fa_wrap)
+
+    #define pottery_phm_alloc_malloc_array_at_least POTTERY_CONCAT(POTTERY_PERFECT_HASH_MAP_ALLOC_PREFIX, _malloc_array_at_least)
+    #define pottery_phm_alloc_impl_malloc_array_at_least_ea POTTERY_CONCAT(POTTERY_PERFECT_HASH_MAP_ALLOC_PREFIX, _impl_malloc_array_at_least_ea)
+    #define pottery_phm_alloc_impl_malloc_array_at_least_fa POTTERY_CONCAT(POTTERY_PERFECT_HASH_MAP_ALLOC_PREFIX, _impl_malloc_array_at_least_fa)
+
+    #define pottery_phm_alloc_malloc_array POTTERY_CONCAT(POTTERY_PERFECT_HASH_MAP_ALLOC_PREFIX, _malloc_array)
+    #define pottery_phm_alloc_malloc_array_zero POTTERY_CONCAT(POTTERY_PERFECT_HASH_MAP_ALLOC_PREFIX, _malloc_array_zero)
+//!!! END_AUTOGENERATED
+
+
+
+// container types
+//!!! AUTOGENERATED:container_types/rename.m.h SRC:pottery_phm DEST:POTTERY_PERFECT_HASH_MAP_PREFIX
+    // This block is auto-generated. Do not modify until END_AUTOGENERATED.
+    // Renames container_types template identifiers from pottery_phm to POTTERY_PERFECT_HASH_MAP_PREFIX
+
+    #define pottery_phm_value_t POTTERY_CONCAT(POTTERY_PERFECT_HASH_MAP_PREFIX, _value_t)
+    #define pottery_phm_ref_t POTTERY_CONCAT(POTTERY_PERFECT_HASH_MAP_PREFIX, _ref_t)
+    #define pottery_phm_const_ref_t POTTERY_CONCAT(POTTERY_PERFECT_HASH_MAP_PREFIX, _const_ref_t)
+    #define pottery_phm_key_t POTTERY_CONCAT(POTTERY_PERFECT_HASH_MAP_PREFIX, _key_t)
+    #define pottery_phm_context_t POTTERY_CONCAT(POTTERY_PERFECT_HASH_MAP_PREFIX, _context_t)
+
+    #define pottery_phm_ref_key POTTERY_CONCAT(POTTERY_PERFECT_HASH_MAP_PREFIX, _ref_key)
+    #define pottery_phm_ref_equal POTTERY_CONCAT(POTTERY_PERFECT_HASH_MAP_PREFIX, _ref_equal)
+//!!! END_AUTOGENERATED
+
+
+
+// lifecycle functions
+#define POTTERY_PERFECT_HASH_MAP_LIFECYCLE_PREFIX POTTERY_PERFECT_HASH_MAP_NAME(_lifecycle)
+//!!! AUTOGENERATED:lifecycle/rename.m.h SRC:pottery_phm_lifecycle DEST:POTTERY_PERFECT_HASH_MAP_LIFECYCLE_PREFIX
+    // This block is auto-generated. Do not modify until END_AUTOGENERATED.
+    // Renames lifecycle identifiers from pottery_phm_lifecycle to POTTERY_PERFECT_HASH_MAP_LIFECYCLE_PREFIX
+
+    #define pottery_phm_lifecycle_init_steal POTTERY_CONCAT(POTTERY_PERFECT_HASH_MAP_LIFECYCLE_PREFIX, _init_steal)
+    #define pottery_phm_lifecycle_init_copy POTTERY_CONCAT(POTTERY_PERFECT_HASH_MAP_LIFECYCLE_PREFIX, _init_copy)
+    #define pottery_phm_lifecycle_init POTTERY_CONCAT(POTTERY_PERFECT_HASH_MAP_LIFECYCLE_PREFIX, _init)
+    #define pottery_phm_lifecycle_destroy POTTERY_CONCAT(POTTERY_PERFECT_HASH_MAP_LIFECYCLE_PREFIX, _destroy)
+
+    #define pottery_phm_lifecycle_swap POTTERY_CONCAT(POTTERY_PERFECT_HASH_MAP_LIFECYCLE_PREFIX, _swap)
+    #define pottery_phm_lifecycle_move POTTERY_CONCAT(POTTERY_PERFECT_HASH_MAP_LIFECYCLE_PREFIX, _move)
+    #define pottery_phm_lifecycle_steal POTTERY_CONCAT(POTTERY_PERFECT_HASH_MAP_LIFECYCLE_PREFIX, _steal)
+    #define pottery_phm_lifecycle_copy POTTERY_CONCAT(POTTERY_PERFECT_HASH_MAP_LIFECYCLE_PREFIX, _copy)
+    #define pottery_phm_lifecycle_swap_restrict POTTERY_CONCAT(POTTERY_PERFECT_HASH_MAP_LIFECYCLE_PREFIX, _swap_restrict)
+    #define pottery_phm_lifecycle_move_restrict POTTERY_CONCAT(POTTERY_PERFECT_HASH_MAP_LIFECYCLE_PREFIX, _move_restrict)
+    #define pottery_phm_lifecycle_steal_restrict POTTERY_CONCAT(POTTERY_PERFECT_HASH_MAP_LIFECYCLE_PREFIX, _steal_restrict)
+    #define pottery_phm_lifecycle_copy_restrict POTTERY_CONCAT(POTTERY_PERFECT_HASH_MAP_LIFECYCLE_PREFIX, _copy_restrict)
+
+    #define pottery_phm_lifecycle_destroy_bulk POTTERY_CONCAT(POTTERY_PERFECT_HASH_MAP_LIFECYCLE_PREFIX, _destroy_bulk)
+    #define pottery_phm_lifecycle_move_bulk POTTERY_CONCAT(POTTERY_PERFECT_HASH_MAP_LIFECYCLE_PREFIX, _move_bulk)
+    #define pottery_phm_lifecycle_move_bulk_restrict POTTERY_CONCAT(POTTERY_PERFECT_HASH_MAP_LIFECYCLE_PREFIX, _move_bulk_restrict)
+    #define pottery_phm_lifecycle_move_bulk_restrict_impl POTTERY_CONCAT(POTTERY_PERFECT_HASH_MAP_LIFECYCLE_PREFIX, _move_bulk_restrict_impl)
+    #define pottery_phm_lifecycle_move_bulk_up POTTERY_CONCAT(POTTERY_PERFECT_HASH_MAP_LIFECYCLE_PREFIX, _move_bulk_up)
+    #define pottery_phm_lifecycle_move_bulk_up_impl POTTERY_CONCAT(POTTERY_PERFECT_HASH_MAP_LIFECYCLE_PREFIX, _move_bulk_up_impl)
+    #define pottery_phm_lifecycle_move_bulk_down POTTERY_CONCAT(POTTERY_PERFECT_HASH_MAP_LIFECYCLE_PREFIX, _move_bulk_down)
+    #define pottery_phm_lifecycle_move_bulk_down_impl POTTERY_CONCAT(POTTERY_PERFECT_HASH_MAP_LIFECYCLE_PREFIX, _move_bulk_down_impl)
+//!!! END_AUTOGENERATED
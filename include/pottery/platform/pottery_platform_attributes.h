@@ -90,6 +90,17 @@
 
 
 
+// prefetch
+
+// Hints that the memory at the given address will soon be read.
+#ifdef __GNUC__
+    #define pottery_prefetch(p) __builtin_prefetch(p)
+#else
+    #define pottery_prefetch(p) ((void)(p))
+#endif
+
+
+
 // always_inline
 
 #if defined(_MSC_VER)
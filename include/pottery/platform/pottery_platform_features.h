@@ -207,6 +207,7 @@ typedef int pottery_error_t;
 #define POTTERY_ERROR_OVERFLOW 2 // A math operation overflowed.
 #define POTTERY_ERROR_FULL 3 // A size-limited container is full.
 #define POTTERY_ERROR_CXX_EXCEPTION 4 // An unrecognized C++ exception was caught.
+#define POTTERY_ERROR_INVALID 5 // Input data (e.g. a serialized buffer) is malformed.
 
 
 
@@ -120,6 +120,65 @@ static inline bool pottery_mul_overflow_s(size_t a, size_t b, size_t* out) {
     #undef POTTERY_MUL_OVERFLOW_S_DEFINED
     #endif
 }
+
+/**
+ * Places a plus b in out.
+ *
+ * Returns true if the addition overflowed, false if it is safe.
+ */
+static inline bool pottery_add_overflow_s(size_t a, size_t b, size_t* out) {
+    *out = a + b;
+    return *out < a;
+}
+
+/**
+ * Returns the number of trailing zero bits in the given non-zero value.
+ */
+static inline size_t pottery_ctz_u32(uint32_t value) {
+    pottery_assert(value != 0);
+    #if defined(__GNUC__)
+        return pottery_cast(size_t, __builtin_ctz(pottery_cast(unsigned, value)));
+    #else
+        size_t count = 0;
+        while ((value & 1) == 0) {
+            value >>= 1;
+            ++count;
+        }
+        return count;
+    #endif
+}
+
+/**
+ * Returns the number of trailing zero bits in the given non-zero value.
+ */
+static inline size_t pottery_ctz_u64(uint64_t value) {
+    pottery_assert(value != 0);
+    #if defined(__GNUC__) && defined(__LP64__)
+        return pottery_cast(size_t, __builtin_ctzl(pottery_cast(unsigned long, value)));
+    #else
+        uint32_t low = pottery_cast(uint32_t, value);
+        if (low != 0)
+            return pottery_ctz_u32(low);
+        return 32 + pottery_ctz_u32(pottery_cast(uint32_t, value >> 32));
+    #endif
+}
+
+/**
+ * Returns the number of leading zero bits in the given non-zero value.
+ */
+static inline size_t pottery_clz_u64(uint64_t value) {
+    pottery_assert(value != 0);
+    #if defined(__GNUC__) && defined(__LP64__)
+        return pottery_cast(size_t, __builtin_clzl(pottery_cast(unsigned long, value)));
+    #else
+        size_t count = 0;
+        while ((value & (pottery_cast(uint64_t, 1) << 63)) == 0) {
+            value <<= 1;
+            ++count;
+        }
+        return count;
+    #endif
+}
 #endif
 
 
@@ -221,6 +280,480 @@ static size_t pottery_knuth_hash_s(size_t value, size_t bits) {
 
 
 
+/*
+ * String hashing
+ */
+
+// This is a 64-bit hash in the style of wyhash. It mixes 16 bytes at a time
+// with a 64x64->128-bit multiply, folding the halves of the product together,
+// and longer inputs are hashed in three independent lanes of 16 bytes to keep
+// the multiplier busy. It's much faster than byte-at-a-time hashes like FNV-1a
+// on all but the shortest strings.
+//
+// The input is read in native byte order so the results are different on
+// big-endian machines. It's not a cryptographic hash; use a random seed if
+// your keys might be chosen by an attacker.
+
+#ifndef POTTERY_GENERATE_CODE
+/**
+ * Multiplies a by b, storing the low 64 bits of the product in a and the high
+ * 64 bits in b.
+ */
+static inline void pottery_mul_u64_u128(uint64_t* a, uint64_t* b) {
+    #if defined(__SIZEOF_INT128__)
+        __extension__ unsigned __int128 product = *a;
+        product *= *b;
+        *a = pottery_cast(uint64_t, product);
+        *b = pottery_cast(uint64_t, product >> 64);
+    #elif defined(_MSC_VER) && defined(_M_X64)
+        *a = _umul128(*a, *b, b);
+    #else
+        uint64_t ha = *a >> 32, hb = *b >> 32;
+        uint64_t la = pottery_cast(uint32_t, *a), lb = pottery_cast(uint32_t, *b);
+        uint64_t rh = ha * hb, rm0 = ha * lb, rm1 = hb * la, rl = la * lb;
+        uint64_t t = rl + (rm0 << 32);
+        uint64_t lo = t + (rm1 << 32);
+        uint64_t carry = pottery_cast(uint64_t, t < rl) + pottery_cast(uint64_t, lo < t);
+        *a = lo;
+        *b = rh + (rm0 >> 32) + (rm1 >> 32) + carry;
+    #endif
+}
+
+static inline uint64_t pottery_hash_mix_u64(uint64_t a, uint64_t b) {
+    pottery_mul_u64_u128(&a, &b);
+    return a ^ b;
+}
+
+static inline uint64_t pottery_hash_read_u64(const unsigned char* p) {
+    uint64_t value;
+    pottery_memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+static inline uint64_t pottery_hash_read_u32(const unsigned char* p) {
+    uint32_t value;
+    pottery_memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+/**
+ * Hashes the given bytes with the given seed.
+ *
+ * The length is mixed into the hash so inputs that differ only in trailing
+ * zeroes hash differently.
+ */
+static inline uint64_t pottery_hash_bytes(const void* data, size_t size, uint64_t seed) {
+    static const uint64_t secret[4] = {
+        UINT64_C(0x2d358dccaa6c78a5), UINT64_C(0x8bb84b93962eacc9),
+        UINT64_C(0x4b33a62ed433d4a3), UINT64_C(0x4d5a2da51de1aa47),
+    };
+    const unsigned char* p = pottery_cast(const unsigned char*, data);
+    uint64_t a, b;
+
+    seed ^= pottery_hash_mix_u64(seed ^ secret[0], secret[1]);
+
+    if (size <= 16) {
+        if (size >= 4) {
+            // Two overlapping pairs of 4-byte reads cover 4 to 16 bytes.
+            size_t offset = (size >> 3) << 2;
+            a = (pottery_hash_read_u32(p) << 32) | pottery_hash_read_u32(p + offset);
+            b = (pottery_hash_read_u32(p + size - 4) << 32) |
+                    pottery_hash_read_u32(p + size - 4 - offset);
+        } else if (size > 0) {
+            a = (pottery_cast(uint64_t, p[0]) << 16) |
+                    (pottery_cast(uint64_t, p[size >> 1]) << 8) |
+                    pottery_cast(uint64_t, p[size - 1]);
+            b = 0;
+        } else {
+            a = 0;
+            b = 0;
+        }
+    } else {
+        size_t remaining = size;
+        if (remaining > 48) {
+            uint64_t lane1 = seed, lane2 = seed;
+            do {
+                seed = pottery_hash_mix_u64(pottery_hash_read_u64(p) ^ secret[1],
+                        pottery_hash_read_u64(p + 8) ^ seed);
+                lane1 = pottery_hash_mix_u64(pottery_hash_read_u64(p + 16) ^ secret[2],
+                        pottery_hash_read_u64(p + 24) ^ lane1);
+                lane2 = pottery_hash_mix_u64(pottery_hash_read_u64(p + 32) ^ secret[3],
+                        pottery_hash_read_u64(p + 40) ^ lane2);
+                p += 48;
+                remaining -= 48;
+            } while (remaining > 48);
+            seed ^= lane1 ^ lane2;
+        }
+        while (remaining > 16) {
+            seed = pottery_hash_mix_u64(pottery_hash_read_u64(p) ^ secret[1],
+                    pottery_hash_read_u64(p + 8) ^ seed);
+            p += 16;
+            remaining -= 16;
+        }
+        // The last 16 bytes, overlapping the previous step if necessary
+        a = pottery_hash_read_u64(p + remaining - 16);
+        b = pottery_hash_read_u64(p + remaining - 8);
+    }
+
+    a ^= secret[1];
+    b ^= seed;
+    pottery_mul_u64_u128(&a, &b);
+    return pottery_hash_mix_u64(a ^ secret[0] ^ pottery_cast(uint64_t, size), b ^ secret[1]);
+}
+
+/**
+ * Hashes the given null-terminated string with the given seed.
+ *
+ * This is the same as hashing its characters (without the null-terminator)
+ * with pottery_hash_bytes(). The length is found with strlen() which is
+ * vectorized in most C libraries.
+ */
+static inline uint64_t pottery_hash_string(const char* string, uint64_t seed) {
+    return pottery_hash_bytes(string, strlen(string), seed);
+}
+
+#if POTTERY_OS_ENTROPY == 3 && !defined(POTTERY_RANDOM_SEED)
+// This matches the declaration in <bcrypt.h>. It returns an NTSTATUS, which
+// is negative on failure.
+long __stdcall BCryptGenRandom(void* algorithm, unsigned char* buffer,
+        unsigned long size, unsigned long flags);
+#endif
+
+/**
+ * Returns a seed for hashing that is hard to predict from outside the
+ * process, mixing in the given salt (e.g. the address of the object being
+ * seeded.)
+ *
+ * By default this asks the operating system for random bytes (see
+ * POTTERY_OS_ENTROPY), in which case the salt is unused. If that isn't
+ * available or fails, it mixes the salt with the addresses of a stack variable
+ * and a function (which are randomized by ASLR on most platforms) and the
+ * processor clock, which is not cryptographically secure. Define
+ * POTTERY_RANDOM_SEED to a function or expression that takes the salt and
+ * returns a uint64_t to use your own source of entropy.
+ */
+static inline uint64_t pottery_random_seed(const void* salt) {
+    #ifdef POTTERY_RANDOM_SEED
+        return POTTERY_RANDOM_SEED(salt);
+    #else
+        uint64_t seed;
+
+        #if POTTERY_OS_ENTROPY == 1
+            // GRND_NONBLOCK makes this fail rather than block if the kernel's
+            // pool isn't initialized yet (e.g. early in boot.)
+            if (getrandom(&seed, sizeof(seed), GRND_NONBLOCK) ==
+                    pottery_cast(ssize_t, sizeof(seed)))
+                return seed;
+        #elif POTTERY_OS_ENTROPY == 2
+            arc4random_buf(&seed, sizeof(seed));
+            return seed;
+        #elif POTTERY_OS_ENTROPY == 3
+            // 2 is BCRYPT_USE_SYSTEM_PREFERRED_RNG.
+            if (BCryptGenRandom(pottery_null,
+                    pottery_reinterpret_cast(unsigned char*, &seed),
+                    pottery_cast(unsigned long, sizeof(seed)), 2) >= 0)
+                return seed;
+        #endif
+
+        seed = pottery_cast(uint64_t, pottery_reinterpret_cast(uintptr_t, salt));
+        seed = pottery_hash_mix_u64(seed ^ pottery_cast(uint64_t,
+                pottery_reinterpret_cast(uintptr_t, &seed)), UINT64_C(0x9E3779B97F4A7C15));
+        seed = pottery_hash_mix_u64(seed ^ pottery_cast(uint64_t,
+                pottery_reinterpret_cast(uintptr_t, &pottery_random_seed)), UINT64_C(0xC2B2AE3D27D4EB4F));
+        return pottery_hash_mix_u64(seed ^ pottery_cast(uint64_t, clock()),
+                UINT64_C(0xD6E8FEB86659FD93));
+    #endif
+}
+#endif
+
+
+
+/*
+ * Metadata groups
+ */
+
+// These are helpers for matching a group of metadata bytes all at once. They
+// are used by hash tables that probe a group of buckets at a time (see the
+// GROUP_PROBING option of open_hash_map.)
+//
+// Each function returns a bitmask of matching bytes in the group, where bit i
+// is set if byte i matches. The group does not need to be aligned.
+//
+// We use SSE2 if it's available (see POTTERY_SSE2 in
+// pottery_platform_headers.h.) Otherwise we fall back to portable SWAR (SIMD
+// within a register) on 64-bit words.
+
+#define POTTERY_GROUP_SIZE 16
+
+#ifndef POTTERY_GENERATE_CODE
+#if !POTTERY_SSE2
+// Loads eight bytes in little-endian order so that bit 8*i of the result
+// holds the low bit of byte i.
+static inline uint64_t pottery_group_load_u64(const uint8_t* bytes) {
+    #if defined(__BYTE_ORDER__) && defined(__ORDER_LITTLE_ENDIAN__)
+        #if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+            #define POTTERY_GROUP_LOAD_U64_DEFINED
+            uint64_t word;
+            pottery_memcpy(&word, bytes, sizeof(word));
+            return word;
+        #endif
+    #endif
+
+    #ifndef POTTERY_GROUP_LOAD_U64_DEFINED
+    uint64_t word = 0;
+    size_t i;
+    for (i = 0; i < 8; ++i)
+        word |= pottery_cast(uint64_t, bytes[i]) << (i * 8);
+    return word;
+    #else
+    #undef POTTERY_GROUP_LOAD_U64_DEFINED
+    #endif
+}
+
+// Gathers the high bit of each byte in the word into the low eight bits.
+static inline uint32_t pottery_group_gather_u64(uint64_t high_bits) {
+    return pottery_cast(uint32_t,
+            ((high_bits >> 7) * UINT64_C(0x0102040810204080)) >> 56);
+}
+
+// Returns a mask of the bytes in the word that are zero. This is exact; it has
+// no false positives caused by borrows between bytes.
+static inline uint32_t pottery_group_zero_bytes_u64(uint64_t word) {
+    uint64_t low_bits = UINT64_C(0x7F7F7F7F7F7F7F7F);
+    return pottery_group_gather_u64(~(((word & low_bits) + low_bits) | word | low_bits));
+}
+#endif
+
+/**
+ * Returns a mask of the bytes in the group that are equal to the given byte.
+ */
+static inline uint32_t pottery_group_match(const uint8_t* group, uint8_t byte) {
+    #if POTTERY_SSE2
+        __m128i bytes = _mm_loadu_si128(pottery_reinterpret_cast(const __m128i*, group));
+        __m128i match = _mm_cmpeq_epi8(bytes, _mm_set1_epi8(pottery_cast(char, byte)));
+        return pottery_cast(uint32_t, _mm_movemask_epi8(match));
+    #else
+        uint64_t repeated = UINT64_C(0x0101010101010101) * pottery_cast(uint64_t, byte);
+        return pottery_group_zero_bytes_u64(pottery_group_load_u64(group) ^ repeated) |
+                (pottery_group_zero_bytes_u64(pottery_group_load_u64(group + 8) ^ repeated) << 8);
+    #endif
+}
+
+/**
+ * Returns a mask of the bytes in the group that have their high bit clear.
+ */
+static inline uint32_t pottery_group_match_high_clear(const uint8_t* group) {
+    #if POTTERY_SSE2
+        __m128i bytes = _mm_loadu_si128(pottery_reinterpret_cast(const __m128i*, group));
+        return pottery_cast(uint32_t, ~_mm_movemask_epi8(bytes) & 0xFFFF);
+    #else
+        uint64_t high_bits = UINT64_C(0x8080808080808080);
+        return pottery_group_gather_u64(~pottery_group_load_u64(group) & high_bits) |
+                (pottery_group_gather_u64(~pottery_group_load_u64(group + 8) & high_bits) << 8);
+    #endif
+}
+#endif
+
+
+
+/*
+ * Atomics
+ */
+
+// These are a minimal set of atomic operations on size_t for templates that
+// can be shared between threads (see sharded_hash_map.) They're only available
+// if POTTERY_ATOMICS is 1 (see pottery_platform_headers.h.)
+//
+// The fences are meant for seqlocks: a writer stores its odd sequence number
+// and then issues a release fence before modifying the protected data, and a
+// reader reads the data and then issues an acquire fence before re-reading
+// the sequence number.
+
+#if POTTERY_ATOMICS && !defined(POTTERY_GENERATE_CODE)
+#if defined(__GNUC__)
+
+static inline size_t pottery_atomic_load_relaxed_s(size_t* p) {
+    return __atomic_load_n(p, __ATOMIC_RELAXED);
+}
+
+static inline size_t pottery_atomic_load_acquire_s(size_t* p) {
+    return __atomic_load_n(p, __ATOMIC_ACQUIRE);
+}
+
+static inline void pottery_atomic_store_relaxed_s(size_t* p, size_t value) {
+    __atomic_store_n(p, value, __ATOMIC_RELAXED);
+}
+
+static inline void pottery_atomic_store_release_s(size_t* p, size_t value) {
+    __atomic_store_n(p, value, __ATOMIC_RELEASE);
+}
+
+static inline size_t pottery_atomic_exchange_acquire_s(size_t* p, size_t value) {
+    return __atomic_exchange_n(p, value, __ATOMIC_ACQUIRE);
+}
+
+// Returns true and stores desired if *p is *expected; otherwise loads *p into
+// *expected. This can fail spuriously so it must be retried in a loop.
+static inline bool pottery_atomic_compare_exchange_weak_relaxed_s(size_t* p,
+        size_t* expected, size_t desired)
+{
+    return __atomic_compare_exchange_n(p, expected, desired, true,
+            __ATOMIC_RELAXED, __ATOMIC_RELAXED);
+}
+
+static inline void pottery_atomic_fence_acquire(void) {
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+}
+
+static inline void pottery_atomic_fence_release(void) {
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+}
+
+#elif defined(_MSC_VER)
+
+// x86 doesn't reorder loads with other loads or stores with other stores so
+// acquire and release only need to stop the compiler from reordering.
+
+static inline size_t pottery_atomic_load_relaxed_s(size_t* p) {
+    return *pottery_cast(volatile size_t*, p);
+}
+
+static inline size_t pottery_atomic_load_acquire_s(size_t* p) {
+    size_t value = *pottery_cast(volatile size_t*, p);
+    _ReadWriteBarrier();
+    return value;
+}
+
+static inline void pottery_atomic_store_relaxed_s(size_t* p, size_t value) {
+    *pottery_cast(volatile size_t*, p) = value;
+}
+
+static inline void pottery_atomic_store_release_s(size_t* p, size_t value) {
+    _ReadWriteBarrier();
+    *pottery_cast(volatile size_t*, p) = value;
+}
+
+static inline size_t pottery_atomic_exchange_acquire_s(size_t* p, size_t value) {
+    #ifdef _M_X64
+    return pottery_cast(size_t, _InterlockedExchange64(
+            pottery_reinterpret_cast(volatile __int64*, p), pottery_cast(__int64, value)));
+    #else
+    return pottery_cast(size_t, _InterlockedExchange(
+            pottery_reinterpret_cast(volatile long*, p), pottery_cast(long, value)));
+    #endif
+}
+
+static inline bool pottery_atomic_compare_exchange_weak_relaxed_s(size_t* p,
+        size_t* expected, size_t desired)
+{
+    #ifdef _M_X64
+    size_t previous = pottery_cast(size_t, _InterlockedCompareExchange64(
+            pottery_reinterpret_cast(volatile __int64*, p),
+            pottery_cast(__int64, desired), pottery_cast(__int64, *expected)));
+    #else
+    size_t previous = pottery_cast(size_t, _InterlockedCompareExchange(
+            pottery_reinterpret_cast(volatile long*, p),
+            pottery_cast(long, desired), pottery_cast(long, *expected)));
+    #endif
+    if (previous == *expected)
+        return true;
+    *expected = previous;
+    return false;
+}
+
+static inline void pottery_atomic_fence_acquire(void) {
+    _ReadWriteBarrier();
+}
+
+static inline void pottery_atomic_fence_release(void) {
+    _ReadWriteBarrier();
+}
+
+#endif
+
+/**
+ * Hints to the processor that we're spinning on a lock.
+ */
+static inline void pottery_atomic_pause(void) {
+    #if defined(_MSC_VER)
+        _mm_pause();
+    #elif defined(__i386__) || defined(__x86_64__)
+        __builtin_ia32_pause();
+    #elif defined(__aarch64__) || (defined(__arm__) && __ARM_ARCH >= 7)
+        __asm__ __volatile__("yield");
+    #endif
+}
+#endif
+
+
+
+/*
+ * Mirrored memory
+ */
+
+// These allocate memory that is mapped twice in a row so that a circular
+// buffer in it can be accessed contiguously across the wraparound (see
+// ring.) They're only available if POTTERY_MIRRORED_MEMORY is 1 (see
+// pottery_platform_headers.h.)
+
+#if POTTERY_MIRRORED_MEMORY && !defined(POTTERY_GENERATE_CODE)
+static inline size_t pottery_page_size(void) {
+    return pottery_cast(size_t, sysconf(_SC_PAGESIZE));
+}
+
+/**
+ * Allocates size bytes of memory followed immediately by a second mapping of
+ * the same memory, i.e. writing to byte i also writes to byte size + i. The
+ * size must be a multiple of the page size.
+ *
+ * Returns null on failure. Free it with pottery_mirror_free().
+ */
+static inline void* pottery_mirror_alloc(size_t size) {
+    pottery_assert(size != 0 && size % pottery_page_size() == 0);
+    if (size > SIZE_MAX / 2 || size > pottery_cast(size_t, PTRDIFF_MAX))
+        return pottery_null;
+
+    int fd = memfd_create("pottery_mirror", MFD_CLOEXEC);
+    if (fd == -1)
+        return pottery_null;
+    if (ftruncate(fd, pottery_cast(off_t, size)) != 0) {
+        close(fd);
+        return pottery_null;
+    }
+
+    // We reserve address space for both halves and then map the file over
+    // each of them.
+    char* base = pottery_cast(char*, mmap(pottery_null, size * 2, PROT_NONE,
+                MAP_PRIVATE | MAP_ANONYMOUS, -1, 0));
+    if (base == MAP_FAILED) {
+        close(fd);
+        return pottery_null;
+    }
+    if (MAP_FAILED == mmap(base, size, PROT_READ | PROT_WRITE,
+                MAP_SHARED | MAP_FIXED, fd, 0) ||
+            MAP_FAILED == mmap(base + size, size, PROT_READ | PROT_WRITE,
+                MAP_SHARED | MAP_FIXED, fd, 0))
+    {
+        munmap(base, size * 2);
+        close(fd);
+        return pottery_null;
+    }
+
+    // The mappings keep the memory alive.
+    close(fd);
+    return base;
+}
+
+/**
+ * Frees memory allocated by pottery_mirror_alloc() with the given size.
+ */
+static inline void pottery_mirror_free(void* ptr, size_t size) {
+    munmap(ptr, size * 2);
+}
+#endif
+
+
+
 /*
  * Memory allocation
  */
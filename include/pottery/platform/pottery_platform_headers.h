@@ -42,6 +42,44 @@ static inline bool POTTERY_YOU_MUST_INCLUDE_DEPENDENCIES_OUTSIDE_OF_NAMESPACES_O
 template <class T> static inline bool POTTERY_SCOPE_ASSERTION(void) { return ::POTTERY_YOU_MUST_INCLUDE_DEPENDENCIES_OUTSIDE_OF_NAMESPACES_OR_EXTERN_C(); /* IMPORTANT: This compiler error means Pottery's dependencies were not included at file scope. You must #include "pottery/pottery_dependencies.h" outside of any class or namespace and outside of any extern "C" block before including pottery template headers within a class, namespace, or extern "C" block. */ }
 #endif
 
+// POTTERY_SSE2 enables the use of SSE2 intrinsics. It's detected automatically
+// on x86 compilers that support it. You can define it to 0 to use only
+// portable code.
+#ifndef POTTERY_SSE2
+    #if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+        #define POTTERY_SSE2 1
+    #else
+        #define POTTERY_SSE2 0
+    #endif
+#endif
+
+// POTTERY_ATOMICS enables the atomic operations in pottery_platform_functions.h
+// which are needed by templates that can be shared between threads. They're
+// implemented with GNU __atomic builtins or with MSVC intrinsics on x86. You
+// can define it to 0 to disable them.
+#ifndef POTTERY_ATOMICS
+    #if defined(__GNUC__) && defined(__ATOMIC_ACQUIRE)
+        #define POTTERY_ATOMICS 1
+    #elif defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+        #define POTTERY_ATOMICS 1
+    #else
+        #define POTTERY_ATOMICS 0
+    #endif
+#endif
+
+// POTTERY_MIRRORED_MEMORY enables pottery_mirror_alloc() in
+// pottery_platform_functions.h, which maps the same memory twice in a row
+// (see ring.) It needs memfd_create() so it's only available on Linux, and
+// only if _GNU_SOURCE is defined before any system headers are included. You
+// can define it to 0 to disable it.
+#ifndef POTTERY_MIRRORED_MEMORY
+    #if defined(__linux__) && defined(_GNU_SOURCE)
+        #define POTTERY_MIRRORED_MEMORY 1
+    #else
+        #define POTTERY_MIRRORED_MEMORY 0
+    #endif
+#endif
+
 // We disable some of the below headers to make manually preprocessed code
 // legible.
 #ifndef POTTERY_GENERATE_CODE
@@ -52,12 +90,51 @@ template <class T> static inline bool POTTERY_SCOPE_ASSERTION(void) { return ::P
 #include <limits.h>
 #include <stdbool.h>
 #include <string.h>
+#include <time.h>
 
 #if defined(__unix__) || defined(__APPLE__)
 // This will help us detect POSIX support
 #include <unistd.h>
 #endif
 
+#if POTTERY_MIRRORED_MEMORY
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+// POTTERY_OS_ENTROPY selects where pottery_random_seed() gets its entropy: 1
+// for getrandom() (glibc 2.25 and later), 2 for arc4random_buf() (the BSDs
+// and Apple) and 3 for BCryptGenRandom() (Windows.) It's 0 if none of these
+// are available, in which case the seed is mixed from addresses and the
+// clock. You can define it to 0 to disable it.
+//
+// 3 is never chosen by default since it requires linking bcrypt.lib. Define
+// it to 3 yourself and link bcrypt.lib to use it. We declare BCryptGenRandom()
+// ourselves so that <windows.h> isn't included.
+#ifndef POTTERY_OS_ENTROPY
+    #if defined(__linux__) && defined(__GLIBC__) && \
+            (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 25))
+        #define POTTERY_OS_ENTROPY 1
+    #elif defined(__APPLE__) || defined(__FreeBSD__) || defined(__OpenBSD__) || \
+            defined(__NetBSD__) || defined(__DragonFly__)
+        #define POTTERY_OS_ENTROPY 2
+    #else
+        #define POTTERY_OS_ENTROPY 0
+    #endif
+#endif
+
+#if POTTERY_OS_ENTROPY == 1
+#include <sys/random.h>
+#endif
+
+#if POTTERY_SSE2
+#include <emmintrin.h>
+#endif
+
+#if defined(_MSC_VER) && (POTTERY_ATOMICS || defined(_M_X64))
+#include <intrin.h>
+#endif
+
 #endif
 
 #endif
@@ -122,7 +122,11 @@
     #define pottery_pq_is_empty POTTERY_CONCAT(POTTERY_PRIORITY_QUEUE_PREFIX, _is_empty)
     #define pottery_pq_at POTTERY_CONCAT(POTTERY_PRIORITY_QUEUE_PREFIX, _at)
     #define pottery_pq_find POTTERY_CONCAT(POTTERY_PRIORITY_QUEUE_PREFIX, _find)
+    #define pottery_pq_find_with_hash POTTERY_CONCAT(POTTERY_PRIORITY_QUEUE_PREFIX, _find_with_hash)
     #define pottery_pq_contains_key POTTERY_CONCAT(POTTERY_PRIORITY_QUEUE_PREFIX, _contains_key)
+    #define pottery_pq_contains_key_with_hash POTTERY_CONCAT(POTTERY_PRIORITY_QUEUE_PREFIX, _contains_key_with_hash)
+    #define pottery_pq_find_bulk POTTERY_CONCAT(POTTERY_PRIORITY_QUEUE_PREFIX, _find_bulk)
+    #define pottery_pq_contains_bulk POTTERY_CONCAT(POTTERY_PRIORITY_QUEUE_PREFIX, _contains_bulk)
     #define pottery_pq_first POTTERY_CONCAT(POTTERY_PRIORITY_QUEUE_PREFIX, _first)
     #define pottery_pq_last POTTERY_CONCAT(POTTERY_PRIORITY_QUEUE_PREFIX, _last)
     #define pottery_pq_any POTTERY_CONCAT(POTTERY_PRIORITY_QUEUE_PREFIX, _any)
@@ -160,6 +164,7 @@
     #define pottery_pq_emplace POTTERY_CONCAT(POTTERY_PRIORITY_QUEUE_PREFIX, _emplace)
     #define pottery_pq_emplace_at POTTERY_CONCAT(POTTERY_PRIORITY_QUEUE_PREFIX, _emplace_at)
     #define pottery_pq_emplace_key POTTERY_CONCAT(POTTERY_PRIORITY_QUEUE_PREFIX, _emplace_key)
+    #define pottery_pq_emplace_key_with_hash POTTERY_CONCAT(POTTERY_PRIORITY_QUEUE_PREFIX, _emplace_key_with_hash)
     #define pottery_pq_emplace_first POTTERY_CONCAT(POTTERY_PRIORITY_QUEUE_PREFIX, _emplace_first)
     #define pottery_pq_emplace_last POTTERY_CONCAT(POTTERY_PRIORITY_QUEUE_PREFIX, _emplace_last)
     #define pottery_pq_emplace_before POTTERY_CONCAT(POTTERY_PRIORITY_QUEUE_PREFIX, _emplace_before)
@@ -195,6 +200,7 @@
     #define pottery_pq_remove POTTERY_CONCAT(POTTERY_PRIORITY_QUEUE_PREFIX, _remove)
     #define pottery_pq_remove_at POTTERY_CONCAT(POTTERY_PRIORITY_QUEUE_PREFIX, _remove_at)
     #define pottery_pq_remove_key POTTERY_CONCAT(POTTERY_PRIORITY_QUEUE_PREFIX, _remove_key)
+    #define pottery_pq_remove_key_with_hash POTTERY_CONCAT(POTTERY_PRIORITY_QUEUE_PREFIX, _remove_key_with_hash)
     #define pottery_pq_remove_first POTTERY_CONCAT(POTTERY_PRIORITY_QUEUE_PREFIX, _remove_first)
     #define pottery_pq_remove_last POTTERY_CONCAT(POTTERY_PRIORITY_QUEUE_PREFIX, _remove_last)
     #define pottery_pq_remove_and_next POTTERY_CONCAT(POTTERY_PRIORITY_QUEUE_PREFIX, _remove_and_next)
@@ -364,7 +370,11 @@
     #define pottery_pq_array_is_empty POTTERY_CONCAT(POTTERY_PRIORITY_QUEUE_NAME(_array), _is_empty)
     #define pottery_pq_array_at POTTERY_CONCAT(POTTERY_PRIORITY_QUEUE_NAME(_array), _at)
     #define pottery_pq_array_find POTTERY_CONCAT(POTTERY_PRIORITY_QUEUE_NAME(_array), _find)
+    #define pottery_pq_array_find_with_hash POTTERY_CONCAT(POTTERY_PRIORITY_QUEUE_NAME(_array), _find_with_hash)
     #define pottery_pq_array_contains_key POTTERY_CONCAT(POTTERY_PRIORITY_QUEUE_NAME(_array), _contains_key)
+    #define pottery_pq_array_contains_key_with_hash POTTERY_CONCAT(POTTERY_PRIORITY_QUEUE_NAME(_array), _contains_key_with_hash)
+    #define pottery_pq_array_find_bulk POTTERY_CONCAT(POTTERY_PRIORITY_QUEUE_NAME(_array), _find_bulk)
+    #define pottery_pq_array_contains_bulk POTTERY_CONCAT(POTTERY_PRIORITY_QUEUE_NAME(_array), _contains_bulk)
     #define pottery_pq_array_first POTTERY_CONCAT(POTTERY_PRIORITY_QUEUE_NAME(_array), _first)
     #define pottery_pq_array_last POTTERY_CONCAT(POTTERY_PRIORITY_QUEUE_NAME(_array), _last)
     #define pottery_pq_array_any POTTERY_CONCAT(POTTERY_PRIORITY_QUEUE_NAME(_array), _any)
@@ -402,6 +412,7 @@
     #define pottery_pq_array_emplace POTTERY_CONCAT(POTTERY_PRIORITY_QUEUE_NAME(_array), _emplace)
     #define pottery_pq_array_emplace_at POTTERY_CONCAT(POTTERY_PRIORITY_QUEUE_NAME(_array), _emplace_at)
     #define pottery_pq_array_emplace_key POTTERY_CONCAT(POTTERY_PRIORITY_QUEUE_NAME(_array), _emplace_key)
+    #define pottery_pq_array_emplace_key_with_hash POTTERY_CONCAT(POTTERY_PRIORITY_QUEUE_NAME(_array), _emplace_key_with_hash)
     #define pottery_pq_array_emplace_first POTTERY_CONCAT(POTTERY_PRIORITY_QUEUE_NAME(_array), _emplace_first)
     #define pottery_pq_array_emplace_last POTTERY_CONCAT(POTTERY_PRIORITY_QUEUE_NAME(_array), _emplace_last)
     #define pottery_pq_array_emplace_before POTTERY_CONCAT(POTTERY_PRIORITY_QUEUE_NAME(_array), _emplace_before)
@@ -437,6 +448,7 @@
     #define pottery_pq_array_remove POTTERY_CONCAT(POTTERY_PRIORITY_QUEUE_NAME(_array), _remove)
     #define pottery_pq_array_remove_at POTTERY_CONCAT(POTTERY_PRIORITY_QUEUE_NAME(_array), _remove_at)
     #define pottery_pq_array_remove_key POTTERY_CONCAT(POTTERY_PRIORITY_QUEUE_NAME(_array), _remove_key)
+    #define pottery_pq_array_remove_key_with_hash POTTERY_CONCAT(POTTERY_PRIORITY_QUEUE_NAME(_array), _remove_key_with_hash)
     #define pottery_pq_array_remove_first POTTERY_CONCAT(POTTERY_PRIORITY_QUEUE_NAME(_array), _remove_first)
     #define pottery_pq_array_remove_last POTTERY_CONCAT(POTTERY_PRIORITY_QUEUE_NAME(_array), _remove_last)
     #define pottery_pq_array_remove_and_next POTTERY_CONCAT(POTTERY_PRIORITY_QUEUE_NAME(_array), _remove_and_next)
@@ -196,7 +196,11 @@
     #undef pottery_pq_is_empty
     #undef pottery_pq_at
     #undef pottery_pq_find
+    #undef pottery_pq_find_with_hash
     #undef pottery_pq_contains_key
+    #undef pottery_pq_contains_key_with_hash
+    #undef pottery_pq_find_bulk
+    #undef pottery_pq_contains_bulk
     #undef pottery_pq_first
     #undef pottery_pq_last
     #undef pottery_pq_any
@@ -234,6 +238,7 @@
     #undef pottery_pq_emplace
     #undef pottery_pq_emplace_at
     #undef pottery_pq_emplace_key
+    #undef pottery_pq_emplace_key_with_hash
     #undef pottery_pq_emplace_first
     #undef pottery_pq_emplace_last
     #undef pottery_pq_emplace_before
@@ -269,6 +274,7 @@
     #undef pottery_pq_remove
     #undef pottery_pq_remove_at
     #undef pottery_pq_remove_key
+    #undef pottery_pq_remove_key_with_hash
     #undef pottery_pq_remove_first
     #undef pottery_pq_remove_last
     #undef pottery_pq_remove_and_next
@@ -354,7 +360,11 @@
     #undef pottery_pq_array_is_empty
     #undef pottery_pq_array_at
     #undef pottery_pq_array_find
+    #undef pottery_pq_array_find_with_hash
     #undef pottery_pq_array_contains_key
+    #undef pottery_pq_array_contains_key_with_hash
+    #undef pottery_pq_array_find_bulk
+    #undef pottery_pq_array_contains_bulk
     #undef pottery_pq_array_first
     #undef pottery_pq_array_last
     #undef pottery_pq_array_any
@@ -392,6 +402,7 @@
     #undef pottery_pq_array_emplace
     #undef pottery_pq_array_emplace_at
     #undef pottery_pq_array_emplace_key
+    #undef pottery_pq_array_emplace_key_with_hash
     #undef pottery_pq_array_emplace_first
     #undef pottery_pq_array_emplace_last
     #undef pottery_pq_array_emplace_before
@@ -427,6 +438,7 @@
     #undef pottery_pq_array_remove
     #undef pottery_pq_array_remove_at
     #undef pottery_pq_array_remove_key
+    #undef pottery_pq_array_remove_key_with_hash
     #undef pottery_pq_array_remove_first
     #undef pottery_pq_array_remove_last
     #undef pottery_pq_array_remove_and_next
@@ -118,7 +118,11 @@
     #define pottery_rbt_is_empty POTTERY_CONCAT(POTTERY_RED_BLACK_TREE_PREFIX, _is_empty)
     #define pottery_rbt_at POTTERY_CONCAT(POTTERY_RED_BLACK_TREE_PREFIX, _at)
     #define pottery_rbt_find POTTERY_CONCAT(POTTERY_RED_BLACK_TREE_PREFIX, _find)
+    #define pottery_rbt_find_with_hash POTTERY_CONCAT(POTTERY_RED_BLACK_TREE_PREFIX, _find_with_hash)
     #define pottery_rbt_contains_key POTTERY_CONCAT(POTTERY_RED_BLACK_TREE_PREFIX, _contains_key)
+    #define pottery_rbt_contains_key_with_hash POTTERY_CONCAT(POTTERY_RED_BLACK_TREE_PREFIX, _contains_key_with_hash)
+    #define pottery_rbt_find_bulk POTTERY_CONCAT(POTTERY_RED_BLACK_TREE_PREFIX, _find_bulk)
+    #define pottery_rbt_contains_bulk POTTERY_CONCAT(POTTERY_RED_BLACK_TREE_PREFIX, _contains_bulk)
     #define pottery_rbt_first POTTERY_CONCAT(POTTERY_RED_BLACK_TREE_PREFIX, _first)
     #define pottery_rbt_last POTTERY_CONCAT(POTTERY_RED_BLACK_TREE_PREFIX, _last)
     #define pottery_rbt_any POTTERY_CONCAT(POTTERY_RED_BLACK_TREE_PREFIX, _any)
@@ -156,6 +160,7 @@
     #define pottery_rbt_emplace POTTERY_CONCAT(POTTERY_RED_BLACK_TREE_PREFIX, _emplace)
     #define pottery_rbt_emplace_at POTTERY_CONCAT(POTTERY_RED_BLACK_TREE_PREFIX, _emplace_at)
     #define pottery_rbt_emplace_key POTTERY_CONCAT(POTTERY_RED_BLACK_TREE_PREFIX, _emplace_key)
+    #define pottery_rbt_emplace_key_with_hash POTTERY_CONCAT(POTTERY_RED_BLACK_TREE_PREFIX, _emplace_key_with_hash)
     #define pottery_rbt_emplace_first POTTERY_CONCAT(POTTERY_RED_BLACK_TREE_PREFIX, _emplace_first)
     #define pottery_rbt_emplace_last POTTERY_CONCAT(POTTERY_RED_BLACK_TREE_PREFIX, _emplace_last)
     #define pottery_rbt_emplace_before POTTERY_CONCAT(POTTERY_RED_BLACK_TREE_PREFIX, _emplace_before)
@@ -191,6 +196,7 @@
     #define pottery_rbt_remove POTTERY_CONCAT(POTTERY_RED_BLACK_TREE_PREFIX, _remove)
     #define pottery_rbt_remove_at POTTERY_CONCAT(POTTERY_RED_BLACK_TREE_PREFIX, _remove_at)
     #define pottery_rbt_remove_key POTTERY_CONCAT(POTTERY_RED_BLACK_TREE_PREFIX, _remove_key)
+    #define pottery_rbt_remove_key_with_hash POTTERY_CONCAT(POTTERY_RED_BLACK_TREE_PREFIX, _remove_key_with_hash)
     #define pottery_rbt_remove_first POTTERY_CONCAT(POTTERY_RED_BLACK_TREE_PREFIX, _remove_first)
     #define pottery_rbt_remove_last POTTERY_CONCAT(POTTERY_RED_BLACK_TREE_PREFIX, _remove_last)
     #define pottery_rbt_remove_and_next POTTERY_CONCAT(POTTERY_RED_BLACK_TREE_PREFIX, _remove_and_next)
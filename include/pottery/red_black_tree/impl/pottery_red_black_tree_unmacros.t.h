@@ -98,7 +98,11 @@
     #undef pottery_rbt_is_empty
     #undef pottery_rbt_at
     #undef pottery_rbt_find
+    #undef pottery_rbt_find_with_hash
     #undef pottery_rbt_contains_key
+    #undef pottery_rbt_contains_key_with_hash
+    #undef pottery_rbt_find_bulk
+    #undef pottery_rbt_contains_bulk
     #undef pottery_rbt_first
     #undef pottery_rbt_last
     #undef pottery_rbt_any
@@ -136,6 +140,7 @@
     #undef pottery_rbt_emplace
     #undef pottery_rbt_emplace_at
     #undef pottery_rbt_emplace_key
+    #undef pottery_rbt_emplace_key_with_hash
     #undef pottery_rbt_emplace_first
     #undef pottery_rbt_emplace_last
     #undef pottery_rbt_emplace_before
@@ -171,6 +176,7 @@
     #undef pottery_rbt_remove
     #undef pottery_rbt_remove_at
     #undef pottery_rbt_remove_key
+    #undef pottery_rbt_remove_key_with_hash
     #undef pottery_rbt_remove_first
     #undef pottery_rbt_remove_last
     #undef pottery_rbt_remove_and_next
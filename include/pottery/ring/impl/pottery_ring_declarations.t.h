@@ -46,6 +46,13 @@ typedef pottery_ring_value_t* pottery_ring_entry_t;
  *
  * The ring is (by default) growable. When the ring needs to grow, all
  * values are copied.
+ *
+ * The capacity is always zero or a power of two so that indexes can be
+ * wrapped around the buffer with a mask rather than a modulus.
+ *
+ * If POTTERY_RING_MIRRORED is enabled, the buffer is mapped twice in a row so
+ * the values (and the free space) are always contiguous. See read_span() and
+ * write_span().
  */
 typedef struct pottery_ring_t {
     pottery_ring_value_t* values;
@@ -62,6 +69,13 @@ typedef struct pottery_ring_t {
 static inline void pottery_ring_sanity_check(pottery_ring_t* ring) {
     (void)ring;
     pottery_assert((ring->capacity == 0) == (ring->values == pottery_null));
+    pottery_assert((ring->capacity & (ring->capacity - 1)) == 0);
+    pottery_assert(ring->count <= ring->capacity);
+}
+
+static inline
+size_t pottery_ring_mask(pottery_ring_t* ring) {
+    return ring->capacity - 1;
 }
 
 #if POTTERY_FORWARD_DECLARATIONS
@@ -94,8 +108,27 @@ POTTERY_RING_EXTERN
 pottery_error_t pottery_ring_emplace_first(pottery_ring_t* ring, pottery_ring_entry_t* entry);
 POTTERY_RING_EXTERN
 pottery_error_t pottery_ring_emplace_last(pottery_ring_t* ring, pottery_ring_entry_t* entry);
+
+/**
+ * Makes room for the given number of uninitialized values at the given index,
+ * returning an entry for the first of them.
+ *
+ * Values are moved out of the way on whichever side of the index has fewer
+ * of them, so this moves at most half the values in the ring. The ring grows
+ * at most once. If it can't grow, it is unchanged and an error is returned.
+ */
+POTTERY_RING_EXTERN
+pottery_error_t pottery_ring_emplace_at_bulk(pottery_ring_t* ring, size_t index,
+        size_t count, pottery_ring_entry_t* entry);
 #endif
 
+static inline
+pottery_error_t pottery_ring_emplace_at(pottery_ring_t* ring, size_t index,
+        pottery_ring_entry_t* entry)
+{
+    return pottery_ring_emplace_at_bulk(ring, index, 1, entry);
+}
+
 #if POTTERY_LIFECYCLE_CAN_PASS
 
 // TODO add C++ const ref / r-value ref helpers like vector
@@ -121,6 +154,15 @@ pottery_error_t pottery_ring_insert_last(pottery_ring_t* ring, pottery_ring_valu
         pottery_move_construct(pottery_ring_value_t, *entry, value);
     return error;
 }
+
+static inline
+pottery_error_t pottery_ring_insert_at(pottery_ring_t* ring, size_t index, pottery_ring_value_t value) {
+    pottery_ring_entry_t entry;
+    pottery_error_t error = pottery_ring_emplace_at(ring, index, &entry);
+    if (error == POTTERY_OK)
+        pottery_move_construct(pottery_ring_value_t, *entry, value);
+    return error;
+}
 #endif
 
 static inline
@@ -128,8 +170,7 @@ pottery_ring_value_t* pottery_ring_at(pottery_ring_t* ring, size_t index) {
     pottery_ring_sanity_check(ring);
     pottery_assert(index < pottery_ring_count(ring));
 
-    size_t offset = (ring->start + index) % ring->capacity;
-    //fprintf(stderr, "at index %i offset %i\n", (int)index, (int)offset);
+    size_t offset = (ring->start + index) & pottery_ring_mask(ring);
     return ring->values + offset;
 }
 
@@ -143,7 +184,7 @@ pottery_ring_value_t* pottery_ring_select(pottery_ring_t* ring, size_t index) {
 static inline
 size_t pottery_ring_index(pottery_ring_t* ring, pottery_ring_value_t* value) {
     size_t offset = pottery_cast(size_t, value - ring->values);
-    return (offset + ring->capacity - ring->start) % ring->capacity;
+    return (offset - ring->start) & pottery_ring_mask(ring);
 }
 
 static inline
@@ -219,8 +260,23 @@ POTTERY_RING_EXTERN
 void pottery_ring_displace_first_bulk(pottery_ring_t* ring, size_t count);
 POTTERY_RING_EXTERN
 void pottery_ring_displace_last_bulk(pottery_ring_t* ring, size_t count);
+
+/**
+ * Removes the given number of values at the given index without destroying
+ * them.
+ *
+ * The gap is closed by moving whichever side of it has fewer values, so this
+ * moves at most half the values in the ring.
+ */
+POTTERY_RING_EXTERN
+void pottery_ring_displace_at_bulk(pottery_ring_t* ring, size_t index, size_t count);
 #endif
 
+static inline
+void pottery_ring_displace_at(pottery_ring_t* ring, size_t index) {
+    pottery_ring_displace_at_bulk(ring, index, 1);
+}
+
 #if POTTERY_LIFECYCLE_CAN_DESTROY
 static inline
 void pottery_ring_remove_first(pottery_ring_t* ring) {
@@ -240,7 +296,16 @@ void pottery_ring_remove_first_bulk(pottery_ring_t* ring, size_t count);
 
 POTTERY_RING_EXTERN
 void pottery_ring_remove_last_bulk(pottery_ring_t* ring, size_t count);
+
+POTTERY_RING_EXTERN
+void pottery_ring_remove_at_bulk(pottery_ring_t* ring, size_t index, size_t count);
 #endif
+
+static inline
+void pottery_ring_remove_at(pottery_ring_t* ring, size_t index) {
+    pottery_ring_lifecycle_destroy(pottery_ring_at(ring, index));
+    pottery_ring_displace_at(ring, index);
+}
 #endif
 
 #if POTTERY_LIFECYCLE_CAN_PASS
@@ -268,29 +333,53 @@ pottery_ring_value_t pottery_ring_extract_last(pottery_ring_t* ring) {
     return element;
 }
 
+static inline
+pottery_ring_value_t pottery_ring_extract_at(pottery_ring_t* ring, size_t index) {
+    pottery_ring_value_t* entry = pottery_ring_at(ring, index);
+    pottery_ring_value_t element = pottery_move_if_cxx(*entry);
+    #ifdef __cplusplus
+    // see pottery_vector_extract() for details
+    entry->~pottery_ring_value_t();
+    #endif
+    pottery_ring_displace_at(ring, index);
+    return element;
+}
+
 #if POTTERY_FORWARD_DECLARATIONS
+/**
+ * Appends the values in the given array to the end of the ring, in order.
+ * (The last value of the array will end up at the end of the ring.)
+ *
+ * The ring grows at most once and the values are copied in at most two
+ * contiguous segments. If the ring can't grow, it is unchanged and an error is
+ * returned.
+ */
 POTTERY_RING_EXTERN
-void pottery_ring_insert_last_bulk(pottery_ring_t* ring, const pottery_ring_value_t* values, size_t count);
+pottery_error_t pottery_ring_insert_last_bulk(pottery_ring_t* ring, const pottery_ring_value_t* values, size_t count);
 
 /**
- * Pushes each element from the given array in reverse order into the front of
- * the ring. (The last element of the given array will end up at the front
- * of the ring.)
+ * Prepends the values in the given array to the front of the ring, in order.
+ * (The first value of the array will end up at the front of the ring.)
  *
  * This is the opposite operation of pottery_ring_extract_first_bulk();
  * inserting an array of bulk data and then extracting it again is functionally
  * idempotent.
  */
 POTTERY_RING_EXTERN
-void pottery_ring_insert_first_bulk(pottery_ring_t* ring, const pottery_ring_value_t* values, size_t count);
+pottery_error_t pottery_ring_insert_first_bulk(pottery_ring_t* ring, const pottery_ring_value_t* values, size_t count);
 
+/**
+ * Moves the given number of values from the front of the ring into the given
+ * array, in order. (The value at the front of the ring will be placed at the
+ * start of the array.)
+ */
 POTTERY_RING_EXTERN
 void pottery_ring_extract_first_bulk(pottery_ring_t* ring, pottery_ring_value_t* values, size_t count);
 
 /**
- * Pops elements from the end of the ring one-by-one in into the given array
- * in reverse order. (The element at the end of the ring will be placed at the
- * start of the array.)
+ * Moves the given number of values from the end of the ring into the given
+ * array, in order. (The value at the end of the ring will be placed at the end
+ * of the array.)
  *
  * This is the opposite operation of pottery_ring_insert_last_bulk(); inserting
  * an array of bulk data and then extracting it again is functionally
@@ -300,3 +389,47 @@ POTTERY_RING_EXTERN
 void pottery_ring_extract_last_bulk(pottery_ring_t* ring, pottery_ring_value_t* values, size_t count);
 #endif
 #endif
+
+#if POTTERY_RING_MIRRORED
+/**
+ * Returns the first value in the ring and stores the number of values in
+ * count.
+ *
+ * The values are contiguous even if they wrap around the end of the buffer
+ * so you can pass them straight to e.g. write() or a parser. Call
+ * displace_first_bulk() (or remove_first_bulk()) with the number of values
+ * you've consumed.
+ */
+static inline
+pottery_ring_value_t* pottery_ring_read_span(pottery_ring_t* ring, size_t* count) {
+    pottery_ring_sanity_check(ring);
+    *count = ring->count;
+    return ring->values + ring->start;
+}
+
+#if POTTERY_FORWARD_DECLARATIONS
+/**
+ * Makes room for at least the given number of values at the end of the ring,
+ * growing it if necessary, and returns all of the free space as a single
+ * contiguous span of uninitialized values.
+ *
+ * You can pass the span straight to e.g. read(). Call commit_span() with the
+ * number of values you've constructed at the start of it to append them to
+ * the ring.
+ */
+POTTERY_RING_EXTERN
+pottery_error_t pottery_ring_write_span(pottery_ring_t* ring, size_t minimum_count,
+        pottery_ring_value_t** span, size_t* count);
+#endif
+
+/**
+ * Appends the given number of values constructed at the start of the span
+ * returned by write_span().
+ */
+static inline
+void pottery_ring_commit_span(pottery_ring_t* ring, size_t count) {
+    pottery_ring_sanity_check(ring);
+    pottery_assert(count <= ring->capacity - ring->count);
+    ring->count += count;
+}
+#endif
@@ -26,13 +26,133 @@
 #error "This is an internal header. Do not include it."
 #endif
 
+/*
+ * Returns the number of values (up to count) that are contiguous in the
+ * buffer starting at the given index. The rest of them (if any) wrap around
+ * to the start of the buffer.
+ */
+static inline
+size_t pottery_ring_impl_segment(pottery_ring_t* ring, size_t index, size_t count) {
+    size_t offset = (ring->start + index) & pottery_ring_mask(ring);
+    return pottery_min_s(count, ring->capacity - offset);
+}
+
 #if POTTERY_LIFECYCLE_CAN_DESTROY
+static inline
+void pottery_ring_impl_destroy_bulk(pottery_ring_t* ring, size_t index, size_t count) {
+    if (count == 0)
+        return;
+    size_t part1 = pottery_ring_impl_segment(ring, index, count);
+    pottery_ring_lifecycle_destroy_bulk(pottery_ring_at(ring, index), part1);
+    pottery_ring_lifecycle_destroy_bulk(ring->values, count - part1);
+}
+
 static void pottery_ring_impl_destroy_all(pottery_ring_t* ring) {
-    pottery_ring_entry_t entry = pottery_ring_begin(ring);
-    while (pottery_ring_entry_exists(ring, entry)) {
-        pottery_ring_lifecycle_destroy(entry);
-        entry = pottery_ring_next(ring, entry);
+    pottery_ring_impl_destroy_bulk(ring, 0, ring->count);
+}
+#endif
+
+/*
+ * Returns the smallest capacity of the buffer.
+ *
+ * A mirrored buffer must be a whole number of pages so that the mirror lines
+ * up with it. The page size is a power of two so the smallest such capacity
+ * is a power of two as well.
+ */
+static inline
+size_t pottery_ring_impl_minimum_capacity(void) {
+    size_t capacity = 4;
+    #if POTTERY_RING_MIRRORED
+    size_t page_size = pottery_page_size();
+    while ((capacity * sizeof(pottery_ring_value_t)) % page_size != 0)
+        capacity *= 2;
+    #endif
+    return capacity;
+}
+
+static inline
+pottery_ring_value_t* pottery_ring_impl_alloc(size_t capacity) {
+    #if POTTERY_RING_MIRRORED
+    size_t size;
+    if (pottery_mul_overflow_s(capacity, sizeof(pottery_ring_value_t), &size))
+        return pottery_null;
+    return pottery_cast(pottery_ring_value_t*, pottery_mirror_alloc(size));
+    #else
+    return pottery_cast(pottery_ring_value_t*,
+            pottery_ring_alloc_malloc_array(
+                pottery_alignof(pottery_ring_value_t),
+                capacity,
+                sizeof(pottery_ring_value_t)));
+    #endif
+}
+
+static inline
+void pottery_ring_impl_free(pottery_ring_value_t* values, size_t capacity) {
+    #if POTTERY_RING_MIRRORED
+    pottery_mirror_free(values, capacity * sizeof(pottery_ring_value_t));
+    #else
+    (void)capacity;
+    pottery_ring_alloc_free(pottery_alignof(pottery_ring_value_t), values);
+    #endif
+}
+
+/*
+ * Moves the values into a new buffer of the given power-of-two capacity,
+ * unwrapping them so that the ring starts at the beginning of it.
+ */
+static pottery_error_t pottery_ring_impl_resize(pottery_ring_t* ring, size_t new_capacity) {
+    pottery_ring_sanity_check(ring);
+    pottery_assert(new_capacity >= ring->count);
+    pottery_assert(new_capacity != 0 && (new_capacity & (new_capacity - 1)) == 0);
+
+    pottery_ring_value_t* new_values = pottery_ring_impl_alloc(new_capacity);
+    if (new_values == pottery_null)
+        return POTTERY_ERROR_ALLOC;
+
+    if (ring->count > 0) {
+        size_t part1 = pottery_ring_impl_segment(ring, 0, ring->count);
+        pottery_ring_lifecycle_move_bulk_restrict(new_values, ring->values + ring->start, part1);
+        pottery_ring_lifecycle_move_bulk_restrict(new_values + part1, ring->values, ring->count - part1);
+    }
+
+    if (ring->values != pottery_null)
+        pottery_ring_impl_free(ring->values, ring->capacity);
+    ring->values = new_values;
+    ring->capacity = new_capacity;
+    ring->start = 0;
+
+    pottery_ring_sanity_check(ring);
+    return POTTERY_OK;
+}
+
+static pottery_error_t pottery_ring_grow(pottery_ring_t* ring, size_t minimum_capacity) {
+    pottery_assert(minimum_capacity > ring->capacity);
+
+    size_t new_capacity = pottery_max_s(pottery_ring_impl_minimum_capacity(), ring->capacity);
+    while (new_capacity < minimum_capacity) {
+        // We limit the overall size so we don't need to do overflow checks.
+        if (new_capacity > SIZE_MAX / 4)
+            return POTTERY_ERROR_ALLOC;
+        new_capacity *= 2;
     }
+
+    return pottery_ring_impl_resize(ring, new_capacity);
+}
+
+#if POTTERY_RING_AUTO_SHRINK
+static void pottery_ring_impl_auto_shrink(pottery_ring_t* ring) {
+    // We shrink by half whenever we're using at most a quarter of our
+    // capacity so that alternating inserts and removes around the threshold
+    // don't resize every time. We don't bother shrinking small rings.
+    size_t minimum_capacity = pottery_max_s(8, pottery_ring_impl_minimum_capacity());
+    size_t new_capacity = ring->capacity;
+    while (new_capacity > minimum_capacity && ring->count <= new_capacity / 4)
+        new_capacity /= 2;
+    if (new_capacity == ring->capacity)
+        return;
+
+    // If we can't allocate a smaller buffer we just keep the larger one.
+    (void)pottery_ring_impl_resize(ring, new_capacity);
 }
 #endif
 
@@ -56,133 +176,111 @@ void pottery_ring_destroy(pottery_ring_t* ring) {
     #endif
 
     if (ring->values != pottery_null)
-        pottery_ring_alloc_free(pottery_alignof(pottery_ring_value_t), ring->values);
+        pottery_ring_impl_free(ring->values, ring->capacity);
 }
 
 POTTERY_RING_EXTERN
 void pottery_ring_displace_all(pottery_ring_t* ring) {
     // TODO: reset to internal/external storage, etc
     ring->count = 0;
-}
-
-#if POTTERY_LIFECYCLE_CAN_DESTROY
-POTTERY_RING_EXTERN
-void pottery_ring_remove_all(pottery_ring_t* ring) {
-    pottery_ring_impl_destroy_all(ring);
-    pottery_ring_displace_all(ring);
-}
-
-POTTERY_RING_EXTERN
-void pottery_ring_remove_first_bulk(pottery_ring_t* ring, size_t count) {
-    // TODO performance
-    size_t i;
-    for (i = 0; i < count; ++i)
-        pottery_ring_remove_first(ring);
-}
+    ring->start = 0;
 
-POTTERY_RING_EXTERN
-void pottery_ring_remove_last_bulk(pottery_ring_t* ring, size_t count) {
-    // TODO performance
-    size_t i;
-    for (i = 0; i < count; ++i)
-        pottery_ring_remove_last(ring);
+    #if POTTERY_RING_AUTO_SHRINK
+    if (ring->values != pottery_null) {
+        pottery_ring_impl_free(ring->values, ring->capacity);
+        ring->values = pottery_null;
+        ring->capacity = 0;
+    }
+    #endif
 }
-#endif
 
 POTTERY_RING_EXTERN
 void pottery_ring_displace_first(pottery_ring_t* ring) {
-    //fprintf(stderr, "displace first\n");
     pottery_ring_sanity_check(ring);
     pottery_assert(!pottery_ring_is_empty(ring));
 
-    ring->start = (ring->start + 1) % ring->capacity;
+    ring->start = (ring->start + 1) & pottery_ring_mask(ring);
     --ring->count;
 
-    // TODO shrink
+    #if POTTERY_RING_AUTO_SHRINK
+    pottery_ring_impl_auto_shrink(ring);
+    #endif
 }
 
 POTTERY_RING_EXTERN
 void pottery_ring_displace_last(pottery_ring_t* ring) {
-    //fprintf(stderr, "displace last\n");
     pottery_ring_sanity_check(ring);
     pottery_assert(!pottery_ring_is_empty(ring));
 
     --ring->count;
 
-    // TODO shrink
+    #if POTTERY_RING_AUTO_SHRINK
+    pottery_ring_impl_auto_shrink(ring);
+    #endif
 }
 
 POTTERY_RING_EXTERN
 void pottery_ring_displace_first_bulk(pottery_ring_t* ring, size_t count) {
-    // TODO performance
-    size_t i;
-    for (i = 0; i < count; ++i)
-        pottery_ring_displace_first(ring);
+    pottery_ring_sanity_check(ring);
+    pottery_assert(count <= ring->count);
+    if (count == 0)
+        return;
+
+    ring->start = (ring->start + count) & pottery_ring_mask(ring);
+    ring->count -= count;
+
+    #if POTTERY_RING_AUTO_SHRINK
+    pottery_ring_impl_auto_shrink(ring);
+    #endif
 }
 
 POTTERY_RING_EXTERN
 void pottery_ring_displace_last_bulk(pottery_ring_t* ring, size_t count) {
-    // TODO performance
-    size_t i;
-    for (i = 0; i < count; ++i)
-        pottery_ring_displace_last(ring);
-}
-
-static pottery_error_t pottery_ring_grow(pottery_ring_t* ring, size_t minimum_capacity) {
     pottery_ring_sanity_check(ring);
+    pottery_assert(count <= ring->count);
+    if (count == 0)
+        return;
 
-    // TODO should actually use minimum capacity?
-    (void)minimum_capacity;
-
-    size_t new_capacity = 4;
-    while (new_capacity < (2 * ring->count)) {
-        new_capacity *= 2;
-    }
-
-    // We limit the overall size so we don't need to do overflow checks.
-    if (new_capacity > SIZE_MAX / 4)
-        return POTTERY_ERROR_ALLOC;
-
-    //fprintf(stderr, "grow newcap %i\n", (int)new_capacity);
-
-    // Note that we aren't using at_least. We'll be changing ring to use
-    // power-of-two sizes so it can mask instead of modulus.
+    ring->count -= count;
 
-    pottery_ring_value_t* new_values = pottery_cast(pottery_ring_value_t*,
-            pottery_ring_alloc_malloc_array(
-                pottery_alignof(pottery_ring_value_t),
-                new_capacity,
-                sizeof(pottery_ring_value_t)));
-    if (new_values == pottery_null)
-        return POTTERY_ERROR_ALLOC;
+    #if POTTERY_RING_AUTO_SHRINK
+    pottery_ring_impl_auto_shrink(ring);
+    #endif
+}
 
-    if (ring->count > 0) {
-        size_t part1 = ring->capacity - ring->start;
-        if (part1 >= ring->count) {
-            //fprintf(stderr, "start %i cap %i count %i part1 %i\n", (int)ring->start, (int)ring->capacity, (int)ring->count, (int)part1);
-            pottery_ring_lifecycle_move_bulk_restrict(new_values, ring->values + ring->start, ring->count);
-        } else {
-            size_t part2 = ring->count - part1;
-            pottery_ring_lifecycle_move_bulk_restrict(new_values, ring->values + ring->start, part1);
-            pottery_ring_lifecycle_move_bulk_restrict(new_values + part1, ring->values, part2);
-        }
-    }
+#if POTTERY_LIFECYCLE_CAN_DESTROY
+POTTERY_RING_EXTERN
+void pottery_ring_remove_all(pottery_ring_t* ring) {
+    pottery_ring_impl_destroy_all(ring);
+    pottery_ring_displace_all(ring);
+}
 
-    if (ring->values != pottery_null)
-        pottery_ring_alloc_free(pottery_alignof(pottery_ring_value_t), ring->values);
-    ring->values = new_values;
-    ring->capacity = new_capacity;
-    ring->start = 0;
+POTTERY_RING_EXTERN
+void pottery_ring_remove_first_bulk(pottery_ring_t* ring, size_t count) {
+    pottery_assert(count <= ring->count);
+    pottery_ring_impl_destroy_bulk(ring, 0, count);
+    pottery_ring_displace_first_bulk(ring, count);
+}
 
-    pottery_ring_sanity_check(ring);
+POTTERY_RING_EXTERN
+void pottery_ring_remove_last_bulk(pottery_ring_t* ring, size_t count) {
+    pottery_assert(count <= ring->count);
+    pottery_ring_impl_destroy_bulk(ring, ring->count - count, count);
+    pottery_ring_displace_last_bulk(ring, count);
+}
 
-    return POTTERY_OK;
+POTTERY_RING_EXTERN
+void pottery_ring_remove_at_bulk(pottery_ring_t* ring, size_t index, size_t count) {
+    pottery_assert(count <= ring->count);
+    pottery_assert(index <= ring->count - count);
+    pottery_ring_impl_destroy_bulk(ring, index, count);
+    pottery_ring_displace_at_bulk(ring, index, count);
 }
+#endif
 
 POTTERY_RING_EXTERN
 pottery_error_t pottery_ring_emplace_last(pottery_ring_t* ring, pottery_ring_entry_t* entry) {
     pottery_ring_sanity_check(ring);
-    //fprintf(stderr, "insert last\n");
 
     size_t new_count = ring->count + 1;
     if (ring->capacity < new_count) {
@@ -200,7 +298,6 @@ pottery_error_t pottery_ring_emplace_last(pottery_ring_t* ring, pottery_ring_ent
 POTTERY_RING_EXTERN
 pottery_error_t pottery_ring_emplace_first(pottery_ring_t* ring, pottery_ring_entry_t* entry) {
     pottery_ring_sanity_check(ring);
-    //fprintf(stderr, "insert first\n");
 
     size_t new_count = ring->count + 1;
     if (ring->capacity < new_count) {
@@ -210,49 +307,226 @@ pottery_error_t pottery_ring_emplace_first(pottery_ring_t* ring, pottery_ring_en
     }
 
     ring->count = new_count;
-    ring->start = (ring->start + ring->capacity - 1) % ring->capacity;
+    ring->start = (ring->start - 1) & pottery_ring_mask(ring);
     *entry = pottery_ring_at(ring, 0);
     pottery_ring_sanity_check(ring);
     return POTTERY_OK;
 }
 
-#if POTTERY_LIFECYCLE_CAN_PASS
+/*
+ * Makes room for count uninitialized values at the front or end of the ring,
+ * growing it at most once.
+ */
+static pottery_error_t pottery_ring_impl_emplace_bulk(pottery_ring_t* ring,
+        bool first, size_t count)
+{
+    pottery_ring_sanity_check(ring);
+
+    size_t new_count = ring->count + count;
+    if (new_count < ring->count)
+        return POTTERY_ERROR_OVERFLOW;
+    if (ring->capacity < new_count) {
+        pottery_error_t error = pottery_ring_grow(ring, new_count);
+        if (error != POTTERY_OK)
+            return error;
+    }
+
+    if (first)
+        ring->start = (ring->start - count) & pottery_ring_mask(ring);
+    ring->count = new_count;
+    return POTTERY_OK;
+}
+
+/*
+ * Moves count values from one index of the ring to another. The ranges may
+ * overlap. Values are moved in contiguous segments, from the front if they're
+ * moving down and from the back if they're moving up, so that no value is
+ * overwritten before it has been moved.
+ */
+static void pottery_ring_impl_shift(pottery_ring_t* ring, size_t to, size_t from, size_t count) {
+    size_t mask = pottery_ring_mask(ring);
+
+    if (to < from) {
+        while (count > 0) {
+            size_t step = pottery_min_s(pottery_ring_impl_segment(ring, to, count),
+                    pottery_ring_impl_segment(ring, from, count));
+            pottery_ring_lifecycle_move_bulk(
+                    ring->values + ((ring->start + to) & mask),
+                    ring->values + ((ring->start + from) & mask),
+                    step);
+            to += step;
+            from += step;
+            count -= step;
+        }
+
+    } else if (to > from) {
+        while (count > 0) {
+            // offsets of the last value of each range
+            size_t to_last = (ring->start + to + count - 1) & mask;
+            size_t from_last = (ring->start + from + count - 1) & mask;
+            size_t step = pottery_min_s(count, pottery_min_s(to_last, from_last) + 1);
+            pottery_ring_lifecycle_move_bulk(
+                    ring->values + to_last + 1 - step,
+                    ring->values + from_last + 1 - step,
+                    step);
+            count -= step;
+        }
+    }
+}
+
 POTTERY_RING_EXTERN
-void pottery_ring_insert_last_bulk(pottery_ring_t* ring, const pottery_ring_value_t* values, size_t count) {
+pottery_error_t pottery_ring_emplace_at_bulk(pottery_ring_t* ring, size_t index,
+        size_t count, pottery_ring_entry_t* entry)
+{
+    pottery_ring_sanity_check(ring);
+    pottery_assert(index <= ring->count);
+
+    // We open the gap on whichever side of the index has fewer values.
+    size_t after = ring->count - index;
+    bool first = index < after;
+    pottery_error_t error = pottery_ring_impl_emplace_bulk(ring, first, count);
+    if (error != POTTERY_OK)
+        return error;
+
+    if (first)
+        pottery_ring_impl_shift(ring, 0, count, index);
+    else
+        pottery_ring_impl_shift(ring, index + count, index, after);
+
+    *entry = pottery_ring_select(ring, index);
     pottery_ring_sanity_check(ring);
-    // TODO performance
-    size_t i = 0;
-    for (; i < count; ++i)
-        pottery_ring_insert_last(ring, values[i]);
+    return POTTERY_OK;
+}
+
+POTTERY_RING_EXTERN
+void pottery_ring_displace_at_bulk(pottery_ring_t* ring, size_t index, size_t count) {
     pottery_ring_sanity_check(ring);
+    pottery_assert(count <= ring->count);
+    pottery_assert(index <= ring->count - count);
+
+    // We close the gap by moving whichever side of it has fewer values.
+    size_t after = ring->count - index - count;
+    if (index < after) {
+        pottery_ring_impl_shift(ring, count, 0, index);
+        pottery_ring_displace_first_bulk(ring, count);
+    } else {
+        pottery_ring_impl_shift(ring, index, index + count, after);
+        pottery_ring_displace_last_bulk(ring, count);
+    }
 }
 
+#if POTTERY_RING_MIRRORED
 POTTERY_RING_EXTERN
-void pottery_ring_insert_first_bulk(pottery_ring_t* ring, const pottery_ring_value_t* values, size_t count) {
+pottery_error_t pottery_ring_write_span(pottery_ring_t* ring, size_t minimum_count,
+        pottery_ring_value_t** span, size_t* count)
+{
     pottery_ring_sanity_check(ring);
-    // TODO performance
+
+    if (ring->capacity - ring->count < minimum_count) {
+        size_t new_count = ring->count + minimum_count;
+        if (new_count < ring->count)
+            return POTTERY_ERROR_OVERFLOW;
+        pottery_error_t error = pottery_ring_grow(ring, new_count);
+        if (error != POTTERY_OK)
+            return error;
+    }
+
+    // The free space after the last value is contiguous in the mirror.
+    *span = ring->values + ((ring->start + ring->count) & pottery_ring_mask(ring));
+    *count = ring->capacity - ring->count;
+    return POTTERY_OK;
+}
+#endif
+
+#if POTTERY_LIFECYCLE_CAN_PASS
+static inline
+void pottery_ring_impl_copy_in(pottery_ring_value_t* to,
+        const pottery_ring_value_t* from, size_t count)
+{
+    #ifdef __cplusplus
     size_t i;
     for (i = 0; i < count; ++i)
-        pottery_ring_insert_first(ring, values[count - i - 1]);
+        pottery_move_construct(pottery_ring_value_t, to[i], from[i]);
+    #else
+    if (count != 0)
+        pottery_memcpy(to, from, count * sizeof(pottery_ring_value_t));
+    #endif
+}
+
+static inline
+void pottery_ring_impl_move_out(pottery_ring_value_t* to,
+        pottery_ring_value_t* from, size_t count)
+{
+    #ifdef __cplusplus
+    size_t i;
+    for (i = 0; i < count; ++i) {
+        to[i] = pottery_move_if_cxx(from[i]);
+        // see pottery_vector_extract() for details
+        from[i].~pottery_ring_value_t();
+    }
+    #else
+    if (count != 0)
+        pottery_memcpy(to, from, count * sizeof(pottery_ring_value_t));
+    #endif
+}
+
+POTTERY_RING_EXTERN
+pottery_error_t pottery_ring_insert_last_bulk(pottery_ring_t* ring, const pottery_ring_value_t* values, size_t count) {
+    if (count == 0)
+        return POTTERY_OK;
+
+    size_t index = ring->count;
+    pottery_error_t error = pottery_ring_impl_emplace_bulk(ring, false, count);
+    if (error != POTTERY_OK)
+        return error;
+
+    size_t part1 = pottery_ring_impl_segment(ring, index, count);
+    pottery_ring_impl_copy_in(pottery_ring_at(ring, index), values, part1);
+    pottery_ring_impl_copy_in(ring->values, values + part1, count - part1);
     pottery_ring_sanity_check(ring);
+    return POTTERY_OK;
 }
 
 POTTERY_RING_EXTERN
-void pottery_ring_extract_first_bulk(pottery_ring_t* ring, pottery_ring_value_t* values, size_t count) {
+pottery_error_t pottery_ring_insert_first_bulk(pottery_ring_t* ring, const pottery_ring_value_t* values, size_t count) {
+    if (count == 0)
+        return POTTERY_OK;
+
+    pottery_error_t error = pottery_ring_impl_emplace_bulk(ring, true, count);
+    if (error != POTTERY_OK)
+        return error;
+
+    size_t part1 = pottery_ring_impl_segment(ring, 0, count);
+    pottery_ring_impl_copy_in(pottery_ring_first(ring), values, part1);
+    pottery_ring_impl_copy_in(ring->values, values + part1, count - part1);
     pottery_ring_sanity_check(ring);
-    size_t i;
-    for (i = 0; i < count; ++i)
-        values[i] = pottery_ring_extract_first(ring);
+    return POTTERY_OK;
+}
+
+POTTERY_RING_EXTERN
+void pottery_ring_extract_first_bulk(pottery_ring_t* ring, pottery_ring_value_t* values, size_t count) {
     pottery_ring_sanity_check(ring);
+    pottery_assert(count <= ring->count);
+    if (count == 0)
+        return;
+
+    size_t part1 = pottery_ring_impl_segment(ring, 0, count);
+    pottery_ring_impl_move_out(values, pottery_ring_first(ring), part1);
+    pottery_ring_impl_move_out(values + part1, ring->values, count - part1);
+    pottery_ring_displace_first_bulk(ring, count);
 }
 
 POTTERY_RING_EXTERN
 void pottery_ring_extract_last_bulk(pottery_ring_t* ring, pottery_ring_value_t* values, size_t count) {
-    //fprintf(stderr, "extract last bulk\n");
-    pottery_ring_sanity_check(ring);
-    size_t i;
-    for (i = 0; i < count; ++i)
-        values[count - i - 1] = pottery_ring_extract_last(ring);
     pottery_ring_sanity_check(ring);
+    pottery_assert(count <= ring->count);
+    if (count == 0)
+        return;
+
+    size_t index = ring->count - count;
+    size_t part1 = pottery_ring_impl_segment(ring, index, count);
+    pottery_ring_impl_move_out(values, pottery_ring_at(ring, index), part1);
+    pottery_ring_impl_move_out(values + part1, ring->values, count - part1);
+    pottery_ring_displace_last_bulk(ring, count);
 }
 #endif
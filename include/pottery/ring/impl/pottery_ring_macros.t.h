@@ -40,12 +40,40 @@
 #define POTTERY_RING_EXTERN /*nothing*/
 #endif
 
+#ifndef POTTERY_RING_AUTO_SHRINK
+    #define POTTERY_RING_AUTO_SHRINK 1
+#endif
+
+#ifndef POTTERY_RING_MIRRORED
+    #define POTTERY_RING_MIRRORED 0
+#endif
+#if POTTERY_RING_MIRRORED && !POTTERY_MIRRORED_MEMORY
+    #error "POTTERY_RING_MIRRORED requires mirrored memory. Define _GNU_SOURCE on Linux (see pottery_platform_headers.h.)"
+#endif
+
 #define POTTERY_RING_NAME(name) POTTERY_CONCAT(POTTERY_RING_PREFIX, name)
 
 // ring internal functions
 #define pottery_ring_sanity_check POTTERY_RING_NAME(_sanity_check)
+#define pottery_ring_mask POTTERY_RING_NAME(_mask)
 #define pottery_ring_grow POTTERY_RING_NAME(_grow)
+#define pottery_ring_impl_resize POTTERY_RING_NAME(_impl_resize)
+#define pottery_ring_impl_auto_shrink POTTERY_RING_NAME(_impl_auto_shrink)
+#define pottery_ring_impl_segment POTTERY_RING_NAME(_impl_segment)
+#define pottery_ring_impl_destroy_bulk POTTERY_RING_NAME(_impl_destroy_bulk)
+#define pottery_ring_impl_copy_in POTTERY_RING_NAME(_impl_copy_in)
+#define pottery_ring_impl_move_out POTTERY_RING_NAME(_impl_move_out)
+#define pottery_ring_impl_emplace_bulk POTTERY_RING_NAME(_impl_emplace_bulk)
 #define pottery_ring_impl_destroy_all POTTERY_RING_NAME(_impl_destroy_all)
+#define pottery_ring_impl_alloc POTTERY_RING_NAME(_impl_alloc)
+#define pottery_ring_impl_free POTTERY_RING_NAME(_impl_free)
+#define pottery_ring_impl_minimum_capacity POTTERY_RING_NAME(_impl_minimum_capacity)
+#define pottery_ring_impl_shift POTTERY_RING_NAME(_impl_shift)
+
+// mirrored ring functions
+#define pottery_ring_read_span POTTERY_RING_NAME(_read_span)
+#define pottery_ring_write_span POTTERY_RING_NAME(_write_span)
+#define pottery_ring_commit_span POTTERY_RING_NAME(_commit_span)
 
 // common array types and functions
 //!!! AUTOGENERATED:container/rename.m.h SRC:pottery_ring DEST:POTTERY_RING_PREFIX
@@ -77,7 +105,11 @@
     #define pottery_ring_is_empty POTTERY_CONCAT(POTTERY_RING_PREFIX, _is_empty)
     #define pottery_ring_at POTTERY_CONCAT(POTTERY_RING_PREFIX, _at)
     #define pottery_ring_find POTTERY_CONCAT(POTTERY_RING_PREFIX, _find)
+    #define pottery_ring_find_with_hash POTTERY_CONCAT(POTTERY_RING_PREFIX, _find_with_hash)
     #define pottery_ring_contains_key POTTERY_CONCAT(POTTERY_RING_PREFIX, _contains_key)
+    #define pottery_ring_contains_key_with_hash POTTERY_CONCAT(POTTERY_RING_PREFIX, _contains_key_with_hash)
+    #define pottery_ring_find_bulk POTTERY_CONCAT(POTTERY_RING_PREFIX, _find_bulk)
+    #define pottery_ring_contains_bulk POTTERY_CONCAT(POTTERY_RING_PREFIX, _contains_bulk)
     #define pottery_ring_first POTTERY_CONCAT(POTTERY_RING_PREFIX, _first)
     #define pottery_ring_last POTTERY_CONCAT(POTTERY_RING_PREFIX, _last)
     #define pottery_ring_any POTTERY_CONCAT(POTTERY_RING_PREFIX, _any)
@@ -115,6 +147,7 @@
     #define pottery_ring_emplace POTTERY_CONCAT(POTTERY_RING_PREFIX, _emplace)
     #define pottery_ring_emplace_at POTTERY_CONCAT(POTTERY_RING_PREFIX, _emplace_at)
     #define pottery_ring_emplace_key POTTERY_CONCAT(POTTERY_RING_PREFIX, _emplace_key)
+    #define pottery_ring_emplace_key_with_hash POTTERY_CONCAT(POTTERY_RING_PREFIX, _emplace_key_with_hash)
     #define pottery_ring_emplace_first POTTERY_CONCAT(POTTERY_RING_PREFIX, _emplace_first)
     #define pottery_ring_emplace_last POTTERY_CONCAT(POTTERY_RING_PREFIX, _emplace_last)
     #define pottery_ring_emplace_before POTTERY_CONCAT(POTTERY_RING_PREFIX, _emplace_before)
@@ -150,6 +183,7 @@
     #define pottery_ring_remove POTTERY_CONCAT(POTTERY_RING_PREFIX, _remove)
     #define pottery_ring_remove_at POTTERY_CONCAT(POTTERY_RING_PREFIX, _remove_at)
     #define pottery_ring_remove_key POTTERY_CONCAT(POTTERY_RING_PREFIX, _remove_key)
+    #define pottery_ring_remove_key_with_hash POTTERY_CONCAT(POTTERY_RING_PREFIX, _remove_key_with_hash)
     #define pottery_ring_remove_first POTTERY_CONCAT(POTTERY_RING_PREFIX, _remove_first)
     #define pottery_ring_remove_last POTTERY_CONCAT(POTTERY_RING_PREFIX, _remove_last)
     #define pottery_ring_remove_and_next POTTERY_CONCAT(POTTERY_RING_PREFIX, _remove_and_next)
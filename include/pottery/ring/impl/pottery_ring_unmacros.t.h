@@ -32,11 +32,31 @@
 #undef POTTERY_RING_EXTERN
 #undef POTTERY_RING_EXTERNAL_ALLOC
 #undef POTTERY_RING_NAME
+#undef POTTERY_RING_AUTO_SHRINK
+#undef POTTERY_RING_MIRRORED
+#undef POTTERY_RING_INTERNAL_CAPACITY
 
 // ring internal functions
 #undef pottery_ring_sanity_check
+#undef pottery_ring_mask
 #undef pottery_ring_grow
+#undef pottery_ring_impl_resize
+#undef pottery_ring_impl_auto_shrink
+#undef pottery_ring_impl_segment
+#undef pottery_ring_impl_destroy_bulk
+#undef pottery_ring_impl_copy_in
+#undef pottery_ring_impl_move_out
+#undef pottery_ring_impl_emplace_bulk
 #undef pottery_ring_impl_destroy_all
+#undef pottery_ring_impl_alloc
+#undef pottery_ring_impl_free
+#undef pottery_ring_impl_minimum_capacity
+#undef pottery_ring_impl_shift
+
+// mirrored ring functions
+#undef pottery_ring_read_span
+#undef pottery_ring_write_span
+#undef pottery_ring_commit_span
 
 // common array types and functions
 //!!! AUTOGENERATED:container/unrename.m.h PREFIX:pottery_ring
@@ -68,7 +88,11 @@
     #undef pottery_ring_is_empty
     #undef pottery_ring_at
     #undef pottery_ring_find
+    #undef pottery_ring_find_with_hash
     #undef pottery_ring_contains_key
+    #undef pottery_ring_contains_key_with_hash
+    #undef pottery_ring_find_bulk
+    #undef pottery_ring_contains_bulk
     #undef pottery_ring_first
     #undef pottery_ring_last
     #undef pottery_ring_any
@@ -106,6 +130,7 @@
     #undef pottery_ring_emplace
     #undef pottery_ring_emplace_at
     #undef pottery_ring_emplace_key
+    #undef pottery_ring_emplace_key_with_hash
     #undef pottery_ring_emplace_first
     #undef pottery_ring_emplace_last
     #undef pottery_ring_emplace_before
@@ -141,6 +166,7 @@
     #undef pottery_ring_remove
     #undef pottery_ring_remove_at
     #undef pottery_ring_remove_key
+    #undef pottery_ring_remove_key_with_hash
     #undef pottery_ring_remove_first
     #undef pottery_ring_remove_last
     #undef pottery_ring_remove_and_next
@@ -235,6 +261,48 @@
 
 #undef POTTERY_RING_LIFECYCLE_PREFIX
 
+//!!! AUTOGENERATED:lifecycle/unconfigure.m.h PREFIX:POTTERY_RING_LIFECYCLE
+    // This block is auto-generated. Do not modify until END_AUTOGENERATED.
+
+    // Undefines (forwardable/forwarded) lifecycle configuration on POTTERY_RING_LIFECYCLE
+
+    #undef POTTERY_RING_LIFECYCLE_BY_VALUE
+    #undef POTTERY_RING_LIFECYCLE_DESTROY
+    #undef POTTERY_RING_LIFECYCLE_DESTROY_BY_VALUE
+    #undef POTTERY_RING_LIFECYCLE_INIT
+    #undef POTTERY_RING_LIFECYCLE_INIT_BY_VALUE
+    #undef POTTERY_RING_LIFECYCLE_INIT_COPY
+    #undef POTTERY_RING_LIFECYCLE_INIT_COPY_BY_VALUE
+    #undef POTTERY_RING_LIFECYCLE_INIT_STEAL
+    #undef POTTERY_RING_LIFECYCLE_INIT_STEAL_BY_VALUE
+    #undef POTTERY_RING_LIFECYCLE_MOVE
+    #undef POTTERY_RING_LIFECYCLE_MOVE_BY_VALUE
+    #undef POTTERY_RING_LIFECYCLE_COPY
+    #undef POTTERY_RING_LIFECYCLE_COPY_BY_VALUE
+    #undef POTTERY_RING_LIFECYCLE_STEAL
+    #undef POTTERY_RING_LIFECYCLE_STEAL_BY_VALUE
+    #undef POTTERY_RING_LIFECYCLE_SWAP
+    #undef POTTERY_RING_LIFECYCLE_SWAP_BY_VALUE
+//!!! END_AUTOGENERATED
+
+//!!! AUTOGENERATED:alloc/unconfigure.m.h PREFIX:POTTERY_RING_ALLOC
+    // This block is auto-generated. Do not modify until END_AUTOGENERATED.
+    // Undefines (forwardable/forwarded) alloc configuration on POTTERY_RING_ALLOC
+    #undef POTTERY_RING_ALLOC_CONTEXT_TYPE
+
+    #undef POTTERY_RING_ALLOC_FREE
+    #undef POTTERY_RING_ALLOC_MALLOC
+    #undef POTTERY_RING_ALLOC_ZALLOC
+    #undef POTTERY_RING_ALLOC_REALLOC
+    #undef POTTERY_RING_ALLOC_MALLOC_GOOD_SIZE
+
+    #undef POTTERY_RING_ALLOC_ALIGNED_FREE
+    #undef POTTERY_RING_ALLOC_ALIGNED_MALLOC
+    #undef POTTERY_RING_ALLOC_ALIGNED_ZALLOC
+    #undef POTTERY_RING_ALLOC_ALIGNED_REALLOC
+    #undef POTTERY_RING_ALLOC_ALIGNED_MALLOC_GOOD_SIZE
+//!!! END_AUTOGENERATED
+
 //!!! AUTOGENERATED:lifecycle/unrename.m.h PREFIX:pottery_ring_lifecycle
     // This block is auto-generated. Do not modify until END_AUTOGENERATED.
     // Un-renames lifecycle identifiers with prefix "pottery_ring_lifecycle"
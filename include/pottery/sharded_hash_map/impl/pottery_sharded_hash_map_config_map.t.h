@@ -0,0 +1,302 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2020-2021 11037650 Canada Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef POTTERY_SHARDED_HASH_MAP_IMPL
+#error "This is an internal header. Do not include it."
+#endif
+
+// Each shard is an ordinary open_hash_map. All of the open_hash_map
+// configuration is forwarded to it unchanged.
+
+#define POTTERY_OPEN_HASH_MAP_PREFIX POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX
+#define POTTERY_OPEN_HASH_MAP_EXTERN POTTERY_SHARDED_HASH_MAP_EXTERN
+
+//!!! AUTOGENERATED:container_types/forward.m.h SRC:POTTERY_SHARDED_HASH_MAP DEST:POTTERY_OPEN_HASH_MAP
+    // This block is auto-generated. Do not modify until END_AUTOGENERATED.
+    // Forwards container_types configuration from POTTERY_SHARDED_HASH_MAP to POTTERY_OPEN_HASH_MAP
+
+    // Forward the types
+    #if defined(POTTERY_SHARDED_HASH_MAP_VALUE_TYPE)
+        #define POTTERY_OPEN_HASH_MAP_VALUE_TYPE POTTERY_SHARDED_HASH_MAP_VALUE_TYPE
+    #endif
+    #if defined(POTTERY_SHARDED_HASH_MAP_REF_TYPE)
+        #define POTTERY_OPEN_HASH_MAP_REF_TYPE POTTERY_SHARDED_HASH_MAP_REF_TYPE
+    #endif
+    #if defined(POTTERY_SHARDED_HASH_MAP_KEY_TYPE)
+        #define POTTERY_OPEN_HASH_MAP_KEY_TYPE POTTERY_SHARDED_HASH_MAP_KEY_TYPE
+    #endif
+    #ifdef POTTERY_SHARDED_HASH_MAP_CONTEXT_TYPE
+        #define POTTERY_OPEN_HASH_MAP_CONTEXT_TYPE POTTERY_SHARDED_HASH_MAP_CONTEXT_TYPE
+    #endif
+
+    // Forward the conversion and comparison expressions
+    #if defined(POTTERY_SHARDED_HASH_MAP_REF_KEY)
+        #define POTTERY_OPEN_HASH_MAP_REF_KEY POTTERY_SHARDED_HASH_MAP_REF_KEY
+    #endif
+    #if defined(POTTERY_SHARDED_HASH_MAP_REF_EQUAL)
+        #define POTTERY_OPEN_HASH_MAP_REF_EQUAL POTTERY_SHARDED_HASH_MAP_REF_EQUAL
+    #endif
+//!!! END_AUTOGENERATED
+
+//!!! AUTOGENERATED:lifecycle/forward.m.h SRC:POTTERY_SHARDED_HASH_MAP_LIFECYCLE DEST:POTTERY_OPEN_HASH_MAP_LIFECYCLE
+    // This block is auto-generated. Do not modify until END_AUTOGENERATED.
+
+    // Forwards lifecycle configuration from POTTERY_SHARDED_HASH_MAP_LIFECYCLE to POTTERY_OPEN_HASH_MAP_LIFECYCLE
+
+    #ifdef POTTERY_SHARDED_HASH_MAP_LIFECYCLE_BY_VALUE
+        #define POTTERY_OPEN_HASH_MAP_LIFECYCLE_BY_VALUE POTTERY_SHARDED_HASH_MAP_LIFECYCLE_BY_VALUE
+    #endif
+
+    #ifdef POTTERY_SHARDED_HASH_MAP_LIFECYCLE_DESTROY
+        #define POTTERY_OPEN_HASH_MAP_LIFECYCLE_DESTROY POTTERY_SHARDED_HASH_MAP_LIFECYCLE_DESTROY
+    #endif
+    #ifdef POTTERY_SHARDED_HASH_MAP_LIFECYCLE_DESTROY_BY_VALUE
+        #define POTTERY_OPEN_HASH_MAP_LIFECYCLE_DESTROY_BY_VALUE POTTERY_SHARDED_HASH_MAP_LIFECYCLE_DESTROY_BY_VALUE
+    #endif
+
+    #ifdef POTTERY_SHARDED_HASH_MAP_LIFECYCLE_INIT
+        #define POTTERY_OPEN_HASH_MAP_LIFECYCLE_INIT POTTERY_SHARDED_HASH_MAP_LIFECYCLE_INIT
+    #endif
+    #ifdef POTTERY_SHARDED_HASH_MAP_LIFECYCLE_INIT_BY_VALUE
+        #define POTTERY_OPEN_HASH_MAP_LIFECYCLE_INIT_BY_VALUE POTTERY_SHARDED_HASH_MAP_LIFECYCLE_INIT_BY_VALUE
+    #endif
+
+    #ifdef POTTERY_SHARDED_HASH_MAP_LIFECYCLE_INIT_COPY
+        #define POTTERY_OPEN_HASH_MAP_LIFECYCLE_INIT_COPY POTTERY_SHARDED_HASH_MAP_LIFECYCLE_INIT_COPY
+    #endif
+    #ifdef POTTERY_SHARDED_HASH_MAP_LIFECYCLE_INIT_COPY_BY_VALUE
+        #define POTTERY_OPEN_HASH_MAP_LIFECYCLE_INIT_COPY_BY_VALUE POTTERY_SHARDED_HASH_MAP_LIFECYCLE_INIT_COPY_BY_VALUE
+    #endif
+
+    #ifdef POTTERY_SHARDED_HASH_MAP_LIFECYCLE_INIT_STEAL
+        #define POTTERY_OPEN_HASH_MAP_LIFECYCLE_INIT_STEAL POTTERY_SHARDED_HASH_MAP_LIFECYCLE_INIT_STEAL
+    #endif
+    #ifdef POTTERY_SHARDED_HASH_MAP_LIFECYCLE_INIT_STEAL_BY_VALUE
+        #define POTTERY_OPEN_HASH_MAP_LIFECYCLE_INIT_STEAL_BY_VALUE POTTERY_SHARDED_HASH_MAP_LIFECYCLE_INIT_STEAL_BY_VALUE
+    #endif
+
+    #ifdef POTTERY_SHARDED_HASH_MAP_LIFECYCLE_MOVE
+        #define POTTERY_OPEN_HASH_MAP_LIFECYCLE_MOVE POTTERY_SHARDED_HASH_MAP_LIFECYCLE_MOVE
+    #endif
+    #ifdef POTTERY_SHARDED_HASH_MAP_LIFECYCLE_MOVE_BY_VALUE
+        #define POTTERY_OPEN_HASH_MAP_LIFECYCLE_MOVE_BY_VALUE POTTERY_SHARDED_HASH_MAP_LIFECYCLE_MOVE_BY_VALUE
+    #endif
+
+    #ifdef POTTERY_SHARDED_HASH_MAP_LIFECYCLE_COPY
+        #define POTTERY_OPEN_HASH_MAP_LIFECYCLE_COPY POTTERY_SHARDED_HASH_MAP_LIFECYCLE_COPY
+    #endif
+    #ifdef POTTERY_SHARDED_HASH_MAP_LIFECYCLE_COPY_BY_VALUE
+        #define POTTERY_OPEN_HASH_MAP_LIFECYCLE_COPY_BY_VALUE POTTERY_SHARDED_HASH_MAP_LIFECYCLE_COPY_BY_VALUE
+    #endif
+
+    #ifdef POTTERY_SHARDED_HASH_MAP_LIFECYCLE_STEAL
+        #define POTTERY_OPEN_HASH_MAP_LIFECYCLE_STEAL POTTERY_SHARDED_HASH_MAP_LIFECYCLE_STEAL
+    #endif
+    #ifdef POTTERY_SHARDED_HASH_MAP_LIFECYCLE_STEAL_BY_VALUE
+        #define POTTERY_OPEN_HASH_MAP_LIFECYCLE_STEAL_BY_VALUE POTTERY_SHARDED_HASH_MAP_LIFECYCLE_STEAL_BY_VALUE
+    #endif
+
+    #ifdef POTTERY_SHARDED_HASH_MAP_LIFECYCLE_SWAP
+        #define POTTERY_OPEN_HASH_MAP_LIFECYCLE_SWAP POTTERY_SHARDED_HASH_MAP_LIFECYCLE_SWAP
+    #endif
+    #ifdef POTTERY_SHARDED_HASH_MAP_LIFECYCLE_SWAP_BY_VALUE
+        #define POTTERY_OPEN_HASH_MAP_LIFECYCLE_SWAP_BY_VALUE POTTERY_SHARDED_HASH_MAP_LIFECYCLE_SWAP_BY_VALUE
+    #endif
+//!!! END_AUTOGENERATED
+
+//!!! AUTOGENERATED:alloc/forward.m.h SRC:POTTERY_SHARDED_HASH_MAP_ALLOC DEST:POTTERY_OPEN_HASH_MAP_ALLOC
+    // This block is auto-generated. Do not modify until END_AUTOGENERATED.
+    // Forwards alloc configuration from POTTERY_SHARDED_HASH_MAP_ALLOC to POTTERY_OPEN_HASH_MAP_ALLOC
+    #ifdef POTTERY_SHARDED_HASH_MAP_ALLOC_CONTEXT_TYPE
+        #define POTTERY_OPEN_HASH_MAP_ALLOC_CONTEXT_TYPE POTTERY_SHARDED_HASH_MAP_ALLOC_CONTEXT_TYPE
+    #endif
+
+    #ifdef POTTERY_SHARDED_HASH_MAP_ALLOC_FREE
+        #define POTTERY_OPEN_HASH_MAP_ALLOC_FREE POTTERY_SHARDED_HASH_MAP_ALLOC_FREE
+    #endif
+    #ifdef POTTERY_SHARDED_HASH_MAP_ALLOC_MALLOC
+        #define POTTERY_OPEN_HASH_MAP_ALLOC_MALLOC POTTERY_SHARDED_HASH_MAP_ALLOC_MALLOC
+    #endif
+    #ifdef POTTERY_SHARDED_HASH_MAP_ALLOC_ZALLOC
+        #define POTTERY_OPEN_HASH_MAP_ALLOC_ZALLOC POTTERY_SHARDED_HASH_MAP_ALLOC_ZALLOC
+    #endif
+    #ifdef POTTERY_SHARDED_HASH_MAP_ALLOC_REALLOC
+        #define POTTERY_OPEN_HASH_MAP_ALLOC_REALLOC POTTERY_SHARDED_HASH_MAP_ALLOC_REALLOC
+    #endif
+    #ifdef POTTERY_SHARDED_HASH_MAP_ALLOC_MALLOC_GOOD_SIZE
+        #define POTTERY_OPEN_HASH_MAP_ALLOC_GOOD_SIZE POTTERY_SHARDED_HASH_MAP_ALLOC_MALLOC_USABLE_SIZE
+    #endif
+
+    #ifdef POTTERY_SHARDED_HASH_MAP_ALLOC_EXTENDED_ALIGNMENT
+        #define POTTERY_OPEN_HASH_MAP_ALLOC_EXTENDED_ALIGNMENT POTTERY_SHARDED_HASH_MAP_ALLOC_EXTENDED_ALIGNMENT
+    #endif
+    #ifdef POTTERY_SHARDED_HASH_MAP_ALLOC_ALIGNED_FREE
+        #define POTTERY_OPEN_HASH_MAP_ALLOC_ALIGNED_FREE POTTERY_SHARDED_HASH_MAP_ALLOC_ALIGNED_FREE
+    #endif
+    #ifdef POTTERY_SHARDED_HASH_MAP_ALLOC_ALIGNED_MALLOC
+        #define POTTERY_OPEN_HASH_MAP_ALLOC_ALIGNED_MALLOC POTTERY_SHARDED_HASH_MAP_ALLOC_ALIGNED_MALLOC
+    #endif
+    #ifdef POTTERY_SHARDED_HASH_MAP_ALLOC_ALIGNED_ZALLOC
+        #define POTTERY_OPEN_HASH_MAP_ALLOC_ALIGNED_ZALLOC POTTERY_SHARDED_HASH_MAP_ALLOC_ALIGNED_ZALLOC
+    #endif
+    #ifdef POTTERY_SHARDED_HASH_MAP_ALLOC_ALIGNED_REALLOC
+        #define POTTERY_OPEN_HASH_MAP_ALLOC_ALIGNED_REALLOC POTTERY_SHARDED_HASH_MAP_ALLOC_ALIGNED_REALLOC
+    #endif
+    #ifdef POTTERY_SHARDED_HASH_MAP_ALLOC_ALIGNED_MALLOC_GOOD_SIZE
+        #define POTTERY_OPEN_HASH_MAP_ALLOC_ALIGNED_GOOD_SIZE POTTERY_SHARDED_HASH_MAP_ALLOC_ALIGNED_MALLOC_USABLE_SIZE
+    #endif
+//!!! END_AUTOGENERATED
+
+//!!! AUTOGENERATED:open_hash_table/forward.m.h SRC:POTTERY_SHARDED_HASH_MAP DEST:POTTERY_OPEN_HASH_MAP
+    // This block is auto-generated. Do not modify until END_AUTOGENERATED.
+
+    // Forwards open_hash_table configuration from POTTERY_SHARDED_HASH_MAP to POTTERY_OPEN_HASH_MAP
+    // Note that we don't forward types. These are forwarded (and changed)
+    // separately by wrapping containers.
+
+    #ifdef POTTERY_SHARDED_HASH_MAP_KEY_TYPE
+        #define POTTERY_OPEN_HASH_MAP_KEY_TYPE POTTERY_SHARDED_HASH_MAP_KEY_TYPE
+    #endif
+
+    #ifdef POTTERY_SHARDED_HASH_MAP_KEY_HASH
+        #define POTTERY_OPEN_HASH_MAP_KEY_HASH POTTERY_SHARDED_HASH_MAP_KEY_HASH
+    #endif
+    #ifdef POTTERY_SHARDED_HASH_MAP_REF_KEY
+        #define POTTERY_OPEN_HASH_MAP_REF_KEY POTTERY_SHARDED_HASH_MAP_REF_KEY
+    #endif
+    #ifdef POTTERY_SHARDED_HASH_MAP_KEY_EQUAL
+        #define POTTERY_OPEN_HASH_MAP_KEY_EQUAL POTTERY_SHARDED_HASH_MAP_KEY_EQUAL
+    #endif
+    #ifdef POTTERY_SHARDED_HASH_MAP_KEY_DOUBLE_HASH
+        #define POTTERY_OPEN_HASH_MAP_KEY_DOUBLE_HASH POTTERY_SHARDED_HASH_MAP_KEY_DOUBLE_HASH
+    #endif
+
+    #ifdef POTTERY_SHARDED_HASH_MAP_IS_EMPTY
+        #define POTTERY_OPEN_HASH_MAP_IS_EMPTY POTTERY_SHARDED_HASH_MAP_IS_EMPTY
+    #endif
+    #ifdef POTTERY_SHARDED_HASH_MAP_SET_EMPTY
+        #define POTTERY_OPEN_HASH_MAP_SET_EMPTY POTTERY_SHARDED_HASH_MAP_SET_EMPTY
+    #endif
+    #ifdef POTTERY_SHARDED_HASH_MAP_EMPTY_IS_ZERO
+        #define POTTERY_OPEN_HASH_MAP_EMPTY_IS_ZERO POTTERY_SHARDED_HASH_MAP_EMPTY_IS_ZERO
+    #endif
+
+    #ifdef POTTERY_SHARDED_HASH_MAP_IS_TOMBSTONE
+        #define POTTERY_OPEN_HASH_MAP_IS_TOMBSTONE POTTERY_SHARDED_HASH_MAP_IS_TOMBSTONE
+    #endif
+    #ifdef POTTERY_SHARDED_HASH_MAP_SET_TOMBSTONE
+        #define POTTERY_OPEN_HASH_MAP_SET_TOMBSTONE POTTERY_SHARDED_HASH_MAP_SET_TOMBSTONE
+    #endif
+
+    #ifdef POTTERY_SHARDED_HASH_MAP_IS_VALUE
+        #define POTTERY_OPEN_HASH_MAP_IS_VALUE POTTERY_SHARDED_HASH_MAP_IS_VALUE
+    #endif
+
+    #ifdef POTTERY_SHARDED_HASH_MAP_LINEAR_PROBING
+        #define POTTERY_OPEN_HASH_MAP_LINEAR_PROBING POTTERY_SHARDED_HASH_MAP_LINEAR_PROBING
+    #endif
+    #ifdef POTTERY_SHARDED_HASH_MAP_QUADRATIC_PROBING
+        #define POTTERY_OPEN_HASH_MAP_QUADRATIC_PROBING POTTERY_SHARDED_HASH_MAP_QUADRATIC_PROBING
+    #endif
+    #ifdef POTTERY_SHARDED_HASH_MAP_DOUBLE_HASHING
+        #define POTTERY_OPEN_HASH_MAP_DOUBLE_HASHING POTTERY_SHARDED_HASH_MAP_DOUBLE_HASHING
+    #endif
+    #ifdef POTTERY_SHARDED_HASH_MAP_ROBIN_HOOD_HASHING
+        #define POTTERY_OPEN_HASH_MAP_ROBIN_HOOD_HASHING POTTERY_SHARDED_HASH_MAP_ROBIN_HOOD_HASHING
+    #endif
+
+    #ifdef POTTERY_SHARDED_HASH_MAP_PROBE_DISTANCE
+        #define POTTERY_OPEN_HASH_MAP_PROBE_DISTANCE POTTERY_SHARDED_HASH_MAP_PROBE_DISTANCE
+    #endif
+    #ifdef POTTERY_SHARDED_HASH_MAP_SET_PROBE_DISTANCE
+        #define POTTERY_OPEN_HASH_MAP_SET_PROBE_DISTANCE POTTERY_SHARDED_HASH_MAP_SET_PROBE_DISTANCE
+    #endif
+
+    #ifdef POTTERY_SHARDED_HASH_MAP_HOPSCOTCH_HASHING
+        #define POTTERY_OPEN_HASH_MAP_HOPSCOTCH_HASHING POTTERY_SHARDED_HASH_MAP_HOPSCOTCH_HASHING
+    #endif
+    #ifdef POTTERY_SHARDED_HASH_MAP_HOPSCOTCH_NEIGHBORHOOD
+        #define POTTERY_OPEN_HASH_MAP_HOPSCOTCH_NEIGHBORHOOD POTTERY_SHARDED_HASH_MAP_HOPSCOTCH_NEIGHBORHOOD
+    #endif
+    #ifdef POTTERY_SHARDED_HASH_MAP_HOP_INFO
+        #define POTTERY_OPEN_HASH_MAP_HOP_INFO POTTERY_SHARDED_HASH_MAP_HOP_INFO
+    #endif
+    #ifdef POTTERY_SHARDED_HASH_MAP_SET_HOP_INFO
+        #define POTTERY_OPEN_HASH_MAP_SET_HOP_INFO POTTERY_SHARDED_HASH_MAP_SET_HOP_INFO
+    #endif
+
+    #ifdef POTTERY_SHARDED_HASH_MAP_STORED_HASH
+        #define POTTERY_OPEN_HASH_MAP_STORED_HASH POTTERY_SHARDED_HASH_MAP_STORED_HASH
+    #endif
+    #ifdef POTTERY_SHARDED_HASH_MAP_SET_STORED_HASH
+        #define POTTERY_OPEN_HASH_MAP_SET_STORED_HASH POTTERY_SHARDED_HASH_MAP_SET_STORED_HASH
+    #endif
+//!!! END_AUTOGENERATED
+
+//!!! AUTOGENERATED:open_hash_map/forward.m.h SRC:POTTERY_SHARDED_HASH_MAP DEST:POTTERY_OPEN_HASH_MAP
+    // This block is auto-generated. Do not modify until END_AUTOGENERATED.
+
+    // Forwards open_hash_map configuration from POTTERY_SHARDED_HASH_MAP to POTTERY_OPEN_HASH_MAP
+    // This only forwards the options specific to open_hash_map. The types and the
+    // lifecycle, alloc and open_hash_table configuration must be forwarded
+    // separately.
+
+    #ifdef POTTERY_SHARDED_HASH_MAP_GROUP_PROBING
+        #define POTTERY_OPEN_HASH_MAP_GROUP_PROBING POTTERY_SHARDED_HASH_MAP_GROUP_PROBING
+    #endif
+
+    #ifdef POTTERY_SHARDED_HASH_MAP_STORE_HASH
+        #define POTTERY_OPEN_HASH_MAP_STORE_HASH POTTERY_SHARDED_HASH_MAP_STORE_HASH
+    #endif
+
+    #ifdef POTTERY_SHARDED_HASH_MAP_INCREMENTAL_REHASH
+        #define POTTERY_OPEN_HASH_MAP_INCREMENTAL_REHASH POTTERY_SHARDED_HASH_MAP_INCREMENTAL_REHASH
+    #endif
+    #ifdef POTTERY_SHARDED_HASH_MAP_INCREMENTAL_REHASH_STEP
+        #define POTTERY_OPEN_HASH_MAP_INCREMENTAL_REHASH_STEP POTTERY_SHARDED_HASH_MAP_INCREMENTAL_REHASH_STEP
+    #endif
+
+    #ifdef POTTERY_SHARDED_HASH_MAP_PREFETCH_BATCH
+        #define POTTERY_OPEN_HASH_MAP_PREFETCH_BATCH POTTERY_SHARDED_HASH_MAP_PREFETCH_BATCH
+    #endif
+
+    #ifdef POTTERY_SHARDED_HASH_MAP_MAX_LOAD_FACTOR_NUMERATOR
+        #define POTTERY_OPEN_HASH_MAP_MAX_LOAD_FACTOR_NUMERATOR POTTERY_SHARDED_HASH_MAP_MAX_LOAD_FACTOR_NUMERATOR
+    #endif
+    #ifdef POTTERY_SHARDED_HASH_MAP_MAX_LOAD_FACTOR_DENOMINATOR
+        #define POTTERY_OPEN_HASH_MAP_MAX_LOAD_FACTOR_DENOMINATOR POTTERY_SHARDED_HASH_MAP_MAX_LOAD_FACTOR_DENOMINATOR
+    #endif
+    #ifdef POTTERY_SHARDED_HASH_MAP_MIN_LOAD_FACTOR_NUMERATOR
+        #define POTTERY_OPEN_HASH_MAP_MIN_LOAD_FACTOR_NUMERATOR POTTERY_SHARDED_HASH_MAP_MIN_LOAD_FACTOR_NUMERATOR
+    #endif
+    #ifdef POTTERY_SHARDED_HASH_MAP_MIN_LOAD_FACTOR_DENOMINATOR
+        #define POTTERY_OPEN_HASH_MAP_MIN_LOAD_FACTOR_DENOMINATOR POTTERY_SHARDED_HASH_MAP_MIN_LOAD_FACTOR_DENOMINATOR
+    #endif
+//!!! END_AUTOGENERATED
+
+// Optimistic readers may still be probing arrays that a shard replaces when
+// it grows or shrinks so we take them over and free them later.
+#if POTTERY_SHARDED_HASH_MAP_OPTIMISTIC_READS
+    #define POTTERY_OPEN_HASH_MAP_RETIRE pottery_shm_impl_retire
+#endif
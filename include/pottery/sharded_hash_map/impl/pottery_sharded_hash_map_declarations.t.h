@@ -0,0 +1,141 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2020-2021 11037650 Canada Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef POTTERY_SHARDED_HASH_MAP_IMPL
+#error "This is an internal header. Do not include it."
+#endif
+
+#if POTTERY_SHARDED_HASH_MAP_SPINLOCK
+typedef size_t pottery_shm_lock_t;
+#else
+typedef POTTERY_SHARDED_HASH_MAP_LOCK_TYPE pottery_shm_lock_t;
+#endif
+
+#if POTTERY_SHARDED_HASH_MAP_OPTIMISTIC_READS
+// A retired array. These nodes are allocated separately rather than stored
+// in the arrays themselves since readers may still be probing the arrays.
+typedef struct pottery_shm_retired_t {
+    struct pottery_shm_retired_t* next;
+    void* ptr;
+    size_t alignment;
+} pottery_shm_retired_t;
+#endif
+
+typedef struct pottery_shm_slot_t {
+    // The shard must come first so that we can find the slot of a shard.
+    pottery_shm_shard_t shard;
+
+    pottery_shm_lock_t lock;
+
+    #if POTTERY_SHARDED_HASH_MAP_OPTIMISTIC_READS
+    // The sequence number is odd while a writer has the shard locked.
+    size_t sequence;
+
+    // A list of arrays the shard has replaced. Readers may still be probing
+    // them so they're only freed by reclaim() and destroy().
+    pottery_shm_retired_t* retired;
+    #endif
+
+    char padding[POTTERY_SHARDED_HASH_MAP_PADDING];
+} pottery_shm_slot_t;
+
+struct pottery_shm_t {
+    pottery_shm_slot_t slots[POTTERY_SHARDED_HASH_MAP_SHARD_COUNT];
+};
+
+POTTERY_SHARDED_HASH_MAP_EXTERN
+pottery_error_t pottery_shm_init(pottery_shm_t* map);
+
+/**
+ * Destroys the map. No other thread may be accessing it.
+ */
+POTTERY_SHARDED_HASH_MAP_EXTERN
+void pottery_shm_destroy(pottery_shm_t* map);
+
+static inline
+size_t pottery_shm_count_shards(pottery_shm_t* map) {
+    (void)map;
+    return POTTERY_SHARDED_HASH_MAP_SHARD_COUNT;
+}
+
+/**
+ * Returns the total number of values in all shards.
+ *
+ * The shards are counted one at a time so this may be out of date by the time
+ * it returns if other threads are modifying the map.
+ */
+POTTERY_SHARDED_HASH_MAP_EXTERN
+size_t pottery_shm_count(pottery_shm_t* map);
+
+/**
+ * Finds the value with the given key, copying it into the given value if it
+ * exists. Returns true if the value was found.
+ *
+ * With OPTIMISTIC_READS this doesn't take a lock. It may retry if a writer
+ * modifies the shard at the same time.
+ */
+POTTERY_SHARDED_HASH_MAP_EXTERN
+bool pottery_shm_find_copy(pottery_shm_t* map, pottery_shm_key_t key,
+        pottery_shm_value_t* /*nullable*/ value);
+
+static inline
+bool pottery_shm_contains_key(pottery_shm_t* map, pottery_shm_key_t key) {
+    return pottery_shm_find_copy(map, key, pottery_null);
+}
+
+/**
+ * Locks the shard that holds the given key and returns it.
+ *
+ * The shard is an ordinary open_hash_map. You can use any of its functions
+ * to insert, find or remove the key until you unlock it. Don't insert any
+ * other keys into it and don't keep its entries after unlocking it.
+ */
+POTTERY_SHARDED_HASH_MAP_EXTERN
+pottery_shm_shard_t* pottery_shm_lock_key(pottery_shm_t* map, pottery_shm_key_t key);
+
+/**
+ * Locks the shard at the given index and returns it.
+ *
+ * This can be used to visit or clear all shards. You can find, remove or
+ * iterate over its values but you must not insert anything into it.
+ */
+POTTERY_SHARDED_HASH_MAP_EXTERN
+pottery_shm_shard_t* pottery_shm_lock_index(pottery_shm_t* map, size_t index);
+
+/**
+ * Unlocks a shard returned by lock_key() or lock_index().
+ */
+POTTERY_SHARDED_HASH_MAP_EXTERN
+void pottery_shm_unlock(pottery_shm_t* map, pottery_shm_shard_t* shard);
+
+/**
+ * Frees the arrays that the shards have replaced as they've grown and shrunk.
+ *
+ * With OPTIMISTIC_READS, readers may still be probing these arrays so they
+ * are kept until you call this or destroy the map. You must make sure no
+ * thread is reading the map while this is running (writers are fine.) Without
+ * OPTIMISTIC_READS this does nothing.
+ */
+POTTERY_SHARDED_HASH_MAP_EXTERN
+void pottery_shm_reclaim(pottery_shm_t* map);
@@ -0,0 +1,303 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2020-2021 11037650 Canada Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef POTTERY_SHARDED_HASH_MAP_IMPL
+#error "This is an internal header. Do not include it."
+#endif
+
+static inline
+size_t pottery_shm_impl_key_hash(pottery_shm_key_t key) {
+    return POTTERY_SHARDED_HASH_MAP_KEY_HASH(key);
+}
+
+/*
+ * Returns the slot for a key with the given hash.
+ *
+ * open_hash_map chooses buckets from the high bits of a multiplicative hash.
+ * If we chose shards from the same bits, each shard would only use a small
+ * fraction of its buckets. We instead choose them from the high bits of a
+ * different mix of the hash (the MurmurHash3 finalizer.)
+ */
+static inline
+pottery_shm_slot_t* pottery_shm_impl_slot(pottery_shm_t* map, size_t hash) {
+    #if POTTERY_SHARDED_HASH_MAP_LOG_2_SHARDS == 0
+    (void)hash;
+    return &map->slots[0];
+    #else
+    uint64_t x = pottery_cast(uint64_t, hash);
+    x ^= x >> 33;
+    x *= UINT64_C(0xff51afd7ed558ccd);
+    x ^= x >> 33;
+    x *= UINT64_C(0xc4ceb9fe1a85ec53);
+    x ^= x >> 33;
+    return &map->slots[x >> (64 - POTTERY_SHARDED_HASH_MAP_LOG_2_SHARDS)];
+    #endif
+}
+
+static inline
+void pottery_shm_impl_lock(pottery_shm_slot_t* slot) {
+    #if POTTERY_SHARDED_HASH_MAP_SPINLOCK
+    // Test and test-and-set
+    while (pottery_atomic_exchange_acquire_s(&slot->lock, 1) != 0)
+        while (pottery_atomic_load_relaxed_s(&slot->lock) != 0)
+            pottery_atomic_pause();
+    #else
+    POTTERY_SHARDED_HASH_MAP_LOCK(&slot->lock);
+    #endif
+
+    #if POTTERY_SHARDED_HASH_MAP_OPTIMISTIC_READS
+    pottery_atomic_store_relaxed_s(&slot->sequence,
+            pottery_atomic_load_relaxed_s(&slot->sequence) + 1);
+    pottery_atomic_fence_release();
+    #endif
+}
+
+static inline
+void pottery_shm_impl_unlock(pottery_shm_slot_t* slot) {
+    #if POTTERY_SHARDED_HASH_MAP_OPTIMISTIC_READS
+    pottery_atomic_store_release_s(&slot->sequence,
+            pottery_atomic_load_relaxed_s(&slot->sequence) + 1);
+    #endif
+
+    #if POTTERY_SHARDED_HASH_MAP_SPINLOCK
+    pottery_atomic_store_release_s(&slot->lock, 0);
+    #else
+    POTTERY_SHARDED_HASH_MAP_UNLOCK(&slot->lock);
+    #endif
+}
+
+#if POTTERY_SHARDED_HASH_MAP_OPTIMISTIC_READS
+// Returns true if the shard has been modified since the given sequence
+// number. This must be called after reading anything from the shard and
+// before using what was read.
+static inline
+bool pottery_shm_impl_read_retry(pottery_shm_slot_t* slot, size_t sequence) {
+    pottery_atomic_fence_acquire();
+    return pottery_atomic_load_relaxed_s(&slot->sequence) != sequence;
+}
+
+// Copies the shard into the given snapshot and returns the sequence number
+// at which it was copied.
+//
+// The snapshot is consistent, and the arrays it points to remain allocated
+// until reclaim() even if a writer replaces them, so it's safe to probe it.
+// The contents of the arrays may still change under us so anything read from
+// them must be checked with read_retry() before it's used.
+static inline
+size_t pottery_shm_impl_read_begin(pottery_shm_slot_t* slot, pottery_shm_shard_t* snapshot) {
+    while (true) {
+        size_t sequence = pottery_atomic_load_acquire_s(&slot->sequence);
+        if ((sequence & 1) == 0) {
+            *snapshot = slot->shard;
+            if (!pottery_shm_impl_read_retry(slot, sequence))
+                return sequence;
+        } else {
+            pottery_atomic_pause();
+        }
+    }
+}
+
+POTTERY_SHARDED_HASH_MAP_EXTERN
+void pottery_shm_impl_retire(struct pottery_shm_shard_t* shard, size_t alignment, void* ptr) {
+    pottery_shm_slot_t* slot = pottery_reinterpret_cast(pottery_shm_slot_t*, shard);
+    pottery_shm_retired_t* retired;
+    if (ptr == pottery_null)
+        return;
+
+    // Outside of the lock (i.e. from destroy() or a failed init()) no one can
+    // be reading the shard so the array is freed right away.
+    if ((pottery_atomic_load_relaxed_s(&slot->sequence) & 1) == 0) {
+        pottery_shm_shard_alloc_free(alignment, ptr);
+        return;
+    }
+
+    // The array must not be touched until reclaim() so we record it in a
+    // separate node. If we can't allocate one, we have nowhere to record it
+    // and we can't free it while readers may be probing it so we leak it.
+    retired = pottery_cast(pottery_shm_retired_t*, pottery_shm_shard_alloc_malloc(
+                pottery_alignof(pottery_shm_retired_t), sizeof(pottery_shm_retired_t)));
+    if (retired == pottery_null)
+        return;
+
+    retired->next = slot->retired;
+    retired->ptr = ptr;
+    retired->alignment = alignment;
+    slot->retired = retired;
+}
+
+static
+void pottery_shm_impl_free_retired(pottery_shm_retired_t* retired) {
+    while (retired != pottery_null) {
+        pottery_shm_retired_t* next = retired->next;
+        pottery_shm_shard_alloc_free(retired->alignment, retired->ptr);
+        pottery_shm_shard_alloc_free(pottery_alignof(pottery_shm_retired_t), retired);
+        retired = next;
+    }
+}
+#endif
+
+POTTERY_SHARDED_HASH_MAP_EXTERN
+pottery_error_t pottery_shm_init(pottery_shm_t* map) {
+    size_t i;
+    for (i = 0; i < POTTERY_SHARDED_HASH_MAP_SHARD_COUNT; ++i) {
+        pottery_shm_slot_t* slot = &map->slots[i];
+        pottery_error_t error;
+
+        #if POTTERY_SHARDED_HASH_MAP_SPINLOCK
+        slot->lock = 0;
+        #elif defined(POTTERY_SHARDED_HASH_MAP_LOCK_INIT)
+        POTTERY_SHARDED_HASH_MAP_LOCK_INIT(&slot->lock);
+        #endif
+
+        #if POTTERY_SHARDED_HASH_MAP_OPTIMISTIC_READS
+        slot->sequence = 0;
+        slot->retired = pottery_null;
+        #endif
+
+        error = pottery_shm_shard_init(&slot->shard);
+        if (error != POTTERY_OK) {
+            // Only the slots before this one have shards and locks to
+            // destroy. Their arrays are freed right away since they aren't
+            // locked so there's nothing to reclaim.
+            #if !POTTERY_SHARDED_HASH_MAP_SPINLOCK && defined(POTTERY_SHARDED_HASH_MAP_LOCK_DESTROY)
+            POTTERY_SHARDED_HASH_MAP_LOCK_DESTROY(&slot->lock);
+            #endif
+            while (i > 0) {
+                slot = &map->slots[--i];
+                pottery_shm_shard_destroy(&slot->shard);
+                #if !POTTERY_SHARDED_HASH_MAP_SPINLOCK && defined(POTTERY_SHARDED_HASH_MAP_LOCK_DESTROY)
+                POTTERY_SHARDED_HASH_MAP_LOCK_DESTROY(&slot->lock);
+                #endif
+            }
+            return error;
+        }
+    }
+    return POTTERY_OK;
+}
+
+POTTERY_SHARDED_HASH_MAP_EXTERN
+void pottery_shm_destroy(pottery_shm_t* map) {
+    size_t i;
+    for (i = 0; i < POTTERY_SHARDED_HASH_MAP_SHARD_COUNT; ++i) {
+        pottery_shm_slot_t* slot = &map->slots[i];
+        pottery_shm_shard_destroy(&slot->shard);
+        #if !POTTERY_SHARDED_HASH_MAP_SPINLOCK && defined(POTTERY_SHARDED_HASH_MAP_LOCK_DESTROY)
+        POTTERY_SHARDED_HASH_MAP_LOCK_DESTROY(&slot->lock);
+        #endif
+    }
+    pottery_shm_reclaim(map);
+}
+
+POTTERY_SHARDED_HASH_MAP_EXTERN
+size_t pottery_shm_count(pottery_shm_t* map) {
+    size_t count = 0;
+    size_t i;
+    for (i = 0; i < POTTERY_SHARDED_HASH_MAP_SHARD_COUNT; ++i) {
+        pottery_shm_slot_t* slot = &map->slots[i];
+        #if POTTERY_SHARDED_HASH_MAP_OPTIMISTIC_READS
+        pottery_shm_shard_t snapshot;
+        pottery_shm_impl_read_begin(slot, &snapshot);
+        count += pottery_shm_shard_count(&snapshot);
+        #else
+        pottery_shm_impl_lock(slot);
+        count += pottery_shm_shard_count(&slot->shard);
+        pottery_shm_impl_unlock(slot);
+        #endif
+    }
+    return count;
+}
+
+POTTERY_SHARDED_HASH_MAP_EXTERN
+bool pottery_shm_find_copy(pottery_shm_t* map, pottery_shm_key_t key,
+        pottery_shm_value_t* /*nullable*/ value)
+{
+    // The key is hashed once to choose both the shard and the bucket.
+    size_t hash = pottery_shm_impl_key_hash(key);
+    pottery_shm_slot_t* slot = pottery_shm_impl_slot(map, hash);
+
+    #if POTTERY_SHARDED_HASH_MAP_OPTIMISTIC_READS
+    while (true) {
+        pottery_shm_shard_t snapshot;
+        size_t sequence = pottery_shm_impl_read_begin(slot, &snapshot);
+        pottery_shm_shard_entry_t entry = pottery_shm_shard_find_with_hash(&snapshot, key, hash);
+        bool found = pottery_shm_shard_entry_exists(&snapshot, entry);
+        if (found && value != pottery_null)
+            *value = *entry;
+        if (!pottery_shm_impl_read_retry(slot, sequence))
+            return found;
+    }
+    #else
+    pottery_shm_shard_entry_t entry;
+    bool found;
+    pottery_shm_impl_lock(slot);
+    entry = pottery_shm_shard_find_with_hash(&slot->shard, key, hash);
+    found = pottery_shm_shard_entry_exists(&slot->shard, entry);
+    if (found && value != pottery_null)
+        *value = *entry;
+    pottery_shm_impl_unlock(slot);
+    return found;
+    #endif
+}
+
+POTTERY_SHARDED_HASH_MAP_EXTERN
+pottery_shm_shard_t* pottery_shm_lock_key(pottery_shm_t* map, pottery_shm_key_t key) {
+    pottery_shm_slot_t* slot = pottery_shm_impl_slot(map, pottery_shm_impl_key_hash(key));
+    pottery_shm_impl_lock(slot);
+    return &slot->shard;
+}
+
+POTTERY_SHARDED_HASH_MAP_EXTERN
+pottery_shm_shard_t* pottery_shm_lock_index(pottery_shm_t* map, size_t index) {
+    pottery_shm_slot_t* slot;
+    pottery_assert(index < POTTERY_SHARDED_HASH_MAP_SHARD_COUNT);
+    slot = &map->slots[index];
+    pottery_shm_impl_lock(slot);
+    return &slot->shard;
+}
+
+POTTERY_SHARDED_HASH_MAP_EXTERN
+void pottery_shm_unlock(pottery_shm_t* map, pottery_shm_shard_t* shard) {
+    pottery_shm_slot_t* slot = pottery_reinterpret_cast(pottery_shm_slot_t*, shard);
+    (void)map;
+    pottery_assert(slot >= map->slots && slot < map->slots + POTTERY_SHARDED_HASH_MAP_SHARD_COUNT);
+    pottery_shm_impl_unlock(slot);
+}
+
+POTTERY_SHARDED_HASH_MAP_EXTERN
+void pottery_shm_reclaim(pottery_shm_t* map) {
+    #if POTTERY_SHARDED_HASH_MAP_OPTIMISTIC_READS
+    size_t i;
+    for (i = 0; i < POTTERY_SHARDED_HASH_MAP_SHARD_COUNT; ++i) {
+        pottery_shm_slot_t* slot = &map->slots[i];
+        pottery_shm_retired_t* retired;
+        pottery_shm_impl_lock(slot);
+        retired = slot->retired;
+        slot->retired = pottery_null;
+        pottery_shm_impl_unlock(slot);
+        pottery_shm_impl_free_retired(retired);
+    }
+    #else
+    (void)map;
+    #endif
+}
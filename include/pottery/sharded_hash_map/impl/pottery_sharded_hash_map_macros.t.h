@@ -0,0 +1,335 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2020-2021 11037650 Canada Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef POTTERY_SHARDED_HASH_MAP_IMPL
+#error "This is an internal header. Do not include it."
+#endif
+
+#include "pottery/pottery_dependencies.h"
+
+
+
+/*
+ * Configuration
+ */
+
+#ifndef POTTERY_SHARDED_HASH_MAP_PREFIX
+#error "POTTERY_SHARDED_HASH_MAP_PREFIX is not defined."
+#endif
+
+#ifndef POTTERY_SHARDED_HASH_MAP_EXTERN
+    #define POTTERY_SHARDED_HASH_MAP_EXTERN /*nothing*/
+#endif
+
+#ifndef POTTERY_SHARDED_HASH_MAP_KEY_HASH
+#error "POTTERY_SHARDED_HASH_MAP_KEY_HASH is required."
+#endif
+
+// The shards are shared between threads so there's no sensible place for a
+// per-thread context.
+#ifdef POTTERY_SHARDED_HASH_MAP_CONTEXT_TYPE
+#error "sharded_hash_map does not support a context."
+#endif
+
+// Shards
+// The map is split into this power of two number of shards, each of which is
+// an open_hash_map with its own lock. The default is 16 shards.
+#ifndef POTTERY_SHARDED_HASH_MAP_LOG_2_SHARDS
+    #define POTTERY_SHARDED_HASH_MAP_LOG_2_SHARDS 4
+#endif
+#if POTTERY_SHARDED_HASH_MAP_LOG_2_SHARDS < 0 || POTTERY_SHARDED_HASH_MAP_LOG_2_SHARDS > 16
+    #error "LOG_2_SHARDS must be between 0 and 16."
+#endif
+#define POTTERY_SHARDED_HASH_MAP_SHARD_COUNT \
+        (pottery_cast(size_t, 1) << POTTERY_SHARDED_HASH_MAP_LOG_2_SHARDS)
+
+// Optimistic reads
+// If enabled (the default), lookups don't take locks. They read a shard
+// optimistically and retry if a writer modified it in the meantime. This
+// requires that keys can be compared and values copied while a writer is
+// modifying them; see the README.
+#ifndef POTTERY_SHARDED_HASH_MAP_OPTIMISTIC_READS
+    #define POTTERY_SHARDED_HASH_MAP_OPTIMISTIC_READS 1
+#endif
+
+// Locks
+// By default each shard has a spinlock. You can instead provide your own lock
+// type (e.g. pthread_mutex_t) with LOCK_TYPE, LOCK and UNLOCK and optionally
+// LOCK_INIT and LOCK_DESTROY. These are all given a pointer to the lock.
+#ifdef POTTERY_SHARDED_HASH_MAP_LOCK_TYPE
+    #if !defined(POTTERY_SHARDED_HASH_MAP_LOCK) || !defined(POTTERY_SHARDED_HASH_MAP_UNLOCK)
+        #error "LOCK_TYPE requires LOCK and UNLOCK."
+    #endif
+    #define POTTERY_SHARDED_HASH_MAP_SPINLOCK 0
+#else
+    #define POTTERY_SHARDED_HASH_MAP_SPINLOCK 1
+#endif
+
+#if (POTTERY_SHARDED_HASH_MAP_SPINLOCK || POTTERY_SHARDED_HASH_MAP_OPTIMISTIC_READS) && !POTTERY_ATOMICS
+    #error "sharded_hash_map needs POTTERY_ATOMICS for its spinlocks and optimistic reads."
+#endif
+
+// Each slot is padded by this much so that the fields of neighbouring slots
+// don't share a cache line.
+#define POTTERY_SHARDED_HASH_MAP_PADDING 64
+
+
+
+/*
+ * Renaming
+ */
+
+#define POTTERY_SHARDED_HASH_MAP_NAME(name) POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_PREFIX, name)
+
+// types
+#define pottery_shm_t POTTERY_SHARDED_HASH_MAP_NAME(_t)
+#define pottery_shm_slot_t POTTERY_SHARDED_HASH_MAP_NAME(_slot_t)
+#define pottery_shm_lock_t POTTERY_SHARDED_HASH_MAP_NAME(_lock_t)
+#define pottery_shm_retired_t POTTERY_SHARDED_HASH_MAP_NAME(_retired_t)
+
+// public functions
+#define pottery_shm_init POTTERY_SHARDED_HASH_MAP_NAME(_init)
+#define pottery_shm_destroy POTTERY_SHARDED_HASH_MAP_NAME(_destroy)
+#define pottery_shm_count POTTERY_SHARDED_HASH_MAP_NAME(_count)
+#define pottery_shm_count_shards POTTERY_SHARDED_HASH_MAP_NAME(_count_shards)
+#define pottery_shm_find_copy POTTERY_SHARDED_HASH_MAP_NAME(_find_copy)
+#define pottery_shm_contains_key POTTERY_SHARDED_HASH_MAP_NAME(_contains_key)
+#define pottery_shm_lock_key POTTERY_SHARDED_HASH_MAP_NAME(_lock_key)
+#define pottery_shm_lock_index POTTERY_SHARDED_HASH_MAP_NAME(_lock_index)
+#define pottery_shm_unlock POTTERY_SHARDED_HASH_MAP_NAME(_unlock)
+#define pottery_shm_reclaim POTTERY_SHARDED_HASH_MAP_NAME(_reclaim)
+
+// internal functions
+#define pottery_shm_impl_key_hash POTTERY_SHARDED_HASH_MAP_NAME(_impl_key_hash)
+#define pottery_shm_impl_slot POTTERY_SHARDED_HASH_MAP_NAME(_impl_slot)
+#define pottery_shm_impl_lock POTTERY_SHARDED_HASH_MAP_NAME(_impl_lock)
+#define pottery_shm_impl_unlock POTTERY_SHARDED_HASH_MAP_NAME(_impl_unlock)
+#define pottery_shm_impl_read_begin POTTERY_SHARDED_HASH_MAP_NAME(_impl_read_begin)
+#define pottery_shm_impl_read_retry POTTERY_SHARDED_HASH_MAP_NAME(_impl_read_retry)
+#define pottery_shm_impl_retire POTTERY_SHARDED_HASH_MAP_NAME(_impl_retire)
+#define pottery_shm_impl_free_retired POTTERY_SHARDED_HASH_MAP_NAME(_impl_free_retired)
+
+// shards
+#define POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_PREFIX, _shard)
+//!!! AUTOGENERATED:container/rename.m.h SRC:pottery_shm_shard DEST:POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX
+    // This block is auto-generated. Do not modify until END_AUTOGENERATED.
+    // Renames array identifiers from pottery_shm_shard to POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX
+
+    // types
+    #define pottery_shm_shard_t POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _t)
+    #define pottery_shm_shard_entry_t POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _entry_t)
+    #define pottery_shm_shard_location_t POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _location_t) // currently only used for intrusive maps
+
+    // lifecycle operations
+    #define pottery_shm_shard_copy POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _copy)
+    #define pottery_shm_shard_destroy POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _destroy)
+    #define pottery_shm_shard_init POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _init)
+    #define pottery_shm_shard_init_copy POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _init_copy)
+    #define pottery_shm_shard_init_steal POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _init_steal)
+    #define pottery_shm_shard_move POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _move)
+    #define pottery_shm_shard_steal POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _steal)
+    #define pottery_shm_shard_swap POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _swap)
+
+    // entry operations
+    #define pottery_shm_shard_entry_exists POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _entry_exists)
+    #define pottery_shm_shard_entry_equal POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _entry_equal)
+    #define pottery_shm_shard_entry_ref POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _entry_ref)
+
+    // lookup
+    #define pottery_shm_shard_count POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _count)
+    #define pottery_shm_shard_is_empty POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _is_empty)
+    #define pottery_shm_shard_at POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _at)
+    #define pottery_shm_shard_find POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _find)
+    #define pottery_shm_shard_find_with_hash POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _find_with_hash)
+    #define pottery_shm_shard_contains_key POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _contains_key)
+    #define pottery_shm_shard_contains_key_with_hash POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _contains_key_with_hash)
+    #define pottery_shm_shard_find_bulk POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _find_bulk)
+    #define pottery_shm_shard_contains_bulk POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _contains_bulk)
+    #define pottery_shm_shard_first POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _first)
+    #define pottery_shm_shard_last POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _last)
+    #define pottery_shm_shard_any POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _any)
+
+    // array access
+    #define pottery_shm_shard_select POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _select)
+    #define pottery_shm_shard_index POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _index)
+    #define pottery_shm_shard_shift POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _shift)
+    #define pottery_shm_shard_offset POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _offset)
+    #define pottery_shm_shard_begin POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _begin)
+    #define pottery_shm_shard_end POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _end)
+    #define pottery_shm_shard_next POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _next)
+    #define pottery_shm_shard_previous POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _previous)
+
+    // misc
+    #define pottery_shm_shard_capacity POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _capacity)
+    #define pottery_shm_shard_reserve POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _reserve)
+    #define pottery_shm_shard_shrink POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _shrink)
+
+    // insert
+    #define pottery_shm_shard_insert POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _insert)
+    #define pottery_shm_shard_insert_at POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _insert_at)
+    #define pottery_shm_shard_insert_first POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _insert_first)
+    #define pottery_shm_shard_insert_last POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _insert_last)
+    #define pottery_shm_shard_insert_before POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _insert_before)
+    #define pottery_shm_shard_insert_after POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _insert_after)
+    #define pottery_shm_shard_insert_bulk POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _insert_bulk)
+    #define pottery_shm_shard_insert_at_bulk POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _insert_at_bulk)
+    #define pottery_shm_shard_insert_first_bulk POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _insert_first_bulk)
+    #define pottery_shm_shard_insert_last_bulk POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _insert_last_bulk)
+    #define pottery_shm_shard_insert_before_bulk POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _insert_before_bulk)
+    #define pottery_shm_shard_insert_after_bulk POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _insert_after_bulk)
+
+    // emplace
+    #define pottery_shm_shard_emplace POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _emplace)
+    #define pottery_shm_shard_emplace_at POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _emplace_at)
+    #define pottery_shm_shard_emplace_key POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _emplace_key)
+    #define pottery_shm_shard_emplace_key_with_hash POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _emplace_key_with_hash)
+    #define pottery_shm_shard_emplace_first POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _emplace_first)
+    #define pottery_shm_shard_emplace_last POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _emplace_last)
+    #define pottery_shm_shard_emplace_before POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _emplace_before)
+    #define pottery_shm_shard_emplace_after POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _emplace_after)
+    #define pottery_shm_shard_emplace_bulk POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _emplace_bulk)
+    #define pottery_shm_shard_emplace_at_bulk POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _emplace_at_bulk)
+    #define pottery_shm_shard_emplace_first_bulk POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _emplace_first_bulk)
+    #define pottery_shm_shard_emplace_last_bulk POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _emplace_last_bulk)
+    #define pottery_shm_shard_emplace_before_bulk POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _emplace_before_bulk)
+    #define pottery_shm_shard_emplace_after_bulk POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _emplace_after_bulk)
+
+    // construct
+    #define pottery_shm_shard_construct POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _construct)
+    #define pottery_shm_shard_construct_at POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _construct_at)
+    #define pottery_shm_shard_construct_key POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _construct_key)
+    #define pottery_shm_shard_construct_first POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _construct_first)
+    #define pottery_shm_shard_construct_last POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _construct_last)
+    #define pottery_shm_shard_construct_before POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _construct_before)
+    #define pottery_shm_shard_construct_after POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _construct_after)
+
+    // extract
+    #define pottery_shm_shard_extract POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _extract)
+    #define pottery_shm_shard_extract_at POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _extract_at)
+    #define pottery_shm_shard_extract_key POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _extract_key)
+    #define pottery_shm_shard_extract_first POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _extract_first)
+    #define pottery_shm_shard_extract_first_bulk POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _extract_first_bulk)
+    #define pottery_shm_shard_extract_last POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _extract_last)
+    #define pottery_shm_shard_extract_last_bulk POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _extract_last_bulk)
+    #define pottery_shm_shard_extract_and_next POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _extract_and_next)
+    #define pottery_shm_shard_extract_and_previous POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _extract_and_previous)
+
+    // remove
+    #define pottery_shm_shard_remove POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _remove)
+    #define pottery_shm_shard_remove_at POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _remove_at)
+    #define pottery_shm_shard_remove_key POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _remove_key)
+    #define pottery_shm_shard_remove_key_with_hash POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _remove_key_with_hash)
+    #define pottery_shm_shard_remove_first POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _remove_first)
+    #define pottery_shm_shard_remove_last POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _remove_last)
+    #define pottery_shm_shard_remove_and_next POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _remove_and_next)
+    #define pottery_shm_shard_remove_and_previous POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _remove_and_previous)
+    #define pottery_shm_shard_remove_all POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _remove_all)
+    #define pottery_shm_shard_remove_bulk POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _remove_bulk)
+    #define pottery_shm_shard_remove_at_bulk POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _remove_at_bulk)
+    #define pottery_shm_shard_remove_first_bulk POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _remove_first_bulk)
+    #define pottery_shm_shard_remove_last_bulk POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _remove_last_bulk)
+    #define pottery_shm_shard_remove_at_bulk POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _remove_at_bulk)
+    #define pottery_shm_shard_remove_and_next_bulk POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _remove_and_next_bulk)
+    #define pottery_shm_shard_remove_and_previous_bulk POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _remove_and_previous_bulk)
+
+    // displace
+    #define pottery_shm_shard_displace POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _displace)
+    #define pottery_shm_shard_displace_at POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _displace_at)
+    #define pottery_shm_shard_displace_key POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _displace_key)
+    #define pottery_shm_shard_displace_first POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _displace_first)
+    #define pottery_shm_shard_displace_last POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _displace_last)
+    #define pottery_shm_shard_displace_and_next POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _displace_and_next)
+    #define pottery_shm_shard_displace_and_previous POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _displace_and_previous)
+    #define pottery_shm_shard_displace_all POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _displace_all)
+    #define pottery_shm_shard_displace_bulk POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _displace_bulk)
+    #define pottery_shm_shard_displace_at_bulk POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _displace_at_bulk)
+    #define pottery_shm_shard_displace_first_bulk POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _displace_first_bulk)
+    #define pottery_shm_shard_displace_last_bulk POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _displace_last_bulk)
+    #define pottery_shm_shard_displace_and_next_bulk POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _displace_and_next_bulk)
+    #define pottery_shm_shard_displace_and_previous_bulk POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _displace_and_previous_bulk)
+
+    // link
+    #define pottery_shm_shard_link POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _link)
+    #define pottery_shm_shard_link_first POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _link_first)
+    #define pottery_shm_shard_link_last POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _link_last)
+    #define pottery_shm_shard_link_before POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _link_before)
+    #define pottery_shm_shard_link_after POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _link_after)
+
+    // unlink
+    #define pottery_shm_shard_unlink POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _unlink)
+    #define pottery_shm_shard_unlink_at POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _unlink_at)
+    #define pottery_shm_shard_unlink_key POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _unlink_key)
+    #define pottery_shm_shard_unlink_first POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _unlink_first)
+    #define pottery_shm_shard_unlink_last POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _unlink_last)
+    #define pottery_shm_shard_unlink_and_next POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _unlink_and_next)
+    #define pottery_shm_shard_unlink_and_previous POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _unlink_and_previous)
+    #define pottery_shm_shard_unlink_all POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _unlink_all)
+
+    // special links
+    #define pottery_shm_shard_replace POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _replace)
+    #define pottery_shm_shard_find_location POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _find_location)
+    #define pottery_shm_shard_link_location POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _link_location)
+//!!! END_AUTOGENERATED
+
+// shard types
+//!!! AUTOGENERATED:container_types/rename.m.h SRC:pottery_shm DEST:POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX
+    // This block is auto-generated. Do not modify until END_AUTOGENERATED.
+    // Renames container_types template identifiers from pottery_shm to POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX
+
+    #define pottery_shm_value_t POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _value_t)
+    #define pottery_shm_ref_t POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _ref_t)
+    #define pottery_shm_const_ref_t POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _const_ref_t)
+    #define pottery_shm_key_t POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _key_t)
+    #define pottery_shm_context_t POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _context_t)
+
+    #define pottery_shm_ref_key POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _ref_key)
+    #define pottery_shm_ref_equal POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _ref_equal)
+//!!! END_AUTOGENERATED
+
+// shard alloc functions
+#define POTTERY_SHARDED_HASH_MAP_SHARD_ALLOC_PREFIX POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX, _alloc)
+//!!! AUTOGENERATED:alloc/rename.m.h SRC:pottery_shm_shard_alloc DEST:POTTERY_SHARDED_HASH_MAP_SHARD_ALLOC_PREFIX
+    // This block is auto-generated. Do not modify until END_AUTOGENERATED.
+    // Renames alloc identifiers from pottery_shm_shard_alloc to POTTERY_SHARDED_HASH_MAP_SHARD_ALLOC_PREFIX
+
+    #define pottery_shm_shard_alloc_free POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_ALLOC_PREFIX, _free)
+    #define pottery_shm_shard_alloc_impl_free_ea POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_ALLOC_PREFIX, _impl_free_ea)
+    #define pottery_shm_shard_alloc_impl_free_fa POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_ALLOC_PREFIX, _impl_free_fa)
+
+    #define pottery_shm_shard_alloc_malloc POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_ALLOC_PREFIX, _malloc)
+    #define pottery_shm_shard_alloc_impl_malloc_ea POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_ALLOC_PREFIX, _impl_malloc_ea)
+    #define pottery_shm_shard_alloc_impl_malloc_fa POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_ALLOC_PREFIX, _impl_malloc_fa)
+
+    #define pottery_shm_shard_alloc_malloc_zero POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_ALLOC_PREFIX, _malloc_zero)
+    #define pottery_shm_shard_alloc_impl_malloc_zero_ea POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_ALLOC_PREFIX, _impl_malloc_zero_ea)
+    #define pottery_shm_shard_alloc_impl_malloc_zero_fa POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_ALLOC_PREFIX, _impl_malloc_zero_fa)
+    #define pottery_shm_shard_alloc_impl_malloc_zero_fa_wrap POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_ALLOC_PREFIX, _impl_malloc_zero_fa_wrap)
+
+    #define pottery_shm_shard_alloc_malloc_array_at_least POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_ALLOC_PREFIX, _malloc_array_at_least)
+    #define pottery_shm_shard_alloc_impl_malloc_array_at_least_ea POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_ALLOC_PREFIX, _impl_malloc_array_at_least_ea)
+    #define pottery_shm_shard_alloc_impl_malloc_array_at_least_fa POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_ALLOC_PREFIX, _impl_malloc_array_at_least_fa)
+
+    #define pottery_shm_shard_alloc_malloc_array POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_ALLOC_PREFIX, _malloc_array)
+    #define pottery_shm_shard_alloc_malloc_array_zero POTTERY_CONCAT(POTTERY_SHARDED_HASH_MAP_SHARD_ALLOC_PREFIX, _malloc_array_zero)
+//!!! END_AUTOGENERATED
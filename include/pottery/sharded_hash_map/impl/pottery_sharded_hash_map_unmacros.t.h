@@ -0,0 +1,411 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2020-2021 11037650 Canada Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef POTTERY_SHARDED_HASH_MAP_IMPL
+#error "This is an internal header. Do not include it."
+#endif
+
+
+
+/*
+ * Forwarded configurations
+ */
+
+//!!! AUTOGENERATED:container_types/unconfigure.m.h CONFIG:POTTERY_SHARDED_HASH_MAP
+    // This block is auto-generated. Do not modify until END_AUTOGENERATED.
+    // Undefines (forwardable/forwarded) container_types configuration on POTTERY_SHARDED_HASH_MAP
+
+    // types
+    #undef POTTERY_SHARDED_HASH_MAP_VALUE_TYPE
+    #undef POTTERY_SHARDED_HASH_MAP_REF_TYPE
+    #undef POTTERY_SHARDED_HASH_MAP_ENTRY_TYPE
+    #undef POTTERY_SHARDED_HASH_MAP_KEY_TYPE
+    #undef POTTERY_SHARDED_HASH_MAP_CONTEXT_TYPE
+
+    // Conversion and comparison expressions
+    #undef POTTERY_SHARDED_HASH_MAP_ENTRY_REF
+    #undef POTTERY_SHARDED_HASH_MAP_REF_KEY
+    #undef POTTERY_SHARDED_HASH_MAP_REF_EQUAL
+//!!! END_AUTOGENERATED
+
+//!!! AUTOGENERATED:lifecycle/unconfigure.m.h PREFIX:POTTERY_SHARDED_HASH_MAP_LIFECYCLE
+    // This block is auto-generated. Do not modify until END_AUTOGENERATED.
+
+    // Undefines (forwardable/forwarded) lifecycle configuration on POTTERY_SHARDED_HASH_MAP_LIFECYCLE
+
+    #undef POTTERY_SHARDED_HASH_MAP_LIFECYCLE_BY_VALUE
+    #undef POTTERY_SHARDED_HASH_MAP_LIFECYCLE_DESTROY
+    #undef POTTERY_SHARDED_HASH_MAP_LIFECYCLE_DESTROY_BY_VALUE
+    #undef POTTERY_SHARDED_HASH_MAP_LIFECYCLE_INIT
+    #undef POTTERY_SHARDED_HASH_MAP_LIFECYCLE_INIT_BY_VALUE
+    #undef POTTERY_SHARDED_HASH_MAP_LIFECYCLE_INIT_COPY
+    #undef POTTERY_SHARDED_HASH_MAP_LIFECYCLE_INIT_COPY_BY_VALUE
+    #undef POTTERY_SHARDED_HASH_MAP_LIFECYCLE_INIT_STEAL
+    #undef POTTERY_SHARDED_HASH_MAP_LIFECYCLE_INIT_STEAL_BY_VALUE
+    #undef POTTERY_SHARDED_HASH_MAP_LIFECYCLE_MOVE
+    #undef POTTERY_SHARDED_HASH_MAP_LIFECYCLE_MOVE_BY_VALUE
+    #undef POTTERY_SHARDED_HASH_MAP_LIFECYCLE_COPY
+    #undef POTTERY_SHARDED_HASH_MAP_LIFECYCLE_COPY_BY_VALUE
+    #undef POTTERY_SHARDED_HASH_MAP_LIFECYCLE_STEAL
+    #undef POTTERY_SHARDED_HASH_MAP_LIFECYCLE_STEAL_BY_VALUE
+    #undef POTTERY_SHARDED_HASH_MAP_LIFECYCLE_SWAP
+    #undef POTTERY_SHARDED_HASH_MAP_LIFECYCLE_SWAP_BY_VALUE
+//!!! END_AUTOGENERATED
+
+//!!! AUTOGENERATED:alloc/unconfigure.m.h PREFIX:POTTERY_SHARDED_HASH_MAP_ALLOC
+    // This block is auto-generated. Do not modify until END_AUTOGENERATED.
+    // Undefines (forwardable/forwarded) alloc configuration on POTTERY_SHARDED_HASH_MAP_ALLOC
+    #undef POTTERY_SHARDED_HASH_MAP_ALLOC_CONTEXT_TYPE
+
+    #undef POTTERY_SHARDED_HASH_MAP_ALLOC_FREE
+    #undef POTTERY_SHARDED_HASH_MAP_ALLOC_MALLOC
+    #undef POTTERY_SHARDED_HASH_MAP_ALLOC_ZALLOC
+    #undef POTTERY_SHARDED_HASH_MAP_ALLOC_REALLOC
+    #undef POTTERY_SHARDED_HASH_MAP_ALLOC_MALLOC_GOOD_SIZE
+
+    #undef POTTERY_SHARDED_HASH_MAP_ALLOC_ALIGNED_FREE
+    #undef POTTERY_SHARDED_HASH_MAP_ALLOC_ALIGNED_MALLOC
+    #undef POTTERY_SHARDED_HASH_MAP_ALLOC_ALIGNED_ZALLOC
+    #undef POTTERY_SHARDED_HASH_MAP_ALLOC_ALIGNED_REALLOC
+    #undef POTTERY_SHARDED_HASH_MAP_ALLOC_ALIGNED_MALLOC_GOOD_SIZE
+//!!! END_AUTOGENERATED
+
+//!!! AUTOGENERATED:open_hash_table/unconfigure.m.h PREFIX:POTTERY_SHARDED_HASH_MAP
+    // This block is auto-generated. Do not modify until END_AUTOGENERATED.
+
+    // Undefines (forwardable/forwarded) lifecycle configuration on POTTERY_SHARDED_HASH_MAP
+
+    #undef POTTERY_SHARDED_HASH_MAP_VALUE_TYPE
+    #undef POTTERY_SHARDED_HASH_MAP_REF_TYPE
+    #undef POTTERY_SHARDED_HASH_MAP_KEY_TYPE
+
+    #undef POTTERY_SHARDED_HASH_MAP_KEY_HASH
+    #undef POTTERY_SHARDED_HASH_MAP_KEY_EQUAL
+    #undef POTTERY_SHARDED_HASH_MAP_KEY_DOUBLE_HASH
+    #undef POTTERY_SHARDED_HASH_MAP_REF_KEY
+
+    #undef POTTERY_SHARDED_HASH_MAP_IS_EMPTY
+    #undef POTTERY_SHARDED_HASH_MAP_SET_EMPTY
+    #undef POTTERY_SHARDED_HASH_MAP_EMPTY_IS_ZERO
+
+    #undef POTTERY_SHARDED_HASH_MAP_IS_TOMBSTONE
+    #undef POTTERY_SHARDED_HASH_MAP_SET_TOMBSTONE
+
+    #undef POTTERY_SHARDED_HASH_MAP_IS_VALUE
+
+    #undef POTTERY_SHARDED_HASH_MAP_LINEAR_PROBING
+    #undef POTTERY_SHARDED_HASH_MAP_QUADRATIC_PROBING
+    #undef POTTERY_SHARDED_HASH_MAP_DOUBLE_HASHING
+    #undef POTTERY_SHARDED_HASH_MAP_DOUBLE_HASH_PROBE
+    #undef POTTERY_SHARDED_HASH_MAP_ROBIN_HOOD_HASHING
+
+    #undef POTTERY_SHARDED_HASH_MAP_PROBE_DISTANCE
+    #undef POTTERY_SHARDED_HASH_MAP_SET_PROBE_DISTANCE
+    #undef POTTERY_SHARDED_HASH_MAP_HOPSCOTCH_HASHING
+    #undef POTTERY_SHARDED_HASH_MAP_HOPSCOTCH_NEIGHBORHOOD
+    #undef POTTERY_SHARDED_HASH_MAP_HOP_INFO
+    #undef POTTERY_SHARDED_HASH_MAP_SET_HOP_INFO
+    #undef POTTERY_SHARDED_HASH_MAP_STORED_HASH
+    #undef POTTERY_SHARDED_HASH_MAP_SET_STORED_HASH
+    #undef POTTERY_SHARDED_HASH_MAP_SEED
+//!!! END_AUTOGENERATED
+
+//!!! AUTOGENERATED:open_hash_map/unconfigure.m.h PREFIX:POTTERY_SHARDED_HASH_MAP
+    // This block is auto-generated. Do not modify until END_AUTOGENERATED.
+
+    // Undefines (forwardable/forwarded) open_hash_map configuration on POTTERY_SHARDED_HASH_MAP
+    // This only includes the options specific to open_hash_map.
+
+    #undef POTTERY_SHARDED_HASH_MAP_GROUP_PROBING
+
+    #undef POTTERY_SHARDED_HASH_MAP_STORE_HASH
+
+    #undef POTTERY_SHARDED_HASH_MAP_INCREMENTAL_REHASH
+    #undef POTTERY_SHARDED_HASH_MAP_INCREMENTAL_REHASH_STEP
+
+    #undef POTTERY_SHARDED_HASH_MAP_PREFETCH_BATCH
+
+    #undef POTTERY_SHARDED_HASH_MAP_MAX_LOAD_FACTOR_NUMERATOR
+    #undef POTTERY_SHARDED_HASH_MAP_MAX_LOAD_FACTOR_DENOMINATOR
+    #undef POTTERY_SHARDED_HASH_MAP_MIN_LOAD_FACTOR_NUMERATOR
+    #undef POTTERY_SHARDED_HASH_MAP_MIN_LOAD_FACTOR_DENOMINATOR
+//!!! END_AUTOGENERATED
+
+
+
+/*
+ * Configuration
+ */
+
+#undef POTTERY_SHARDED_HASH_MAP_PREFIX
+#undef POTTERY_SHARDED_HASH_MAP_NAME
+#undef POTTERY_SHARDED_HASH_MAP_EXTERN
+#undef POTTERY_SHARDED_HASH_MAP_LOG_2_SHARDS
+#undef POTTERY_SHARDED_HASH_MAP_SHARD_COUNT
+#undef POTTERY_SHARDED_HASH_MAP_OPTIMISTIC_READS
+#undef POTTERY_SHARDED_HASH_MAP_LOCK_TYPE
+#undef POTTERY_SHARDED_HASH_MAP_LOCK
+#undef POTTERY_SHARDED_HASH_MAP_UNLOCK
+#undef POTTERY_SHARDED_HASH_MAP_LOCK_INIT
+#undef POTTERY_SHARDED_HASH_MAP_LOCK_DESTROY
+#undef POTTERY_SHARDED_HASH_MAP_SPINLOCK
+#undef POTTERY_SHARDED_HASH_MAP_PADDING
+#undef POTTERY_SHARDED_HASH_MAP_SHARD_PREFIX
+#undef POTTERY_SHARDED_HASH_MAP_SHARD_ALLOC_PREFIX
+
+
+
+/*
+ * Renames
+ */
+
+// types
+#undef pottery_shm_t
+#undef pottery_shm_slot_t
+#undef pottery_shm_lock_t
+#undef pottery_shm_retired_t
+
+// public functions
+#undef pottery_shm_init
+#undef pottery_shm_destroy
+#undef pottery_shm_count
+#undef pottery_shm_count_shards
+#undef pottery_shm_find_copy
+#undef pottery_shm_contains_key
+#undef pottery_shm_lock_key
+#undef pottery_shm_lock_index
+#undef pottery_shm_unlock
+#undef pottery_shm_reclaim
+
+// internal functions
+#undef pottery_shm_impl_key_hash
+#undef pottery_shm_impl_slot
+#undef pottery_shm_impl_lock
+#undef pottery_shm_impl_unlock
+#undef pottery_shm_impl_read_begin
+#undef pottery_shm_impl_read_retry
+#undef pottery_shm_impl_retire
+#undef pottery_shm_impl_free_retired
+
+// shards
+//!!! AUTOGENERATED:container/unrename.m.h PREFIX:pottery_shm_shard
+    // This block is auto-generated. Do not modify until END_AUTOGENERATED.
+    // Un-renames array identifiers with prefix "pottery_shm_shard"
+
+    // types
+    #undef pottery_shm_shard_t
+    #undef pottery_shm_shard_entry_t
+    #undef pottery_shm_shard_location_t // currently only used for intrusive maps
+
+    // lifecycle operations
+    #undef pottery_shm_shard_copy
+    #undef pottery_shm_shard_destroy
+    #undef pottery_shm_shard_init
+    #undef pottery_shm_shard_init_copy
+    #undef pottery_shm_shard_init_steal
+    #undef pottery_shm_shard_move
+    #undef pottery_shm_shard_steal
+    #undef pottery_shm_shard_swap
+
+    // entry operations
+    #undef pottery_shm_shard_entry_exists
+    #undef pottery_shm_shard_entry_equal
+    #undef pottery_shm_shard_entry_ref
+
+    // lookup
+    #undef pottery_shm_shard_count
+    #undef pottery_shm_shard_is_empty
+    #undef pottery_shm_shard_at
+    #undef pottery_shm_shard_find
+    #undef pottery_shm_shard_find_with_hash
+    #undef pottery_shm_shard_contains_key
+    #undef pottery_shm_shard_contains_key_with_hash
+    #undef pottery_shm_shard_find_bulk
+    #undef pottery_shm_shard_contains_bulk
+    #undef pottery_shm_shard_first
+    #undef pottery_shm_shard_last
+    #undef pottery_shm_shard_any
+
+    // array access
+    #undef pottery_shm_shard_select
+    #undef pottery_shm_shard_index
+    #undef pottery_shm_shard_shift
+    #undef pottery_shm_shard_offset
+    #undef pottery_shm_shard_begin
+    #undef pottery_shm_shard_end
+    #undef pottery_shm_shard_next
+    #undef pottery_shm_shard_previous
+
+    // misc
+    #undef pottery_shm_shard_capacity
+    #undef pottery_shm_shard_reserve
+    #undef pottery_shm_shard_shrink
+
+    // insert
+    #undef pottery_shm_shard_insert
+    #undef pottery_shm_shard_insert_at
+    #undef pottery_shm_shard_insert_first
+    #undef pottery_shm_shard_insert_last
+    #undef pottery_shm_shard_insert_before
+    #undef pottery_shm_shard_insert_after
+    #undef pottery_shm_shard_insert_bulk
+    #undef pottery_shm_shard_insert_at_bulk
+    #undef pottery_shm_shard_insert_first_bulk
+    #undef pottery_shm_shard_insert_last_bulk
+    #undef pottery_shm_shard_insert_before_bulk
+    #undef pottery_shm_shard_insert_after_bulk
+
+    // emplace
+    #undef pottery_shm_shard_emplace
+    #undef pottery_shm_shard_emplace_at
+    #undef pottery_shm_shard_emplace_key
+    #undef pottery_shm_shard_emplace_key_with_hash
+    #undef pottery_shm_shard_emplace_first
+    #undef pottery_shm_shard_emplace_last
+    #undef pottery_shm_shard_emplace_before
+    #undef pottery_shm_shard_emplace_after
+    #undef pottery_shm_shard_emplace_bulk
+    #undef pottery_shm_shard_emplace_at_bulk
+    #undef pottery_shm_shard_emplace_first_bulk
+    #undef pottery_shm_shard_emplace_last_bulk
+    #undef pottery_shm_shard_emplace_before_bulk
+    #undef pottery_shm_shard_emplace_after_bulk
+
+    // construct
+    #undef pottery_shm_shard_construct
+    #undef pottery_shm_shard_construct_at
+    #undef pottery_shm_shard_construct_key
+    #undef pottery_shm_shard_construct_first
+    #undef pottery_shm_shard_construct_last
+    #undef pottery_shm_shard_construct_before
+    #undef pottery_shm_shard_construct_after
+
+    // extract
+    #undef pottery_shm_shard_extract
+    #undef pottery_shm_shard_extract_at
+    #undef pottery_shm_shard_extract_key
+    #undef pottery_shm_shard_extract_first
+    #undef pottery_shm_shard_extract_first_bulk
+    #undef pottery_shm_shard_extract_last
+    #undef pottery_shm_shard_extract_last_bulk
+    #undef pottery_shm_shard_extract_and_next
+    #undef pottery_shm_shard_extract_and_previous
+
+    // remove
+    #undef pottery_shm_shard_remove
+    #undef pottery_shm_shard_remove_at
+    #undef pottery_shm_shard_remove_key
+    #undef pottery_shm_shard_remove_key_with_hash
+    #undef pottery_shm_shard_remove_first
+    #undef pottery_shm_shard_remove_last
+    #undef pottery_shm_shard_remove_and_next
+    #undef pottery_shm_shard_remove_and_previous
+    #undef pottery_shm_shard_remove_all
+    #undef pottery_shm_shard_remove_bulk
+    #undef pottery_shm_shard_remove_at_bulk
+    #undef pottery_shm_shard_remove_first_bulk
+    #undef pottery_shm_shard_remove_last_bulk
+    #undef pottery_shm_shard_remove_at_bulk
+    #undef pottery_shm_shard_remove_and_next_bulk
+    #undef pottery_shm_shard_remove_and_previous_bulk
+
+    // displace
+    #undef pottery_shm_shard_displace
+    #undef pottery_shm_shard_displace_at
+    #undef pottery_shm_shard_displace_key
+    #undef pottery_shm_shard_displace_first
+    #undef pottery_shm_shard_displace_last
+    #undef pottery_shm_shard_displace_and_next
+    #undef pottery_shm_shard_displace_and_previous
+    #undef pottery_shm_shard_displace_all
+    #undef pottery_shm_shard_displace_bulk
+    #undef pottery_shm_shard_displace_at_bulk
+    #undef pottery_shm_shard_displace_first_bulk
+    #undef pottery_shm_shard_displace_last_bulk
+    #undef pottery_shm_shard_displace_and_next_bulk
+    #undef pottery_shm_shard_displace_and_previous_bulk
+
+    // link
+    #undef pottery_shm_shard_link
+    #undef pottery_shm_shard_link_first
+    #undef pottery_shm_shard_link_last
+    #undef pottery_shm_shard_link_before
+    #undef pottery_shm_shard_link_after
+
+    // unlink
+    #undef pottery_shm_shard_unlink
+    #undef pottery_shm_shard_unlink_at
+    #undef pottery_shm_shard_unlink_key
+    #undef pottery_shm_shard_unlink_first
+    #undef pottery_shm_shard_unlink_last
+    #undef pottery_shm_shard_unlink_and_next
+    #undef pottery_shm_shard_unlink_and_previous
+    #undef pottery_shm_shard_unlink_all
+
+    // special links
+    #undef pottery_shm_shard_replace
+    #undef pottery_shm_shard_find_location
+    #undef pottery_shm_shard_link_location
+//!!! END_AUTOGENERATED
+
+// shard types
+//!!! AUTOGENERATED:container_types/unrename.m.h PREFIX:pottery_shm
+    // This block is auto-generated. Do not modify until END_AUTOGENERATED.
+    // Unrenames container_types template identifiers from pottery_shm
+
+    #undef pottery_shm_value_t
+    #undef pottery_shm_ref_t
+    #undef pottery_shm_const_ref_t
+    #undef pottery_shm_key_t
+    #undef pottery_shm_context_t
+
+    #undef pottery_shm_ref_key
+    #undef pottery_shm_ref_equal
+//!!! END_AUTOGENERATED
+
+// shard alloc functions
+//!!! AUTOGENERATED:alloc/unrename.m.h PREFIX:pottery_shm_shard_alloc
+    // This block is auto-generated. Do not modify until END_AUTOGENERATED.
+    // Un-renames alloc identifiers with prefix "pottery_shm_shard_alloc"
+
+    #undef pottery_shm_shard_alloc_free
+    #undef pottery_shm_shard_alloc_impl_free_ea
+    #undef pottery_shm_shard_alloc_impl_free_fa
+
+    #undef pottery_shm_shard_alloc_malloc
+    #undef pottery_shm_shard_alloc_impl_malloc_ea
+    #undef pottery_shm_shard_alloc_impl_malloc_fa
+
+    #undef pottery_shm_shard_alloc_malloc_zero
+    #undef pottery_shm_shard_alloc_impl_malloc_zero_ea
+    #undef pottery_shm_shard_alloc_impl_malloc_zero_fa
+    #undef pottery_shm_shard_alloc_impl_malloc_zero_fa_wrap
+
+    #undef pottery_shm_shard_alloc_malloc_array_at_least
+    #undef pottery_shm_shard_alloc_impl_malloc_array_at_least_ea
+    #undef pottery_shm_shard_alloc_impl_malloc_array_at_least_fa
+
+    #undef pottery_shm_shard_alloc_malloc_array
+    #undef pottery_shm_shard_alloc_malloc_array_zero
+//!!! END_AUTOGENERATED
@@ -0,0 +1,306 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2020-2021 11037650 Canada Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef POTTERY_SPSC_QUEUE_IMPL
+#error "This is an internal header. Do not include it."
+#endif
+
+typedef pottery_spsc_queue_value_t* pottery_spsc_queue_entry_t;
+
+/**
+ * A fixed-capacity lock-free queue for passing values from a single producer
+ * thread to a single consumer thread.
+ *
+ * Only the producer may call try_emplace(), commit() and try_push() (and
+ * their bulk variants.) Only the consumer may call try_peek(), displace(),
+ * remove() and try_pop() (and their bulk variants.) init() and destroy() must
+ * not run concurrently with anything else.
+ *
+ * The head and tail are free-running counters; they are masked to find their
+ * slots in the buffer, whose capacity is a power of two.
+ */
+typedef struct pottery_spsc_queue_t {
+    pottery_spsc_queue_value_t* values;
+    size_t mask;
+
+    char padding0[POTTERY_SPSC_QUEUE_PADDING];
+
+    // Written by the producer. The producer keeps a copy of the head so that
+    // it only needs to read the consumer's cache line when the queue looks
+    // full.
+    size_t tail;
+    size_t cached_head;
+
+    char padding1[POTTERY_SPSC_QUEUE_PADDING];
+
+    // Written by the consumer. Likewise it keeps a copy of the tail.
+    size_t head;
+    size_t cached_tail;
+
+    char padding2[POTTERY_SPSC_QUEUE_PADDING];
+} pottery_spsc_queue_t;
+
+#if POTTERY_FORWARD_DECLARATIONS
+/**
+ * Initializes a queue that can hold at least the given number of values.
+ *
+ * The capacity is rounded up to a power of two.
+ */
+POTTERY_SPSC_QUEUE_EXTERN
+pottery_error_t pottery_spsc_queue_init(pottery_spsc_queue_t* queue, size_t capacity);
+
+/**
+ * Destroys the queue, destroying any values that remain in it.
+ */
+POTTERY_SPSC_QUEUE_EXTERN
+void pottery_spsc_queue_destroy(pottery_spsc_queue_t* queue);
+#endif
+
+static inline
+size_t pottery_spsc_queue_capacity(pottery_spsc_queue_t* queue) {
+    return queue->mask + 1;
+}
+
+/**
+ * Returns the number of values in the queue.
+ *
+ * This can be called from any thread but it may be out of date by the time it
+ * returns if the producer or consumer is using the queue.
+ */
+static inline
+size_t pottery_spsc_queue_count(pottery_spsc_queue_t* queue) {
+    // The head is read first so it can't be past the tail we read afterwards.
+    size_t head = pottery_atomic_load_acquire_s(&queue->head);
+    size_t tail = pottery_atomic_load_acquire_s(&queue->tail);
+    return pottery_min_s(tail - head, pottery_spsc_queue_capacity(queue));
+}
+
+static inline
+bool pottery_spsc_queue_is_empty(pottery_spsc_queue_t* queue) {
+    return pottery_spsc_queue_count(queue) == 0;
+}
+
+
+
+/*
+ * Producer functions
+ */
+
+static inline
+size_t pottery_spsc_queue_impl_free_space(pottery_spsc_queue_t* queue, size_t tail) {
+    return pottery_spsc_queue_capacity(queue) - (tail - queue->cached_head);
+}
+
+/**
+ * Finds room for up to the given number of values at the end of the queue,
+ * returning the number of contiguous slots available and the first slot in
+ * entry. Returns 0 if the queue is full.
+ *
+ * Construct values in the returned slots and then publish them to the
+ * consumer with commit_bulk(). Fewer slots than requested may be returned if
+ * the free space wraps around the end of the buffer; commit these and call
+ * this again to get the rest.
+ */
+static inline
+size_t pottery_spsc_queue_try_emplace_bulk(pottery_spsc_queue_t* queue,
+        size_t count, pottery_spsc_queue_entry_t* entry)
+{
+    size_t tail = pottery_atomic_load_relaxed_s(&queue->tail);
+    size_t space = pottery_spsc_queue_impl_free_space(queue, tail);
+    if (space < count) {
+        queue->cached_head = pottery_atomic_load_acquire_s(&queue->head);
+        space = pottery_spsc_queue_impl_free_space(queue, tail);
+    }
+
+    size_t offset = tail & queue->mask;
+    *entry = queue->values + offset;
+    return pottery_min_s(pottery_min_s(count, space),
+            pottery_spsc_queue_capacity(queue) - offset);
+}
+
+/**
+ * Publishes the given number of values constructed in slots returned by
+ * try_emplace_bulk().
+ */
+static inline
+void pottery_spsc_queue_commit_bulk(pottery_spsc_queue_t* queue, size_t count) {
+    size_t tail = pottery_atomic_load_relaxed_s(&queue->tail);
+    pottery_assert(tail + count - queue->cached_head <= pottery_spsc_queue_capacity(queue));
+    pottery_atomic_store_release_s(&queue->tail, tail + count);
+}
+
+/**
+ * Finds room for a value at the end of the queue, returning false if the
+ * queue is full. Construct the value in entry and then call commit().
+ */
+static inline
+bool pottery_spsc_queue_try_emplace(pottery_spsc_queue_t* queue, pottery_spsc_queue_entry_t* entry) {
+    return pottery_spsc_queue_try_emplace_bulk(queue, 1, entry) == 1;
+}
+
+static inline
+void pottery_spsc_queue_commit(pottery_spsc_queue_t* queue) {
+    pottery_spsc_queue_commit_bulk(queue, 1);
+}
+
+
+
+/*
+ * Consumer functions
+ */
+
+static inline
+size_t pottery_spsc_queue_impl_available(pottery_spsc_queue_t* queue, size_t head) {
+    return queue->cached_tail - head;
+}
+
+/**
+ * Finds up to the given number of values at the front of the queue,
+ * returning the number of contiguous values available and the first value in
+ * entry. Returns 0 if the queue is empty.
+ *
+ * The values remain in the queue until you call displace_bulk() or
+ * remove_bulk(). As with try_emplace_bulk(), fewer values than requested may
+ * be returned if they wrap around the end of the buffer.
+ */
+static inline
+size_t pottery_spsc_queue_try_peek_bulk(pottery_spsc_queue_t* queue,
+        size_t count, pottery_spsc_queue_entry_t* entry)
+{
+    size_t head = pottery_atomic_load_relaxed_s(&queue->head);
+    size_t available = pottery_spsc_queue_impl_available(queue, head);
+    if (available < count) {
+        queue->cached_tail = pottery_atomic_load_acquire_s(&queue->tail);
+        available = pottery_spsc_queue_impl_available(queue, head);
+    }
+
+    size_t offset = head & queue->mask;
+    *entry = queue->values + offset;
+    return pottery_min_s(pottery_min_s(count, available),
+            pottery_spsc_queue_capacity(queue) - offset);
+}
+
+/**
+ * Removes the given number of values from the front of the queue without
+ * destroying them, handing their slots back to the producer. The values must
+ * have been returned by try_peek_bulk() (or try_peek().)
+ */
+static inline
+void pottery_spsc_queue_displace_bulk(pottery_spsc_queue_t* queue, size_t count) {
+    size_t head = pottery_atomic_load_relaxed_s(&queue->head);
+    pottery_assert(count <= pottery_spsc_queue_impl_available(queue, head));
+    pottery_atomic_store_release_s(&queue->head, head + count);
+}
+
+/**
+ * Finds the value at the front of the queue, returning false if the queue is
+ * empty. Call displace() or remove() when you're done with it.
+ */
+static inline
+bool pottery_spsc_queue_try_peek(pottery_spsc_queue_t* queue, pottery_spsc_queue_entry_t* entry) {
+    return pottery_spsc_queue_try_peek_bulk(queue, 1, entry) == 1;
+}
+
+static inline
+void pottery_spsc_queue_displace(pottery_spsc_queue_t* queue) {
+    pottery_spsc_queue_displace_bulk(queue, 1);
+}
+
+#if POTTERY_LIFECYCLE_CAN_DESTROY
+#if POTTERY_FORWARD_DECLARATIONS
+/**
+ * Destroys and removes the given number of values from the front of the
+ * queue. The values must have been returned by try_peek_bulk() (or
+ * try_peek().)
+ */
+POTTERY_SPSC_QUEUE_EXTERN
+void pottery_spsc_queue_remove_bulk(pottery_spsc_queue_t* queue, size_t count);
+#endif
+
+static inline
+void pottery_spsc_queue_remove(pottery_spsc_queue_t* queue) {
+    pottery_spsc_queue_remove_bulk(queue, 1);
+}
+#endif
+
+
+
+/*
+ * Pass-by-value functions
+ */
+
+#if POTTERY_LIFECYCLE_CAN_PASS
+/**
+ * Moves the given value into the end of the queue, returning false if the
+ * queue is full. (Only the producer may call this.)
+ */
+static inline
+bool pottery_spsc_queue_try_push(pottery_spsc_queue_t* queue, pottery_spsc_queue_value_t value) {
+    pottery_spsc_queue_entry_t entry;
+    if (!pottery_spsc_queue_try_emplace(queue, &entry))
+        return false;
+    pottery_move_construct(pottery_spsc_queue_value_t, *entry, value);
+    pottery_spsc_queue_commit(queue);
+    return true;
+}
+
+/**
+ * Moves the value at the front of the queue into the given value, returning
+ * false if the queue is empty. (Only the consumer may call this.)
+ */
+static inline
+bool pottery_spsc_queue_try_pop(pottery_spsc_queue_t* queue, pottery_spsc_queue_value_t* value) {
+    pottery_spsc_queue_entry_t entry;
+    if (!pottery_spsc_queue_try_peek(queue, &entry))
+        return false;
+    *value = pottery_move_if_cxx(*entry);
+    #ifdef __cplusplus
+    // see pottery_vector_extract() for details
+    entry->~pottery_spsc_queue_value_t();
+    #endif
+    pottery_spsc_queue_displace(queue);
+    return true;
+}
+
+#if POTTERY_FORWARD_DECLARATIONS
+/**
+ * Copies as many of the given values as will fit into the end of the queue,
+ * returning the number copied. (Only the producer may call this.)
+ *
+ * The values are published to the consumer all at once.
+ */
+POTTERY_SPSC_QUEUE_EXTERN
+size_t pottery_spsc_queue_try_push_bulk(pottery_spsc_queue_t* queue,
+        const pottery_spsc_queue_value_t* values, size_t count);
+
+/**
+ * Moves up to the given number of values from the front of the queue into
+ * the given array, returning the number moved. (Only the consumer may call
+ * this.)
+ */
+POTTERY_SPSC_QUEUE_EXTERN
+size_t pottery_spsc_queue_try_pop_bulk(pottery_spsc_queue_t* queue,
+        pottery_spsc_queue_value_t* values, size_t count);
+#endif
+#endif
@@ -0,0 +1,170 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2020-2021 11037650 Canada Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef POTTERY_SPSC_QUEUE_IMPL
+#error "This is an internal header. Do not include it."
+#endif
+
+#if POTTERY_LIFECYCLE_CAN_DESTROY
+/*
+ * Destroys count values starting at the given counter, wrapping around the
+ * end of the buffer if necessary.
+ */
+static inline
+void pottery_spsc_queue_impl_destroy_bulk(pottery_spsc_queue_t* queue, size_t head, size_t count) {
+    size_t offset = head & queue->mask;
+    size_t part1 = pottery_min_s(count, pottery_spsc_queue_capacity(queue) - offset);
+    pottery_spsc_queue_lifecycle_destroy_bulk(queue->values + offset, part1);
+    pottery_spsc_queue_lifecycle_destroy_bulk(queue->values, count - part1);
+}
+#endif
+
+POTTERY_SPSC_QUEUE_EXTERN
+pottery_error_t pottery_spsc_queue_init(pottery_spsc_queue_t* queue, size_t capacity) {
+    size_t rounded = 1;
+    while (rounded < capacity) {
+        // We limit the overall size so we don't need to do overflow checks.
+        if (rounded > SIZE_MAX / 4)
+            return POTTERY_ERROR_ALLOC;
+        rounded *= 2;
+    }
+
+    queue->values = pottery_cast(pottery_spsc_queue_value_t*,
+            pottery_spsc_queue_alloc_malloc_array(
+                pottery_alignof(pottery_spsc_queue_value_t),
+                rounded,
+                sizeof(pottery_spsc_queue_value_t)));
+    if (queue->values == pottery_null)
+        return POTTERY_ERROR_ALLOC;
+
+    queue->mask = rounded - 1;
+    queue->tail = 0;
+    queue->cached_head = 0;
+    queue->head = 0;
+    queue->cached_tail = 0;
+    return POTTERY_OK;
+}
+
+POTTERY_SPSC_QUEUE_EXTERN
+void pottery_spsc_queue_destroy(pottery_spsc_queue_t* queue) {
+    #if POTTERY_LIFECYCLE_CAN_DESTROY
+    pottery_spsc_queue_impl_destroy_bulk(queue, queue->head, queue->tail - queue->head);
+    #else
+    // Without a destroy expression it is an error to destroy a non-empty
+    // container.
+    pottery_assert(queue->head == queue->tail);
+    #endif
+
+    pottery_spsc_queue_alloc_free(pottery_alignof(pottery_spsc_queue_value_t), queue->values);
+}
+
+#if POTTERY_LIFECYCLE_CAN_DESTROY
+POTTERY_SPSC_QUEUE_EXTERN
+void pottery_spsc_queue_remove_bulk(pottery_spsc_queue_t* queue, size_t count) {
+    size_t head = pottery_atomic_load_relaxed_s(&queue->head);
+    pottery_assert(count <= pottery_spsc_queue_impl_available(queue, head));
+    pottery_spsc_queue_impl_destroy_bulk(queue, head, count);
+    pottery_atomic_store_release_s(&queue->head, head + count);
+}
+#endif
+
+#if POTTERY_LIFECYCLE_CAN_PASS
+static inline
+void pottery_spsc_queue_impl_copy_in(pottery_spsc_queue_value_t* to,
+        const pottery_spsc_queue_value_t* from, size_t count)
+{
+    #ifdef __cplusplus
+    size_t i;
+    for (i = 0; i < count; ++i)
+        pottery_move_construct(pottery_spsc_queue_value_t, to[i], from[i]);
+    #else
+    if (count != 0)
+        pottery_memcpy(to, from, count * sizeof(pottery_spsc_queue_value_t));
+    #endif
+}
+
+static inline
+void pottery_spsc_queue_impl_move_out(pottery_spsc_queue_value_t* to,
+        pottery_spsc_queue_value_t* from, size_t count)
+{
+    #ifdef __cplusplus
+    size_t i;
+    for (i = 0; i < count; ++i) {
+        to[i] = pottery_move_if_cxx(from[i]);
+        // see pottery_vector_extract() for details
+        from[i].~pottery_spsc_queue_value_t();
+    }
+    #else
+    if (count != 0)
+        pottery_memcpy(to, from, count * sizeof(pottery_spsc_queue_value_t));
+    #endif
+}
+
+POTTERY_SPSC_QUEUE_EXTERN
+size_t pottery_spsc_queue_try_push_bulk(pottery_spsc_queue_t* queue,
+        const pottery_spsc_queue_value_t* values, size_t count)
+{
+    size_t tail = pottery_atomic_load_relaxed_s(&queue->tail);
+    size_t space = pottery_spsc_queue_impl_free_space(queue, tail);
+    if (space < count) {
+        queue->cached_head = pottery_atomic_load_acquire_s(&queue->head);
+        space = pottery_spsc_queue_impl_free_space(queue, tail);
+        count = pottery_min_s(count, space);
+    }
+    if (count == 0)
+        return 0;
+
+    // The values wrap around the buffer at most once.
+    size_t offset = tail & queue->mask;
+    size_t part1 = pottery_min_s(count, pottery_spsc_queue_capacity(queue) - offset);
+    pottery_spsc_queue_impl_copy_in(queue->values + offset, values, part1);
+    pottery_spsc_queue_impl_copy_in(queue->values, values + part1, count - part1);
+
+    pottery_atomic_store_release_s(&queue->tail, tail + count);
+    return count;
+}
+
+POTTERY_SPSC_QUEUE_EXTERN
+size_t pottery_spsc_queue_try_pop_bulk(pottery_spsc_queue_t* queue,
+        pottery_spsc_queue_value_t* values, size_t count)
+{
+    size_t head = pottery_atomic_load_relaxed_s(&queue->head);
+    size_t available = pottery_spsc_queue_impl_available(queue, head);
+    if (available < count) {
+        queue->cached_tail = pottery_atomic_load_acquire_s(&queue->tail);
+        available = pottery_spsc_queue_impl_available(queue, head);
+        count = pottery_min_s(count, available);
+    }
+    if (count == 0)
+        return 0;
+
+    size_t offset = head & queue->mask;
+    size_t part1 = pottery_min_s(count, pottery_spsc_queue_capacity(queue) - offset);
+    pottery_spsc_queue_impl_move_out(values, queue->values + offset, part1);
+    pottery_spsc_queue_impl_move_out(values + part1, queue->values, count - part1);
+
+    pottery_atomic_store_release_s(&queue->head, head + count);
+    return count;
+}
+#endif
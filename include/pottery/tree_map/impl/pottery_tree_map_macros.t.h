@@ -120,7 +120,11 @@
     #define pottery_tree_map_is_empty POTTERY_CONCAT(POTTERY_TREE_MAP_PREFIX, _is_empty)
     #define pottery_tree_map_at POTTERY_CONCAT(POTTERY_TREE_MAP_PREFIX, _at)
     #define pottery_tree_map_find POTTERY_CONCAT(POTTERY_TREE_MAP_PREFIX, _find)
+    #define pottery_tree_map_find_with_hash POTTERY_CONCAT(POTTERY_TREE_MAP_PREFIX, _find_with_hash)
     #define pottery_tree_map_contains_key POTTERY_CONCAT(POTTERY_TREE_MAP_PREFIX, _contains_key)
+    #define pottery_tree_map_contains_key_with_hash POTTERY_CONCAT(POTTERY_TREE_MAP_PREFIX, _contains_key_with_hash)
+    #define pottery_tree_map_find_bulk POTTERY_CONCAT(POTTERY_TREE_MAP_PREFIX, _find_bulk)
+    #define pottery_tree_map_contains_bulk POTTERY_CONCAT(POTTERY_TREE_MAP_PREFIX, _contains_bulk)
     #define pottery_tree_map_first POTTERY_CONCAT(POTTERY_TREE_MAP_PREFIX, _first)
     #define pottery_tree_map_last POTTERY_CONCAT(POTTERY_TREE_MAP_PREFIX, _last)
     #define pottery_tree_map_any POTTERY_CONCAT(POTTERY_TREE_MAP_PREFIX, _any)
@@ -158,6 +162,7 @@
     #define pottery_tree_map_emplace POTTERY_CONCAT(POTTERY_TREE_MAP_PREFIX, _emplace)
     #define pottery_tree_map_emplace_at POTTERY_CONCAT(POTTERY_TREE_MAP_PREFIX, _emplace_at)
     #define pottery_tree_map_emplace_key POTTERY_CONCAT(POTTERY_TREE_MAP_PREFIX, _emplace_key)
+    #define pottery_tree_map_emplace_key_with_hash POTTERY_CONCAT(POTTERY_TREE_MAP_PREFIX, _emplace_key_with_hash)
     #define pottery_tree_map_emplace_first POTTERY_CONCAT(POTTERY_TREE_MAP_PREFIX, _emplace_first)
     #define pottery_tree_map_emplace_last POTTERY_CONCAT(POTTERY_TREE_MAP_PREFIX, _emplace_last)
     #define pottery_tree_map_emplace_before POTTERY_CONCAT(POTTERY_TREE_MAP_PREFIX, _emplace_before)
@@ -193,6 +198,7 @@
     #define pottery_tree_map_remove POTTERY_CONCAT(POTTERY_TREE_MAP_PREFIX, _remove)
     #define pottery_tree_map_remove_at POTTERY_CONCAT(POTTERY_TREE_MAP_PREFIX, _remove_at)
     #define pottery_tree_map_remove_key POTTERY_CONCAT(POTTERY_TREE_MAP_PREFIX, _remove_key)
+    #define pottery_tree_map_remove_key_with_hash POTTERY_CONCAT(POTTERY_TREE_MAP_PREFIX, _remove_key_with_hash)
     #define pottery_tree_map_remove_first POTTERY_CONCAT(POTTERY_TREE_MAP_PREFIX, _remove_first)
     #define pottery_tree_map_remove_last POTTERY_CONCAT(POTTERY_TREE_MAP_PREFIX, _remove_last)
     #define pottery_tree_map_remove_and_next POTTERY_CONCAT(POTTERY_TREE_MAP_PREFIX, _remove_and_next)
@@ -278,7 +284,11 @@
     #define pottery_tree_map_tree_is_empty POTTERY_CONCAT(POTTERY_TREE_MAP_RBT_PREFIX, _is_empty)
     #define pottery_tree_map_tree_at POTTERY_CONCAT(POTTERY_TREE_MAP_RBT_PREFIX, _at)
     #define pottery_tree_map_tree_find POTTERY_CONCAT(POTTERY_TREE_MAP_RBT_PREFIX, _find)
+    #define pottery_tree_map_tree_find_with_hash POTTERY_CONCAT(POTTERY_TREE_MAP_RBT_PREFIX, _find_with_hash)
     #define pottery_tree_map_tree_contains_key POTTERY_CONCAT(POTTERY_TREE_MAP_RBT_PREFIX, _contains_key)
+    #define pottery_tree_map_tree_contains_key_with_hash POTTERY_CONCAT(POTTERY_TREE_MAP_RBT_PREFIX, _contains_key_with_hash)
+    #define pottery_tree_map_tree_find_bulk POTTERY_CONCAT(POTTERY_TREE_MAP_RBT_PREFIX, _find_bulk)
+    #define pottery_tree_map_tree_contains_bulk POTTERY_CONCAT(POTTERY_TREE_MAP_RBT_PREFIX, _contains_bulk)
     #define pottery_tree_map_tree_first POTTERY_CONCAT(POTTERY_TREE_MAP_RBT_PREFIX, _first)
     #define pottery_tree_map_tree_last POTTERY_CONCAT(POTTERY_TREE_MAP_RBT_PREFIX, _last)
     #define pottery_tree_map_tree_any POTTERY_CONCAT(POTTERY_TREE_MAP_RBT_PREFIX, _any)
@@ -316,6 +326,7 @@
     #define pottery_tree_map_tree_emplace POTTERY_CONCAT(POTTERY_TREE_MAP_RBT_PREFIX, _emplace)
     #define pottery_tree_map_tree_emplace_at POTTERY_CONCAT(POTTERY_TREE_MAP_RBT_PREFIX, _emplace_at)
     #define pottery_tree_map_tree_emplace_key POTTERY_CONCAT(POTTERY_TREE_MAP_RBT_PREFIX, _emplace_key)
+    #define pottery_tree_map_tree_emplace_key_with_hash POTTERY_CONCAT(POTTERY_TREE_MAP_RBT_PREFIX, _emplace_key_with_hash)
     #define pottery_tree_map_tree_emplace_first POTTERY_CONCAT(POTTERY_TREE_MAP_RBT_PREFIX, _emplace_first)
     #define pottery_tree_map_tree_emplace_last POTTERY_CONCAT(POTTERY_TREE_MAP_RBT_PREFIX, _emplace_last)
     #define pottery_tree_map_tree_emplace_before POTTERY_CONCAT(POTTERY_TREE_MAP_RBT_PREFIX, _emplace_before)
@@ -351,6 +362,7 @@
     #define pottery_tree_map_tree_remove POTTERY_CONCAT(POTTERY_TREE_MAP_RBT_PREFIX, _remove)
     #define pottery_tree_map_tree_remove_at POTTERY_CONCAT(POTTERY_TREE_MAP_RBT_PREFIX, _remove_at)
     #define pottery_tree_map_tree_remove_key POTTERY_CONCAT(POTTERY_TREE_MAP_RBT_PREFIX, _remove_key)
+    #define pottery_tree_map_tree_remove_key_with_hash POTTERY_CONCAT(POTTERY_TREE_MAP_RBT_PREFIX, _remove_key_with_hash)
     #define pottery_tree_map_tree_remove_first POTTERY_CONCAT(POTTERY_TREE_MAP_RBT_PREFIX, _remove_first)
     #define pottery_tree_map_tree_remove_last POTTERY_CONCAT(POTTERY_TREE_MAP_RBT_PREFIX, _remove_last)
     #define pottery_tree_map_tree_remove_and_next POTTERY_CONCAT(POTTERY_TREE_MAP_RBT_PREFIX, _remove_and_next)
@@ -131,7 +131,11 @@
     #undef pottery_tree_map_is_empty
     #undef pottery_tree_map_at
     #undef pottery_tree_map_find
+    #undef pottery_tree_map_find_with_hash
     #undef pottery_tree_map_contains_key
+    #undef pottery_tree_map_contains_key_with_hash
+    #undef pottery_tree_map_find_bulk
+    #undef pottery_tree_map_contains_bulk
     #undef pottery_tree_map_first
     #undef pottery_tree_map_last
     #undef pottery_tree_map_any
@@ -169,6 +173,7 @@
     #undef pottery_tree_map_emplace
     #undef pottery_tree_map_emplace_at
     #undef pottery_tree_map_emplace_key
+    #undef pottery_tree_map_emplace_key_with_hash
     #undef pottery_tree_map_emplace_first
     #undef pottery_tree_map_emplace_last
     #undef pottery_tree_map_emplace_before
@@ -204,6 +209,7 @@
     #undef pottery_tree_map_remove
     #undef pottery_tree_map_remove_at
     #undef pottery_tree_map_remove_key
+    #undef pottery_tree_map_remove_key_with_hash
     #undef pottery_tree_map_remove_first
     #undef pottery_tree_map_remove_last
     #undef pottery_tree_map_remove_and_next
@@ -291,7 +297,11 @@
     #undef pottery_tree_map_tree_is_empty
     #undef pottery_tree_map_tree_at
     #undef pottery_tree_map_tree_find
+    #undef pottery_tree_map_tree_find_with_hash
     #undef pottery_tree_map_tree_contains_key
+    #undef pottery_tree_map_tree_contains_key_with_hash
+    #undef pottery_tree_map_tree_find_bulk
+    #undef pottery_tree_map_tree_contains_bulk
     #undef pottery_tree_map_tree_first
     #undef pottery_tree_map_tree_last
     #undef pottery_tree_map_tree_any
@@ -329,6 +339,7 @@
     #undef pottery_tree_map_tree_emplace
     #undef pottery_tree_map_tree_emplace_at
     #undef pottery_tree_map_tree_emplace_key
+    #undef pottery_tree_map_tree_emplace_key_with_hash
     #undef pottery_tree_map_tree_emplace_first
     #undef pottery_tree_map_tree_emplace_last
     #undef pottery_tree_map_tree_emplace_before
@@ -364,6 +375,7 @@
     #undef pottery_tree_map_tree_remove
     #undef pottery_tree_map_tree_remove_at
     #undef pottery_tree_map_tree_remove_key
+    #undef pottery_tree_map_tree_remove_key_with_hash
     #undef pottery_tree_map_tree_remove_first
     #undef pottery_tree_map_tree_remove_last
     #undef pottery_tree_map_tree_remove_and_next
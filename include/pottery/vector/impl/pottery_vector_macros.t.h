@@ -126,7 +126,11 @@
     #define pottery_vector_is_empty POTTERY_CONCAT(POTTERY_VECTOR_PREFIX, _is_empty)
     #define pottery_vector_at POTTERY_CONCAT(POTTERY_VECTOR_PREFIX, _at)
     #define pottery_vector_find POTTERY_CONCAT(POTTERY_VECTOR_PREFIX, _find)
+    #define pottery_vector_find_with_hash POTTERY_CONCAT(POTTERY_VECTOR_PREFIX, _find_with_hash)
     #define pottery_vector_contains_key POTTERY_CONCAT(POTTERY_VECTOR_PREFIX, _contains_key)
+    #define pottery_vector_contains_key_with_hash POTTERY_CONCAT(POTTERY_VECTOR_PREFIX, _contains_key_with_hash)
+    #define pottery_vector_find_bulk POTTERY_CONCAT(POTTERY_VECTOR_PREFIX, _find_bulk)
+    #define pottery_vector_contains_bulk POTTERY_CONCAT(POTTERY_VECTOR_PREFIX, _contains_bulk)
     #define pottery_vector_first POTTERY_CONCAT(POTTERY_VECTOR_PREFIX, _first)
     #define pottery_vector_last POTTERY_CONCAT(POTTERY_VECTOR_PREFIX, _last)
     #define pottery_vector_any POTTERY_CONCAT(POTTERY_VECTOR_PREFIX, _any)
@@ -164,6 +168,7 @@
     #define pottery_vector_emplace POTTERY_CONCAT(POTTERY_VECTOR_PREFIX, _emplace)
     #define pottery_vector_emplace_at POTTERY_CONCAT(POTTERY_VECTOR_PREFIX, _emplace_at)
     #define pottery_vector_emplace_key POTTERY_CONCAT(POTTERY_VECTOR_PREFIX, _emplace_key)
+    #define pottery_vector_emplace_key_with_hash POTTERY_CONCAT(POTTERY_VECTOR_PREFIX, _emplace_key_with_hash)
     #define pottery_vector_emplace_first POTTERY_CONCAT(POTTERY_VECTOR_PREFIX, _emplace_first)
     #define pottery_vector_emplace_last POTTERY_CONCAT(POTTERY_VECTOR_PREFIX, _emplace_last)
     #define pottery_vector_emplace_before POTTERY_CONCAT(POTTERY_VECTOR_PREFIX, _emplace_before)
@@ -199,6 +204,7 @@
     #define pottery_vector_remove POTTERY_CONCAT(POTTERY_VECTOR_PREFIX, _remove)
     #define pottery_vector_remove_at POTTERY_CONCAT(POTTERY_VECTOR_PREFIX, _remove_at)
     #define pottery_vector_remove_key POTTERY_CONCAT(POTTERY_VECTOR_PREFIX, _remove_key)
+    #define pottery_vector_remove_key_with_hash POTTERY_CONCAT(POTTERY_VECTOR_PREFIX, _remove_key_with_hash)
     #define pottery_vector_remove_first POTTERY_CONCAT(POTTERY_VECTOR_PREFIX, _remove_first)
     #define pottery_vector_remove_last POTTERY_CONCAT(POTTERY_VECTOR_PREFIX, _remove_last)
     #define pottery_vector_remove_and_next POTTERY_CONCAT(POTTERY_VECTOR_PREFIX, _remove_and_next)
@@ -156,7 +156,11 @@
     #undef pottery_vector_is_empty
     #undef pottery_vector_at
     #undef pottery_vector_find
+    #undef pottery_vector_find_with_hash
     #undef pottery_vector_contains_key
+    #undef pottery_vector_contains_key_with_hash
+    #undef pottery_vector_find_bulk
+    #undef pottery_vector_contains_bulk
     #undef pottery_vector_first
     #undef pottery_vector_last
     #undef pottery_vector_any
@@ -194,6 +198,7 @@
     #undef pottery_vector_emplace
     #undef pottery_vector_emplace_at
     #undef pottery_vector_emplace_key
+    #undef pottery_vector_emplace_key_with_hash
     #undef pottery_vector_emplace_first
     #undef pottery_vector_emplace_last
     #undef pottery_vector_emplace_before
@@ -229,6 +234,7 @@
     #undef pottery_vector_remove
     #undef pottery_vector_remove_at
     #undef pottery_vector_remove_key
+    #undef pottery_vector_remove_key_with_hash
     #undef pottery_vector_remove_first
     #undef pottery_vector_remove_last
     #undef pottery_vector_remove_and_next
@@ -55,7 +55,11 @@
 #define {SRC}_is_empty POTTERY_CONCAT({DEST}, _is_empty)
 #define {SRC}_at POTTERY_CONCAT({DEST}, _at)
 #define {SRC}_find POTTERY_CONCAT({DEST}, _find)
+#define {SRC}_find_with_hash POTTERY_CONCAT({DEST}, _find_with_hash)
 #define {SRC}_contains_key POTTERY_CONCAT({DEST}, _contains_key)
+#define {SRC}_contains_key_with_hash POTTERY_CONCAT({DEST}, _contains_key_with_hash)
+#define {SRC}_find_bulk POTTERY_CONCAT({DEST}, _find_bulk)
+#define {SRC}_contains_bulk POTTERY_CONCAT({DEST}, _contains_bulk)
 #define {SRC}_first POTTERY_CONCAT({DEST}, _first)
 #define {SRC}_last POTTERY_CONCAT({DEST}, _last)
 #define {SRC}_any POTTERY_CONCAT({DEST}, _any)
@@ -93,6 +97,7 @@
 #define {SRC}_emplace POTTERY_CONCAT({DEST}, _emplace)
 #define {SRC}_emplace_at POTTERY_CONCAT({DEST}, _emplace_at)
 #define {SRC}_emplace_key POTTERY_CONCAT({DEST}, _emplace_key)
+#define {SRC}_emplace_key_with_hash POTTERY_CONCAT({DEST}, _emplace_key_with_hash)
 #define {SRC}_emplace_first POTTERY_CONCAT({DEST}, _emplace_first)
 #define {SRC}_emplace_last POTTERY_CONCAT({DEST}, _emplace_last)
 #define {SRC}_emplace_before POTTERY_CONCAT({DEST}, _emplace_before)
@@ -128,6 +133,7 @@
 #define {SRC}_remove POTTERY_CONCAT({DEST}, _remove)
 #define {SRC}_remove_at POTTERY_CONCAT({DEST}, _remove_at)
 #define {SRC}_remove_key POTTERY_CONCAT({DEST}, _remove_key)
+#define {SRC}_remove_key_with_hash POTTERY_CONCAT({DEST}, _remove_key_with_hash)
 #define {SRC}_remove_first POTTERY_CONCAT({DEST}, _remove_first)
 #define {SRC}_remove_last POTTERY_CONCAT({DEST}, _remove_last)
 #define {SRC}_remove_and_next POTTERY_CONCAT({DEST}, _remove_and_next)
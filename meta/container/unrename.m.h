@@ -50,7 +50,11 @@
 #undef {PREFIX}_is_empty
 #undef {PREFIX}_at
 #undef {PREFIX}_find
+#undef {PREFIX}_find_with_hash
 #undef {PREFIX}_contains_key
+#undef {PREFIX}_contains_key_with_hash
+#undef {PREFIX}_find_bulk
+#undef {PREFIX}_contains_bulk
 #undef {PREFIX}_first
 #undef {PREFIX}_last
 #undef {PREFIX}_any
@@ -88,6 +92,7 @@
 #undef {PREFIX}_emplace
 #undef {PREFIX}_emplace_at
 #undef {PREFIX}_emplace_key
+#undef {PREFIX}_emplace_key_with_hash
 #undef {PREFIX}_emplace_first
 #undef {PREFIX}_emplace_last
 #undef {PREFIX}_emplace_before
@@ -123,6 +128,7 @@
 #undef {PREFIX}_remove
 #undef {PREFIX}_remove_at
 #undef {PREFIX}_remove_key
+#undef {PREFIX}_remove_key_with_hash
 #undef {PREFIX}_remove_first
 #undef {PREFIX}_remove_last
 #undef {PREFIX}_remove_and_next
@@ -0,0 +1,61 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2020-2021 11037650 Canada Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+//!!! END_LICENSE
+
+// Forwards open_hash_map configuration from {SRC} to {DEST}
+// This only forwards the options specific to open_hash_map. The types and the
+// lifecycle, alloc and open_hash_table configuration must be forwarded
+// separately.
+
+#ifdef {SRC}_GROUP_PROBING
+    #define {DEST}_GROUP_PROBING {SRC}_GROUP_PROBING
+#endif
+
+#ifdef {SRC}_STORE_HASH
+    #define {DEST}_STORE_HASH {SRC}_STORE_HASH
+#endif
+
+#ifdef {SRC}_INCREMENTAL_REHASH
+    #define {DEST}_INCREMENTAL_REHASH {SRC}_INCREMENTAL_REHASH
+#endif
+#ifdef {SRC}_INCREMENTAL_REHASH_STEP
+    #define {DEST}_INCREMENTAL_REHASH_STEP {SRC}_INCREMENTAL_REHASH_STEP
+#endif
+
+#ifdef {SRC}_PREFETCH_BATCH
+    #define {DEST}_PREFETCH_BATCH {SRC}_PREFETCH_BATCH
+#endif
+
+#ifdef {SRC}_MAX_LOAD_FACTOR_NUMERATOR
+    #define {DEST}_MAX_LOAD_FACTOR_NUMERATOR {SRC}_MAX_LOAD_FACTOR_NUMERATOR
+#endif
+#ifdef {SRC}_MAX_LOAD_FACTOR_DENOMINATOR
+    #define {DEST}_MAX_LOAD_FACTOR_DENOMINATOR {SRC}_MAX_LOAD_FACTOR_DENOMINATOR
+#endif
+#ifdef {SRC}_MIN_LOAD_FACTOR_NUMERATOR
+    #define {DEST}_MIN_LOAD_FACTOR_NUMERATOR {SRC}_MIN_LOAD_FACTOR_NUMERATOR
+#endif
+#ifdef {SRC}_MIN_LOAD_FACTOR_DENOMINATOR
+    #define {DEST}_MIN_LOAD_FACTOR_DENOMINATOR {SRC}_MIN_LOAD_FACTOR_DENOMINATOR
+#endif
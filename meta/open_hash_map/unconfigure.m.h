@@ -0,0 +1,41 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2020-2021 11037650 Canada Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+//!!! END_LICENSE
+
+// Undefines (forwardable/forwarded) open_hash_map configuration on {PREFIX}
+// This only includes the options specific to open_hash_map.
+
+#undef {PREFIX}_GROUP_PROBING
+
+#undef {PREFIX}_STORE_HASH
+
+#undef {PREFIX}_INCREMENTAL_REHASH
+#undef {PREFIX}_INCREMENTAL_REHASH_STEP
+
+#undef {PREFIX}_PREFETCH_BATCH
+
+#undef {PREFIX}_MAX_LOAD_FACTOR_NUMERATOR
+#undef {PREFIX}_MAX_LOAD_FACTOR_DENOMINATOR
+#undef {PREFIX}_MIN_LOAD_FACTOR_NUMERATOR
+#undef {PREFIX}_MIN_LOAD_FACTOR_DENOMINATOR
@@ -40,6 +40,9 @@
 #ifdef {SRC}_KEY_EQUAL
     #define {DEST}_KEY_EQUAL {SRC}_KEY_EQUAL
 #endif
+#ifdef {SRC}_KEY_DOUBLE_HASH
+    #define {DEST}_KEY_DOUBLE_HASH {SRC}_KEY_DOUBLE_HASH
+#endif
 
 #ifdef {SRC}_IS_EMPTY
     #define {DEST}_IS_EMPTY {SRC}_IS_EMPTY
@@ -47,6 +50,9 @@
 #ifdef {SRC}_SET_EMPTY
     #define {DEST}_SET_EMPTY {SRC}_SET_EMPTY
 #endif
+#ifdef {SRC}_EMPTY_IS_ZERO
+    #define {DEST}_EMPTY_IS_ZERO {SRC}_EMPTY_IS_ZERO
+#endif
 
 #ifdef {SRC}_IS_TOMBSTONE
     #define {DEST}_IS_TOMBSTONE {SRC}_IS_TOMBSTONE
@@ -56,7 +62,7 @@
 #endif
 
 #ifdef {SRC}_IS_VALUE
-    #define {DEST}_IS_VALUE {SRC}_IS_ELEMENT
+    #define {DEST}_IS_VALUE {SRC}_IS_VALUE
 #endif
 
 #ifdef {SRC}_LINEAR_PROBING
@@ -68,3 +74,33 @@
 #ifdef {SRC}_DOUBLE_HASHING
     #define {DEST}_DOUBLE_HASHING {SRC}_DOUBLE_HASHING
 #endif
+#ifdef {SRC}_ROBIN_HOOD_HASHING
+    #define {DEST}_ROBIN_HOOD_HASHING {SRC}_ROBIN_HOOD_HASHING
+#endif
+
+#ifdef {SRC}_PROBE_DISTANCE
+    #define {DEST}_PROBE_DISTANCE {SRC}_PROBE_DISTANCE
+#endif
+#ifdef {SRC}_SET_PROBE_DISTANCE
+    #define {DEST}_SET_PROBE_DISTANCE {SRC}_SET_PROBE_DISTANCE
+#endif
+
+#ifdef {SRC}_HOPSCOTCH_HASHING
+    #define {DEST}_HOPSCOTCH_HASHING {SRC}_HOPSCOTCH_HASHING
+#endif
+#ifdef {SRC}_HOPSCOTCH_NEIGHBORHOOD
+    #define {DEST}_HOPSCOTCH_NEIGHBORHOOD {SRC}_HOPSCOTCH_NEIGHBORHOOD
+#endif
+#ifdef {SRC}_HOP_INFO
+    #define {DEST}_HOP_INFO {SRC}_HOP_INFO
+#endif
+#ifdef {SRC}_SET_HOP_INFO
+    #define {DEST}_SET_HOP_INFO {SRC}_SET_HOP_INFO
+#endif
+
+#ifdef {SRC}_STORED_HASH
+    #define {DEST}_STORED_HASH {SRC}_STORED_HASH
+#endif
+#ifdef {SRC}_SET_STORED_HASH
+    #define {DEST}_SET_STORED_HASH {SRC}_SET_STORED_HASH
+#endif
@@ -26,8 +26,10 @@
 // Renames open_hash_table identifiers from {SRC} to {DEST}
 
 #define {SRC}_emplace_key POTTERY_CONCAT({DEST}, _emplace_key)
+#define {SRC}_emplace_key_with_hash POTTERY_CONCAT({DEST}, _emplace_key_with_hash)
 #define {SRC}_insert POTTERY_CONCAT({DEST}, _insert)
 #define {SRC}_find POTTERY_CONCAT({DEST}, _find)
+#define {SRC}_find_with_hash POTTERY_CONCAT({DEST}, _find_with_hash)
 #define {SRC}_displace POTTERY_CONCAT({DEST}, _displace)
 #define {SRC}_displace_all POTTERY_CONCAT({DEST}, _displace_all)
 #define {SRC}_remove POTTERY_CONCAT({DEST}, _remove)
@@ -45,6 +47,7 @@
 
 #define {SRC}_key POTTERY_CONCAT({DEST}, _key)
 #define {SRC}_key_hash POTTERY_CONCAT({DEST}, _key_hash)
+#define {SRC}_key_double_hash_interval POTTERY_CONCAT({DEST}, _key_double_hash_interval)
 #define {SRC}_key_equal POTTERY_CONCAT({DEST}, _key_equal)
 #define {SRC}_double_hash_interval POTTERY_CONCAT({DEST}, _double_hash_interval)
 #define {SRC}_entry_is_tombstone POTTERY_CONCAT({DEST}, _entry_is_tombstone)
@@ -56,5 +59,23 @@
 #define {SRC}_entry_exists POTTERY_CONCAT({DEST}, _entry_exists)
 
 #define {SRC}_bucket_for_hash POTTERY_CONCAT({DEST}, _bucket_for_hash)
+#define {SRC}_mix_seed POTTERY_CONCAT({DEST}, _mix_seed)
 #define {SRC}_next_probe POTTERY_CONCAT({DEST}, _next_probe)
 #define {SRC}_probe POTTERY_CONCAT({DEST}, _probe)
+#define {SRC}_probe_free POTTERY_CONCAT({DEST}, _probe_free)
+#define {SRC}_entry_probe_length POTTERY_CONCAT({DEST}, _entry_probe_length)
+
+#define {SRC}_entry_probe_distance POTTERY_CONCAT({DEST}, _entry_probe_distance)
+#define {SRC}_entry_set_probe_distance POTTERY_CONCAT({DEST}, _entry_set_probe_distance)
+#define {SRC}_entry_hash POTTERY_CONCAT({DEST}, _entry_hash)
+#define {SRC}_entry_set_hash POTTERY_CONCAT({DEST}, _entry_set_hash)
+#define {SRC}_entry_has_key POTTERY_CONCAT({DEST}, _entry_has_key)
+#define {SRC}_robin_hood_probe POTTERY_CONCAT({DEST}, _robin_hood_probe)
+#define {SRC}_robin_hood_shift POTTERY_CONCAT({DEST}, _robin_hood_shift)
+#define {SRC}_hop_info POTTERY_CONCAT({DEST}, _hop_info)
+#define {SRC}_set_hop_info POTTERY_CONCAT({DEST}, _set_hop_info)
+#define {SRC}_hopscotch_neighborhood POTTERY_CONCAT({DEST}, _hopscotch_neighborhood)
+#define {SRC}_hopscotch_find POTTERY_CONCAT({DEST}, _hopscotch_find)
+#define {SRC}_hopscotch_find_overflow POTTERY_CONCAT({DEST}, _hopscotch_find_overflow)
+#define {SRC}_hopscotch_insert POTTERY_CONCAT({DEST}, _hopscotch_insert)
+#define {SRC}_hopscotch_unlink POTTERY_CONCAT({DEST}, _hopscotch_unlink)
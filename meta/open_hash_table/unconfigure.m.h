@@ -31,6 +31,7 @@
 
 #undef {PREFIX}_KEY_HASH
 #undef {PREFIX}_KEY_EQUAL
+#undef {PREFIX}_KEY_DOUBLE_HASH
 #undef {PREFIX}_REF_KEY
 
 #undef {PREFIX}_IS_EMPTY
@@ -46,3 +47,14 @@
 #undef {PREFIX}_QUADRATIC_PROBING
 #undef {PREFIX}_DOUBLE_HASHING
 #undef {PREFIX}_DOUBLE_HASH_PROBE
+#undef {PREFIX}_ROBIN_HOOD_HASHING
+
+#undef {PREFIX}_PROBE_DISTANCE
+#undef {PREFIX}_SET_PROBE_DISTANCE
+#undef {PREFIX}_HOPSCOTCH_HASHING
+#undef {PREFIX}_HOPSCOTCH_NEIGHBORHOOD
+#undef {PREFIX}_HOP_INFO
+#undef {PREFIX}_SET_HOP_INFO
+#undef {PREFIX}_STORED_HASH
+#undef {PREFIX}_SET_STORED_HASH
+#undef {PREFIX}_SEED
@@ -25,9 +25,11 @@
 //!!! END_LICENSE
 // Un-renames open_hash_table identifiers with prefix "{PREFIX}"
 
-#undef {PREFIX}_emplace
+#undef {PREFIX}_emplace_key
+#undef {PREFIX}_emplace_key_with_hash
 #undef {PREFIX}_insert
 #undef {PREFIX}_find
+#undef {PREFIX}_find_with_hash
 #undef {PREFIX}_displace
 #undef {PREFIX}_displace_all
 #undef {PREFIX}_remove
@@ -45,6 +47,7 @@
 
 #undef {PREFIX}_key
 #undef {PREFIX}_key_hash
+#undef {PREFIX}_key_double_hash_interval
 #undef {PREFIX}_key_equal
 #undef {PREFIX}_double_hash_interval
 #undef {PREFIX}_entry_is_tombstone
@@ -56,5 +59,23 @@
 #undef {PREFIX}_entry_exists
 
 #undef {PREFIX}_bucket_for_hash
+#undef {PREFIX}_mix_seed
 #undef {PREFIX}_next_probe
 #undef {PREFIX}_probe
+#undef {PREFIX}_probe_free
+#undef {PREFIX}_entry_probe_length
+
+#undef {PREFIX}_entry_probe_distance
+#undef {PREFIX}_entry_set_probe_distance
+#undef {PREFIX}_entry_hash
+#undef {PREFIX}_entry_set_hash
+#undef {PREFIX}_entry_has_key
+#undef {PREFIX}_robin_hood_probe
+#undef {PREFIX}_robin_hood_shift
+#undef {PREFIX}_hop_info
+#undef {PREFIX}_set_hop_info
+#undef {PREFIX}_hopscotch_neighborhood
+#undef {PREFIX}_hopscotch_find
+#undef {PREFIX}_hopscotch_find_overflow
+#undef {PREFIX}_hopscotch_insert
+#undef {PREFIX}_hopscotch_unlink
@@ -1,6 +1,6 @@
 #!/bin/sh
 
-# Builds and runs Pottery benchmarks.
+# Builds and runs Pottery benchmarks. Pass "sort" or "map" to run only those.
 
 set -e
 cd "$(dirname $0)/.."
@@ -95,4 +95,4 @@ make -j8 -f test/tools/benchmark-makefile.mk
 
 # Run them
 echo "Running test/.build/benchmark/runner"
-test/.build/benchmark/runner
+test/.build/benchmark/runner "$@"
@@ -33,6 +33,7 @@
 #include <stdlib.h>
 
 #include "pottery/benchmark/test_benchmark_sort_common.h"
+#include "pottery/benchmark/test_benchmark_map_common.h"
 
 
 // qsort wrappers
@@ -382,10 +383,66 @@ static void benchmark_all_sorts(void) {
 }
 
 
+// map benchmarks
+
+static void benchmark_map_sweep(const intptr_t* keys, const char* name,
+        const benchmark_map_load_t* loads)
+{
+    for (; loads->function != NULL; ++loads) {
+        // This matches the capacity computed by open_hash_map so the map is
+        // filled exactly to its max load factor without growing past it.
+        size_t count = (BENCHMARK_MAP_BUCKETS / loads->denominator) * loads->numerator +
+                (BENCHMARK_MAP_BUCKETS % loads->denominator) * loads->numerator / loads->denominator;
+        benchmark_map_result_t result;
+        loads->function(keys, count, &result);
+
+        printf("%-16s % 5.1f%% % 10.2f % 10.2f % 10.2f % 10.2f % 10.2f\n",
+                name, 100.0 * (double)loads->numerator / (double)loads->denominator,
+                (double)count / result.insert_seconds / 1.e6,
+                (double)count / result.lookup_hit_seconds / 1.e6,
+                (double)count / result.lookup_bulk_seconds / 1.e6,
+                (double)count / result.lookup_miss_seconds / 1.e6,
+                (double)result.bytes / (double)count);
+    }
+}
+
+static void benchmark_all_maps(void) {
+
+    // Generate unique keys that look random. Each step of this mix is a
+    // bijection so keys are unique regardless of the width of intptr_t.
+    size_t key_count = 2 * BENCHMARK_MAP_BUCKETS;
+    intptr_t* keys = pottery_cast(intptr_t*, malloc(sizeof(intptr_t) * key_count));
+    size_t i;
+    for (i = 0; i < key_count; ++i) {
+        uintptr_t x = pottery_cast(uintptr_t, i);
+        x = (x ^ (x >> 16)) * 0x45d9f3bu;
+        x = (x ^ (x >> 16)) * 0x45d9f3bu;
+        keys[i] = pottery_cast(intptr_t, x ^ (x >> 16));
+    }
+
+    printf("\nFilling open_hash_map to each max load factor at %zi buckets of %zi bytes\n",
+            BENCHMARK_MAP_BUCKETS, sizeof(benchmark_map_value_t));
+    printf("%-16s %6s %10s %10s %10s %10s %10s\n", "mode", "load",
+            "insert/us", "hit/us", "bulk/us", "miss/us", "bytes/elem");
+
+    benchmark_map_sweep(keys, "linear", pottery_benchmark_ohm_linear);
+    benchmark_map_sweep(keys, "quadratic", pottery_benchmark_ohm_quadratic);
+    benchmark_map_sweep(keys, "double hashing", pottery_benchmark_ohm_double_hashing);
+    benchmark_map_sweep(keys, "robin hood", pottery_benchmark_ohm_robin_hood);
+    benchmark_map_sweep(keys, "group", pottery_benchmark_ohm_group);
+
+    free(keys);
+}
+
+
 // all benchmarks
 
-int main(void) {
-    benchmark_all_sorts();
+int main(int argc, char** argv) {
 
-    // so far we only have a simple benchmark for sorting algorithms. :(
+    // Pass "sort" or "map" to run only those benchmarks.
+    const char* only = (argc > 1) ? argv[1] : NULL;
+    if (only == NULL || 0 == strcmp(only, "sort"))
+        benchmark_all_sorts();
+    if (only == NULL || 0 == strcmp(only, "map"))
+        benchmark_all_maps();
 }
@@ -0,0 +1,61 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2020-2021 11037650 Canada Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <stdlib.h>
+#include <time.h>
+
+#include "pottery/benchmark/test_benchmark_map_common.h"
+
+size_t benchmark_map_allocated_bytes;
+
+// We store the size of each allocation before it. This wastes some memory but
+// we don't count it.
+typedef union benchmark_map_header_t {
+    size_t size;
+    max_align_t align;
+} benchmark_map_header_t;
+
+void* benchmark_map_malloc(size_t size) {
+    benchmark_map_header_t* header = (benchmark_map_header_t*)malloc(
+            sizeof(benchmark_map_header_t) + size);
+    if (header == NULL)
+        return NULL;
+    header->size = size;
+    benchmark_map_allocated_bytes += size;
+    return header + 1;
+}
+
+void benchmark_map_free(void* ptr) {
+    if (ptr == NULL)
+        return;
+    benchmark_map_header_t* header = (benchmark_map_header_t*)ptr - 1;
+    benchmark_map_allocated_bytes -= header->size;
+    free(header);
+}
+
+double benchmark_map_now(void) {
+    struct timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return (double)time.tv_sec + (double)time.tv_nsec / 1.e9;
+}
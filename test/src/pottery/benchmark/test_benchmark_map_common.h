@@ -0,0 +1,79 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2020-2021 11037650 Canada Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef POTTERY_BENCHMARK_TEST_BENCHMARK_MAP_COMMON_H
+#define POTTERY_BENCHMARK_TEST_BENCHMARK_MAP_COMMON_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Values stored in the benchmarked maps: a key and a payload.
+typedef struct benchmark_map_value_t {
+    intptr_t key;
+    intptr_t payload;
+} benchmark_map_value_t;
+
+// Results of a single map benchmark
+typedef struct benchmark_map_result_t {
+    double insert_seconds;
+    double lookup_hit_seconds;
+    double lookup_bulk_seconds;
+    double lookup_miss_seconds;
+    size_t bytes;
+} benchmark_map_result_t;
+
+// Each benchmarked map is filled to its max load factor at this bucket count.
+// The benchmark then looks up every key, plus as many keys that are missing.
+#define BENCHMARK_MAP_LOG_2_BUCKETS 20
+#define BENCHMARK_MAP_BUCKETS (((size_t)1) << BENCHMARK_MAP_LOG_2_BUCKETS)
+
+// A benchmark function for one map configuration. It inserts the first count
+// keys and looks up all of them (one at a time and in bulk) and the next
+// count keys (which are missing.) All keys must be unique.
+typedef void (*benchmark_map_function_t)(const intptr_t* keys, size_t count,
+        benchmark_map_result_t* result);
+
+// A map benchmark with the given max load factor
+typedef struct benchmark_map_load_t {
+    size_t numerator;
+    size_t denominator;
+    benchmark_map_function_t function;
+} benchmark_map_load_t;
+
+// Sweeps of load factors for each open_hash_map probing mode. Each ends with
+// a null function.
+extern const benchmark_map_load_t pottery_benchmark_ohm_linear[];
+extern const benchmark_map_load_t pottery_benchmark_ohm_quadratic[];
+extern const benchmark_map_load_t pottery_benchmark_ohm_double_hashing[];
+extern const benchmark_map_load_t pottery_benchmark_ohm_robin_hood[];
+extern const benchmark_map_load_t pottery_benchmark_ohm_group[];
+
+// Counting allocator so we can report the memory used by each map
+extern size_t benchmark_map_allocated_bytes;
+void* benchmark_map_malloc(size_t size);
+void benchmark_map_free(void* ptr);
+
+double benchmark_map_now(void);
+
+#endif
@@ -0,0 +1,152 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2020-2021 11037650 Canada Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * This is a template that benchmarks one configuration of open_hash_map. It's
+ * instantiated for each probing mode and load factor we want to compare.
+ *
+ * Define BENCHMARK_MAP_OHM_PREFIX to the name of the benchmark function,
+ * BENCHMARK_MAP_OHM_MODE to one of the modes below, and
+ * BENCHMARK_MAP_OHM_LOAD_NUMERATOR/DENOMINATOR to the max load factor.
+ */
+
+#include "pottery/benchmark/test_benchmark_map_common.h"
+#include "pottery/pottery_dependencies.h"
+
+#define BENCHMARK_MAP_OHM_MODE_LINEAR 0
+#define BENCHMARK_MAP_OHM_MODE_QUADRATIC 1
+#define BENCHMARK_MAP_OHM_MODE_DOUBLE_HASHING 2
+#define BENCHMARK_MAP_OHM_MODE_ROBIN_HOOD 3
+#define BENCHMARK_MAP_OHM_MODE_GROUP 4
+
+#if !defined(BENCHMARK_MAP_OHM_PREFIX) || !defined(BENCHMARK_MAP_OHM_MODE) || \
+        !defined(BENCHMARK_MAP_OHM_LOAD_NUMERATOR) || !defined(BENCHMARK_MAP_OHM_LOAD_DENOMINATOR)
+#error "Misconfigured template"
+#endif
+
+#define benchmark_ohm POTTERY_CONCAT(BENCHMARK_MAP_OHM_PREFIX, _map)
+#define benchmark_ohm_t POTTERY_CONCAT(benchmark_ohm, _t)
+#define benchmark_ohm_entry_t POTTERY_CONCAT(benchmark_ohm, _entry_t)
+#define benchmark_ohm_init POTTERY_CONCAT(benchmark_ohm, _init)
+#define benchmark_ohm_destroy POTTERY_CONCAT(benchmark_ohm, _destroy)
+#define benchmark_ohm_emplace_key POTTERY_CONCAT(benchmark_ohm, _emplace_key)
+#define benchmark_ohm_find POTTERY_CONCAT(benchmark_ohm, _find)
+#define benchmark_ohm_find_bulk POTTERY_CONCAT(benchmark_ohm, _find_bulk)
+#define benchmark_ohm_entry_exists POTTERY_CONCAT(benchmark_ohm, _entry_exists)
+
+#define POTTERY_OPEN_HASH_MAP_PREFIX benchmark_ohm
+#define POTTERY_OPEN_HASH_MAP_VALUE_TYPE benchmark_map_value_t
+#define POTTERY_OPEN_HASH_MAP_KEY_TYPE intptr_t
+#define POTTERY_OPEN_HASH_MAP_REF_KEY(value) value->key
+#define POTTERY_OPEN_HASH_MAP_KEY_HASH(key) (size_t)key
+#define POTTERY_OPEN_HASH_MAP_KEY_EQUAL(x, y) x == y
+#define POTTERY_OPEN_HASH_MAP_LIFECYCLE_BY_VALUE 1
+#define POTTERY_OPEN_HASH_MAP_ALLOC_MALLOC benchmark_map_malloc
+#define POTTERY_OPEN_HASH_MAP_ALLOC_FREE benchmark_map_free
+#define POTTERY_OPEN_HASH_MAP_MAX_LOAD_FACTOR_NUMERATOR BENCHMARK_MAP_OHM_LOAD_NUMERATOR
+#define POTTERY_OPEN_HASH_MAP_MAX_LOAD_FACTOR_DENOMINATOR BENCHMARK_MAP_OHM_LOAD_DENOMINATOR
+#define POTTERY_OPEN_HASH_MAP_MIN_LOAD_FACTOR_NUMERATOR 0
+#if BENCHMARK_MAP_OHM_MODE == BENCHMARK_MAP_OHM_MODE_QUADRATIC
+    #define POTTERY_OPEN_HASH_MAP_QUADRATIC_PROBING 1
+#elif BENCHMARK_MAP_OHM_MODE == BENCHMARK_MAP_OHM_MODE_DOUBLE_HASHING
+    #define POTTERY_OPEN_HASH_MAP_DOUBLE_HASHING 1
+#elif BENCHMARK_MAP_OHM_MODE == BENCHMARK_MAP_OHM_MODE_ROBIN_HOOD
+    #define POTTERY_OPEN_HASH_MAP_ROBIN_HOOD_HASHING 1
+#elif BENCHMARK_MAP_OHM_MODE == BENCHMARK_MAP_OHM_MODE_GROUP
+    #define POTTERY_OPEN_HASH_MAP_GROUP_PROBING 1
+#endif
+#include "pottery/open_hash_map/pottery_open_hash_map_static.t.h"
+
+void BENCHMARK_MAP_OHM_PREFIX(const intptr_t* keys, size_t count,
+        benchmark_map_result_t* result)
+{
+    size_t i;
+    size_t bytes_before = benchmark_map_allocated_bytes;
+    benchmark_ohm_t map;
+    benchmark_ohm_init(&map);
+
+    // insert
+    double start = benchmark_map_now();
+    for (i = 0; i < count; ++i) {
+        benchmark_ohm_entry_t entry;
+        if (POTTERY_OK != benchmark_ohm_emplace_key(&map, keys[i], &entry, pottery_null))
+            pottery_abort();
+        entry->key = keys[i];
+        entry->payload = pottery_cast(intptr_t, i);
+    }
+    result->insert_seconds = benchmark_map_now() - start;
+    result->bytes = benchmark_map_allocated_bytes - bytes_before;
+
+    // lookup existing keys
+    // We sum the payloads so the lookups can't be optimized away.
+    size_t sum = 0;
+    start = benchmark_map_now();
+    for (i = 0; i < count; ++i)
+        sum += pottery_cast(size_t, benchmark_ohm_find(&map, keys[i])->payload);
+    result->lookup_hit_seconds = benchmark_map_now() - start;
+    if (sum != count * (count - 1) / 2)
+        pottery_abort();
+
+    // lookup existing keys in bulk
+    #define BENCHMARK_MAP_OHM_BULK 1024
+    benchmark_ohm_entry_t entries[BENCHMARK_MAP_OHM_BULK];
+    sum = 0;
+    start = benchmark_map_now();
+    for (i = 0; i < count; i += BENCHMARK_MAP_OHM_BULK) {
+        size_t batch = (count - i < BENCHMARK_MAP_OHM_BULK) ? count - i : BENCHMARK_MAP_OHM_BULK;
+        size_t j;
+        benchmark_ohm_find_bulk(&map, keys + i, batch, entries);
+        for (j = 0; j < batch; ++j)
+            sum += pottery_cast(size_t, entries[j]->payload);
+    }
+    result->lookup_bulk_seconds = benchmark_map_now() - start;
+    if (sum != count * (count - 1) / 2)
+        pottery_abort();
+    #undef BENCHMARK_MAP_OHM_BULK
+
+    // lookup missing keys
+    size_t found = 0;
+    start = benchmark_map_now();
+    for (i = 0; i < count; ++i)
+        found += benchmark_ohm_entry_exists(&map, benchmark_ohm_find(&map, keys[count + i]));
+    result->lookup_miss_seconds = benchmark_map_now() - start;
+    if (found != 0)
+        pottery_abort();
+
+    benchmark_ohm_destroy(&map);
+}
+
+#undef benchmark_ohm
+#undef benchmark_ohm_t
+#undef benchmark_ohm_entry_t
+#undef benchmark_ohm_init
+#undef benchmark_ohm_destroy
+#undef benchmark_ohm_emplace_key
+#undef benchmark_ohm_find
+#undef benchmark_ohm_find_bulk
+#undef benchmark_ohm_entry_exists
+
+#undef BENCHMARK_MAP_OHM_PREFIX
+#undef BENCHMARK_MAP_OHM_LOAD_NUMERATOR
+#undef BENCHMARK_MAP_OHM_LOAD_DENOMINATOR
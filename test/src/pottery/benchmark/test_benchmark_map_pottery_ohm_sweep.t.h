@@ -0,0 +1,77 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2020-2021 11037650 Canada Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * Sweeps the max load factor of open_hash_map for one probing mode.
+ *
+ * Define BENCHMARK_MAP_OHM_MODE to the probing mode and
+ * BENCHMARK_MAP_OHM_SWEEP to the name of the table of benchmarks to define.
+ */
+
+#if !defined(BENCHMARK_MAP_OHM_SWEEP) || !defined(BENCHMARK_MAP_OHM_MODE)
+#error "Misconfigured template"
+#endif
+
+#define BENCHMARK_MAP_OHM_PREFIX POTTERY_CONCAT(BENCHMARK_MAP_OHM_SWEEP, _50)
+#define BENCHMARK_MAP_OHM_LOAD_NUMERATOR 1
+#define BENCHMARK_MAP_OHM_LOAD_DENOMINATOR 2
+#include "pottery/benchmark/test_benchmark_map_pottery_ohm.t.h"
+
+#define BENCHMARK_MAP_OHM_PREFIX POTTERY_CONCAT(BENCHMARK_MAP_OHM_SWEEP, _57)
+#define BENCHMARK_MAP_OHM_LOAD_NUMERATOR 4
+#define BENCHMARK_MAP_OHM_LOAD_DENOMINATOR 7
+#include "pottery/benchmark/test_benchmark_map_pottery_ohm.t.h"
+
+#define BENCHMARK_MAP_OHM_PREFIX POTTERY_CONCAT(BENCHMARK_MAP_OHM_SWEEP, _67)
+#define BENCHMARK_MAP_OHM_LOAD_NUMERATOR 2
+#define BENCHMARK_MAP_OHM_LOAD_DENOMINATOR 3
+#include "pottery/benchmark/test_benchmark_map_pottery_ohm.t.h"
+
+#define BENCHMARK_MAP_OHM_PREFIX POTTERY_CONCAT(BENCHMARK_MAP_OHM_SWEEP, _75)
+#define BENCHMARK_MAP_OHM_LOAD_NUMERATOR 3
+#define BENCHMARK_MAP_OHM_LOAD_DENOMINATOR 4
+#include "pottery/benchmark/test_benchmark_map_pottery_ohm.t.h"
+
+#define BENCHMARK_MAP_OHM_PREFIX POTTERY_CONCAT(BENCHMARK_MAP_OHM_SWEEP, _85)
+#define BENCHMARK_MAP_OHM_LOAD_NUMERATOR 17
+#define BENCHMARK_MAP_OHM_LOAD_DENOMINATOR 20
+#include "pottery/benchmark/test_benchmark_map_pottery_ohm.t.h"
+
+#define BENCHMARK_MAP_OHM_PREFIX POTTERY_CONCAT(BENCHMARK_MAP_OHM_SWEEP, _90)
+#define BENCHMARK_MAP_OHM_LOAD_NUMERATOR 9
+#define BENCHMARK_MAP_OHM_LOAD_DENOMINATOR 10
+#include "pottery/benchmark/test_benchmark_map_pottery_ohm.t.h"
+
+const benchmark_map_load_t BENCHMARK_MAP_OHM_SWEEP[] = {
+    {1, 2, POTTERY_CONCAT(BENCHMARK_MAP_OHM_SWEEP, _50)},
+    {4, 7, POTTERY_CONCAT(BENCHMARK_MAP_OHM_SWEEP, _57)},
+    {2, 3, POTTERY_CONCAT(BENCHMARK_MAP_OHM_SWEEP, _67)},
+    {3, 4, POTTERY_CONCAT(BENCHMARK_MAP_OHM_SWEEP, _75)},
+    {17, 20, POTTERY_CONCAT(BENCHMARK_MAP_OHM_SWEEP, _85)},
+    {9, 10, POTTERY_CONCAT(BENCHMARK_MAP_OHM_SWEEP, _90)},
+    {0, 0, NULL},
+};
+
+#undef BENCHMARK_MAP_OHM_SWEEP
+#undef BENCHMARK_MAP_OHM_MODE
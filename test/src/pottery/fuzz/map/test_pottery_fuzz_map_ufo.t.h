@@ -32,6 +32,12 @@
 #ifndef TEST_POTTERY_FUZZ_MAP_UFO_CAN_SHRINK
 #define TEST_POTTERY_FUZZ_MAP_UFO_CAN_SHRINK 1
 #endif
+#ifndef TEST_POTTERY_FUZZ_MAP_UFO_CAN_ITERATE
+#define TEST_POTTERY_FUZZ_MAP_UFO_CAN_ITERATE 0
+#endif
+#ifndef TEST_POTTERY_FUZZ_MAP_UFO_CAN_FIND_BULK
+#define TEST_POTTERY_FUZZ_MAP_UFO_CAN_FIND_BULK 0
+#endif
 
 #ifdef TEST_POTTERY_FUZZ_MAIN
     #include <stdio.h>
@@ -74,7 +80,11 @@
     #define ufo_map_is_empty POTTERY_CONCAT(TEST_POTTERY_FUZZ_MAP_UFO_PREFIX, _is_empty)
     #define ufo_map_at POTTERY_CONCAT(TEST_POTTERY_FUZZ_MAP_UFO_PREFIX, _at)
     #define ufo_map_find POTTERY_CONCAT(TEST_POTTERY_FUZZ_MAP_UFO_PREFIX, _find)
+    #define ufo_map_find_with_hash POTTERY_CONCAT(TEST_POTTERY_FUZZ_MAP_UFO_PREFIX, _find_with_hash)
     #define ufo_map_contains_key POTTERY_CONCAT(TEST_POTTERY_FUZZ_MAP_UFO_PREFIX, _contains_key)
+    #define ufo_map_contains_key_with_hash POTTERY_CONCAT(TEST_POTTERY_FUZZ_MAP_UFO_PREFIX, _contains_key_with_hash)
+    #define ufo_map_find_bulk POTTERY_CONCAT(TEST_POTTERY_FUZZ_MAP_UFO_PREFIX, _find_bulk)
+    #define ufo_map_contains_bulk POTTERY_CONCAT(TEST_POTTERY_FUZZ_MAP_UFO_PREFIX, _contains_bulk)
     #define ufo_map_first POTTERY_CONCAT(TEST_POTTERY_FUZZ_MAP_UFO_PREFIX, _first)
     #define ufo_map_last POTTERY_CONCAT(TEST_POTTERY_FUZZ_MAP_UFO_PREFIX, _last)
     #define ufo_map_any POTTERY_CONCAT(TEST_POTTERY_FUZZ_MAP_UFO_PREFIX, _any)
@@ -112,6 +122,7 @@
     #define ufo_map_emplace POTTERY_CONCAT(TEST_POTTERY_FUZZ_MAP_UFO_PREFIX, _emplace)
     #define ufo_map_emplace_at POTTERY_CONCAT(TEST_POTTERY_FUZZ_MAP_UFO_PREFIX, _emplace_at)
     #define ufo_map_emplace_key POTTERY_CONCAT(TEST_POTTERY_FUZZ_MAP_UFO_PREFIX, _emplace_key)
+    #define ufo_map_emplace_key_with_hash POTTERY_CONCAT(TEST_POTTERY_FUZZ_MAP_UFO_PREFIX, _emplace_key_with_hash)
     #define ufo_map_emplace_first POTTERY_CONCAT(TEST_POTTERY_FUZZ_MAP_UFO_PREFIX, _emplace_first)
     #define ufo_map_emplace_last POTTERY_CONCAT(TEST_POTTERY_FUZZ_MAP_UFO_PREFIX, _emplace_last)
     #define ufo_map_emplace_before POTTERY_CONCAT(TEST_POTTERY_FUZZ_MAP_UFO_PREFIX, _emplace_before)
@@ -147,6 +158,7 @@
     #define ufo_map_remove POTTERY_CONCAT(TEST_POTTERY_FUZZ_MAP_UFO_PREFIX, _remove)
     #define ufo_map_remove_at POTTERY_CONCAT(TEST_POTTERY_FUZZ_MAP_UFO_PREFIX, _remove_at)
     #define ufo_map_remove_key POTTERY_CONCAT(TEST_POTTERY_FUZZ_MAP_UFO_PREFIX, _remove_key)
+    #define ufo_map_remove_key_with_hash POTTERY_CONCAT(TEST_POTTERY_FUZZ_MAP_UFO_PREFIX, _remove_key_with_hash)
     #define ufo_map_remove_first POTTERY_CONCAT(TEST_POTTERY_FUZZ_MAP_UFO_PREFIX, _remove_first)
     #define ufo_map_remove_last POTTERY_CONCAT(TEST_POTTERY_FUZZ_MAP_UFO_PREFIX, _remove_last)
     #define ufo_map_remove_and_next POTTERY_CONCAT(TEST_POTTERY_FUZZ_MAP_UFO_PREFIX, _remove_and_next)
@@ -229,6 +241,53 @@ static void fuzz_check(ufo_map_t* map, shadow_t* shadow) {
         pottery_test_assert(ufo_map_entry_exists(map, entry));
         pottery_test_assert(ufo_equal(ufo, ufo_map_entry_ref(map, entry)));
     }
+
+    #if TEST_POTTERY_FUZZ_MAP_UFO_CAN_FIND_BULK
+    // make sure bulk lookups find every element in the shadow, plus one that
+    // doesn't exist
+    if (shadow->count != 0) {
+        size_t bulk_count = shadow->count + 1;
+        const char** keys = pottery_cast(const char**, malloc(sizeof(const char*) * bulk_count));
+        ufo_map_entry_t* entries = pottery_cast(ufo_map_entry_t*,
+                malloc(sizeof(ufo_map_entry_t) * bulk_count));
+        bool* results = pottery_cast(bool*, malloc(sizeof(bool) * bulk_count));
+        for (i = 0; i < shadow->count; ++i)
+            keys[i] = shadow->map[i].string;
+        keys[shadow->count] = "";
+
+        ufo_map_find_bulk(map, keys, bulk_count, entries);
+        for (i = 0; i < shadow->count; ++i)
+            pottery_test_assert(ufo_equal(shadow->map + i, ufo_map_entry_ref(map, entries[i])));
+        pottery_test_assert(!ufo_map_entry_exists(map, entries[shadow->count]) ||
+                0 == strcmp("", ufo_map_entry_ref(map, entries[shadow->count])->string));
+
+        size_t found = ufo_map_contains_bulk(map, keys, bulk_count, results);
+        for (i = 0; i < shadow->count; ++i)
+            pottery_test_assert(results[i]);
+        pottery_test_assert(found == shadow->count + (results[shadow->count] ? 1 : 0));
+
+        free(results);
+        free(entries);
+        free(keys);
+    }
+    #endif
+
+    #if TEST_POTTERY_FUZZ_MAP_UFO_CAN_ITERATE
+    // make sure iterating forwards and backwards visits every element
+    size_t count = 0;
+    ufo_map_entry_t entry;
+    for (entry = ufo_map_begin(map); ufo_map_entry_exists(map, entry);
+            entry = ufo_map_next(map, entry))
+        ++count;
+    pottery_test_assert(count == shadow->count);
+    if (count != 0) {
+        ufo_map_entry_t first = ufo_map_first(map);
+        count = 1;
+        for (entry = ufo_map_last(map); entry != first; entry = ufo_map_previous(map, entry))
+            ++count;
+        pottery_test_assert(count == shadow->count);
+    }
+    #endif
 }
 
 typedef enum command_t {
@@ -266,7 +325,8 @@ static void fuzz_reserve(ufo_map_t* map, fuzz_input_t* input) {
     // nothing), but usually we'll be reserving more, sometimes much more.
     size_t new_capacity = fuzz_load_u24(input) % (4 * (ufo_map_count(map) + 1));
     //printf("reserving %zi (currently %zi/%zi)\n", new_capacity, ufo_map_count(map), ufo_map_capacity(map));
-    ufo_map_reserve(map, new_capacity);
+    if (ufo_map_reserve(map, new_capacity) == POTTERY_OK)
+        pottery_test_assert(ufo_map_capacity(map) >= new_capacity);
 }
 #endif
 
@@ -347,7 +407,11 @@ static void fuzz(fuzz_input_t* input) {
     };
     pottery_test_assert(shadow.map != pottery_null);
 
+    // Some maps return an error from init() and some don't so we can't check
+    // it here. We zero the map first so that GCC doesn't warn that it may be
+    // uninitialized if init() fails.
     ufo_map_t map;
+    memset(&map, 0, sizeof(map));
     ufo_map_init(&map);
 
     //printf("=============================\n");
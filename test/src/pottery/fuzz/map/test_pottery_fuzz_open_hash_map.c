@@ -43,6 +43,5 @@ static inline size_t fnv1a(const char* p) {
 #include "pottery/open_hash_map/pottery_open_hash_map_static.t.h"
 
 #define TEST_POTTERY_FUZZ_MAP_UFO_PREFIX pottery_open_hash_map_fuzz_ufo
-#define TEST_POTTERY_FUZZ_MAP_UFO_CAN_RESERVE 0
-#define TEST_POTTERY_FUZZ_MAP_UFO_CAN_SHRINK 0
+#define TEST_POTTERY_FUZZ_MAP_UFO_CAN_FIND_BULK 1
 #include "pottery/fuzz/map/test_pottery_fuzz_map_ufo.t.h"
@@ -39,6 +39,4 @@
 #include "pottery/open_hash_map/pottery_open_hash_map_static.t.h"
 
 #define TEST_POTTERY_FUZZ_MAP_UFO_PREFIX pottery_open_hash_map_fuzz_ufo_degenerate
-#define TEST_POTTERY_FUZZ_MAP_UFO_CAN_RESERVE 0
-#define TEST_POTTERY_FUZZ_MAP_UFO_CAN_SHRINK 0
 #include "pottery/fuzz/map/test_pottery_fuzz_map_ufo.t.h"
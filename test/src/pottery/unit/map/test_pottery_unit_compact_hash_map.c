@@ -0,0 +1,169 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2020-2021 11037650 Canada Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "pottery/common/test_pottery_ufo.h"
+#include "pottery/unit/test_pottery_framework.h"
+
+// workarounds for MSVC C++/CLR not allowing different structs in different
+// translation units with the same name
+#ifdef __CLR_VER
+#define ufo_map_t pottery_compact_hash_map_ufo_t
+#endif
+
+// Instantiate a compact map of const char* to ufo_t
+#define POTTERY_COMPACT_HASH_MAP_PREFIX ufo_map
+#define POTTERY_COMPACT_HASH_MAP_VALUE_TYPE ufo_t
+#define POTTERY_COMPACT_HASH_MAP_KEY_TYPE const char*
+#define POTTERY_COMPACT_HASH_MAP_REF_KEY(x) x->string
+#define POTTERY_COMPACT_HASH_MAP_KEY_HASH(x) pottery_cast(size_t, pottery_hash_string(x, 0))
+#define POTTERY_COMPACT_HASH_MAP_KEY_EQUAL 0 == strcmp
+#define POTTERY_COMPACT_HASH_MAP_LIFECYCLE_MOVE ufo_move
+#define POTTERY_COMPACT_HASH_MAP_LIFECYCLE_DESTROY ufo_destroy
+#include "pottery/compact_hash_map/pottery_compact_hash_map_static.t.h"
+
+// Instantiate ufo_map tests on our ufo map
+#define POTTERY_TEST_MAP_UFO_PREFIX pottery_compact_hash_map_ufo
+#define POTTERY_TEST_MAP_UFO_HAS_CAPACITY 1
+#include "pottery/unit/map/test_pottery_unit_map_ufo.t.h"
+
+
+
+// A map of ints with keys as their own hashes, to check insertion order and
+// index widths
+
+typedef struct int_pair_t {
+    int key;
+    int value;
+} int_pair_t;
+
+#define POTTERY_COMPACT_HASH_MAP_PREFIX int_map
+#define POTTERY_COMPACT_HASH_MAP_VALUE_TYPE int_pair_t
+#define POTTERY_COMPACT_HASH_MAP_KEY_TYPE int
+#define POTTERY_COMPACT_HASH_MAP_REF_KEY(x) x->key
+#define POTTERY_COMPACT_HASH_MAP_KEY_HASH(x) pottery_cast(size_t, x)
+#define POTTERY_COMPACT_HASH_MAP_KEY_EQUAL(x, y) x == y
+#define POTTERY_COMPACT_HASH_MAP_LIFECYCLE_MOVE_BY_VALUE 1
+#define POTTERY_COMPACT_HASH_MAP_LIFECYCLE_DESTROY(x) (void)x
+#include "pottery/compact_hash_map/pottery_compact_hash_map_static.t.h"
+
+static void int_map_add(int_map_t* map, int key) {
+    int_pair_t* entry;
+    bool created;
+    pottery_test_assert(POTTERY_OK == int_map_emplace_key(map, key, &entry, &created));
+    pottery_test_assert(created);
+    entry->key = key;
+    entry->value = key * 10;
+}
+
+// Checks that the map contains exactly the keys in [0,count) that aren't
+// multiples of skip (if skip is not zero), in increasing order.
+static void int_map_check_order(int_map_t* map, int count, int skip) {
+    int_pair_t* entry = int_map_begin(map);
+    int i;
+    for (i = 0; i < count; ++i) {
+        if (skip != 0 && i % skip == 0) {
+            pottery_test_assert(!int_map_contains_key(map, i));
+            continue;
+        }
+        pottery_test_assert(int_map_entry_exists(map, entry));
+        pottery_test_assert(entry->key == i);
+        pottery_test_assert(entry->value == i * 10);
+        pottery_test_assert(int_map_find(map, i) == entry);
+        entry = int_map_next(map, entry);
+    }
+    pottery_test_assert(!int_map_entry_exists(map, entry));
+}
+
+POTTERY_TEST(pottery_compact_hash_map_insertion_order) {
+    int_map_t map;
+    int_pair_t* entry;
+    bool created;
+    int i;
+
+    pottery_test_assert(POTTERY_OK == int_map_init(&map));
+
+    // Values stay in insertion order as the map grows, across removals and
+    // when it compacts its holes.
+    for (i = 0; i < 1000; ++i)
+        int_map_add(&map, i);
+    int_map_check_order(&map, 1000, 0);
+    for (i = 0; i < 1000; i += 3)
+        pottery_test_assert(int_map_remove_key(&map, i));
+    int_map_check_order(&map, 1000, 3);
+    pottery_test_assert(int_map_count(&map) == 666);
+    for (i = 0; i < 1000; ++i) {
+        if (i % 3 != 0)
+            continue;
+        pottery_test_assert(int_map_remove_key(&map, i + 1) == (i + 1 < 1000));
+        int_map_add(&map, i + 1);
+    }
+
+    // Re-inserted keys go to the end. Existing keys keep their place.
+    entry = int_map_first(&map);
+    pottery_test_assert(entry->key == 2);
+    entry = int_map_last(&map);
+    pottery_test_assert(entry->key == 1000);
+    pottery_test_assert(POTTERY_OK == int_map_emplace_key(&map, 2, &entry, &created));
+    pottery_test_assert(!created);
+    pottery_test_assert(entry == int_map_first(&map));
+    pottery_test_assert(int_map_previous(&map, int_map_first(&map)) == pottery_null);
+
+    int_map_destroy(&map);
+}
+
+POTTERY_TEST(pottery_compact_hash_map_index_width) {
+    int_map_t map;
+    int i;
+
+    pottery_test_assert(POTTERY_OK == int_map_init(&map));
+    pottery_test_assert(map.index_width == 1);
+
+    // The indices widen as the map grows and narrow as it shrinks.
+    for (i = 0; i < 300; ++i)
+        int_map_add(&map, i);
+    pottery_test_assert(map.index_width == 2);
+    pottery_test_assert(POTTERY_OK == int_map_reserve(&map, 70000));
+    pottery_test_assert(map.index_width == 4);
+    pottery_test_assert(int_map_capacity(&map) >= 70000);
+    int_map_check_order(&map, 300, 0);
+
+    for (i = 299; i >= 10; --i)
+        pottery_test_assert(int_map_remove_key(&map, i));
+    pottery_test_assert(map.index_width == 1);
+    int_map_check_order(&map, 10, 0);
+
+    // Repeatedly adding and removing different keys fills the index table
+    // with tombstones. The map cleans them up at the same size rather than
+    // growing.
+    int_map_remove_all(&map);
+    int_map_add(&map, 6);
+    for (i = 0; i < 1000; ++i) {
+        int_map_add(&map, 100 + i);
+        pottery_test_assert(int_map_remove_key(&map, 100 + i));
+    }
+    pottery_test_assert(int_map_count(&map) == 1);
+    pottery_test_assert(int_map_first(&map)->key == 6);
+    pottery_test_assert(map.log_2_size == 3);
+
+    int_map_destroy(&map);
+}
@@ -0,0 +1,104 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2020-2021 11037650 Canada Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "pottery/common/test_pottery_ufo.h"
+#include "pottery/unit/test_pottery_framework.h"
+
+static inline size_t fnv1a(const char* p) {
+    uint32_t hash = 2166136261;
+    for (; *p != 0; ++p)
+        hash = (hash ^ pottery_cast(uint8_t, *p)) * 16777619;
+    return hash;
+}
+
+// workarounds for MSVC C++/CLR not allowing different structs in different
+// translation units with the same name
+#ifdef __CLR_VER
+#define ufo_map_t pottery_cuckoo_hash_map_ufo_t
+#endif
+
+// Instantiate a cuckoo map of const char* to ufo_t
+#define POTTERY_CUCKOO_HASH_MAP_PREFIX ufo_map
+#define POTTERY_CUCKOO_HASH_MAP_VALUE_TYPE ufo_t
+#define POTTERY_CUCKOO_HASH_MAP_KEY_TYPE const char*
+#define POTTERY_CUCKOO_HASH_MAP_REF_KEY(x) x->string
+#define POTTERY_CUCKOO_HASH_MAP_KEY_HASH fnv1a
+#define POTTERY_CUCKOO_HASH_MAP_KEY_EQUAL 0 == strcmp
+#define POTTERY_CUCKOO_HASH_MAP_LIFECYCLE_MOVE ufo_move
+#define POTTERY_CUCKOO_HASH_MAP_LIFECYCLE_DESTROY ufo_destroy
+#include "pottery/cuckoo_hash_map/pottery_cuckoo_hash_map_static.t.h"
+
+// Instantiate ufo_map tests on our ufo map
+#define POTTERY_TEST_MAP_UFO_PREFIX pottery_cuckoo_hash_map_ufo
+#define POTTERY_TEST_MAP_UFO_HAS_CAPACITY 1
+#include "pottery/unit/map/test_pottery_unit_map_ufo.t.h"
+
+
+
+// A map of ints with one slot per bucket and every key hashed to the same
+// value. Only two values fit; the third must fail without losing anything.
+
+typedef struct int_pair_t {
+    int key;
+    int value;
+} int_pair_t;
+
+#define POTTERY_CUCKOO_HASH_MAP_PREFIX degenerate_map
+#define POTTERY_CUCKOO_HASH_MAP_VALUE_TYPE int_pair_t
+#define POTTERY_CUCKOO_HASH_MAP_KEY_TYPE int
+#define POTTERY_CUCKOO_HASH_MAP_REF_KEY(x) x->key
+#define POTTERY_CUCKOO_HASH_MAP_KEY_HASH(x) (void)x, 0xBAAAAAAD
+#define POTTERY_CUCKOO_HASH_MAP_KEY_EQUAL(x, y) x == y
+#define POTTERY_CUCKOO_HASH_MAP_LIFECYCLE_MOVE_BY_VALUE 1
+#define POTTERY_CUCKOO_HASH_MAP_BUCKET_SLOTS 1
+#include "pottery/cuckoo_hash_map/pottery_cuckoo_hash_map_static.t.h"
+
+POTTERY_TEST(pottery_cuckoo_hash_map_degenerate_full) {
+    degenerate_map_t map;
+    int_pair_t* entry;
+    bool created;
+    int i;
+
+    pottery_test_assert(POTTERY_OK == degenerate_map_init(&map));
+
+    for (i = 0; i < 2; ++i) {
+        pottery_test_assert(POTTERY_OK == degenerate_map_emplace_key(&map, i, &entry, &created));
+        pottery_test_assert(created);
+        entry->key = i;
+        entry->value = i * 10;
+    }
+
+    pottery_test_assert(POTTERY_ERROR_FULL == degenerate_map_emplace_key(&map, 2, &entry, &created));
+    pottery_test_assert(degenerate_map_count(&map) == 2);
+    for (i = 0; i < 2; ++i) {
+        entry = degenerate_map_find(&map, i);
+        pottery_test_assert(degenerate_map_entry_exists(&map, entry));
+        pottery_test_assert(entry->value == i * 10);
+    }
+    pottery_test_assert(!degenerate_map_contains_key(&map, 2));
+
+    degenerate_map_displace_all(&map);
+    degenerate_map_destroy(&map);
+}
@@ -0,0 +1,98 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2020-2021 11037650 Canada Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "pottery/common/test_pottery_ufo.h"
+#include "pottery/unit/test_pottery_framework.h"
+
+// workarounds for MSVC C++/CLR not allowing different structs in different
+// translation units with the same name
+#ifdef __CLR_VER
+#define ufo_map_t pottery_node_hash_map_ufo_t
+#endif
+
+// Instantiate a map of const char* to ufo_t
+#define POTTERY_NODE_HASH_MAP_PREFIX ufo_map
+#define POTTERY_NODE_HASH_MAP_VALUE_TYPE ufo_t
+#define POTTERY_NODE_HASH_MAP_KEY_TYPE const char*
+#define POTTERY_NODE_HASH_MAP_REF_KEY(x) x->string
+#define POTTERY_NODE_HASH_MAP_KEY_HASH(x) pottery_cast(size_t, pottery_hash_string(x, 0))
+#define POTTERY_NODE_HASH_MAP_KEY_EQUAL 0 == strcmp
+#define POTTERY_NODE_HASH_MAP_LIFECYCLE_MOVE ufo_move
+#define POTTERY_NODE_HASH_MAP_LIFECYCLE_DESTROY ufo_destroy
+#include "pottery/node_hash_map/pottery_node_hash_map_static.t.h"
+
+// Instantiate ufo_map tests on our ufo map
+#define POTTERY_TEST_MAP_UFO_PREFIX pottery_node_hash_map_ufo
+#define POTTERY_TEST_MAP_UFO_HAS_CAPACITY 1
+#define POTTERY_TEST_MAP_UFO_INIT_CAN_FAIL 0
+#include "pottery/unit/map/test_pottery_unit_map_ufo.t.h"
+
+// Entries are never moved, not even when the map grows or shrinks
+POTTERY_TEST(pottery_node_hash_map_pointer_stability) {
+    static const char* const strings[] = {
+        "alice", "bob", "carol", "dave", "eve", "frank", "grace", "heidi",
+        "ivan", "judy", "mallory", "niaj", "olivia", "peggy", "rupert", "sybil",
+        "trent", "victor", "walter", "xavier", "yvonne", "zed",
+    };
+    const size_t count = sizeof(strings) / sizeof(*strings);
+    ufo_t* entries[sizeof(strings) / sizeof(*strings)];
+
+    ufo_map_t map;
+    ufo_map_init(&map);
+
+    size_t i;
+    for (i = 0; i < count; ++i) {
+        bool created;
+        pottery_test_assert(POTTERY_OK == ufo_map_emplace_key(&map, strings[i], &entries[i], &created));
+        pottery_test_assert(created);
+        pottery_test_assert(POTTERY_OK == ufo_init(entries[i], strings[i], pottery_cast(int32_t, i)));
+    }
+    pottery_test_assert(ufo_map_bucket_count(&map) >= count);
+
+    // remove most of them so the map shrinks
+    for (i = 0; i < count; ++i)
+        if (i % 5 != 0)
+            pottery_test_assert(ufo_map_remove_key(&map, strings[i]));
+    pottery_test_assert(ufo_map_count(&map) == 5);
+    pottery_test_assert(POTTERY_OK == ufo_map_shrink(&map));
+    pottery_test_assert(ufo_map_bucket_count(&map) < count);
+
+    for (i = 0; i < count; i += 5)
+        pottery_test_assert(ufo_map_find(&map, strings[i]) == entries[i]);
+
+    // grow it again
+    pottery_test_assert(POTTERY_OK == ufo_map_reserve(&map, 1000));
+    pottery_test_assert(ufo_map_capacity(&map) >= 1000);
+    for (i = 0; i < count; i += 5)
+        pottery_test_assert(ufo_map_find(&map, strings[i]) == entries[i]);
+
+    // remove_all() keeps the buckets, shrink() on an empty map frees them
+    ufo_map_remove_all(&map);
+    pottery_test_assert(ufo_map_is_empty(&map));
+    pottery_test_assert(ufo_map_bucket_count(&map) >= 1000);
+    pottery_test_assert(POTTERY_OK == ufo_map_shrink(&map));
+    pottery_test_assert(ufo_map_bucket_count(&map) == 0);
+
+    ufo_map_destroy(&map);
+}
@@ -84,3 +84,282 @@ typedef struct bar_s {
 #define POTTERY_OPEN_HASH_MAP_KEY_EQUAL(x, y) (x == y)
 #define POTTERY_OPEN_HASH_MAP_LIFECYCLE_MOVE(p,q) memcpy(p, q, sizeof (bar_t))
 #include "pottery/open_hash_map/pottery_open_hash_map_static.t.h"
+
+
+
+// Test of sharing precomputed hashes between maps of the same key type
+
+static inline size_t ulong_hash(unsigned long x) {
+    return pottery_cast(size_t, x) * 2654435761u;
+}
+
+#define POTTERY_OPEN_HASH_MAP_PREFIX map_ulong_hashed
+#define POTTERY_OPEN_HASH_MAP_VALUE_TYPE bar_t
+#define POTTERY_OPEN_HASH_MAP_KEY_TYPE unsigned long
+#define POTTERY_OPEN_HASH_MAP_REF_KEY(v) v->key
+#define POTTERY_OPEN_HASH_MAP_KEY_HASH ulong_hash
+#define POTTERY_OPEN_HASH_MAP_KEY_EQUAL(x, y) (x == y)
+#define POTTERY_OPEN_HASH_MAP_LIFECYCLE_MOVE(p,q) memcpy(p, q, sizeof (bar_t))
+#define POTTERY_OPEN_HASH_MAP_LIFECYCLE_DESTROY(p) (void)p
+#include "pottery/open_hash_map/pottery_open_hash_map_static.t.h"
+
+#define POTTERY_OPEN_HASH_MAP_PREFIX map_ulong_hashed_group
+#define POTTERY_OPEN_HASH_MAP_VALUE_TYPE bar_t
+#define POTTERY_OPEN_HASH_MAP_KEY_TYPE unsigned long
+#define POTTERY_OPEN_HASH_MAP_REF_KEY(v) v->key
+#define POTTERY_OPEN_HASH_MAP_KEY_HASH ulong_hash
+#define POTTERY_OPEN_HASH_MAP_KEY_EQUAL(x, y) (x == y)
+#define POTTERY_OPEN_HASH_MAP_LIFECYCLE_MOVE(p,q) memcpy(p, q, sizeof (bar_t))
+#define POTTERY_OPEN_HASH_MAP_LIFECYCLE_DESTROY(p) (void)p
+#define POTTERY_OPEN_HASH_MAP_GROUP_PROBING 1
+#define POTTERY_OPEN_HASH_MAP_INCREMENTAL_REHASH 1
+#include "pottery/open_hash_map/pottery_open_hash_map_static.t.h"
+
+// All keys have the same hash
+#define POTTERY_OPEN_HASH_MAP_PREFIX map_ulong_degenerate
+#define POTTERY_OPEN_HASH_MAP_VALUE_TYPE bar_t
+#define POTTERY_OPEN_HASH_MAP_KEY_TYPE unsigned long
+#define POTTERY_OPEN_HASH_MAP_REF_KEY(v) v->key
+#define POTTERY_OPEN_HASH_MAP_KEY_HASH(x) ((void)x, 0)
+#define POTTERY_OPEN_HASH_MAP_KEY_EQUAL(x, y) (x == y)
+#define POTTERY_OPEN_HASH_MAP_LIFECYCLE_MOVE(p,q) memcpy(p, q, sizeof (bar_t))
+#define POTTERY_OPEN_HASH_MAP_LIFECYCLE_DESTROY(p) (void)p
+#include "pottery/open_hash_map/pottery_open_hash_map_static.t.h"
+
+// Zero is the empty key. With quadratic probing the map stores tombstones in
+// its metadata.
+#define POTTERY_OPEN_HASH_MAP_PREFIX map_ulong_zero
+#define POTTERY_OPEN_HASH_MAP_VALUE_TYPE bar_t
+#define POTTERY_OPEN_HASH_MAP_KEY_TYPE unsigned long
+#define POTTERY_OPEN_HASH_MAP_REF_KEY(v) v->key
+#define POTTERY_OPEN_HASH_MAP_KEY_HASH ulong_hash
+#define POTTERY_OPEN_HASH_MAP_KEY_EQUAL(x, y) (x == y)
+#define POTTERY_OPEN_HASH_MAP_LIFECYCLE_MOVE(p,q) memcpy(p, q, sizeof (bar_t))
+#define POTTERY_OPEN_HASH_MAP_LIFECYCLE_DESTROY(p) (void)p
+#define POTTERY_OPEN_HASH_MAP_QUADRATIC_PROBING 1
+#define POTTERY_OPEN_HASH_MAP_EMPTY_IS_ZERO 1
+#define POTTERY_OPEN_HASH_MAP_IS_EMPTY(v) v->key == 0
+#define POTTERY_OPEN_HASH_MAP_SET_EMPTY(v) v->key = 0
+#include "pottery/open_hash_map/pottery_open_hash_map_static.t.h"
+
+POTTERY_TEST(pottery_open_hash_map_with_hash) {
+    map_ulong_hashed_t plain;
+    map_ulong_hashed_group_t group;
+    unsigned long i;
+
+    pottery_test_assert(POTTERY_OK == map_ulong_hashed_init(&plain));
+    pottery_test_assert(POTTERY_OK == map_ulong_hashed_group_init(&group));
+
+    // Hash each key once and insert it into both maps.
+    for (i = 0; i < 500; ++i) {
+        size_t hash = ulong_hash(i);
+        bar_t* entry;
+        bool created;
+
+        pottery_test_assert(POTTERY_OK == map_ulong_hashed_emplace_key_with_hash(&plain, i, hash, &entry, &created));
+        pottery_test_assert(created);
+        entry->key = i;
+        entry->value = i * 2;
+
+        pottery_test_assert(POTTERY_OK == map_ulong_hashed_group_emplace_key_with_hash(&group, i, hash, &entry, &created));
+        pottery_test_assert(created);
+        entry->key = i;
+        entry->value = i * 3;
+
+        pottery_test_assert(POTTERY_OK == map_ulong_hashed_emplace_key_with_hash(&plain, i, hash, &entry, &created));
+        pottery_test_assert(!created);
+    }
+
+    for (i = 0; i < 600; ++i) {
+        size_t hash = ulong_hash(i);
+        bar_t* entry = map_ulong_hashed_find_with_hash(&plain, i, hash);
+        pottery_test_assert(map_ulong_hashed_entry_exists(&plain, entry) == (i < 500));
+        pottery_test_assert(i >= 500 || entry->value == i * 2);
+        entry = map_ulong_hashed_group_find_with_hash(&group, i, hash);
+        pottery_test_assert(map_ulong_hashed_group_entry_exists(&group, entry) == (i < 500));
+        pottery_test_assert(i >= 500 || entry->value == i * 3);
+    }
+
+    // Remove the even keys from both maps.
+    for (i = 0; i < 500; i += 2) {
+        size_t hash = ulong_hash(i);
+        pottery_test_assert(map_ulong_hashed_remove_key_with_hash(&plain, i, hash));
+        pottery_test_assert(map_ulong_hashed_group_remove_key_with_hash(&group, i, hash));
+        pottery_test_assert(!map_ulong_hashed_remove_key_with_hash(&plain, i, hash));
+    }
+
+    for (i = 0; i < 500; ++i) {
+        size_t hash = ulong_hash(i);
+        pottery_test_assert(map_ulong_hashed_contains_key_with_hash(&plain, i, hash) == (i % 2 == 1));
+        pottery_test_assert(map_ulong_hashed_group_contains_key_with_hash(&group, i, hash) == (i % 2 == 1));
+    }
+    pottery_test_assert(map_ulong_hashed_count(&plain) == 250);
+    pottery_test_assert(map_ulong_hashed_group_count(&group) == 250);
+
+    map_ulong_hashed_group_destroy(&group);
+    map_ulong_hashed_destroy(&plain);
+}
+
+POTTERY_TEST(pottery_open_hash_map_reserve_insert_bulk) {
+    map_ulong_hashed_t map;
+    bar_t values[1000];
+    size_t capacity;
+    unsigned long i;
+
+    pottery_test_assert(POTTERY_OK == map_ulong_hashed_init(&map));
+
+    // Reserving grows the map once so it doesn't grow while inserting.
+    pottery_test_assert(POTTERY_OK == map_ulong_hashed_reserve(&map, 1000));
+    capacity = map_ulong_hashed_capacity(&map);
+    pottery_test_assert(capacity >= 1000);
+    pottery_test_assert(POTTERY_OK == map_ulong_hashed_reserve(&map, 10));
+    pottery_test_assert(map_ulong_hashed_capacity(&map) == capacity);
+
+    for (i = 0; i < 1000; ++i) {
+        values[i].key = i;
+        values[i].value = i;
+    }
+    pottery_test_assert(POTTERY_OK == map_ulong_hashed_insert_bulk(&map, values, 1000));
+    pottery_test_assert(map_ulong_hashed_count(&map) == 1000);
+    pottery_test_assert(map_ulong_hashed_capacity(&map) == capacity);
+
+    // Inserting existing keys replaces their values.
+    for (i = 0; i < 100; ++i) {
+        values[i].key = i * 20;
+        values[i].value = i + 5000;
+    }
+    pottery_test_assert(POTTERY_OK == map_ulong_hashed_insert_bulk(&map, values, 100));
+    pottery_test_assert(map_ulong_hashed_count(&map) == 1050);
+
+    for (i = 0; i < 2000; ++i) {
+        bar_t* entry = map_ulong_hashed_find(&map, i);
+        if (i % 20 == 0) {
+            pottery_test_assert(entry->value == i / 20 + 5000);
+        } else if (i < 1000) {
+            pottery_test_assert(entry->value == i);
+        } else {
+            pottery_test_assert(!map_ulong_hashed_entry_exists(&map, entry));
+        }
+    }
+
+    map_ulong_hashed_destroy(&map);
+}
+
+POTTERY_TEST(pottery_open_hash_map_stats) {
+    map_ulong_degenerate_t map;
+    map_ulong_degenerate_stats_t stats;
+    bar_t* entry;
+    unsigned long i;
+
+    // All keys collide so the values form a single cluster with probe lengths
+    // 0 to 19.
+    pottery_test_assert(POTTERY_OK == map_ulong_degenerate_init(&map));
+    for (i = 0; i < 20; ++i) {
+        pottery_test_assert(POTTERY_OK == map_ulong_degenerate_emplace_key(&map, i, &entry, pottery_null));
+        entry->key = i;
+        entry->value = i;
+    }
+
+    map_ulong_degenerate_stats(&map, &stats);
+    pottery_test_assert(stats.count == 20);
+    pottery_test_assert(stats.tombstones == 0);
+    pottery_test_assert(stats.load == 20);
+    pottery_test_assert(stats.bucket_count == 64);
+    pottery_test_assert(stats.capacity == map_ulong_degenerate_capacity(&map));
+    pottery_test_assert(stats.probe_length_total == 19 * 20 / 2);
+    pottery_test_assert(stats.probe_length_max == 19);
+    for (i = 0; i < 15; ++i)
+        pottery_test_assert(stats.probe_length_histogram[i] == 1);
+    pottery_test_assert(stats.probe_length_histogram[15] == 5);
+
+    // A miss starting in the cluster probes to its end.
+    pottery_test_assert(stats.miss_probe_length_total == 20 * 21 / 2);
+    pottery_test_assert(stats.miss_probe_starts == 64);
+
+    pottery_test_assert(stats.value_bytes == 64 * sizeof(bar_t));
+    pottery_test_assert(stats.metadata_bytes == 64);
+
+    map_ulong_degenerate_destroy(&map);
+}
+
+POTTERY_TEST(pottery_open_hash_map_stats_group) {
+    map_ulong_hashed_group_t map;
+    map_ulong_hashed_group_stats_t stats;
+    bar_t* entry;
+    size_t total;
+    unsigned long i;
+
+    pottery_test_assert(POTTERY_OK == map_ulong_hashed_group_init(&map));
+    for (i = 0; i < 1000; ++i) {
+        pottery_test_assert(POTTERY_OK == map_ulong_hashed_group_emplace_key(&map, i, &entry, pottery_null));
+        entry->key = i;
+        entry->value = i;
+    }
+    for (i = 0; i < 1000; i += 3)
+        pottery_test_assert(map_ulong_hashed_group_remove_key(&map, i));
+
+    // The histogram covers every value, including any that haven't been
+    // migrated yet.
+    map_ulong_hashed_group_stats(&map, &stats);
+    pottery_test_assert(stats.count == 666);
+    pottery_test_assert(stats.load == stats.count + stats.tombstones);
+    total = 0;
+    for (i = 0; i < 16; ++i)
+        total += stats.probe_length_histogram[i];
+    pottery_test_assert(total == 666);
+    pottery_test_assert(stats.probe_length_total >= stats.probe_length_max);
+    pottery_test_assert(stats.miss_probe_starts >= stats.bucket_count / 16);
+    pottery_test_assert(stats.value_bytes >= stats.bucket_count * sizeof(bar_t));
+
+    map_ulong_hashed_group_destroy(&map);
+}
+
+#define TEST_KEEP_CAPACITY(prefix) \
+    POTTERY_TEST(pottery_open_hash_map_##prefix##_keep_capacity) { \
+        prefix##_t map; \
+        bar_t* entry; \
+        size_t capacity; \
+        unsigned long i; \
+        int round; \
+        \
+        pottery_test_assert(POTTERY_OK == prefix##_init(&map)); \
+        for (round = 0; round < 4; ++round) { \
+            /* Zero is the empty key of some maps so we start at one. */ \
+            for (i = 1; i <= 1000; ++i) { \
+                pottery_test_assert(POTTERY_OK == prefix##_emplace_key(&map, i, &entry, pottery_null)); \
+                entry->key = i; \
+                entry->value = i + pottery_cast(unsigned long, round); \
+            } \
+            /* leave some tombstones */ \
+            for (i = 1; i <= 1000; i += 3) \
+                pottery_test_assert(prefix##_remove_key(&map, i)); \
+            for (i = 1; i <= 1000; ++i) { \
+                entry = prefix##_find(&map, i); \
+                pottery_test_assert(prefix##_entry_exists(&map, entry) == (i % 3 != 1)); \
+                if (prefix##_entry_exists(&map, entry)) \
+                    pottery_test_assert(entry->value == i + pottery_cast(unsigned long, round)); \
+            } \
+            \
+            /* Alternate between keeping and freeing the buckets. */ \
+            capacity = prefix##_capacity(&map); \
+            if (round % 2 == 0) { \
+                prefix##_remove_all_keep_capacity(&map); \
+                pottery_test_assert(prefix##_capacity(&map) == capacity); \
+            } else { \
+                prefix##_displace_all_keep_capacity(&map); \
+                pottery_test_assert(prefix##_capacity(&map) == capacity); \
+                prefix##_remove_all(&map); \
+                pottery_test_assert(prefix##_capacity(&map) < capacity); \
+            } \
+            pottery_test_assert(prefix##_count(&map) == 0); \
+            pottery_test_assert(prefix##_is_empty(&map)); \
+            pottery_test_assert(!prefix##_entry_exists(&map, prefix##_begin(&map))); \
+            for (i = 1; i <= 1000; ++i) \
+                pottery_test_assert(!prefix##_contains_key(&map, i)); \
+        } \
+        prefix##_destroy(&map); \
+    }
+
+TEST_KEEP_CAPACITY(map_ulong_hashed)
+TEST_KEEP_CAPACITY(map_ulong_hashed_group)
+TEST_KEEP_CAPACITY(map_ulong_zero)
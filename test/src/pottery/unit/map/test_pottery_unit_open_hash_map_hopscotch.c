@@ -0,0 +1,201 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2020-2021 11037650 Canada Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "pottery/common/test_pottery_ufo.h"
+#include "pottery/unit/test_pottery_framework.h"
+
+static inline size_t fnv1a(const char* p) {
+    uint32_t hash = 2166136261;
+    for (; *p != 0; ++p)
+        hash = (hash ^ pottery_cast(uint8_t, *p)) * 16777619;
+    return hash;
+}
+
+// workarounds for MSVC C++/CLR not allowing different structs in different
+// translation units with the same name
+#ifdef __CLR_VER
+#define ufo_map_t pottery_open_hash_map_hopscotch_ufo_t
+#endif
+
+// Instantiate a map of const char* to ufo_t
+// Use hopscotch hashing at a high load factor. The map stores hop info for
+// us.
+#define POTTERY_OPEN_HASH_MAP_PREFIX ufo_map
+#define POTTERY_OPEN_HASH_MAP_VALUE_TYPE ufo_t
+#define POTTERY_OPEN_HASH_MAP_KEY_TYPE const char*
+#define POTTERY_OPEN_HASH_MAP_REF_KEY(x) x->string
+#define POTTERY_OPEN_HASH_MAP_KEY_HASH fnv1a
+#define POTTERY_OPEN_HASH_MAP_KEY_EQUAL 0 == strcmp
+#define POTTERY_OPEN_HASH_MAP_LIFECYCLE_MOVE ufo_move
+#define POTTERY_OPEN_HASH_MAP_LIFECYCLE_DESTROY ufo_destroy
+#define POTTERY_OPEN_HASH_MAP_HOPSCOTCH_HASHING 1
+#define POTTERY_OPEN_HASH_MAP_MAX_LOAD_FACTOR_NUMERATOR 9
+#define POTTERY_OPEN_HASH_MAP_MAX_LOAD_FACTOR_DENOMINATOR 10
+#include "pottery/open_hash_map/pottery_open_hash_map_static.t.h"
+
+// Instantiate ufo_map tests on our ufo map
+#define POTTERY_TEST_MAP_UFO_PREFIX pottery_open_hash_map_ufo_hopscotch
+#define POTTERY_TEST_MAP_UFO_HAS_CAPACITY 1
+#include "pottery/unit/map/test_pottery_unit_map_ufo.t.h"
+
+typedef struct bar_s {
+  unsigned long key;
+  unsigned long value;
+} bar_t;
+
+// Groups of 32 keys share a hash so they overflow a neighborhood of 8. The
+// metadata is packed into one bit per bucket.
+#define POTTERY_OPEN_HASH_MAP_PREFIX map_hopscotch_packed
+#define POTTERY_OPEN_HASH_MAP_VALUE_TYPE bar_t
+#define POTTERY_OPEN_HASH_MAP_KEY_TYPE unsigned long
+#define POTTERY_OPEN_HASH_MAP_REF_KEY(v) v->key
+#define POTTERY_OPEN_HASH_MAP_KEY_HASH(x) (x / 32)
+#define POTTERY_OPEN_HASH_MAP_KEY_EQUAL(x, y) (x == y)
+#define POTTERY_OPEN_HASH_MAP_LIFECYCLE_MOVE(p,q) memcpy(p, q, sizeof (bar_t))
+#define POTTERY_OPEN_HASH_MAP_LIFECYCLE_DESTROY(p) (void)p
+#define POTTERY_OPEN_HASH_MAP_HOPSCOTCH_HASHING 1
+#define POTTERY_OPEN_HASH_MAP_HOPSCOTCH_NEIGHBORHOOD 8
+#define POTTERY_OPEN_HASH_MAP_PACKED_METADATA 1
+#include "pottery/open_hash_map/pottery_open_hash_map_static.t.h"
+
+// The same with an in-band empty key and no metadata.
+#define POTTERY_OPEN_HASH_MAP_PREFIX map_hopscotch_inband
+#define POTTERY_OPEN_HASH_MAP_VALUE_TYPE bar_t
+#define POTTERY_OPEN_HASH_MAP_KEY_TYPE unsigned long
+#define POTTERY_OPEN_HASH_MAP_REF_KEY(v) v->key
+#define POTTERY_OPEN_HASH_MAP_KEY_HASH(x) (x / 32)
+#define POTTERY_OPEN_HASH_MAP_KEY_EQUAL(x, y) (x == y)
+#define POTTERY_OPEN_HASH_MAP_LIFECYCLE_MOVE(p,q) memcpy(p, q, sizeof (bar_t))
+#define POTTERY_OPEN_HASH_MAP_LIFECYCLE_DESTROY(p) (void)p
+#define POTTERY_OPEN_HASH_MAP_HOPSCOTCH_HASHING 1
+#define POTTERY_OPEN_HASH_MAP_HOPSCOTCH_NEIGHBORHOOD 8
+#define POTTERY_OPEN_HASH_MAP_EMPTY_IS_ZERO 1
+#define POTTERY_OPEN_HASH_MAP_IS_EMPTY(v) v->key == 0
+#define POTTERY_OPEN_HASH_MAP_SET_EMPTY(v) v->key = 0
+#include "pottery/open_hash_map/pottery_open_hash_map_static.t.h"
+
+// Well mixed keys with the default neighborhood (24) so nothing overflows.
+#define POTTERY_OPEN_HASH_MAP_PREFIX map_hopscotch_mixed
+#define POTTERY_OPEN_HASH_MAP_VALUE_TYPE bar_t
+#define POTTERY_OPEN_HASH_MAP_KEY_TYPE unsigned long
+#define POTTERY_OPEN_HASH_MAP_REF_KEY(v) v->key
+#define POTTERY_OPEN_HASH_MAP_KEY_HASH(x) pottery_cast(size_t, \
+        pottery_hash_mix_u64(x, UINT64_C(0x9E3779B97F4A7C15)))
+#define POTTERY_OPEN_HASH_MAP_KEY_EQUAL(x, y) (x == y)
+#define POTTERY_OPEN_HASH_MAP_LIFECYCLE_MOVE(p,q) memcpy(p, q, sizeof (bar_t))
+#define POTTERY_OPEN_HASH_MAP_LIFECYCLE_DESTROY(p) (void)p
+#define POTTERY_OPEN_HASH_MAP_HOPSCOTCH_HASHING 1
+#define POTTERY_OPEN_HASH_MAP_MAX_LOAD_FACTOR_NUMERATOR 9
+#define POTTERY_OPEN_HASH_MAP_MAX_LOAD_FACTOR_DENOMINATOR 10
+#include "pottery/open_hash_map/pottery_open_hash_map_static.t.h"
+
+#define TEST_HOPSCOTCH_COLLISIONS(prefix) \
+    POTTERY_TEST(pottery_open_hash_map_##prefix##_collisions) { \
+        prefix##_t map; \
+        bar_t* entry; \
+        unsigned long i; \
+        int round; \
+        \
+        pottery_test_assert(POTTERY_OK == prefix##_init(&map)); \
+        for (round = 0; round < 2; ++round) { \
+            \
+            /* Zero is the empty key of the in-band map so we start at one. */ \
+            for (i = 1; i <= 2000; ++i) { \
+                bool created; \
+                pottery_test_assert(POTTERY_OK == prefix##_emplace_key(&map, i, &entry, &created)); \
+                pottery_test_assert(created); \
+                entry->key = i; \
+                entry->value = i * 2; \
+            } \
+            for (i = 1; i <= 2000; i += 3) \
+                pottery_test_assert(prefix##_remove_key(&map, i)); \
+            \
+            for (i = 1; i <= 2100; ++i) { \
+                entry = prefix##_find(&map, i); \
+                pottery_test_assert(prefix##_entry_exists(&map, entry) == \
+                        (i <= 2000 && i % 3 != 1)); \
+                if (prefix##_entry_exists(&map, entry)) \
+                    pottery_test_assert(entry->value == i * 2); \
+            } \
+            \
+            /* Clearing must also clear hop info. */ \
+            prefix##_remove_all(&map); \
+            pottery_test_assert(prefix##_count(&map) == 0); \
+            for (i = 1; i <= 2000; ++i) \
+                pottery_test_assert(!prefix##_contains_key(&map, i)); \
+        } \
+        prefix##_destroy(&map); \
+    }
+
+TEST_HOPSCOTCH_COLLISIONS(map_hopscotch_packed)
+TEST_HOPSCOTCH_COLLISIONS(map_hopscotch_inband)
+
+POTTERY_TEST(pottery_open_hash_map_hopscotch_stats) {
+    map_hopscotch_packed_t map;
+    map_hopscotch_packed_stats_t stats;
+    bar_t* entry;
+    unsigned long i;
+
+    pottery_test_assert(POTTERY_OK == map_hopscotch_packed_init(&map));
+    for (i = 1; i <= 100; ++i) {
+        pottery_test_assert(POTTERY_OK == map_hopscotch_packed_emplace_key(&map, i, &entry, pottery_null));
+        entry->key = i;
+        entry->value = i;
+    }
+
+    // The metadata bytes include a word of hop info per bucket.
+    map_hopscotch_packed_stats(&map, &stats);
+    pottery_test_assert(stats.count == 100);
+    pottery_test_assert(stats.metadata_bytes >= stats.bucket_count * sizeof(uint32_t));
+
+    map_hopscotch_packed_destroy(&map);
+}
+
+POTTERY_TEST(pottery_open_hash_map_hopscotch_stats_miss) {
+    map_hopscotch_mixed_t map;
+    map_hopscotch_mixed_stats_t stats;
+    bar_t* entry;
+    unsigned long i;
+
+    // Fill the map to its maximum load. Linear probing would have long runs
+    // of full buckets at this load but a hopscotch lookup only visits the
+    // buckets in the hop info of its home bucket.
+    pottery_test_assert(POTTERY_OK == map_hopscotch_mixed_init(&map));
+    pottery_test_assert(POTTERY_OK == map_hopscotch_mixed_reserve(&map, 1000));
+    for (i = 1; map_hopscotch_mixed_count(&map) < map_hopscotch_mixed_capacity(&map); ++i) {
+        pottery_test_assert(POTTERY_OK == map_hopscotch_mixed_emplace_key(&map, i, &entry, pottery_null));
+        entry->key = i;
+        entry->value = i;
+    }
+    for (i = 0; i < map_hopscotch_mixed_bucket_count(&map); ++i)
+        pottery_test_assert((map.hop_info[i] >> 24) == 0);
+
+    // Without overflow, no lookup visits more than the neighborhood.
+    map_hopscotch_mixed_stats(&map, &stats);
+    pottery_test_assert(stats.miss_probe_starts == stats.bucket_count);
+    pottery_test_assert(stats.miss_probe_length_total <= stats.miss_probe_starts * 24);
+    pottery_test_assert(stats.probe_length_max < 24);
+
+    map_hopscotch_mixed_destroy(&map);
+}
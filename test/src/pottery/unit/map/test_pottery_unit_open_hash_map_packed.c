@@ -0,0 +1,194 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2020-2021 11037650 Canada Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "pottery/common/test_pottery_ufo.h"
+#include "pottery/unit/test_pottery_framework.h"
+
+static inline size_t fnv1a(const char* p) {
+    uint32_t hash = 2166136261;
+    for (; *p != 0; ++p)
+        hash = (hash ^ pottery_cast(uint8_t, *p)) * 16777619;
+    return hash;
+}
+
+// workarounds for MSVC C++/CLR not allowing different structs in different
+// translation units with the same name
+#ifdef __CLR_VER
+#define ufo_map_t pottery_open_hash_map_packed_ufo_t
+#endif
+
+// Instantiate a map of const char* to ufo_t
+// Use quadratic probing with no empty or tombstone states and pack our
+// metadata into two bits per bucket.
+#define POTTERY_OPEN_HASH_MAP_PREFIX ufo_map
+#define POTTERY_OPEN_HASH_MAP_VALUE_TYPE ufo_t
+#define POTTERY_OPEN_HASH_MAP_KEY_TYPE const char*
+#define POTTERY_OPEN_HASH_MAP_REF_KEY(x) x->string
+#define POTTERY_OPEN_HASH_MAP_KEY_HASH fnv1a
+#define POTTERY_OPEN_HASH_MAP_KEY_EQUAL 0 == strcmp
+#define POTTERY_OPEN_HASH_MAP_LIFECYCLE_MOVE ufo_move
+#define POTTERY_OPEN_HASH_MAP_LIFECYCLE_DESTROY ufo_destroy
+#define POTTERY_OPEN_HASH_MAP_QUADRATIC_PROBING 1
+#define POTTERY_OPEN_HASH_MAP_PACKED_METADATA 1
+#include "pottery/open_hash_map/pottery_open_hash_map_static.t.h"
+
+// Instantiate ufo_map tests on our ufo map
+#define POTTERY_TEST_MAP_UFO_PREFIX pottery_open_hash_map_ufo_packed
+#define POTTERY_TEST_MAP_UFO_HAS_CAPACITY 1
+#include "pottery/unit/map/test_pottery_unit_map_ufo.t.h"
+
+typedef struct bar_s {
+  unsigned long key;
+  unsigned long value;
+} bar_t;
+
+// Linear probing without tombstones: one bit per bucket for empty
+#define POTTERY_OPEN_HASH_MAP_PREFIX map_packed_linear
+#define POTTERY_OPEN_HASH_MAP_VALUE_TYPE bar_t
+#define POTTERY_OPEN_HASH_MAP_KEY_TYPE unsigned long
+#define POTTERY_OPEN_HASH_MAP_REF_KEY(v) v->key
+#define POTTERY_OPEN_HASH_MAP_KEY_HASH(x) (x)
+#define POTTERY_OPEN_HASH_MAP_KEY_EQUAL(x, y) (x == y)
+#define POTTERY_OPEN_HASH_MAP_LIFECYCLE_MOVE(p,q) memcpy(p, q, sizeof (bar_t))
+#define POTTERY_OPEN_HASH_MAP_LIFECYCLE_DESTROY(p) (void)p
+#define POTTERY_OPEN_HASH_MAP_PACKED_METADATA 1
+#include "pottery/open_hash_map/pottery_open_hash_map_static.t.h"
+
+// Quadratic probing with an in-band empty key: one bit per bucket for
+// tombstones
+#define POTTERY_OPEN_HASH_MAP_PREFIX map_packed_tombstone
+#define POTTERY_OPEN_HASH_MAP_VALUE_TYPE bar_t
+#define POTTERY_OPEN_HASH_MAP_KEY_TYPE unsigned long
+#define POTTERY_OPEN_HASH_MAP_REF_KEY(v) v->key
+#define POTTERY_OPEN_HASH_MAP_KEY_HASH(x) (x)
+#define POTTERY_OPEN_HASH_MAP_KEY_EQUAL(x, y) (x == y)
+#define POTTERY_OPEN_HASH_MAP_LIFECYCLE_MOVE(p,q) memcpy(p, q, sizeof (bar_t))
+#define POTTERY_OPEN_HASH_MAP_LIFECYCLE_DESTROY(p) (void)p
+#define POTTERY_OPEN_HASH_MAP_QUADRATIC_PROBING 1
+#define POTTERY_OPEN_HASH_MAP_EMPTY_IS_ZERO 1
+#define POTTERY_OPEN_HASH_MAP_IS_EMPTY(v) v->key == 0
+#define POTTERY_OPEN_HASH_MAP_SET_EMPTY(v) v->key = 0
+#define POTTERY_OPEN_HASH_MAP_PACKED_METADATA 1
+#include "pottery/open_hash_map/pottery_open_hash_map_static.t.h"
+
+POTTERY_TEST(pottery_open_hash_map_packed_linear_iterate) {
+    map_packed_linear_t map;
+    bar_t* entry;
+    unsigned long i;
+    size_t count;
+    unsigned long sum;
+
+    pottery_test_assert(POTTERY_OK == map_packed_linear_init(&map));
+    for (i = 0; i < 1000; ++i) {
+        bool created;
+        pottery_test_assert(POTTERY_OK == map_packed_linear_emplace_key(&map, i, &entry, &created));
+        pottery_test_assert(created);
+        entry->key = i;
+        entry->value = i;
+    }
+
+    // Remove all but a few keys so that iteration has to skip long runs of
+    // empty buckets.
+    for (i = 0; i < 1000; ++i)
+        if (i % 97 != 5)
+            pottery_test_assert(map_packed_linear_remove_key(&map, i));
+    pottery_test_assert(map_packed_linear_count(&map) == 11);
+
+    count = 0;
+    sum = 0;
+    for (entry = map_packed_linear_begin(&map);
+            map_packed_linear_entry_exists(&map, entry);
+            entry = map_packed_linear_next(&map, entry))
+    {
+        pottery_test_assert(entry->key % 97 == 5);
+        sum += entry->key;
+        ++count;
+    }
+    pottery_test_assert(count == 11);
+    pottery_test_assert(sum == 5 * 11 + 97 * 55);
+
+    // Iterate backwards from the last value.
+    count = 1;
+    entry = map_packed_linear_last(&map);
+    while (entry != map_packed_linear_first(&map)) {
+        entry = map_packed_linear_previous(&map, entry);
+        pottery_test_assert(entry->key % 97 == 5);
+        ++count;
+    }
+    pottery_test_assert(count == 11);
+
+    map_packed_linear_displace_all(&map);
+    pottery_test_assert(map_packed_linear_is_empty(&map));
+    pottery_test_assert(map_packed_linear_begin(&map) == map_packed_linear_end(&map));
+    pottery_test_assert(!map_packed_linear_contains_key(&map, 5));
+
+    map_packed_linear_destroy(&map);
+}
+
+POTTERY_TEST(pottery_open_hash_map_packed_tombstone) {
+    map_packed_tombstone_t map;
+    bar_t* entry;
+    unsigned long i;
+    size_t count;
+
+    pottery_test_assert(POTTERY_OK == map_packed_tombstone_init(&map));
+
+    // Zero is our empty key so we start at one.
+    for (i = 1; i <= 500; ++i) {
+        bool created;
+        pottery_test_assert(POTTERY_OK == map_packed_tombstone_emplace_key(&map, i, &entry, &created));
+        pottery_test_assert(created);
+        entry->key = i;
+        entry->value = i * 2;
+    }
+    for (i = 1; i <= 500; i += 2)
+        pottery_test_assert(map_packed_tombstone_remove_key(&map, i));
+
+    // Re-inserting removed keys may reuse their tombstones.
+    for (i = 1; i <= 100; i += 2) {
+        bool created;
+        pottery_test_assert(POTTERY_OK == map_packed_tombstone_emplace_key(&map, i, &entry, &created));
+        pottery_test_assert(created);
+        entry->key = i;
+        entry->value = i * 2;
+    }
+
+    for (i = 1; i <= 600; ++i) {
+        entry = map_packed_tombstone_find(&map, i);
+        pottery_test_assert(map_packed_tombstone_entry_exists(&map, entry) ==
+                (i <= 500 && (i % 2 == 0 || i <= 100)));
+        if (map_packed_tombstone_entry_exists(&map, entry))
+            pottery_test_assert(entry->value == i * 2);
+    }
+
+    count = 0;
+    for (entry = map_packed_tombstone_begin(&map);
+            map_packed_tombstone_entry_exists(&map, entry);
+            entry = map_packed_tombstone_next(&map, entry))
+        ++count;
+    pottery_test_assert(count == 300);
+    pottery_test_assert(map_packed_tombstone_count(&map) == 300);
+
+    map_packed_tombstone_destroy(&map);
+}
@@ -56,3 +56,146 @@ static inline size_t fnv1a(const char* p) {
 #define POTTERY_TEST_MAP_UFO_PREFIX pottery_open_hash_map_ufo_qp
 #define POTTERY_TEST_MAP_UFO_HAS_CAPACITY 1
 #include "pottery/unit/map/test_pottery_unit_map_ufo.t.h"
+
+typedef struct bar_s {
+  unsigned long key;
+  unsigned long value;
+} bar_t;
+
+// Keys are their own hashes. Automatic shrinking is disabled so that we can
+// test shrinking manually.
+#define POTTERY_OPEN_HASH_MAP_PREFIX map_qp
+#define POTTERY_OPEN_HASH_MAP_VALUE_TYPE bar_t
+#define POTTERY_OPEN_HASH_MAP_KEY_TYPE unsigned long
+#define POTTERY_OPEN_HASH_MAP_REF_KEY(v) v->key
+#define POTTERY_OPEN_HASH_MAP_KEY_HASH(x) (x)
+#define POTTERY_OPEN_HASH_MAP_KEY_EQUAL(x, y) (x == y)
+#define POTTERY_OPEN_HASH_MAP_LIFECYCLE_MOVE_BY_VALUE 1
+#define POTTERY_OPEN_HASH_MAP_LIFECYCLE_DESTROY(p) (void)p
+#define POTTERY_OPEN_HASH_MAP_QUADRATIC_PROBING 1
+#define POTTERY_OPEN_HASH_MAP_MIN_LOAD_FACTOR_NUMERATOR 0
+#include "pottery/open_hash_map/pottery_open_hash_map_static.t.h"
+
+// The same with group probing and stored hashes
+#define POTTERY_OPEN_HASH_MAP_PREFIX map_qp_group
+#define POTTERY_OPEN_HASH_MAP_VALUE_TYPE bar_t
+#define POTTERY_OPEN_HASH_MAP_KEY_TYPE unsigned long
+#define POTTERY_OPEN_HASH_MAP_REF_KEY(v) v->key
+#define POTTERY_OPEN_HASH_MAP_KEY_HASH(x) (x)
+#define POTTERY_OPEN_HASH_MAP_KEY_EQUAL(x, y) (x == y)
+#define POTTERY_OPEN_HASH_MAP_LIFECYCLE_MOVE_BY_VALUE 1
+#define POTTERY_OPEN_HASH_MAP_LIFECYCLE_DESTROY(p) (void)p
+#define POTTERY_OPEN_HASH_MAP_GROUP_PROBING 1
+#define POTTERY_OPEN_HASH_MAP_STORE_HASH 1
+#define POTTERY_OPEN_HASH_MAP_MIN_LOAD_FACTOR_NUMERATOR 0
+#include "pottery/open_hash_map/pottery_open_hash_map_static.t.h"
+
+static void map_qp_add(map_qp_t* map, unsigned long key) {
+    bar_t* entry;
+    pottery_test_assert(POTTERY_OK == map_qp_emplace_key(map, key, &entry, pottery_null));
+    entry->key = key;
+    entry->value = key * 3;
+}
+
+static void map_qp_group_add(map_qp_group_t* map, unsigned long key) {
+    bar_t* entry;
+    pottery_test_assert(POTTERY_OK == map_qp_group_emplace_key(map, key, &entry, pottery_null));
+    entry->key = key;
+    entry->value = key * 3;
+}
+
+POTTERY_TEST(pottery_open_hash_map_qp_shrink) {
+    map_qp_t map;
+    bar_t* entry;
+    unsigned long i;
+
+    pottery_test_assert(POTTERY_OK == map_qp_init(&map));
+    for (i = 0; i < 1000; ++i)
+        map_qp_add(&map, i);
+    for (i = 0; i < 1000; ++i)
+        if (i % 100 != 0)
+            pottery_test_assert(map_qp_remove_key(&map, i));
+    pottery_test_assert(map.log_2_size == 11);
+    pottery_test_assert(map.tombstones == 990);
+
+    // The map shrinks to the smallest size that holds ten values.
+    pottery_test_assert(POTTERY_OK == map_qp_shrink(&map));
+    pottery_test_assert(map.log_2_size == 5);
+    pottery_test_assert(map.tombstones == 0);
+    for (i = 0; i < 1000; ++i) {
+        entry = map_qp_find(&map, i);
+        pottery_test_assert(map_qp_entry_exists(&map, entry) == (i % 100 == 0));
+        if (i % 100 == 0)
+            pottery_test_assert(entry->value == i * 3);
+    }
+
+    // Shrinking again does nothing.
+    pottery_test_assert(POTTERY_OK == map_qp_shrink(&map));
+    pottery_test_assert(map.log_2_size == 5);
+
+    map_qp_destroy(&map);
+}
+
+POTTERY_TEST(pottery_open_hash_map_qp_purge_in_place) {
+    map_qp_t map;
+    bar_t* values;
+    unsigned long i;
+
+    pottery_test_assert(POTTERY_OK == map_qp_init(&map));
+    for (i = 0; i < 3; ++i)
+        map_qp_add(&map, i);
+    values = map.values;
+
+    // Churning keys fills the map with tombstones. It purges them in place
+    // rather than growing or allocating a new table.
+    for (i = 100; i < 1100; ++i) {
+        map_qp_add(&map, i);
+        pottery_test_assert(map_qp_remove_key(&map, i));
+    }
+    pottery_test_assert(map.values == values);
+    pottery_test_assert(map.log_2_size == 4);
+    for (i = 0; i < 3; ++i)
+        pottery_test_assert(map_qp_contains_key(&map, i));
+
+    // Shrinking at the same size purges in place as well.
+    pottery_test_assert(map_qp_remove_key(&map, 2));
+    pottery_test_assert(map.tombstones != 0);
+    pottery_test_assert(POTTERY_OK == map_qp_shrink(&map));
+    pottery_test_assert(map.tombstones == 0);
+    pottery_test_assert(map.values == values);
+    for (i = 0; i < 3; ++i)
+        pottery_test_assert(map_qp_contains_key(&map, i) == (i != 2));
+
+    map_qp_destroy(&map);
+}
+
+POTTERY_TEST(pottery_open_hash_map_qp_purge_in_place_group) {
+    map_qp_group_t map;
+    bar_t* values;
+    bar_t* entry;
+    unsigned long i;
+
+    // Every other key is removed so that groups fill with tombstones.
+    pottery_test_assert(POTTERY_OK == map_qp_group_init(&map));
+    pottery_test_assert(POTTERY_OK == map_qp_group_reserve(&map, 200));
+    values = map.values;
+    for (i = 0; i < 4000; ++i) {
+        map_qp_group_add(&map, i);
+        if (i % 2 == 1 || i >= 200)
+            pottery_test_assert(map_qp_group_remove_key(&map, i));
+    }
+    pottery_test_assert(map.values == values);
+
+    pottery_test_assert(POTTERY_OK == map_qp_group_shrink(&map));
+    pottery_test_assert(map.tombstones == 0);
+    for (i = 0; i < 400; ++i) {
+        entry = map_qp_group_find(&map, i);
+        pottery_test_assert(map_qp_group_entry_exists(&map, entry) == (i % 2 == 0 && i < 200));
+        if (map_qp_group_entry_exists(&map, entry)) {
+            pottery_test_assert(entry->value == i * 3);
+            pottery_test_assert(map.hashes[entry - map.values] == i);
+        }
+    }
+
+    map_qp_group_destroy(&map);
+}
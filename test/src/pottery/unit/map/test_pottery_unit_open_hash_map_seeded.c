@@ -0,0 +1,193 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2020-2021 11037650 Canada Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "pottery/common/test_pottery_ufo.h"
+#include "pottery/unit/test_pottery_framework.h"
+
+// workarounds for MSVC C++/CLR not allowing different structs in different
+// translation units with the same name
+#ifdef __CLR_VER
+#define ufo_map_t pottery_open_hash_map_seeded_ufo_t
+#endif
+
+// Instantiate a seeded map of const char* to ufo_t with the probe watchdog
+#define POTTERY_OPEN_HASH_MAP_PREFIX ufo_map
+#define POTTERY_OPEN_HASH_MAP_VALUE_TYPE ufo_t
+#define POTTERY_OPEN_HASH_MAP_KEY_TYPE const char*
+#define POTTERY_OPEN_HASH_MAP_REF_KEY(x) x->string
+#define POTTERY_OPEN_HASH_MAP_KEY_HASH(x) pottery_cast(size_t, pottery_hash_string(x, 0))
+#define POTTERY_OPEN_HASH_MAP_KEY_EQUAL 0 == strcmp
+#define POTTERY_OPEN_HASH_MAP_LIFECYCLE_MOVE ufo_move
+#define POTTERY_OPEN_HASH_MAP_LIFECYCLE_DESTROY ufo_destroy
+#define POTTERY_OPEN_HASH_MAP_QUADRATIC_PROBING 1
+#define POTTERY_OPEN_HASH_MAP_SEEDED 1
+#define POTTERY_OPEN_HASH_MAP_PROBE_LIMIT 16
+#include "pottery/open_hash_map/pottery_open_hash_map_static.t.h"
+
+// Instantiate ufo_map tests on our ufo map
+#define POTTERY_TEST_MAP_UFO_PREFIX pottery_open_hash_map_ufo_seeded
+#define POTTERY_TEST_MAP_UFO_HAS_CAPACITY 1
+#include "pottery/unit/map/test_pottery_unit_map_ufo.t.h"
+
+typedef struct bar_s {
+  unsigned long key;
+  unsigned long value;
+} bar_t;
+
+// Keys are their own hashes
+#define POTTERY_OPEN_HASH_MAP_PREFIX map_seeded
+#define POTTERY_OPEN_HASH_MAP_VALUE_TYPE bar_t
+#define POTTERY_OPEN_HASH_MAP_KEY_TYPE unsigned long
+#define POTTERY_OPEN_HASH_MAP_REF_KEY(v) v->key
+#define POTTERY_OPEN_HASH_MAP_KEY_HASH(x) (x)
+#define POTTERY_OPEN_HASH_MAP_KEY_EQUAL(x, y) (x == y)
+#define POTTERY_OPEN_HASH_MAP_LIFECYCLE_MOVE_BY_VALUE 1
+#define POTTERY_OPEN_HASH_MAP_LIFECYCLE_DESTROY(p) (void)p
+#define POTTERY_OPEN_HASH_MAP_SEEDED 1
+#include "pottery/open_hash_map/pottery_open_hash_map_static.t.h"
+
+// All keys have the same hash
+#define POTTERY_OPEN_HASH_MAP_PREFIX map_degenerate
+#define POTTERY_OPEN_HASH_MAP_VALUE_TYPE bar_t
+#define POTTERY_OPEN_HASH_MAP_KEY_TYPE unsigned long
+#define POTTERY_OPEN_HASH_MAP_REF_KEY(v) v->key
+#define POTTERY_OPEN_HASH_MAP_KEY_HASH(x) ((void)x, 7)
+#define POTTERY_OPEN_HASH_MAP_KEY_EQUAL(x, y) (x == y)
+#define POTTERY_OPEN_HASH_MAP_LIFECYCLE_MOVE_BY_VALUE 1
+#define POTTERY_OPEN_HASH_MAP_LIFECYCLE_DESTROY(p) (void)p
+#define POTTERY_OPEN_HASH_MAP_SEEDED 1
+#define POTTERY_OPEN_HASH_MAP_PROBE_LIMIT 8
+#include "pottery/open_hash_map/pottery_open_hash_map_static.t.h"
+
+// The same with group probing
+#define POTTERY_OPEN_HASH_MAP_PREFIX map_degenerate_group
+#define POTTERY_OPEN_HASH_MAP_VALUE_TYPE bar_t
+#define POTTERY_OPEN_HASH_MAP_KEY_TYPE unsigned long
+#define POTTERY_OPEN_HASH_MAP_REF_KEY(v) v->key
+#define POTTERY_OPEN_HASH_MAP_KEY_HASH(x) ((void)x, 7)
+#define POTTERY_OPEN_HASH_MAP_KEY_EQUAL(x, y) (x == y)
+#define POTTERY_OPEN_HASH_MAP_LIFECYCLE_MOVE_BY_VALUE 1
+#define POTTERY_OPEN_HASH_MAP_LIFECYCLE_DESTROY(p) (void)p
+#define POTTERY_OPEN_HASH_MAP_GROUP_PROBING 1
+#define POTTERY_OPEN_HASH_MAP_SEEDED 1
+#define POTTERY_OPEN_HASH_MAP_PROBE_LIMIT 2
+#include "pottery/open_hash_map/pottery_open_hash_map_static.t.h"
+
+POTTERY_TEST(pottery_open_hash_map_seeded_seeds) {
+    map_seeded_t first;
+    map_seeded_t second;
+    bar_t* entry;
+    unsigned long i;
+    uint64_t seed;
+
+    // Maps get different seeds.
+    pottery_test_assert(POTTERY_OK == map_seeded_init(&first));
+    pottery_test_assert(POTTERY_OK == map_seeded_init(&second));
+    pottery_test_assert(first.seed != second.seed);
+    seed = first.seed;
+
+    // The seed is kept when the map grows.
+    for (i = 0; i < 1000; ++i) {
+        pottery_test_assert(POTTERY_OK == map_seeded_emplace_key(&first, i, &entry, pottery_null));
+        entry->key = i;
+        entry->value = i * 3;
+    }
+    pottery_test_assert(first.seed == seed);
+    for (i = 0; i < 1000; ++i) {
+        entry = map_seeded_find(&first, i);
+        pottery_test_assert(map_seeded_entry_exists(&first, entry));
+        pottery_test_assert(entry->value == i * 3);
+    }
+    pottery_test_assert(!map_seeded_contains_key(&first, 1000));
+
+    map_seeded_destroy(&first);
+    map_seeded_destroy(&second);
+}
+
+POTTERY_TEST(pottery_open_hash_map_seeded_watchdog) {
+    map_degenerate_t map;
+    bar_t* entry;
+    unsigned long i;
+    uint64_t seed;
+
+    pottery_test_assert(POTTERY_OK == map_degenerate_init(&map));
+    seed = map.seed;
+
+    // Every key collides so the map reseeds once the probes get long. It
+    // doesn't help but the map keeps working, and it doesn't reseed again
+    // until it changes size.
+    for (i = 0; i < 9; ++i) {
+        pottery_test_assert(POTTERY_OK == map_degenerate_emplace_key(&map, i, &entry, pottery_null));
+        entry->key = i;
+        entry->value = i;
+    }
+    pottery_test_assert(map.long_probe);
+    pottery_test_assert(map.seed == seed);
+    pottery_test_assert(POTTERY_OK == map_degenerate_emplace_key(&map, 9, &entry, pottery_null));
+    entry->key = 9;
+    entry->value = 9;
+    pottery_test_assert(map.reseeded);
+    pottery_test_assert(map.seed != seed);
+    seed = map.seed;
+    pottery_test_assert(map.long_probe);
+    pottery_test_assert(POTTERY_OK == map_degenerate_emplace_key(&map, 0, &entry, pottery_null));
+    pottery_test_assert(map.seed == seed);
+
+    for (i = 10; i < 200; ++i) {
+        pottery_test_assert(POTTERY_OK == map_degenerate_emplace_key(&map, i, &entry, pottery_null));
+        entry->key = i;
+        entry->value = i;
+    }
+    for (i = 0; i < 200; ++i)
+        pottery_test_assert(map_degenerate_contains_key(&map, i));
+    pottery_test_assert(map_degenerate_count(&map) == 200);
+
+    map_degenerate_destroy(&map);
+}
+
+POTTERY_TEST(pottery_open_hash_map_seeded_watchdog_group) {
+    map_degenerate_group_t map;
+    bar_t* entry;
+    unsigned long i;
+    uint64_t seed;
+
+    pottery_test_assert(POTTERY_OK == map_degenerate_group_init(&map));
+    seed = map.seed;
+
+    // The first two groups fill up, then the watchdog fires.
+    for (i = 0; i < 200; ++i) {
+        pottery_test_assert(POTTERY_OK == map_degenerate_group_emplace_key(&map, i, &entry, pottery_null));
+        entry->key = i;
+        entry->value = i;
+    }
+    pottery_test_assert(map.seed != seed);
+    for (i = 0; i < 200; ++i)
+        pottery_test_assert(map_degenerate_group_contains_key(&map, i));
+    for (i = 0; i < 200; i += 2)
+        pottery_test_assert(map_degenerate_group_remove_key(&map, i));
+    for (i = 0; i < 200; ++i)
+        pottery_test_assert(map_degenerate_group_contains_key(&map, i) == (i % 2 == 1));
+
+    map_degenerate_group_destroy(&map);
+}
@@ -0,0 +1,202 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2020-2021 11037650 Canada Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "pottery/common/test_pottery_ufo.h"
+#include "pottery/unit/test_pottery_framework.h"
+
+static inline size_t fnv1a(const char* p) {
+    uint32_t hash = 2166136261;
+    for (; *p != 0; ++p)
+        hash = (hash ^ pottery_cast(uint8_t, *p)) * 16777619;
+    return hash;
+}
+
+// workarounds for MSVC C++/CLR not allowing different structs in different
+// translation units with the same name
+#ifdef __CLR_VER
+#define ufo_map_t pottery_perfect_hash_map_ufo_t
+#endif
+
+// Instantiate a perfect hash map of const char* to ufo_t
+#define POTTERY_PERFECT_HASH_MAP_PREFIX ufo_map
+#define POTTERY_PERFECT_HASH_MAP_VALUE_TYPE ufo_t
+#define POTTERY_PERFECT_HASH_MAP_KEY_TYPE const char*
+#define POTTERY_PERFECT_HASH_MAP_REF_KEY(x) x->string
+#define POTTERY_PERFECT_HASH_MAP_KEY_HASH fnv1a
+#define POTTERY_PERFECT_HASH_MAP_KEY_EQUAL 0 == strcmp
+#define POTTERY_PERFECT_HASH_MAP_LIFECYCLE_MOVE ufo_move
+#define POTTERY_PERFECT_HASH_MAP_LIFECYCLE_DESTROY ufo_destroy
+#include "pottery/perfect_hash_map/pottery_perfect_hash_map_static.t.h"
+
+POTTERY_TEST(pottery_perfect_hash_map_ufo) {
+    static const char* const strings[] = {
+        "alice", "bob", "carol", "dave", "eve", "frank", "grace", "heidi",
+        "ivan", "judy", "mallory", "niaj", "olivia", "peggy", "rupert",
+        "sybil", "trent", "victor", "walter",
+    };
+    size_t count = sizeof(strings) / sizeof(*strings);
+    ufo_t values[sizeof(strings) / sizeof(*strings)];
+    ufo_map_t map;
+    ufo_t* entry;
+    size_t i;
+
+    for (i = 0; i < count; ++i)
+        pottery_test_assert(POTTERY_OK == ufo_init(values + i, strings[i], pottery_cast(int32_t, i)));
+
+    ufo_map_init(&map);
+    pottery_test_assert(ufo_map_is_empty(&map));
+    pottery_test_assert(!ufo_map_contains_key(&map, "alice"));
+    pottery_test_assert(POTTERY_OK == ufo_map_build(&map, values, count));
+    pottery_test_assert(ufo_map_count(&map) == count);
+
+    for (i = 0; i < count; ++i) {
+        entry = ufo_map_find(&map, strings[i]);
+        pottery_test_assert(ufo_map_entry_exists(&map, entry));
+        ufo_check(entry);
+        pottery_test_assert(entry->integer == pottery_cast(int32_t, i));
+    }
+    pottery_test_assert(!ufo_map_contains_key(&map, "zed"));
+    pottery_test_assert(!ufo_map_contains_key(&map, ""));
+
+    // The values are dense so iteration visits every slot.
+    i = 0;
+    for (entry = ufo_map_begin(&map); ufo_map_entry_exists(&map, entry);
+            entry = ufo_map_next(&map, entry))
+        ++i;
+    pottery_test_assert(i == count);
+
+    ufo_map_destroy(&map);
+}
+
+
+
+typedef struct int_pair_t {
+    uint32_t key;
+    uint32_t value;
+} int_pair_t;
+
+static inline size_t int_hash(uint32_t x) {
+    return pottery_cast(size_t, x);
+}
+
+#define POTTERY_PERFECT_HASH_MAP_PREFIX int_map
+#define POTTERY_PERFECT_HASH_MAP_VALUE_TYPE int_pair_t
+#define POTTERY_PERFECT_HASH_MAP_KEY_TYPE uint32_t
+#define POTTERY_PERFECT_HASH_MAP_REF_KEY(x) x->key
+#define POTTERY_PERFECT_HASH_MAP_KEY_HASH int_hash
+#define POTTERY_PERFECT_HASH_MAP_KEY_EQUAL(x, y) x == y
+#define POTTERY_PERFECT_HASH_MAP_LIFECYCLE_MOVE_BY_VALUE 1
+#include "pottery/perfect_hash_map/pottery_perfect_hash_map_static.t.h"
+
+#define INT_MAP_COUNT 20000
+
+static void int_map_fill(int_pair_t* values, uint32_t count) {
+    uint32_t i;
+    for (i = 0; i < count; ++i) {
+        values[i].key = i * 7 + 3;
+        values[i].value = i;
+    }
+}
+
+static void int_map_check(int_map_t* map, uint32_t count) {
+    uint32_t i;
+    pottery_test_assert(int_map_count(map) == count);
+    for (i = 0; i < count; ++i) {
+        int_pair_t* entry = int_map_find(map, i * 7 + 3);
+        pottery_test_assert(int_map_entry_exists(map, entry));
+        pottery_test_assert(entry->value == i);
+        pottery_test_assert(!int_map_contains_key(map, i * 7 + 4));
+    }
+}
+
+POTTERY_TEST(pottery_perfect_hash_map_build) {
+    int_pair_t* values = pottery_cast(int_pair_t*, pottery_test_malloc(sizeof(int_pair_t) * INT_MAP_COUNT));
+    int_map_t map;
+    uint32_t count;
+
+    // Build a few sizes, rebuilding the same map each time.
+    int_map_init(&map);
+    for (count = 0; count <= INT_MAP_COUNT; count = count * 3 + 1) {
+        int_map_fill(values, count);
+        pottery_test_assert(POTTERY_OK == int_map_build(&map, values, count));
+        int_map_check(&map, count);
+    }
+    int_map_destroy(&map);
+
+    pottery_test_free(values);
+}
+
+POTTERY_TEST(pottery_perfect_hash_map_duplicates) {
+    int_pair_t values[4];
+    int_map_t map;
+
+    int_map_init(&map);
+    int_map_fill(values, 2);
+    pottery_test_assert(POTTERY_OK == int_map_build(&map, values, 2));
+
+    // A duplicate key can't be placed. The map keeps its contents.
+    int_map_fill(values, 4);
+    values[3].key = values[1].key;
+    pottery_test_assert(POTTERY_ERROR_FULL == int_map_build(&map, values, 4));
+    int_map_check(&map, 2);
+
+    int_map_destroy(&map);
+}
+
+POTTERY_TEST(pottery_perfect_hash_map_serialize) {
+    int_pair_t* values = pottery_cast(int_pair_t*, pottery_test_malloc(sizeof(int_pair_t) * INT_MAP_COUNT));
+    int_map_t map;
+    int_map_t view;
+    uint64_t* buffer;
+    size_t size;
+
+    int_map_init(&map);
+    int_map_fill(values, INT_MAP_COUNT);
+    pottery_test_assert(POTTERY_OK == int_map_build(&map, values, INT_MAP_COUNT));
+    pottery_test_free(values);
+
+    size = int_map_serialized_size(&map);
+    buffer = pottery_cast(uint64_t*, pottery_test_malloc(size));
+    int_map_serialize(&map, buffer);
+    int_map_destroy(&map);
+
+    pottery_test_assert(POTTERY_OK == int_map_init_serialized(&view, buffer, size));
+    int_map_check(&view, INT_MAP_COUNT);
+    int_map_destroy(&view);
+
+    // Truncated or corrupted buffers are rejected.
+    pottery_test_assert(POTTERY_ERROR_INVALID == int_map_init_serialized(&view, buffer, size - 1));
+    pottery_test_assert(POTTERY_ERROR_INVALID == int_map_init_serialized(&view, buffer, 16));
+    *pottery_reinterpret_cast(char*, buffer) ^= 1;
+    pottery_test_assert(POTTERY_ERROR_INVALID == int_map_init_serialized(&view, buffer, size));
+    *pottery_reinterpret_cast(char*, buffer) ^= 1;
+
+    // A huge bucket count is rejected. (On 32-bit platforms the size of its
+    // pilots overflows.)
+    buffer[1] = UINT64_C(0x7fffffff);
+    buffer[2] = UINT64_C(0x7fffffff);
+    pottery_test_assert(POTTERY_ERROR_INVALID == int_map_init_serialized(&view, buffer, size));
+
+    pottery_test_free(buffer);
+}
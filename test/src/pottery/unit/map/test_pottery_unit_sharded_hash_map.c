@@ -0,0 +1,364 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2020-2021 11037650 Canada Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "pottery/unit/test_pottery_framework.h"
+
+typedef struct pair_t {
+    size_t key;
+    size_t value;
+} pair_t;
+
+static inline size_t identity_hash(size_t x) {
+    return x;
+}
+
+// A map of 16 shards of Robin Hood hash maps with the default spinlocks and
+// optimistic readers
+#define POTTERY_SHARDED_HASH_MAP_PREFIX pair_map
+#define POTTERY_SHARDED_HASH_MAP_VALUE_TYPE pair_t
+#define POTTERY_SHARDED_HASH_MAP_KEY_TYPE size_t
+#define POTTERY_SHARDED_HASH_MAP_REF_KEY(x) x->key
+#define POTTERY_SHARDED_HASH_MAP_KEY_HASH identity_hash
+#define POTTERY_SHARDED_HASH_MAP_KEY_EQUAL(x, y) x == y
+#define POTTERY_SHARDED_HASH_MAP_LIFECYCLE_BY_VALUE 1
+#define POTTERY_SHARDED_HASH_MAP_ROBIN_HOOD_HASHING 1
+#include "pottery/sharded_hash_map/pottery_sharded_hash_map_static.t.h"
+
+// A map with a single shard, a custom lock and no optimistic readers. The
+// lock counts how many times it's held so we can check that it's balanced.
+static int test_lock_count;
+static int test_lock_depth;
+
+static void test_lock(int* lock) {
+    pottery_test_assert(*lock == 0);
+    *lock = 1;
+    ++test_lock_count;
+    ++test_lock_depth;
+}
+
+static void test_unlock(int* lock) {
+    pottery_test_assert(*lock == 1);
+    *lock = 0;
+    --test_lock_depth;
+}
+
+#define POTTERY_SHARDED_HASH_MAP_PREFIX locked_map
+#define POTTERY_SHARDED_HASH_MAP_VALUE_TYPE pair_t
+#define POTTERY_SHARDED_HASH_MAP_KEY_TYPE size_t
+#define POTTERY_SHARDED_HASH_MAP_REF_KEY(x) x->key
+#define POTTERY_SHARDED_HASH_MAP_KEY_HASH identity_hash
+#define POTTERY_SHARDED_HASH_MAP_KEY_EQUAL(x, y) x == y
+#define POTTERY_SHARDED_HASH_MAP_LIFECYCLE_BY_VALUE 1
+#define POTTERY_SHARDED_HASH_MAP_GROUP_PROBING 1
+#define POTTERY_SHARDED_HASH_MAP_LOG_2_SHARDS 0
+#define POTTERY_SHARDED_HASH_MAP_OPTIMISTIC_READS 0
+#define POTTERY_SHARDED_HASH_MAP_LOCK_TYPE int
+#define POTTERY_SHARDED_HASH_MAP_LOCK_INIT(x) *(x) = 0
+#define POTTERY_SHARDED_HASH_MAP_LOCK test_lock
+#define POTTERY_SHARDED_HASH_MAP_UNLOCK test_unlock
+#include "pottery/sharded_hash_map/pottery_sharded_hash_map_static.t.h"
+
+// A map of 4 shards whose allocations can be made to fail. The locks count
+// how many are set up and torn down.
+static size_t test_alloc_remaining;
+static size_t test_alloc_outstanding;
+static int test_lock_inits;
+
+static void* test_alloc_malloc(size_t size) {
+    void* p;
+    if (test_alloc_remaining == 0)
+        return pottery_null;
+    --test_alloc_remaining;
+    p = malloc(size);
+    if (p != pottery_null)
+        ++test_alloc_outstanding;
+    return p;
+}
+
+static void test_alloc_free(void* p) {
+    if (p != pottery_null)
+        --test_alloc_outstanding;
+    free(p);
+}
+
+#define POTTERY_SHARDED_HASH_MAP_PREFIX failing_map
+#define POTTERY_SHARDED_HASH_MAP_VALUE_TYPE pair_t
+#define POTTERY_SHARDED_HASH_MAP_KEY_TYPE size_t
+#define POTTERY_SHARDED_HASH_MAP_REF_KEY(x) x->key
+#define POTTERY_SHARDED_HASH_MAP_KEY_HASH identity_hash
+#define POTTERY_SHARDED_HASH_MAP_KEY_EQUAL(x, y) x == y
+#define POTTERY_SHARDED_HASH_MAP_LIFECYCLE_BY_VALUE 1
+#define POTTERY_SHARDED_HASH_MAP_LOG_2_SHARDS 2
+#define POTTERY_SHARDED_HASH_MAP_LOCK_TYPE int
+#define POTTERY_SHARDED_HASH_MAP_LOCK_INIT(x) (*(x) = 0, ++test_lock_inits)
+#define POTTERY_SHARDED_HASH_MAP_LOCK_DESTROY(x) (pottery_test_assert(*(x) == 0), --test_lock_inits)
+#define POTTERY_SHARDED_HASH_MAP_LOCK test_lock
+#define POTTERY_SHARDED_HASH_MAP_UNLOCK test_unlock
+#define POTTERY_SHARDED_HASH_MAP_ALLOC_MALLOC test_alloc_malloc
+#define POTTERY_SHARDED_HASH_MAP_ALLOC_FREE test_alloc_free
+#include "pottery/sharded_hash_map/pottery_sharded_hash_map_static.t.h"
+
+#define SHARDED_HASH_MAP_TEST_COUNT 5000
+
+static void pair_map_insert(pair_map_t* map, size_t key, size_t value) {
+    pair_map_shard_t* shard = pair_map_lock_key(map, key);
+    pair_map_shard_entry_t entry;
+    bool created;
+    pottery_test_assert(POTTERY_OK == pair_map_shard_emplace_key(shard, key, &entry, &created));
+    if (created)
+        entry->key = key;
+    entry->value = value;
+    pair_map_unlock(map, shard);
+}
+
+static bool pair_map_remove_key(pair_map_t* map, size_t key) {
+    pair_map_shard_t* shard = pair_map_lock_key(map, key);
+    bool removed = pair_map_shard_remove_key(shard, key);
+    pair_map_unlock(map, shard);
+    return removed;
+}
+
+POTTERY_TEST(pottery_sharded_hash_map_basic) {
+    pair_map_t map;
+    pair_t pair;
+    size_t i;
+
+    pottery_test_assert(POTTERY_OK == pair_map_init(&map));
+    pottery_test_assert(pair_map_count(&map) == 0);
+    pottery_test_assert(pair_map_count_shards(&map) == 16);
+    pottery_test_assert(!pair_map_contains_key(&map, 1));
+
+    for (i = 0; i < SHARDED_HASH_MAP_TEST_COUNT; ++i)
+        pair_map_insert(&map, i, i * 3);
+    pottery_test_assert(pair_map_count(&map) == SHARDED_HASH_MAP_TEST_COUNT);
+
+    // overwrite some values
+    for (i = 0; i < SHARDED_HASH_MAP_TEST_COUNT; i += 2)
+        pair_map_insert(&map, i, i * 5);
+    pottery_test_assert(pair_map_count(&map) == SHARDED_HASH_MAP_TEST_COUNT);
+
+    for (i = 0; i < SHARDED_HASH_MAP_TEST_COUNT; ++i) {
+        pottery_test_assert(pair_map_find_copy(&map, i, &pair));
+        pottery_test_assert(pair.key == i);
+        pottery_test_assert(pair.value == i * ((i % 2 == 0) ? 5 : 3));
+    }
+    pottery_test_assert(!pair_map_find_copy(&map, SHARDED_HASH_MAP_TEST_COUNT, &pair));
+
+    // remove the odd keys
+    for (i = 1; i < SHARDED_HASH_MAP_TEST_COUNT; i += 2)
+        pottery_test_assert(pair_map_remove_key(&map, i));
+    pottery_test_assert(!pair_map_remove_key(&map, 1));
+    pottery_test_assert(pair_map_count(&map) == SHARDED_HASH_MAP_TEST_COUNT / 2);
+    for (i = 0; i < SHARDED_HASH_MAP_TEST_COUNT; ++i)
+        pottery_test_assert(pair_map_contains_key(&map, i) == (i % 2 == 0));
+
+    // the arrays replaced as the shards grew and shrank can be reclaimed
+    // while nothing is reading
+    pair_map_reclaim(&map);
+    for (i = 0; i < SHARDED_HASH_MAP_TEST_COUNT; ++i)
+        pottery_test_assert(pair_map_contains_key(&map, i) == (i % 2 == 0));
+
+    pair_map_destroy(&map);
+}
+
+POTTERY_TEST(pottery_sharded_hash_map_shards) {
+    pair_map_t map;
+    size_t i;
+    size_t total = 0;
+
+    pottery_test_assert(POTTERY_OK == pair_map_init(&map));
+    for (i = 0; i < SHARDED_HASH_MAP_TEST_COUNT; ++i)
+        pair_map_insert(&map, i, i);
+
+    // Keys with an identity hash should still be spread across all shards,
+    // and iterating over the shards should visit every value.
+    for (i = 0; i < pair_map_count_shards(&map); ++i) {
+        pair_map_shard_t* shard = pair_map_lock_index(&map, i);
+        pair_map_shard_entry_t entry = pair_map_shard_first(shard);
+        size_t count = pair_map_shard_count(shard);
+        pottery_test_assert(count > SHARDED_HASH_MAP_TEST_COUNT / 32);
+        total += count;
+        while (pair_map_shard_entry_exists(shard, entry)) {
+            pottery_test_assert(entry->key < SHARDED_HASH_MAP_TEST_COUNT);
+            pottery_test_assert(entry->value == entry->key);
+            entry = pair_map_shard_next(shard, entry);
+        }
+        pair_map_unlock(&map, shard);
+    }
+    pottery_test_assert(total == SHARDED_HASH_MAP_TEST_COUNT);
+
+    // Clear the map one shard at a time
+    for (i = 0; i < pair_map_count_shards(&map); ++i) {
+        pair_map_shard_t* shard = pair_map_lock_index(&map, i);
+        pair_map_shard_remove_all(shard);
+        pair_map_unlock(&map, shard);
+    }
+    pottery_test_assert(pair_map_count(&map) == 0);
+
+    pair_map_destroy(&map);
+}
+
+POTTERY_TEST(pottery_sharded_hash_map_custom_lock) {
+    locked_map_t map;
+    locked_map_shard_t* shard;
+    locked_map_shard_entry_t entry;
+    pair_t pair;
+    bool created;
+    size_t i;
+
+    test_lock_count = 0;
+    test_lock_depth = 0;
+    pottery_test_assert(POTTERY_OK == locked_map_init(&map));
+    pottery_test_assert(locked_map_count_shards(&map) == 1);
+
+    for (i = 0; i < SHARDED_HASH_MAP_TEST_COUNT; ++i) {
+        shard = locked_map_lock_key(&map, i);
+        pottery_test_assert(test_lock_depth == 1);
+        pottery_test_assert(POTTERY_OK == locked_map_shard_emplace_key(shard, i, &entry, &created));
+        pottery_test_assert(created);
+        entry->key = i;
+        entry->value = i + 1;
+        locked_map_unlock(&map, shard);
+    }
+    pottery_test_assert(test_lock_depth == 0);
+    pottery_test_assert(test_lock_count == SHARDED_HASH_MAP_TEST_COUNT);
+
+    // readers take the lock
+    pottery_test_assert(locked_map_find_copy(&map, 7, &pair));
+    pottery_test_assert(pair.value == 8);
+    pottery_test_assert(!locked_map_contains_key(&map, SHARDED_HASH_MAP_TEST_COUNT));
+    pottery_test_assert(locked_map_count(&map) == SHARDED_HASH_MAP_TEST_COUNT);
+    pottery_test_assert(test_lock_count == SHARDED_HASH_MAP_TEST_COUNT + 3);
+    pottery_test_assert(test_lock_depth == 0);
+
+    locked_map_reclaim(&map);
+    locked_map_destroy(&map);
+}
+
+POTTERY_TEST(pottery_sharded_hash_map_init_failure) {
+    failing_map_t map;
+    size_t per_shard;
+    size_t shard;
+    size_t extra;
+
+    // Find out how many allocations initializing a shard takes.
+    test_alloc_remaining = SIZE_MAX;
+    test_alloc_outstanding = 0;
+    test_lock_inits = 0;
+    pottery_test_assert(POTTERY_OK == failing_map_init(&map));
+    pottery_test_assert(failing_map_count_shards(&map) == 4);
+    pottery_test_assert(test_lock_inits == 4);
+    per_shard = test_alloc_outstanding / 4;
+    pottery_test_assert(per_shard > 0);
+    failing_map_destroy(&map);
+    pottery_test_assert(test_alloc_outstanding == 0);
+    pottery_test_assert(test_lock_inits == 0);
+
+    // Fail each allocation of every shard after the first. Everything set up
+    // for the earlier shards must be torn down.
+    for (shard = 1; shard < 4; ++shard) {
+        for (extra = 0; extra < per_shard; ++extra) {
+            test_alloc_remaining = shard * per_shard + extra;
+            pottery_test_assert(POTTERY_ERROR_ALLOC == failing_map_init(&map));
+            pottery_test_assert(test_alloc_outstanding == 0);
+            pottery_test_assert(test_lock_inits == 0);
+        }
+    }
+}
+
+#if POTTERY_TEST_PTHREADS
+// Writers repeatedly fill and empty their own ranges of keys so that the
+// shards grow and shrink, replacing their arrays while readers are probing
+// them without locks. Every value a reader finds must match its key.
+#define SHARDED_HASH_MAP_THREADED_WRITERS 2
+#define SHARDED_HASH_MAP_THREADED_READERS 2
+#define SHARDED_HASH_MAP_THREADED_KEYS 2000
+#define SHARDED_HASH_MAP_THREADED_ROUNDS 50
+
+static pair_map_t threaded_map;
+static size_t threaded_done;
+
+static size_t threaded_value(size_t key) {
+    return key * 3 + 1;
+}
+
+static void* threaded_writer(void* arg) {
+    size_t writer = *pottery_cast(size_t*, arg);
+    size_t round, i;
+    for (round = 0; round < SHARDED_HASH_MAP_THREADED_ROUNDS; ++round) {
+        for (i = writer; i < SHARDED_HASH_MAP_THREADED_KEYS; i += SHARDED_HASH_MAP_THREADED_WRITERS)
+            pair_map_insert(&threaded_map, i, threaded_value(i));
+        for (i = writer; i < SHARDED_HASH_MAP_THREADED_KEYS; i += SHARDED_HASH_MAP_THREADED_WRITERS)
+            pottery_test_assert(pair_map_remove_key(&threaded_map, i));
+    }
+    return pottery_null;
+}
+
+static void* threaded_reader(void* arg) {
+    size_t key = 0;
+    pair_t pair;
+    (void)arg;
+
+    // Keep reading until the writers are done. (Some keys are never
+    // inserted so we probe for misses as well.)
+    while (pottery_atomic_load_acquire_s(&threaded_done) == 0) {
+        key = (key + 7919) % (SHARDED_HASH_MAP_THREADED_KEYS + 100);
+        if (pair_map_find_copy(&threaded_map, key, &pair)) {
+            pottery_test_assert(key < SHARDED_HASH_MAP_THREADED_KEYS);
+            pottery_test_assert(pair.key == key);
+            pottery_test_assert(pair.value == threaded_value(key));
+        }
+    }
+    return pottery_null;
+}
+
+POTTERY_TEST(pottery_sharded_hash_map_threaded) {
+    pthread_t writers[SHARDED_HASH_MAP_THREADED_WRITERS];
+    pthread_t readers[SHARDED_HASH_MAP_THREADED_READERS];
+    size_t indexes[SHARDED_HASH_MAP_THREADED_WRITERS];
+    size_t i;
+
+    pottery_test_assert(POTTERY_OK == pair_map_init(&threaded_map));
+    threaded_done = 0;
+
+    for (i = 0; i < SHARDED_HASH_MAP_THREADED_READERS; ++i)
+        pottery_test_assert(0 == pthread_create(&readers[i], pottery_null, threaded_reader, pottery_null));
+    for (i = 0; i < SHARDED_HASH_MAP_THREADED_WRITERS; ++i) {
+        indexes[i] = i;
+        pottery_test_assert(0 == pthread_create(&writers[i], pottery_null, threaded_writer, &indexes[i]));
+    }
+
+    for (i = 0; i < SHARDED_HASH_MAP_THREADED_WRITERS; ++i)
+        pottery_test_assert(0 == pthread_join(writers[i], pottery_null));
+    pottery_atomic_store_release_s(&threaded_done, 1);
+    for (i = 0; i < SHARDED_HASH_MAP_THREADED_READERS; ++i)
+        pottery_test_assert(0 == pthread_join(readers[i], pottery_null));
+
+    // The writers removed everything they inserted.
+    pottery_test_assert(pair_map_count(&threaded_map) == 0);
+
+    pair_map_reclaim(&threaded_map);
+    pair_map_destroy(&threaded_map);
+}
+#endif
@@ -0,0 +1,192 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2020-2021 11037650 Canada Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <stddef.h>
+#include <stdbool.h>
+
+// workarounds for MSVC C++/CLR not allowing different structs in different
+// translation units with the same name
+#ifdef __CLR_VER
+#define foo_t cht_foo_t
+#define foo_table_t cht_foo_table_t
+#define bar_t cht_bar_t
+#define bar_table_t cht_bar_table_t
+#endif
+
+typedef struct foo_t {
+    struct foo_t* next;
+    size_t value;
+} foo_t;
+
+#define POTTERY_CHAINED_HASH_TABLE_PREFIX foo_table
+#define POTTERY_CHAINED_HASH_TABLE_KEY_TYPE size_t
+#define POTTERY_CHAINED_HASH_TABLE_VALUE_TYPE foo_t
+#define POTTERY_CHAINED_HASH_TABLE_REF_KEY(foo) foo->value
+#define POTTERY_CHAINED_HASH_TABLE_KEY_HASH(x) x
+#define POTTERY_CHAINED_HASH_TABLE_KEY_EQUAL(x, y) x == y
+#include "pottery/chained_hash_table/pottery_chained_hash_table_static.t.h"
+
+// A table of values in a static pool, linked by index with a stored hash
+typedef struct bar_t {
+    uint16_t link;
+    size_t hash;
+    int value;
+} bar_t;
+
+static bar_t bar_pool[100];
+
+#define POTTERY_CHAINED_HASH_TABLE_PREFIX bar_table
+#define POTTERY_CHAINED_HASH_TABLE_KEY_TYPE int
+#define POTTERY_CHAINED_HASH_TABLE_REF_TYPE uint16_t
+#define POTTERY_CHAINED_HASH_TABLE_REF_KEY(i) bar_pool[i].value
+#define POTTERY_CHAINED_HASH_TABLE_NULL UINT16_MAX
+#define POTTERY_CHAINED_HASH_TABLE_NEXT(i) bar_pool[i].link
+#define POTTERY_CHAINED_HASH_TABLE_STORED_HASH(i) bar_pool[i].hash
+#define POTTERY_CHAINED_HASH_TABLE_SET_STORED_HASH(i, h) bar_pool[i].hash = h
+#define POTTERY_CHAINED_HASH_TABLE_KEY_HASH(x) pottery_cast(size_t, x) % 7 // lots of collisions
+#define POTTERY_CHAINED_HASH_TABLE_KEY_EQUAL(x, y) x == y
+#include "pottery/chained_hash_table/pottery_chained_hash_table_static.t.h"
+
+#include "pottery/unit/test_pottery_framework.h"
+
+POTTERY_TEST(pottery_chained_hash_table_basic) {
+    foo_t* buckets[4];
+    foo_table_t table;
+    foo_table_init(&table, buckets, 2);
+    pottery_test_assert(foo_table_bucket_count(&table) == 4);
+
+    foo_t foo;
+    foo.value = 5;
+    foo_table_link(&table, &foo);
+    pottery_test_assert(foo_table_count(&table) == 1);
+    pottery_test_assert(foo_table_find(&table, 5) == &foo);
+    pottery_test_assert(!foo_table_entry_exists(&table, foo_table_find(&table, 6)));
+
+    foo_table_unlink_all(&table);
+    pottery_test_assert(foo_table_is_empty(&table));
+    foo_table_destroy(&table);
+}
+
+POTTERY_TEST(pottery_chained_hash_table_no_buckets) {
+    foo_table_t table;
+    foo_table_init(&table, pottery_null, 0);
+    pottery_test_assert(foo_table_bucket_count(&table) == 0);
+    pottery_test_assert(!foo_table_contains_key(&table, 1));
+    pottery_test_assert(!foo_table_entry_exists(&table, foo_table_first(&table)));
+
+    foo_t* buckets[1];
+    foo_table_rehash(&table, buckets, 0);
+    pottery_test_assert(foo_table_bucket_count(&table) == 1);
+
+    foo_t foos[3];
+    size_t i;
+    for (i = 0; i < 3; ++i) {
+        foos[i].value = i;
+        foo_table_link(&table, foos + i);
+    }
+    for (i = 0; i < 3; ++i)
+        pottery_test_assert(foo_table_find(&table, i) == foos + i);
+
+    foo_table_unlink_all(&table);
+    foo_table_destroy(&table);
+}
+
+POTTERY_TEST(pottery_chained_hash_table_rehash) {
+    foo_t* small_buckets[2];
+    foo_t* large_buckets[64];
+    foo_table_t table;
+    foo_table_init(&table, small_buckets, 1);
+
+    foo_t foos[50];
+    size_t count = pottery_array_count(foos);
+    size_t i;
+    for (i = 0; i < count; ++i) {
+        foos[i].value = i * 3;
+        foo_table_link(&table, foos + i);
+    }
+
+    // Values stay where they are when the table is rehashed
+    foo_table_rehash(&table, large_buckets, 6);
+    pottery_test_assert(foo_table_count(&table) == count);
+    for (i = 0; i < count; ++i)
+        pottery_test_assert(foo_table_find(&table, i * 3) == foos + i);
+    pottery_test_assert(!foo_table_contains_key(&table, 1));
+
+    // Iteration visits every value once
+    bool seen[50] = {false};
+    foo_t* foo;
+    size_t visited = 0;
+    for (foo = foo_table_begin(&table); foo_table_entry_exists(&table, foo);
+            foo = foo_table_next(&table, foo))
+    {
+        pottery_test_assert(!seen[foo - foos]);
+        seen[foo - foos] = true;
+        ++visited;
+    }
+    pottery_test_assert(visited == count);
+
+    // Unlink half by value and half by key
+    for (i = 0; i < count; i += 2)
+        foo_table_unlink(&table, foos + i);
+    for (i = 1; i < count; i += 2)
+        pottery_test_assert(foo_table_unlink_key(&table, i * 3) == foos + i);
+    pottery_test_assert(foo_table_unlink_key(&table, 3) == pottery_null);
+    pottery_test_assert(foo_table_is_empty(&table));
+    pottery_test_assert(foo_table_first(&table) == pottery_null);
+
+    foo_table_destroy(&table);
+}
+
+POTTERY_TEST(pottery_chained_hash_table_index_refs) {
+    uint16_t buckets[8];
+    bar_table_t table;
+    bar_table_init(&table, buckets, 3);
+
+    uint16_t i;
+    for (i = 0; i < 100; ++i) {
+        bar_pool[i].value = i * 10;
+        bar_table_link(&table, i);
+    }
+    for (i = 0; i < 100; ++i) {
+        pottery_test_assert(bar_table_find(&table, i * 10) == i);
+        pottery_test_assert(bar_pool[i].hash == pottery_cast(size_t, i * 10) % 7);
+    }
+    pottery_test_assert(bar_table_find(&table, 5) == UINT16_MAX);
+
+    // Unlink from the middle, head and tail of chains
+    for (i = 0; i < 100; i += 3)
+        bar_table_unlink(&table, i);
+    for (i = 0; i < 100; ++i)
+        pottery_test_assert(bar_table_contains_key(&table, i * 10) == (i % 3 != 0));
+
+    size_t visited = 0;
+    uint16_t entry;
+    for (entry = bar_table_first(&table); bar_table_entry_exists(&table, entry);
+            entry = bar_table_next(&table, entry))
+        ++visited;
+    pottery_test_assert(visited == bar_table_count(&table));
+
+    bar_table_unlink_all(&table);
+    bar_table_destroy(&table);
+}
@@ -0,0 +1,81 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2020-2021 11037650 Canada Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "pottery/unit/test_pottery_framework.h"
+
+#define TEST_POTTERY_HASH_MAX 200
+
+POTTERY_TEST(pottery_hash_bytes_lengths) {
+    static char buffer[TEST_POTTERY_HASH_MAX + 9];
+    static uint64_t hashes[TEST_POTTERY_HASH_MAX + 1];
+    size_t i, j;
+
+    for (i = 0; i < TEST_POTTERY_HASH_MAX; ++i)
+        buffer[i] = pottery_cast(char, 'a' + i % 26);
+
+    // Every prefix of the buffer hashes differently, including those that
+    // differ only in trailing zeroes.
+    for (i = 0; i <= TEST_POTTERY_HASH_MAX; ++i) {
+        hashes[i] = pottery_hash_bytes(buffer, i, 0);
+        pottery_test_assert(hashes[i] == pottery_hash_bytes(buffer, i, 0));
+        for (j = 0; j < i; ++j)
+            pottery_test_assert(hashes[i] != hashes[j]);
+    }
+    pottery_test_assert(pottery_hash_bytes("\0", 1, 0) != pottery_hash_bytes("\0\0", 2, 0));
+
+    // The hash doesn't depend on alignment.
+    for (i = 1; i < 9; ++i) {
+        pottery_memmove(buffer + i, buffer + i - 1, TEST_POTTERY_HASH_MAX);
+        for (j = 0; j <= TEST_POTTERY_HASH_MAX; ++j)
+            pottery_test_assert(hashes[j] == pottery_hash_bytes(buffer + i, j, 0));
+    }
+}
+
+POTTERY_TEST(pottery_hash_bytes_bits) {
+    unsigned char buffer[TEST_POTTERY_HASH_MAX];
+    size_t size, bit;
+
+    pottery_memset(buffer, 0, sizeof(buffer));
+
+    // Flipping any bit of the input or the seed changes the hash. We test
+    // sizes on either side of each read width and lane boundary.
+    for (size = 1; size < TEST_POTTERY_HASH_MAX; size = size * 2 - size / 3 + 1) {
+        uint64_t hash = pottery_hash_bytes(buffer, size, 0);
+        for (bit = 0; bit < size * 8; ++bit) {
+            buffer[bit / 8] ^= pottery_cast(unsigned char, 1u << (bit % 8));
+            pottery_test_assert(hash != pottery_hash_bytes(buffer, size, 0));
+            buffer[bit / 8] ^= pottery_cast(unsigned char, 1u << (bit % 8));
+        }
+        for (bit = 0; bit < 64; ++bit)
+            pottery_test_assert(hash != pottery_hash_bytes(buffer, size, pottery_cast(uint64_t, 1) << bit));
+    }
+}
+
+POTTERY_TEST(pottery_hash_string) {
+    const char* str = "The quick brown fox jumps over the lazy dog";
+    pottery_test_assert(pottery_hash_string(str, 0) == pottery_hash_bytes(str, strlen(str), 0));
+    pottery_test_assert(pottery_hash_string(str, 1) == pottery_hash_bytes(str, strlen(str), 1));
+    pottery_test_assert(pottery_hash_string(str, 0) != pottery_hash_string(str, 1));
+    pottery_test_assert(pottery_hash_string("", 0) == pottery_hash_bytes(str, 0, 0));
+}
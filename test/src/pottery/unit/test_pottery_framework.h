@@ -29,6 +29,16 @@
 
 #include <stdio.h>
 
+// Tests of concurrent containers that need threads are only compiled if the
+// build links with pthreads. (See test/tools/configure.py.)
+#ifndef POTTERY_TEST_PTHREADS
+#define POTTERY_TEST_PTHREADS 0
+#endif
+#if POTTERY_TEST_PTHREADS
+#include <pthread.h>
+#include <sched.h>
+#endif
+
 /*
  * This is a minimal unit testing framework. I couldn't find an existing one
  * that would do what I need. Here are Pottery's requirements:
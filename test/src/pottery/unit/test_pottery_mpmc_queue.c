@@ -0,0 +1,351 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2020-2021 11037650 Canada Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "pottery/pottery_dependencies.h"
+
+#if POTTERY_ATOMICS
+
+// Most of these tests use the queue from one thread. They test that values go
+// through the queue in order, that slots are handed back properly and that
+// the queue wraps around its buffer. The threaded test at the end runs
+// several producers and consumers at once.
+
+#define POTTERY_MPMC_QUEUE_PREFIX int_mpmc_queue
+#define POTTERY_MPMC_QUEUE_VALUE_TYPE int
+#define POTTERY_MPMC_QUEUE_LIFECYCLE_BY_VALUE 1
+#include "pottery/mpmc_queue/pottery_mpmc_queue_static.t.h"
+
+#include "pottery/common/test_pottery_ufo.h"
+#define POTTERY_MPMC_QUEUE_PREFIX ufo_mpmc_queue
+#define POTTERY_MPMC_QUEUE_VALUE_TYPE ufo_t
+#define POTTERY_MPMC_QUEUE_LIFECYCLE_DESTROY ufo_destroy
+#include "pottery/mpmc_queue/pottery_mpmc_queue_static.t.h"
+
+#include "pottery/unit/test_pottery_framework.h"
+
+POTTERY_TEST(pottery_mpmc_queue_init_destroy) {
+    int_mpmc_queue_t queue;
+    pottery_test_assert(POTTERY_OK == int_mpmc_queue_init(&queue, 100));
+    pottery_test_assert(int_mpmc_queue_capacity(&queue) == 128);
+    pottery_test_assert(int_mpmc_queue_is_empty(&queue));
+    int_mpmc_queue_destroy(&queue);
+
+    pottery_test_assert(POTTERY_OK == int_mpmc_queue_init(&queue, 0));
+    pottery_test_assert(int_mpmc_queue_capacity(&queue) == 2);
+    int_mpmc_queue_destroy(&queue);
+}
+
+POTTERY_TEST(pottery_mpmc_queue_push_pop) {
+    int_mpmc_queue_t queue;
+    pottery_test_assert(POTTERY_OK == int_mpmc_queue_init(&queue, 8));
+
+    int pushed = 0;
+    int popped = 0;
+    int value;
+    int round;
+    for (round = 0; round < 100; ++round) {
+        // push until full
+        while (int_mpmc_queue_try_push(&queue, pushed))
+            ++pushed;
+        pottery_test_assert(int_mpmc_queue_count(&queue) == 8);
+
+        // pop a few
+        int i;
+        for (i = 0; i < round % 8 + 1; ++i) {
+            pottery_test_assert(int_mpmc_queue_try_pop(&queue, &value));
+            pottery_test_assert(value == popped++);
+        }
+    }
+
+    while (int_mpmc_queue_try_pop(&queue, &value))
+        pottery_test_assert(value == popped++);
+    pottery_test_assert(popped == pushed);
+    pottery_test_assert(int_mpmc_queue_is_empty(&queue));
+
+    int_mpmc_queue_destroy(&queue);
+}
+
+POTTERY_TEST(pottery_mpmc_queue_bulk) {
+    int_mpmc_queue_t queue;
+    pottery_test_assert(POTTERY_OK == int_mpmc_queue_init(&queue, 64));
+
+    int in[100];
+    int out[100];
+    int next_in = 0;
+    int next_out = 0;
+    int round;
+    for (round = 0; round < 200; ++round) {
+        int i;
+        size_t count = pottery_cast(size_t, round * 7 % 100);
+        for (i = 0; i < 100; ++i)
+            in[i] = next_in + i;
+
+        // Only as many values as fit are pushed, wrapping around the buffer.
+        size_t space = 64 - int_mpmc_queue_count(&queue);
+        size_t pushed = int_mpmc_queue_try_push_bulk(&queue, in, count);
+        pottery_test_assert(pushed == pottery_min_s(count, space));
+        next_in += pottery_cast(int, pushed);
+
+        count = pottery_cast(size_t, round * 13 % 50);
+        size_t available = int_mpmc_queue_count(&queue);
+        size_t popped = int_mpmc_queue_try_pop_bulk(&queue, out, count);
+        pottery_test_assert(popped == pottery_min_s(count, available));
+        for (i = 0; i < pottery_cast(int, popped); ++i)
+            pottery_test_assert(out[i] == next_out++);
+    }
+
+    int_mpmc_queue_destroy(&queue);
+}
+
+POTTERY_TEST(pottery_mpmc_queue_claim_out_of_order) {
+    int_mpmc_queue_t queue;
+    pottery_test_assert(POTTERY_OK == int_mpmc_queue_init(&queue, 4));
+
+    // Two producers claim slots. The second commits first but consumers
+    // can't get past the first until it's committed.
+    int_mpmc_queue_entry_t first;
+    int_mpmc_queue_entry_t second;
+    pottery_test_assert(int_mpmc_queue_try_emplace(&queue, &first));
+    pottery_test_assert(int_mpmc_queue_try_emplace(&queue, &second));
+    *int_mpmc_queue_entry_ref(&queue, second) = 2;
+    int_mpmc_queue_commit(&queue, second);
+
+    int_mpmc_queue_entry_t entry;
+    pottery_test_assert(!int_mpmc_queue_try_claim(&queue, &entry));
+    *int_mpmc_queue_entry_ref(&queue, first) = 1;
+    int_mpmc_queue_commit(&queue, first);
+
+    // Likewise two consumers claim values. Producers can't reuse the first
+    // slot until it's displaced.
+    pottery_test_assert(int_mpmc_queue_try_claim(&queue, &first));
+    pottery_test_assert(int_mpmc_queue_try_claim(&queue, &second));
+    pottery_test_assert(*int_mpmc_queue_entry_ref(&queue, first) == 1);
+    pottery_test_assert(*int_mpmc_queue_entry_ref(&queue, second) == 2);
+    int_mpmc_queue_displace(&queue, second);
+
+    pottery_test_assert(int_mpmc_queue_try_push(&queue, 3));
+    pottery_test_assert(int_mpmc_queue_try_push(&queue, 4));
+    pottery_test_assert(!int_mpmc_queue_try_push(&queue, 5));
+    int_mpmc_queue_displace(&queue, first);
+    pottery_test_assert(int_mpmc_queue_try_push(&queue, 5));
+
+    // Spans don't cross the end of the buffer.
+    size_t count = int_mpmc_queue_try_claim_bulk(&queue, 10, &entry);
+    pottery_test_assert(count == 2);
+    pottery_test_assert(*int_mpmc_queue_entry_ref(&queue, entry) == 3);
+    int_mpmc_queue_displace_bulk(&queue, entry, count);
+    count = int_mpmc_queue_try_claim_bulk(&queue, 10, &entry);
+    pottery_test_assert(count == 1);
+    pottery_test_assert(entry == queue.slots);
+    pottery_test_assert(*int_mpmc_queue_entry_ref(&queue, entry) == 5);
+    int_mpmc_queue_displace_bulk(&queue, entry, count);
+
+    pottery_test_assert(int_mpmc_queue_is_empty(&queue));
+    int_mpmc_queue_destroy(&queue);
+}
+
+POTTERY_TEST(pottery_mpmc_queue_ufo) {
+    ufo_mpmc_queue_t queue;
+    pottery_test_assert(POTTERY_OK == ufo_mpmc_queue_init(&queue, 4));
+
+    int32_t next_in = 0;
+    int32_t next_out = 0;
+    int round;
+    for (round = 0; round < 50; ++round) {
+        ufo_mpmc_queue_entry_t entry;
+        while (ufo_mpmc_queue_try_emplace(&queue, &entry)) {
+            ufo_init(ufo_mpmc_queue_entry_ref(&queue, entry), "hello", next_in++);
+            ufo_mpmc_queue_commit(&queue, entry);
+        }
+
+        int i;
+        for (i = 0; i < 3; ++i) {
+            pottery_test_assert(ufo_mpmc_queue_try_claim(&queue, &entry));
+            pottery_test_assert(ufo_mpmc_queue_entry_ref(&queue, entry)->integer == next_out++);
+            ufo_mpmc_queue_remove(&queue, entry);
+        }
+    }
+
+    // The remaining values are destroyed with the queue.
+    pottery_test_assert(ufo_mpmc_queue_count(&queue) == 1);
+    ufo_mpmc_queue_destroy(&queue);
+}
+
+#if POTTERY_TEST_PTHREADS
+// Several producers push numbered values tagged with their index through a
+// small queue while several consumers pop them. Both sides cycle between the
+// single, bulk and span functions so that slots are claimed in batches by
+// competing threads. Every value must be received exactly once, and each
+// consumer must see each producer's values in order.
+#define MPMC_QUEUE_THREADED_PRODUCERS 3
+#define MPMC_QUEUE_THREADED_CONSUMERS 3
+#define MPMC_QUEUE_THREADED_COUNT 50000
+#define MPMC_QUEUE_THREADED_CAPACITY 64
+#define MPMC_QUEUE_THREADED_TOTAL (MPMC_QUEUE_THREADED_PRODUCERS * MPMC_QUEUE_THREADED_COUNT)
+
+static int_mpmc_queue_t threaded_queue;
+static size_t threaded_done;
+
+// Each consumer marks the values it receives in its own array so that they
+// don't race. They are compared once all threads are joined.
+static bool threaded_received[MPMC_QUEUE_THREADED_CONSUMERS][MPMC_QUEUE_THREADED_TOTAL];
+
+static void* threaded_producer(void* arg) {
+    int producer = *pottery_cast(int*, arg);
+    int in[40];
+    int next = 0;
+    size_t round = 0;
+
+    while (next < MPMC_QUEUE_THREADED_COUNT) {
+        size_t count = pottery_min_s(round % 37 + 1,
+                pottery_cast(size_t, MPMC_QUEUE_THREADED_COUNT - next));
+        int value = producer * MPMC_QUEUE_THREADED_COUNT + next;
+        size_t pushed = 0;
+        size_t i;
+
+        switch (round++ % 3) {
+            case 0:
+                if (int_mpmc_queue_try_push(&threaded_queue, value))
+                    pushed = 1;
+                break;
+            case 1:
+                for (i = 0; i < count; ++i)
+                    in[i] = value + pottery_cast(int, i);
+                pushed = int_mpmc_queue_try_push_bulk(&threaded_queue, in, count);
+                break;
+            default: {
+                int_mpmc_queue_entry_t entry;
+                pushed = int_mpmc_queue_try_emplace_bulk(&threaded_queue, count, &entry);
+                for (i = 0; i < pushed; ++i)
+                    *int_mpmc_queue_entry_ref(&threaded_queue, entry + i) = value + pottery_cast(int, i);
+                int_mpmc_queue_commit_bulk(&threaded_queue, entry, pushed);
+                break;
+            }
+        }
+
+        next += pottery_cast(int, pushed);
+        if (pushed == 0)
+            sched_yield();
+    }
+    return pottery_null;
+}
+
+static void* threaded_consumer(void* arg) {
+    int consumer = *pottery_cast(int*, arg);
+    int last[MPMC_QUEUE_THREADED_PRODUCERS];
+    int out[40];
+    size_t round = 0;
+    int i;
+
+    for (i = 0; i < MPMC_QUEUE_THREADED_PRODUCERS; ++i)
+        last[i] = -1;
+
+    while (true) {
+        // The producers have all finished if this is set so once we see it,
+        // an empty queue means there's nothing left to receive.
+        size_t done = pottery_atomic_load_acquire_s(&threaded_done);
+        size_t count = round % 29 + 1;
+        size_t popped = 0;
+        size_t j;
+
+        switch (round++ % 3) {
+            case 0:
+                if (int_mpmc_queue_try_pop(&threaded_queue, &out[0]))
+                    popped = 1;
+                break;
+            case 1:
+                popped = int_mpmc_queue_try_pop_bulk(&threaded_queue, out, count);
+                break;
+            default: {
+                int_mpmc_queue_entry_t entry;
+                popped = int_mpmc_queue_try_claim_bulk(&threaded_queue, count, &entry);
+                for (j = 0; j < popped; ++j)
+                    out[j] = *int_mpmc_queue_entry_ref(&threaded_queue, entry + j);
+                int_mpmc_queue_displace_bulk(&threaded_queue, entry, popped);
+                break;
+            }
+        }
+
+        for (j = 0; j < popped; ++j) {
+            int value = out[j];
+            int producer = value / MPMC_QUEUE_THREADED_COUNT;
+            pottery_test_assert(value >= 0 && value < MPMC_QUEUE_THREADED_TOTAL);
+            pottery_test_assert(value > last[producer]);
+            last[producer] = value;
+            pottery_test_assert(!threaded_received[consumer][value]);
+            threaded_received[consumer][value] = true;
+        }
+
+        if (popped == 0) {
+            if (done)
+                break;
+            sched_yield();
+        }
+    }
+    return pottery_null;
+}
+
+POTTERY_TEST(pottery_mpmc_queue_threaded) {
+    pthread_t producers[MPMC_QUEUE_THREADED_PRODUCERS];
+    pthread_t consumers[MPMC_QUEUE_THREADED_CONSUMERS];
+    int producer_indexes[MPMC_QUEUE_THREADED_PRODUCERS];
+    int consumer_indexes[MPMC_QUEUE_THREADED_CONSUMERS];
+    int i, j;
+
+    pottery_test_assert(POTTERY_OK == int_mpmc_queue_init(&threaded_queue,
+                MPMC_QUEUE_THREADED_CAPACITY));
+    threaded_done = 0;
+    memset(threaded_received, 0, sizeof(threaded_received));
+
+    for (i = 0; i < MPMC_QUEUE_THREADED_CONSUMERS; ++i) {
+        consumer_indexes[i] = i;
+        pottery_test_assert(0 == pthread_create(&consumers[i], pottery_null,
+                    threaded_consumer, &consumer_indexes[i]));
+    }
+    for (i = 0; i < MPMC_QUEUE_THREADED_PRODUCERS; ++i) {
+        producer_indexes[i] = i;
+        pottery_test_assert(0 == pthread_create(&producers[i], pottery_null,
+                    threaded_producer, &producer_indexes[i]));
+    }
+
+    for (i = 0; i < MPMC_QUEUE_THREADED_PRODUCERS; ++i)
+        pottery_test_assert(0 == pthread_join(producers[i], pottery_null));
+    pottery_atomic_store_release_s(&threaded_done, 1);
+    for (i = 0; i < MPMC_QUEUE_THREADED_CONSUMERS; ++i)
+        pottery_test_assert(0 == pthread_join(consumers[i], pottery_null));
+
+    // Every value was received by exactly one consumer.
+    for (j = 0; j < MPMC_QUEUE_THREADED_TOTAL; ++j) {
+        int receivers = 0;
+        for (i = 0; i < MPMC_QUEUE_THREADED_CONSUMERS; ++i)
+            receivers += threaded_received[i][j] ? 1 : 0;
+        pottery_test_assert(receivers == 1);
+    }
+
+    pottery_test_assert(int_mpmc_queue_is_empty(&threaded_queue));
+    int_mpmc_queue_destroy(&threaded_queue);
+}
+#endif
+
+#endif
@@ -207,6 +207,84 @@ POTTERY_TEST(pottery_pager_bulk_extract_last) {
     int_pager_destroy(&pager);
 }
 
+POTTERY_TEST(pottery_pager_insert_remove_at) {
+    int_pager_t pager;
+    int_pager_init(&pager);
+
+    // We mirror every operation in a plain array and compare them. Values are
+    // inserted and removed in bulk across page boundaries on both sides.
+    static int expected[10000];
+    int values[50];
+    size_t count = 0;
+    size_t i;
+    int round;
+    for (round = 0; round < 400; ++round) {
+        size_t index = pottery_cast(size_t, round * 7919) % (count + 1);
+        size_t bulk = pottery_cast(size_t, round % 50);
+        if (round % 3 != 2) {
+            for (i = 0; i < bulk; ++i)
+                values[i] = round * 100 + pottery_cast(int, i);
+            int_pager_entry_t entry;
+            pottery_test_assert(POTTERY_OK == int_pager_emplace_at_bulk(&pager, index, bulk, &entry));
+            for (i = 0; i < bulk; ++i) {
+                *int_pager_entry_ref(&pager, entry) = values[i];
+                entry = int_pager_next(&pager, entry);
+            }
+            pottery_memmove(expected + index + bulk, expected + index, (count - index) * sizeof(int));
+            pottery_memcpy(expected + index, values, bulk * sizeof(int));
+            count += bulk;
+        } else {
+            bulk = pottery_min_s(bulk, count - index);
+            int_pager_remove_at_bulk(&pager, index, bulk);
+            pottery_memmove(expected + index, expected + index + bulk, (count - index - bulk) * sizeof(int));
+            count -= bulk;
+        }
+
+        pottery_test_assert(int_pager_count(&pager) == count);
+        for (i = 0; i < count; ++i)
+            pottery_test_assert(*int_pager_entry_ref(&pager, int_pager_at(&pager, i)) == expected[i]);
+    }
+
+    // single values
+    pottery_test_assert(POTTERY_OK == int_pager_insert_at(&pager, 40, -1));
+    pottery_test_assert(*int_pager_entry_ref(&pager, int_pager_at(&pager, 40)) == -1);
+    pottery_test_assert(int_pager_extract_at(&pager, 40) == -1);
+    int_pager_displace_at(&pager, 0);
+    pottery_test_assert(int_pager_count(&pager) == count - 1);
+    for (i = 1; i < count; ++i)
+        pottery_test_assert(*int_pager_entry_ref(&pager, int_pager_at(&pager, i - 1)) == expected[i]);
+
+    int_pager_destroy(&pager);
+}
+
+POTTERY_TEST(pottery_pager_insert_at_moves_shorter_side) {
+    int_pager_t pager;
+    int_pager_init(&pager);
+
+    int i;
+    for (i = 0; i < 500; ++i)
+        int_pager_insert_last(&pager, i);
+
+    // Inserting near the back doesn't move values at the front.
+    int* first = int_pager_entry_ref(&pager, int_pager_first(&pager));
+    pottery_test_assert(POTTERY_OK == int_pager_insert_at(&pager, 450, -1));
+    pottery_test_assert(int_pager_entry_ref(&pager, int_pager_first(&pager)) == first);
+
+    // Removing near the front doesn't move values at the back.
+    int* last = int_pager_entry_ref(&pager, int_pager_last(&pager));
+    int_pager_remove_at_bulk(&pager, 10, 40);
+    pottery_test_assert(int_pager_entry_ref(&pager, int_pager_last(&pager)) == last);
+
+    pottery_test_assert(int_pager_count(&pager) == 461);
+    for (i = 0; i < 10; ++i)
+        pottery_test_assert(*int_pager_entry_ref(&pager, int_pager_at(&pager, pottery_cast(size_t, i))) == i);
+    for (i = 10; i < 410; ++i)
+        pottery_test_assert(*int_pager_entry_ref(&pager, int_pager_at(&pager, pottery_cast(size_t, i))) == i + 40);
+    pottery_test_assert(*int_pager_entry_ref(&pager, int_pager_at(&pager, 410)) == -1);
+
+    int_pager_destroy(&pager);
+}
+
 // This should be moved to test_pottery_unit_array_ufo but pager doesn't use it
 // yet! See for_each in test_pottery_unit_map_ufo for the map equivalent
 #if POTTERY_HAS_FULL_FOR_EACH
@@ -22,6 +22,11 @@
  * SOFTWARE.
  */
 
+// We want memfd_create() for the mirrored ring
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+
 // We define an int ring as separate declare/define headers to make sure it
 // works properly. We also give it a small page size to help test paging and
 // bulk methods.
@@ -44,6 +49,16 @@
 #define POTTERY_RING_LIFECYCLE_DESTROY ufo_destroy
 #include "pottery/ring/pottery_ring_static.t.h"
 
+// A mirrored ring of bytes, as for buffering a stream
+#include "pottery/pottery_dependencies.h"
+#if POTTERY_MIRRORED_MEMORY
+#define POTTERY_RING_PREFIX byte_ring
+#define POTTERY_RING_VALUE_TYPE char
+#define POTTERY_RING_LIFECYCLE_BY_VALUE 1
+#define POTTERY_RING_MIRRORED 1
+#include "pottery/ring/pottery_ring_static.t.h"
+#endif
+
 #include "pottery/unit/test_pottery_framework.h"
 
 POTTERY_TEST(pottery_ring_int_init_destroy) {
@@ -275,3 +290,255 @@ POTTERY_TEST(pottery_ring_wrap_backward) {
 
     int_ring_destroy(&ring);
 }
+
+POTTERY_TEST(pottery_ring_bulk_wrap) {
+    int_ring_t ring;
+    int_ring_init(&ring);
+
+    int block[100];
+    int i;
+    for (i = 0; i < 100; ++i)
+        block[i] = i;
+
+    // Shift the start of the ring around its buffer so that bulk operations
+    // wrap at various offsets.
+    int offset;
+    for (offset = 0; offset < 70; ++offset) {
+        pottery_test_assert(POTTERY_OK == int_ring_insert_last_bulk(&ring, block, 20));
+        pottery_test_assert(POTTERY_OK == int_ring_insert_first_bulk(&ring, block + 20, 20));
+        pottery_test_assert(int_ring_count(&ring) == 40);
+        for (i = 0; i < 20; ++i) {
+            pottery_test_assert(*int_ring_at(&ring, pottery_cast(size_t, i)) == 20 + i);
+            pottery_test_assert(*int_ring_at(&ring, pottery_cast(size_t, 20 + i)) == i);
+        }
+
+        int out[40];
+        int_ring_extract_last_bulk(&ring, out, 15);
+        for (i = 0; i < 15; ++i)
+            pottery_test_assert(out[i] == 5 + i);
+        int_ring_extract_first_bulk(&ring, out, 25);
+        for (i = 0; i < 20; ++i)
+            pottery_test_assert(out[i] == 20 + i);
+        for (i = 0; i < 5; ++i)
+            pottery_test_assert(out[20 + i] == i);
+        pottery_test_assert(int_ring_is_empty(&ring));
+
+        // leave the ring with a different start next time
+        int_ring_insert_last(&ring, 0);
+        int_ring_displace_first_bulk(&ring, 1);
+        int_ring_insert_first(&ring, 0);
+        int_ring_displace_last(&ring);
+        for (i = 0; i < offset % 7; ++i)
+            int_ring_insert_last(&ring, i);
+        int_ring_displace_first_bulk(&ring, pottery_cast(size_t, offset % 7));
+    }
+
+    int_ring_destroy(&ring);
+}
+
+POTTERY_TEST(pottery_ring_capacity_power_of_two) {
+    int_ring_t ring;
+    int_ring_init(&ring);
+
+    int i;
+    for (i = 0; i < 1000; ++i) {
+        int_ring_insert_last(&ring, i);
+        pottery_test_assert((ring.capacity & (ring.capacity - 1)) == 0);
+        pottery_test_assert(ring.capacity >= int_ring_count(&ring));
+    }
+
+    // The ring shrinks as values are removed.
+    size_t full_capacity = ring.capacity;
+    int_ring_displace_first_bulk(&ring, 990);
+    pottery_test_assert(ring.capacity < full_capacity);
+    pottery_test_assert((ring.capacity & (ring.capacity - 1)) == 0);
+    for (i = 0; i < 10; ++i)
+        pottery_test_assert(*int_ring_at(&ring, pottery_cast(size_t, i)) == 990 + i);
+
+    int_ring_displace_all(&ring);
+    pottery_test_assert(ring.capacity == 0);
+    int_ring_destroy(&ring);
+}
+
+POTTERY_TEST(pottery_ring_ufo_remove_bulk) {
+    ufo_ring_t ring;
+    ufo_ring_init(&ring);
+
+    // Alternately insert values at both ends and remove them in bulk from the
+    // other end so that removals wrap around the buffer. (ASan will catch any
+    // values that aren't destroyed.)
+    int32_t first = 0;
+    int32_t last = 0;
+    int round;
+    for (round = 0; round < 20; ++round) {
+        int i;
+        ufo_t* entry;
+        for (i = 0; i < 30; ++i) {
+            pottery_test_assert(POTTERY_OK == ufo_ring_emplace_first(&ring, &entry));
+            ufo_init(entry, "hello", --first);
+            pottery_test_assert(POTTERY_OK == ufo_ring_emplace_last(&ring, &entry));
+            ufo_init(entry, "world", last++);
+        }
+        ufo_ring_remove_first_bulk(&ring, 25);
+        first += 25;
+        ufo_ring_remove_last_bulk(&ring, 27);
+        last -= 27;
+
+        size_t count = ufo_ring_count(&ring);
+        pottery_test_assert(count == pottery_cast(size_t, last - first));
+        size_t j;
+        for (j = 0; j < count; ++j)
+            pottery_test_assert(ufo_ring_at(&ring, j)->integer == first + pottery_cast(int32_t, j));
+    }
+
+    ufo_ring_remove_first_bulk(&ring, ufo_ring_count(&ring) / 2);
+    ufo_ring_destroy(&ring);
+}
+
+POTTERY_TEST(pottery_ring_int_insert_remove_at) {
+    int_ring_t ring;
+    int_ring_init(&ring);
+
+    // We mirror every operation in a plain array and compare them. The
+    // indexes move around so that values are shifted from both sides and
+    // across the wrap of the buffer.
+    int expected[300];
+    size_t count = 0;
+    size_t i;
+    int round;
+    for (round = 0; round < 600; ++round) {
+        size_t index = pottery_cast(size_t, round * 7919) % (count + 1);
+        if (round % 3 != 2 || count == 0) {
+            pottery_test_assert(POTTERY_OK == int_ring_insert_at(&ring, index, round));
+            pottery_memmove(expected + index + 1, expected + index, (count - index) * sizeof(int));
+            expected[index] = round;
+            ++count;
+        } else {
+            if (index == count)
+                --index;
+            pottery_test_assert(int_ring_extract_at(&ring, index) == expected[index]);
+            pottery_memmove(expected + index, expected + index + 1, (count - index - 1) * sizeof(int));
+            --count;
+        }
+
+        pottery_test_assert(int_ring_count(&ring) == count);
+        for (i = 0; i < count; ++i)
+            pottery_test_assert(*int_ring_at(&ring, i) == expected[i]);
+    }
+
+    int_ring_displace_all(&ring);
+    int_ring_destroy(&ring);
+}
+
+POTTERY_TEST(pottery_ring_int_insert_at_moves_shorter_side) {
+    int_ring_t ring;
+    int_ring_init(&ring);
+
+    int i;
+    for (i = 0; i < 50; ++i)
+        int_ring_insert_last(&ring, i);
+    pottery_test_assert(ring.capacity > 60);
+    int* first = int_ring_first(&ring);
+    int* last = int_ring_last(&ring);
+
+    // Inserting near the front moves the front, not the back.
+    int* entry;
+    pottery_test_assert(POTTERY_OK == int_ring_emplace_at_bulk(&ring, 3, 5, &entry));
+    for (i = 0; i < 5; ++i)
+        *int_ring_at(&ring, pottery_cast(size_t, 3 + i)) = -1;
+    pottery_test_assert(int_ring_last(&ring) == last);
+
+    // Removing near the back moves the back, not the front.
+    first = int_ring_first(&ring);
+    int_ring_displace_at_bulk(&ring, 45, 4);
+    pottery_test_assert(int_ring_first(&ring) == first);
+
+    pottery_test_assert(int_ring_count(&ring) == 51);
+    for (i = 0; i < 3; ++i)
+        pottery_test_assert(*int_ring_at(&ring, pottery_cast(size_t, i)) == i);
+    for (i = 3; i < 8; ++i)
+        pottery_test_assert(*int_ring_at(&ring, pottery_cast(size_t, i)) == -1);
+    for (i = 8; i < 45; ++i)
+        pottery_test_assert(*int_ring_at(&ring, pottery_cast(size_t, i)) == i - 5);
+    for (i = 45; i < 51; ++i)
+        pottery_test_assert(*int_ring_at(&ring, pottery_cast(size_t, i)) == i - 1);
+
+    int_ring_displace_all(&ring);
+    int_ring_destroy(&ring);
+}
+
+POTTERY_TEST(pottery_ring_ufo_remove_at_bulk) {
+    ufo_ring_t ring;
+    ufo_ring_init(&ring);
+
+    // Values in the middle of the ring are moved with the move expression.
+    // (ASan will catch any values that aren't destroyed.)
+    int32_t i;
+    ufo_t* entry;
+    for (i = 0; i < 40; ++i) {
+        pottery_test_assert(POTTERY_OK == ufo_ring_emplace_first(&ring, &entry));
+        ufo_init(entry, "hello", 39 - i);
+    }
+    pottery_test_assert(POTTERY_OK == ufo_ring_emplace_at_bulk(&ring, 30, 10, &entry));
+    for (i = 0; i < 10; ++i)
+        ufo_init(ufo_ring_at(&ring, pottery_cast(size_t, 30 + i)), "world", 100 + i);
+    ufo_ring_remove_at_bulk(&ring, 5, 20);
+    ufo_ring_remove_at(&ring, 1);
+
+    size_t count = ufo_ring_count(&ring);
+    pottery_test_assert(count == 29);
+    int32_t expected[29] = {0, 2, 3, 4, 25, 26, 27, 28, 29,
+            100, 101, 102, 103, 104, 105, 106, 107, 108, 109,
+            30, 31, 32, 33, 34, 35, 36, 37, 38, 39};
+    size_t j;
+    for (j = 0; j < count; ++j) {
+        ufo_check(ufo_ring_at(&ring, j));
+        pottery_test_assert(ufo_ring_at(&ring, j)->integer == expected[j]);
+    }
+
+    ufo_ring_destroy(&ring);
+}
+
+#if POTTERY_MIRRORED_MEMORY
+POTTERY_TEST(pottery_ring_mirrored_spans) {
+    byte_ring_t ring;
+    byte_ring_init(&ring);
+
+    // Write and read messages of various lengths so that they wrap around
+    // the end of the buffer. Each message is read back as a single span.
+    char* span;
+    size_t count;
+    char next_in = 0;
+    char next_out = 0;
+    size_t i;
+    int round;
+    for (round = 0; round < 2000; ++round) {
+        size_t length = pottery_cast(size_t, round * 37 % 1000) + 1;
+        pottery_test_assert(POTTERY_OK == byte_ring_write_span(&ring, length, &span, &count));
+        pottery_test_assert(count >= length);
+        for (i = 0; i < length; ++i)
+            span[i] = next_in++;
+        byte_ring_commit_span(&ring, length);
+
+        // The buffer is a whole number of pages and its mirror follows it.
+        size_t capacity = ring.capacity;
+        pottery_test_assert(capacity * sizeof(char) % pottery_page_size() == 0);
+        pottery_test_assert(ring.values[0] == ring.values[capacity]);
+
+        // Leave some of the values behind so the ring moves around.
+        span = byte_ring_read_span(&ring, &count);
+        pottery_test_assert(count == byte_ring_count(&ring));
+        count -= count / 3;
+        for (i = 0; i < count; ++i)
+            pottery_test_assert(span[i] == next_out++);
+        byte_ring_displace_first_bulk(&ring, count);
+    }
+
+    // Values are also visible through the usual interface.
+    span = byte_ring_read_span(&ring, &count);
+    for (i = 0; i < count; ++i)
+        pottery_test_assert(*byte_ring_at(&ring, i) == span[i]);
+
+    byte_ring_destroy(&ring);
+}
+#endif
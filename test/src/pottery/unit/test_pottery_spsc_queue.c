@@ -0,0 +1,277 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2020-2021 11037650 Canada Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "pottery/pottery_dependencies.h"
+
+#if POTTERY_ATOMICS
+
+// Most of these tests use the queue from one thread. They test that values go
+// through the queue in order and that it wraps around its buffer properly.
+// The threaded test at the end runs a producer and a consumer at once.
+
+#define POTTERY_SPSC_QUEUE_PREFIX int_spsc_queue
+#define POTTERY_SPSC_QUEUE_VALUE_TYPE int
+#define POTTERY_SPSC_QUEUE_LIFECYCLE_BY_VALUE 1
+#include "pottery/spsc_queue/pottery_spsc_queue_static.t.h"
+
+#include "pottery/common/test_pottery_ufo.h"
+#define POTTERY_SPSC_QUEUE_PREFIX ufo_spsc_queue
+#define POTTERY_SPSC_QUEUE_VALUE_TYPE ufo_t
+#define POTTERY_SPSC_QUEUE_LIFECYCLE_DESTROY ufo_destroy
+#include "pottery/spsc_queue/pottery_spsc_queue_static.t.h"
+
+#include "pottery/unit/test_pottery_framework.h"
+
+POTTERY_TEST(pottery_spsc_queue_init_destroy) {
+    int_spsc_queue_t queue;
+    pottery_test_assert(POTTERY_OK == int_spsc_queue_init(&queue, 100));
+    pottery_test_assert(int_spsc_queue_capacity(&queue) == 128);
+    pottery_test_assert(int_spsc_queue_is_empty(&queue));
+    int_spsc_queue_destroy(&queue);
+
+    pottery_test_assert(POTTERY_OK == int_spsc_queue_init(&queue, 0));
+    pottery_test_assert(int_spsc_queue_capacity(&queue) == 1);
+    int_spsc_queue_destroy(&queue);
+}
+
+POTTERY_TEST(pottery_spsc_queue_push_pop) {
+    int_spsc_queue_t queue;
+    pottery_test_assert(POTTERY_OK == int_spsc_queue_init(&queue, 8));
+
+    int pushed = 0;
+    int popped = 0;
+    int value;
+    int round;
+    for (round = 0; round < 100; ++round) {
+        // push until full
+        while (int_spsc_queue_try_push(&queue, pushed))
+            ++pushed;
+        pottery_test_assert(int_spsc_queue_count(&queue) == 8);
+
+        // pop a few
+        int i;
+        for (i = 0; i < round % 8 + 1; ++i) {
+            pottery_test_assert(int_spsc_queue_try_pop(&queue, &value));
+            pottery_test_assert(value == popped++);
+        }
+    }
+
+    while (int_spsc_queue_try_pop(&queue, &value))
+        pottery_test_assert(value == popped++);
+    pottery_test_assert(popped == pushed);
+    pottery_test_assert(int_spsc_queue_is_empty(&queue));
+
+    int_spsc_queue_destroy(&queue);
+}
+
+POTTERY_TEST(pottery_spsc_queue_bulk) {
+    int_spsc_queue_t queue;
+    pottery_test_assert(POTTERY_OK == int_spsc_queue_init(&queue, 64));
+
+    int in[100];
+    int out[100];
+    int next_in = 0;
+    int next_out = 0;
+    int round;
+    for (round = 0; round < 200; ++round) {
+        int i;
+        size_t count = pottery_cast(size_t, round * 7 % 100);
+        for (i = 0; i < 100; ++i)
+            in[i] = next_in + i;
+
+        // Only as many values as fit are pushed.
+        size_t space = 64 - int_spsc_queue_count(&queue);
+        size_t pushed = int_spsc_queue_try_push_bulk(&queue, in, count);
+        pottery_test_assert(pushed == pottery_min_s(count, space));
+        next_in += pottery_cast(int, pushed);
+
+        count = pottery_cast(size_t, round * 13 % 50);
+        size_t available = int_spsc_queue_count(&queue);
+        size_t popped = int_spsc_queue_try_pop_bulk(&queue, out, count);
+        pottery_test_assert(popped == pottery_min_s(count, available));
+        for (i = 0; i < pottery_cast(int, popped); ++i)
+            pottery_test_assert(out[i] == next_out++);
+    }
+
+    int_spsc_queue_destroy(&queue);
+}
+
+POTTERY_TEST(pottery_spsc_queue_spans) {
+    int_spsc_queue_t queue;
+    pottery_test_assert(POTTERY_OK == int_spsc_queue_init(&queue, 16));
+
+    int next_in = 0;
+    int next_out = 0;
+    int round;
+    for (round = 0; round < 100; ++round) {
+        // Fill a contiguous span. It never crosses the end of the buffer.
+        int* entry;
+        size_t count = int_spsc_queue_try_emplace_bulk(&queue, 10, &entry);
+        pottery_test_assert(count <= 10);
+        pottery_test_assert(entry + count <= queue.values + 16);
+        size_t i;
+        for (i = 0; i < count; ++i)
+            entry[i] = next_in++;
+        int_spsc_queue_commit_bulk(&queue, count);
+
+        count = int_spsc_queue_try_peek_bulk(&queue, 7, &entry);
+        pottery_test_assert(entry + count <= queue.values + 16);
+        for (i = 0; i < count; ++i)
+            pottery_test_assert(entry[i] == next_out++);
+        int_spsc_queue_displace_bulk(&queue, count);
+    }
+
+    int_spsc_queue_destroy(&queue);
+}
+
+POTTERY_TEST(pottery_spsc_queue_ufo) {
+    ufo_spsc_queue_t queue;
+    pottery_test_assert(POTTERY_OK == ufo_spsc_queue_init(&queue, 4));
+
+    int32_t next_in = 0;
+    int32_t next_out = 0;
+    int round;
+    for (round = 0; round < 50; ++round) {
+        ufo_t* entry;
+        while (ufo_spsc_queue_try_emplace(&queue, &entry)) {
+            ufo_init(entry, "hello", next_in++);
+            ufo_spsc_queue_commit(&queue);
+        }
+
+        int i;
+        for (i = 0; i < 3; ++i) {
+            pottery_test_assert(ufo_spsc_queue_try_peek(&queue, &entry));
+            pottery_test_assert(entry->integer == next_out++);
+            ufo_spsc_queue_remove(&queue);
+        }
+    }
+
+    // The remaining values are destroyed with the queue.
+    pottery_test_assert(ufo_spsc_queue_count(&queue) == 1);
+    ufo_spsc_queue_destroy(&queue);
+}
+
+#if POTTERY_TEST_PTHREADS
+// A producer pushes a long numbered sequence through a small queue while a
+// consumer pops it. Both sides cycle between the single, bulk and span
+// functions. The consumer must see every number exactly once and in order.
+#define SPSC_QUEUE_THREADED_COUNT 200000
+#define SPSC_QUEUE_THREADED_CAPACITY 64
+
+static int_spsc_queue_t threaded_queue;
+
+static void* threaded_producer(void* arg) {
+    int in[40];
+    int next = 0;
+    size_t round = 0;
+    (void)arg;
+
+    while (next < SPSC_QUEUE_THREADED_COUNT) {
+        size_t count = pottery_min_s(round % 37 + 1,
+                pottery_cast(size_t, SPSC_QUEUE_THREADED_COUNT - next));
+        size_t pushed = 0;
+        size_t i;
+
+        switch (round++ % 3) {
+            case 0:
+                if (int_spsc_queue_try_push(&threaded_queue, next))
+                    pushed = 1;
+                break;
+            case 1:
+                for (i = 0; i < count; ++i)
+                    in[i] = next + pottery_cast(int, i);
+                pushed = int_spsc_queue_try_push_bulk(&threaded_queue, in, count);
+                break;
+            default: {
+                int* entry;
+                pushed = int_spsc_queue_try_emplace_bulk(&threaded_queue, count, &entry);
+                for (i = 0; i < pushed; ++i)
+                    entry[i] = next + pottery_cast(int, i);
+                int_spsc_queue_commit_bulk(&threaded_queue, pushed);
+                break;
+            }
+        }
+
+        next += pottery_cast(int, pushed);
+        if (pushed == 0)
+            sched_yield();
+    }
+    return pottery_null;
+}
+
+static void* threaded_consumer(void* arg) {
+    int out[40];
+    int next = 0;
+    size_t round = 0;
+    (void)arg;
+
+    while (next < SPSC_QUEUE_THREADED_COUNT) {
+        size_t count = round % 29 + 1;
+        size_t popped = 0;
+        size_t i;
+
+        switch (round++ % 3) {
+            case 0:
+                if (int_spsc_queue_try_pop(&threaded_queue, &out[0]))
+                    popped = 1;
+                break;
+            case 1:
+                popped = int_spsc_queue_try_pop_bulk(&threaded_queue, out, count);
+                break;
+            default: {
+                int* entry;
+                popped = int_spsc_queue_try_peek_bulk(&threaded_queue, count, &entry);
+                for (i = 0; i < popped; ++i)
+                    out[i] = entry[i];
+                int_spsc_queue_displace_bulk(&threaded_queue, popped);
+                break;
+            }
+        }
+
+        for (i = 0; i < popped; ++i)
+            pottery_test_assert(out[i] == next++);
+        if (popped == 0)
+            sched_yield();
+    }
+    return pottery_null;
+}
+
+POTTERY_TEST(pottery_spsc_queue_threaded) {
+    pthread_t producer;
+    pthread_t consumer;
+    pottery_test_assert(POTTERY_OK == int_spsc_queue_init(&threaded_queue,
+                SPSC_QUEUE_THREADED_CAPACITY));
+
+    pottery_test_assert(0 == pthread_create(&consumer, pottery_null, threaded_consumer, pottery_null));
+    pottery_test_assert(0 == pthread_create(&producer, pottery_null, threaded_producer, pottery_null));
+    pottery_test_assert(0 == pthread_join(producer, pottery_null));
+    pottery_test_assert(0 == pthread_join(consumer, pottery_null));
+
+    // The consumer stopped after the last number so nothing is left over.
+    pottery_test_assert(int_spsc_queue_is_empty(&threaded_queue));
+    int_spsc_queue_destroy(&threaded_queue);
+}
+#endif
+
+#endif
@@ -343,6 +343,12 @@ if compiler != "MSVC":
     elif checkFlags("-Wstrict-aliasing"):
         defaultCPPFlags.append("-Wstrict-aliasing")
 
+    # The concurrent containers are tested from several threads if pthreads
+    # are available.
+    if checkFlags("-pthread"):
+        defaultCPPFlags += ["-pthread", "-DPOTTERY_TEST_PTHREADS=1"]
+        defaultLDFlags.append("-pthread")
+
     extraFlags = [
         "-Wextra",
         "-Wpedantic",
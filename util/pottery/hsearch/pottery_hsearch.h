@@ -53,11 +53,8 @@ typedef struct {
 // want binary compatibility with existing implementations.) You would probably
 // also want to un-inline any inline functions here.
 
-static inline size_t pottery_hsearch_fnv1a(const char* p) {
-    uint32_t hash = 2166136261;
-    for (; *p != 0; ++p)
-        hash = (hash ^ pottery_cast(uint8_t, *p)) * 16777619;
-    return hash;
+static inline size_t pottery_hsearch_hash(const char* key) {
+    return pottery_cast(size_t, pottery_hash_string(key, 0));
 }
 
 #include "pottery_hsearch_ohm.t.h"
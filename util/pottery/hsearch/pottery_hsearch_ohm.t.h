@@ -26,7 +26,7 @@
 #define POTTERY_OPEN_HASH_MAP_VALUE_TYPE POTTERY_ENTRY
 #define POTTERY_OPEN_HASH_MAP_KEY_TYPE const char*
 #define POTTERY_OPEN_HASH_MAP_REF_KEY(x) x->key
-#define POTTERY_OPEN_HASH_MAP_KEY_HASH pottery_hsearch_fnv1a
+#define POTTERY_OPEN_HASH_MAP_KEY_HASH pottery_hsearch_hash
 #define POTTERY_OPEN_HASH_MAP_KEY_EQUAL 0 == strcmp
 #define POTTERY_OPEN_HASH_MAP_LIFECYCLE_MOVE_BY_VALUE 1
 
@@ -32,11 +32,8 @@
     #define pottery_string_set_strdup strdup
 #endif
 
-static inline size_t fnv1a(const char* p) {
-    uint32_t hash = 2166136261;
-    for (; *p != 0; ++p)
-        hash = (hash ^ pottery_cast(uint8_t, *p)) * 16777619;
-    return hash;
+static inline size_t string_set_hash(const char* str) {
+    return pottery_cast(size_t, pottery_hash_string(str, 0));
 }
 
 // We use an internal hash map that uses const char* as the key type so we can
@@ -46,7 +43,7 @@ static inline size_t fnv1a(const char* p) {
 #define POTTERY_OPEN_HASH_MAP_VALUE_TYPE char*
 #define POTTERY_OPEN_HASH_MAP_KEY_TYPE const char*
 #define POTTERY_OPEN_HASH_MAP_REF_KEY(x) *x
-#define POTTERY_OPEN_HASH_MAP_KEY_HASH fnv1a
+#define POTTERY_OPEN_HASH_MAP_KEY_HASH string_set_hash
 #define POTTERY_OPEN_HASH_MAP_KEY_EQUAL 0 == strcmp
 #define POTTERY_OPEN_HASH_MAP_LIFECYCLE_MOVE_BY_VALUE 1
 #define POTTERY_OPEN_HASH_MAP_LIFECYCLE_DESTROY(x) free(*x)